@@ -0,0 +1,82 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "cacheTraceListener.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::CACHETRACER;
+
+cacheTraceListener::cacheTraceListener(ComponentId_t id, Params& params) : CacheListener(id, params) {
+    unsigned int debug = params.find<unsigned int>("debug", 0);
+    out = new Output("cacheTraceListener[@f:@l:@p] ", debug, 0, Output::STDOUT);
+
+    std::string path = params.find<std::string>("traceFile", "");
+    if (path.empty())
+        out->fatal(CALL_INFO, -1, "%s, Param not specified: traceFile\n", getName().c_str());
+
+    std::string traceFormat = params.find<std::string>("traceFormat", "binary");
+    traceFile = nullptr;
+    binaryTrace = nullptr;
+    if ("binary" == traceFormat) {
+        bool compress = params.find<bool>("traceCompression", true);
+        size_t blockRecords = params.find<size_t>("traceBlockRecords", 16384);
+        size_t maxPending = params.find<size_t>("traceMaxPendingBlocks", 4);
+        binaryTrace = new TraceWriter(path, blockRecords, maxPending, compress, out);
+    } else if ("text" == traceFormat) {
+        traceFile = fopen(path.c_str(), "wt");
+        if (traceFile == nullptr)
+            out->fatal(CALL_INFO, -1, "%s, could not open trace file %s\n", getName().c_str(), path.c_str());
+    } else {
+        out->fatal(CALL_INFO, -1, "%s, traceFormat must be 'text' or 'binary', got '%s'\n", getName().c_str(), traceFormat.c_str());
+    }
+    out->debug(CALL_INFO, 1, 0, "Writing %s trace to file: %s\n", traceFormat.c_str(), path.c_str());
+}
+
+cacheTraceListener::~cacheTraceListener() {
+    delete binaryTrace;
+    delete out;
+}
+
+void cacheTraceListener::notifyAccess(const CacheListenerNotification& notify) {
+    TraceRecord rec;
+    rec.addr = notify.getPhysicalAddress();
+    rec.timestamp = getCurrentSimCycle();
+    rec.timeNs = getCurrentSimTimeNano();
+    rec.id = notify.getVirtualAddress();
+    rec.idSrc = 0;
+    rec.responseId = notify.getInstructionPointer();
+    rec.responseIdSrc = 0;
+    rec.size = notify.getSize();
+    rec.cmd = (uint16_t) notify.getAccessType();
+    rec.kind = TRACE_LISTENER;
+    rec.result = (uint8_t) notify.getResultType();
+
+    if (binaryTrace)
+        binaryTrace->record(rec);
+    else
+        printTraceRecord(traceFile, rec);
+}
+
+void cacheTraceListener::finish() {
+    if (binaryTrace)
+        binaryTrace->close();
+    if (traceFile) {
+        fclose(traceFile);
+        traceFile = nullptr;
+    }
+}
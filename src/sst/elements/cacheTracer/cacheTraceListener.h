@@ -0,0 +1,71 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CACHETRACER_CACHETRACELISTENER_H
+#define _CACHETRACER_CACHETRACELISTENER_H
+
+#include <sst/core/output.h>
+#include <sst/core/params.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include "traceFormat.h"
+#include "traceWriter.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+namespace SST {
+namespace CACHETRACER {
+
+/*
+ * Cache listener that traces every access reported by the cache it is
+ * attached to, in the same record format as the cacheTracer component.
+ */
+class cacheTraceListener : public SST::MemHierarchy::CacheListener {
+public:
+    cacheTraceListener(ComponentId_t id, Params& params);
+    ~cacheTraceListener();
+
+    void notifyAccess(const CacheListenerNotification& notify);
+    void finish();
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        cacheTraceListener,
+        "cacheTracer",
+        "cacheTraceListener",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Cache listener that writes a trace of cache accesses",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "traceFile", "File to write the trace to. Required", "" },
+        { "traceFormat", "Format of the trace file: 'text' or 'binary'. Decode binary traces with sst-cachetracer-decode", "binary" },
+        { "traceCompression", "Compress binary trace blocks with zlib (if SST was built with libz)", "1" },
+        { "traceBlockRecords", "Number of records per binary trace block", "16384" },
+        { "traceMaxPendingBlocks", "Number of full binary trace blocks that may wait to be written before the simulation stalls", "4" },
+        { "debug", "Print debug statements with increasing verbosity [0-10]", "0" }
+    )
+
+private:
+    Output* out;
+    FILE* traceFile;
+    TraceWriter* binaryTrace;
+};
+
+} // namespace CACHETRACER
+} // namespace SST
+
+#endif //_CACHETRACER_CACHETRACELISTENER_H
@@ -50,10 +50,25 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
     registerClock( frequency, new Clock::Handler<cacheTracer>(this, &cacheTracer::clock) );
     out->debug(CALL_INFO, 1, 0, "Clock registered\n");
 
+    string traceFormat = params.find<std::string>("traceFormat", "text");
+    if (traceFormat != "text" && traceFormat != "binary") {
+        out->fatal(CALL_INFO, -1, "cacheTracer: traceFormat must be 'text' or 'binary', got '%s'\n", traceFormat.c_str());
+    }
+
     string tracePrefix = params.find<std::string>("tracePrefix", "");
+    writeBinary = false;
+    binaryTrace = nullptr;
     if("" == tracePrefix){
         out->debug(CALL_INFO, 1, 0, "Tracing Not Enabled.\n");
         writeTrace = false;
+    } else if ("binary" == traceFormat) {
+        out->output("Writing binary trace to file: %s\n", tracePrefix.c_str());
+        bool compress = params.find<bool>("traceCompression", true);
+        size_t blockRecords = params.find<size_t>("traceBlockRecords", 16384);
+        size_t maxPending = params.find<size_t>("traceMaxPendingBlocks", 4);
+        binaryTrace = new TraceWriter(tracePrefix, blockRecords, maxPending, compress, out);
+        writeTrace = false;
+        writeBinary = true;
     } else {
         out->debug(CALL_INFO, 1, 0, "Tracing is Enabled, prefix is set to %s\n", tracePrefix.c_str());
         char* traceFilePath = (char*) malloc( sizeof(char) * (tracePrefix.size()+ 20) );
@@ -97,7 +112,9 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
 } // constructor
 
 // destructor
-cacheTracer::~cacheTracer() {}
+cacheTracer::~cacheTracer() {
+    delete binaryTrace;
+}
 
 void cacheTracer::init(unsigned int phase) {
     // Since cacheTracer can sit between memH components, it needs to forward init events
@@ -138,16 +155,7 @@ bool cacheTracer::clock(Cycle_t current){
         //InFlightReqQueue[me->getID()] = timestamp;
         InFlightReqQueue[me->getID()] = nanoseconds;
 
-        if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"NB: Addr: 0x%" PRIu64, addr);
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
-        }
+        recordEvent(me, TRACE_NORTHBUS, nanoseconds);
 
         // Send the request to south-bus
         southBus->send(me);
@@ -181,16 +189,7 @@ bool cacheTracer::clock(Cycle_t current){
            InFlightReqQueue.erase(me->getResponseToID());
         }
 
-        if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"SB: Addr: 0x%" PRIu64, me->getAddr());
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
-        }
+        recordEvent(me, TRACE_SOUTHBUS, nanoseconds);
 
        // Send the request to north-bus
         northBus->send(me);
@@ -199,6 +198,29 @@ bool cacheTracer::clock(Cycle_t current){
     return false;
 } //clock
 
+void cacheTracer::recordEvent(MemEvent* me, TraceRecordKind kind, uint64_t nanoseconds) {
+    if (!writeBinary && !(writeDebug_8 & writeTrace))
+        return;
+
+    TraceRecord rec;
+    rec.addr = me->getAddr();
+    rec.timestamp = timestamp;
+    rec.timeNs = nanoseconds;
+    rec.id = me->getID().first;
+    rec.idSrc = me->getID().second;
+    rec.responseId = me->getResponseToID().first;
+    rec.responseIdSrc = me->getResponseToID().second;
+    rec.size = me->getSize();
+    rec.cmd = (uint16_t) me->getCmd();
+    rec.kind = kind;
+    rec.result = 0;
+
+    if (writeBinary)
+        binaryTrace->record(rec);
+    else
+        printTraceRecord(traceFile, rec);
+}
+
 void cacheTracer::finish(){
     if(stats){
         if(writeStats){
@@ -211,6 +233,9 @@ void cacheTracer::finish(){
     if(writeTrace){
        fclose(traceFile);
     }
+    if(writeBinary){
+       binaryTrace->close();
+    }
 } // finish()
 
 
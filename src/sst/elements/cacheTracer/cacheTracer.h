@@ -31,7 +31,10 @@
 
 #include <iostream>
 #include <fstream>
-#include <map>
+#include <unordered_map>
+
+#include "traceFormat.h"
+#include "traceWriter.h"
 
 using namespace std;
 using namespace SST;
@@ -63,7 +66,11 @@ public:
     	{ "debug", "Print debug statements with increasing verbosity [0-10]", "0" },
     	{ "statistics", "0-No-stats, 1-print-stats", "0" },
     	{ "pageSize", "Page Size (bytes), used for selecting number of bins for address histogram ", "4096" },
-    	{"accessLatencyBins", "Number of bins for access latency histogram" "10" }
+    	{"accessLatencyBins", "Number of bins for access latency histogram" "10" },
+    	{ "traceFormat", "Format of the trace file: 'text' (written when debug >= 8) or 'binary' (always written). Decode binary traces with sst-cachetracer-decode", "text" },
+    	{ "traceCompression", "Compress binary trace blocks with zlib (if SST was built with libz)", "1" },
+    	{ "traceBlockRecords", "Number of records per binary trace block", "16384" },
+    	{ "traceMaxPendingBlocks", "Number of full binary trace blocks that may wait to be written before the simulation stalls", "4" }
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -93,6 +100,7 @@ private:
 
     // Flags
     bool writeTrace;
+    bool writeBinary;
     bool writeStats;
     bool writeDebug_8;
 
@@ -103,7 +111,15 @@ private:
     vector<SST::MemHierarchy::Addr>AddrHist;   // Address Histogram
     vector<unsigned int> AccessLatencyDist;
 
-    map<MemEvent::id_type,uint64_t>InFlightReqQueue;
+    struct IdHash {
+        size_t operator()(const MemEvent::id_type& id) const {
+            return std::hash<uint64_t>()(id.first ^ ((uint64_t)id.second << 48));
+        }
+    };
+    unordered_map<MemEvent::id_type,uint64_t,IdHash>InFlightReqQueue;
+
+    TraceWriter* binaryTrace;
+    void recordEvent(MemEvent* me, TraceRecordKind kind, uint64_t nanoseconds);
 
     TimeConverter* picoTimeConv;
     TimeConverter* nanoTimeConv;
@@ -2,6 +2,9 @@
 
 from sst_unittest import *
 from sst_unittest_support import *
+import shutil
+
+decoder = shutil.which("sst-cachetracer-decode")
 
 
 class testcase_cacheTracer_Component(SSTTestCase):
@@ -23,6 +26,11 @@ class testcase_cacheTracer_Component(SSTTestCase):
     def test_cacheTracer_2(self):
         self.cacheTracer_test_template_2()
 
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "CacheTracer: test_cacheTracer_3 skipped if ranks > 1")
+    @unittest.skipIf(decoder is None, "CacheTracer: test_cacheTracer_3 requires sst-cachetracer-decode in PATH")
+    def test_cacheTracer_3(self):
+        self.cacheTracer_test_template_3()
+
 #####
 
     def cacheTracer_test_template_1(self):
@@ -98,3 +106,53 @@ class testcase_cacheTracer_Component(SSTTestCase):
             log_failure(diffdata)
         self.assertTrue(cmp_result, "File {0} does not match Reference File {1} ignoring whitespace".format(out_memRefFile, reffile))
 
+###
+
+    # Binary traces. The tracer sees the same events as in test 2, so its
+    # decoded trace and its stats must match test 2's reference. The L1's
+    # binary listener trace must decode to its text listener trace.
+    def cacheTracer_test_template_3(self):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_cacheTracer_3"
+
+        sdlfile = "{0}/{1}.py".format(test_path, testDataFileName)
+        reffile = "{0}/refFiles/test_cacheTracer_2_memRef.out".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        out_memRefFile = "{0}/{1}_memRef.out".format(outdir, testDataFileName)
+        decodedTrace = "{0}/{1}_mem_ref_trace.txt".format(outdir, testDataFileName)
+        listenerText = "{0}/{1}_l1_trace.txt".format(outdir, testDataFileName)
+        listenerDecoded = "{0}/{1}_l1_trace.decoded.txt".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("cacheTracer3 test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        rtn = os.system("{0} {1}/{2}_mem_ref_trace.bin {3}".format(decoder, outdir, testDataFileName, decodedTrace))
+        self.assertEqual(rtn, 0, "sst-cachetracer-decode failed on the tracer's binary trace")
+        rtn = os.system("{0} {1}/{2}_l1_trace.bin {3}".format(decoder, outdir, testDataFileName, listenerDecoded))
+        self.assertEqual(rtn, 0, "sst-cachetracer-decode failed on the listener's binary trace")
+
+        cmd = "cat {0} {1} > {2}".format(decodedTrace,
+                                         "{0}/{1}_mem_ref_stats.txt".format(outdir, testDataFileName),
+                                         out_memRefFile)
+        os.system(cmd)
+
+        cmp_result = testing_compare_diff(testDataFileName, out_memRefFile, reffile, ignore_ws=True)
+        if (cmp_result == False):
+            diffdata = testing_get_diff_data(testDataFileName)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "File {0} does not match Reference File {1} ignoring whitespace".format(out_memRefFile, reffile))
+
+        self.assertTrue(os_test_file(listenerText, "-s"), "Listener trace {0} is empty".format(listenerText))
+        cmp_result = testing_compare_diff(testDataFileName, listenerDecoded, listenerText)
+        if (cmp_result == False):
+            diffdata = testing_get_diff_data(testDataFileName)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Decoded listener trace {0} does not match text listener trace {1}".format(listenerDecoded, listenerText))
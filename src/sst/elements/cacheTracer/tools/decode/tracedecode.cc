@@ -0,0 +1,113 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Decode a binary cacheTracer/cacheTraceListener trace into the text trace format
+
+#include "sst_config.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#include "../../traceFormat.h"
+
+using namespace SST::CACHETRACER;
+
+int
+main(int argc, char* argv[]) {
+
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: sst-cachetracer-decode <binary trace> [text output, default stdout]\n");
+        exit(1);
+    }
+
+    FILE* input = fopen(argv[1], "rb");
+    if (input == NULL) {
+        fprintf(stderr, "Error: could not open %s\n", argv[1]);
+        exit(1);
+    }
+
+    FILE* output = stdout;
+    if (argc == 3) {
+        output = fopen(argv[2], "wt");
+        if (output == NULL) {
+            fprintf(stderr, "Error: could not open %s\n", argv[2]);
+            exit(1);
+        }
+    }
+
+    TraceFileHeader header;
+    if (fread(&header, sizeof(header), 1, input) != 1 || memcmp(header.magic, CACHETRACER_MAGIC, sizeof(header.magic)) != 0) {
+        fprintf(stderr, "Error: %s is not a binary cache trace\n", argv[1]);
+        exit(1);
+    }
+    if (header.version != CACHETRACER_VERSION || header.recordSize != sizeof(TraceRecord)) {
+        fprintf(stderr, "Error: unsupported trace version %u (record size %u), expected version %u (record size %zu)\n",
+                header.version, header.recordSize, CACHETRACER_VERSION, sizeof(TraceRecord));
+        exit(1);
+    }
+
+    std::vector<TraceRecord> records;
+    std::vector<unsigned char> stored;
+    TraceBlockHeader block;
+    uint64_t numBlocks = 0;
+
+    while (fread(&block, sizeof(block), 1, input) == 1) {
+        if (block.rawBytes % sizeof(TraceRecord) != 0 || block.storedBytes > block.rawBytes) {
+            fprintf(stderr, "Error: corrupt block %" PRIu64 "\n", numBlocks);
+            exit(1);
+        }
+        records.resize(block.rawBytes / sizeof(TraceRecord));
+
+        if (block.storedBytes == block.rawBytes) {
+            if (fread(records.data(), 1, block.rawBytes, input) != block.rawBytes) {
+                fprintf(stderr, "Error: truncated block %" PRIu64 "\n", numBlocks);
+                exit(1);
+            }
+        } else {
+            stored.resize(block.storedBytes);
+            if (fread(stored.data(), 1, block.storedBytes, input) != block.storedBytes) {
+                fprintf(stderr, "Error: truncated block %" PRIu64 "\n", numBlocks);
+                exit(1);
+            }
+#ifdef HAVE_LIBZ
+            uLongf rawBytes = block.rawBytes;
+            if (uncompress(reinterpret_cast<Bytef*>(records.data()), &rawBytes, stored.data(), block.storedBytes) != Z_OK
+                    || rawBytes != block.rawBytes) {
+                fprintf(stderr, "Error: could not decompress block %" PRIu64 "\n", numBlocks);
+                exit(1);
+            }
+#else
+            fprintf(stderr, "Error: trace is compressed but this decoder was built without libz\n");
+            exit(1);
+#endif
+        }
+
+        for (const TraceRecord& rec : records)
+            printTraceRecord(output, rec);
+        numBlocks++;
+    }
+
+    fclose(input);
+    if (output != stdout)
+        fclose(output);
+
+    return 0;
+}
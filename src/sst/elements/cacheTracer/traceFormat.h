@@ -0,0 +1,107 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CACHETRACER_TRACEFORMAT_H
+#define _CACHETRACER_TRACEFORMAT_H
+
+/*
+ * Binary cache trace format, shared by the cacheTracer component, the
+ * cacheTraceListener subcomponent and the offline decoder.
+ *
+ * A file is a TraceFileHeader followed by blocks. Each block is a
+ * TraceBlockHeader followed by 'storedBytes' bytes. If storedBytes is less
+ * than rawBytes the block is zlib-compressed, otherwise it holds the
+ * TraceRecords as is. Records are written in host byte order.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+namespace SST {
+namespace CACHETRACER {
+
+#define CACHETRACER_MAGIC "SSTCTRCE"
+#define CACHETRACER_VERSION 1
+
+enum TraceCompression { TRACE_COMPRESSION_NONE = 0, TRACE_COMPRESSION_ZLIB = 1 };
+
+/* Where a record came from */
+enum TraceRecordKind {
+    TRACE_NORTHBUS = 0,     // cacheTracer, event travelling north to south
+    TRACE_SOUTHBUS = 1,     // cacheTracer, event travelling south to north
+    TRACE_LISTENER = 2      // cacheTraceListener, a cache access
+};
+
+struct TraceFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t compression;
+    uint32_t reserved;
+};
+
+struct TraceBlockHeader {
+    uint32_t rawBytes;
+    uint32_t storedBytes;
+};
+
+/* One traced event. For listener records, 'id' holds the virtual address,
+ * 'responseId' the instruction pointer, 'cmd' the access type and 'result'
+ * the hit/miss result of the access. */
+struct TraceRecord {
+    uint64_t addr;
+    uint64_t timestamp;     // component cycle (cacheTracer) or core cycle (listener)
+    uint64_t timeNs;
+    uint64_t id;
+    uint64_t responseId;
+    int32_t  idSrc;
+    int32_t  responseIdSrc;
+    uint32_t size;
+    uint16_t cmd;
+    uint8_t  kind;
+    uint8_t  result;
+};
+
+static_assert(sizeof(TraceRecord) == 56, "TraceRecord must stay fixed-width");
+
+inline void initTraceFileHeader(TraceFileHeader& header, uint32_t compression) {
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHETRACER_MAGIC, sizeof(header.magic));
+    header.version = CACHETRACER_VERSION;
+    header.recordSize = sizeof(TraceRecord);
+    header.compression = compression;
+}
+
+/* Print a record in the cacheTracer text trace format */
+inline void printTraceRecord(FILE* fp, const TraceRecord& rec) {
+    if (rec.kind == TRACE_LISTENER) {
+        static const char* types[] = { "READ", "WRITE", "EVICT", "PREFETCH" };
+        static const char* results[] = { "HIT", "MISS", "NA" };
+        fprintf(fp, "LS: Addr: 0x%" PRIu64 " timestamp: %" PRIu64 " Type: %s Result: %s Size: %u VAddr: 0x%" PRIx64 " IP: 0x%" PRIx64 " @%" PRIu64 " ns\n",
+                rec.addr, rec.timestamp, rec.cmd < 4 ? types[rec.cmd] : "UNKNOWN", rec.result < 3 ? results[rec.result] : "UNKNOWN",
+                rec.size, rec.id, rec.responseId, rec.timeNs);
+        return;
+    }
+    fprintf(fp, "%s: Addr: 0x%" PRIu64 " timestamp: %" PRIu64 " Cmd: %u ID: %" PRIu64 "-%d ResponseID: %" PRIu64 "-%d @%" PRIu64 " ns\n",
+            rec.kind == TRACE_NORTHBUS ? "NB" : "SB", rec.addr, rec.timestamp, (unsigned)rec.cmd,
+            rec.id, rec.idSrc, rec.responseId, rec.responseIdSrc, rec.timeNs);
+}
+
+} // namespace CACHETRACER
+} // namespace SST
+
+#endif //_CACHETRACER_TRACEFORMAT_H
@@ -0,0 +1,134 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "traceWriter.h"
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+using namespace SST;
+using namespace SST::CACHETRACER;
+
+TraceWriter::TraceWriter(const std::string& path, size_t blockRecords, size_t maxPending, bool compress, SST::Output* out) :
+    out_(out), compress_(compress), closed_(false), count_(0), maxPending_(maxPending), done_(false) {
+
+#ifndef HAVE_LIBZ
+    if (compress_) {
+        out_->verbose(CALL_INFO, 1, 0, "Trace compression requested but SST was built without libz, writing uncompressed blocks\n");
+        compress_ = false;
+    }
+#endif
+
+    file_ = fopen(path.c_str(), "wb");
+    if (file_ == nullptr)
+        out_->fatal(CALL_INFO, -1, "cacheTracer: could not open trace file %s\n", path.c_str());
+
+    TraceFileHeader header;
+    initTraceFileHeader(header, compress_ ? TRACE_COMPRESSION_ZLIB : TRACE_COMPRESSION_NONE);
+    fwrite(&header, sizeof(header), 1, file_);
+
+    if (blockRecords == 0) blockRecords = 1;
+    if (maxPending_ == 0) maxPending_ = 1;
+    block_.resize(blockRecords);
+
+    thread_ = std::thread(&TraceWriter::flushLoop, this);
+}
+
+TraceWriter::~TraceWriter() {
+    close();
+}
+
+void TraceWriter::close() {
+    if (closed_) return;
+    closed_ = true;
+
+    if (count_ != 0)
+        submit();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_ = true;
+    }
+    workCV_.notify_one();
+    thread_.join();
+
+    fclose(file_);
+}
+
+/* Hand the current block to the background thread and start a new one */
+void TraceWriter::submit() {
+    size_t blockRecords = block_.size();
+    std::unique_lock<std::mutex> lock(mutex_);
+    spaceCV_.wait(lock, [this] { return pending_.size() < maxPending_; });
+
+    Block full;
+    full.records.swap(block_);
+    full.count = count_;
+    pending_.push_back(std::move(full));
+
+    if (!freeBlocks_.empty()) {
+        block_.swap(freeBlocks_.back());
+        freeBlocks_.pop_back();
+    }
+    lock.unlock();
+    workCV_.notify_one();
+
+    block_.resize(blockRecords);
+    count_ = 0;
+}
+
+void TraceWriter::flushLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        workCV_.wait(lock, [this] { return done_ || !pending_.empty(); });
+        if (pending_.empty())
+            break; // done_ and drained
+
+        Block block = std::move(pending_.front());
+        pending_.pop_front();
+        lock.unlock();
+        spaceCV_.notify_one();
+
+        writeBlock(block);
+
+        lock.lock();
+        freeBlocks_.push_back(std::move(block.records));
+    }
+}
+
+void TraceWriter::writeBlock(const Block& block) {
+    TraceBlockHeader header;
+    header.rawBytes = block.count * sizeof(TraceRecord);
+    header.storedBytes = header.rawBytes;
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(block.records.data());
+
+#ifdef HAVE_LIBZ
+    if (compress_) {
+        uLongf compressedBytes = compressBound(header.rawBytes);
+        compressBuffer_.resize(compressedBytes);
+        if (compress2(compressBuffer_.data(), &compressedBytes, data, header.rawBytes, Z_BEST_SPEED) == Z_OK
+                && compressedBytes < header.rawBytes) {
+            header.storedBytes = compressedBytes;
+            data = compressBuffer_.data();
+        }
+    }
+#endif
+
+    fwrite(&header, sizeof(header), 1, file_);
+    fwrite(data, 1, header.storedBytes, file_);
+}
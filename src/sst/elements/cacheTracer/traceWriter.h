@@ -0,0 +1,92 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CACHETRACER_TRACEWRITER_H
+#define _CACHETRACER_TRACEWRITER_H
+
+#include <sst/core/output.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "traceFormat.h"
+
+namespace SST {
+namespace CACHETRACER {
+
+/*
+ * Writes binary trace records.
+ * Each writer belongs to one component, so its block is only touched by
+ * that component's simulation thread and record() needs no locking. Full
+ * blocks are handed to a background thread that compresses and writes
+ * them. At most 'maxPending' blocks wait for the background thread before
+ * the simulation thread blocks.
+ */
+class TraceWriter {
+public:
+    TraceWriter(const std::string& path, size_t blockRecords, size_t maxPending, bool compress, SST::Output* out);
+    ~TraceWriter();
+
+    void record(const TraceRecord& rec) {
+        if (count_ == block_.size())
+            submit();
+        block_[count_++] = rec;
+    }
+
+    /* Write out everything recorded and close the file */
+    void close();
+
+private:
+    struct Block {
+        std::vector<TraceRecord> records;
+        size_t count;
+    };
+
+    void submit();
+    void flushLoop();
+    void writeBlock(const Block& block);
+
+    SST::Output* out_;
+    FILE* file_;
+    bool compress_;
+    bool closed_;
+
+    // Owned by the simulation thread
+    std::vector<TraceRecord> block_;
+    size_t count_;
+
+    // Shared with the background thread
+    std::mutex mutex_;
+    std::condition_variable workCV_;
+    std::condition_variable spaceCV_;
+    std::deque<Block> pending_;
+    std::vector<std::vector<TraceRecord> > freeBlocks_;
+    size_t maxPending_;
+    bool done_;
+
+    // Owned by the background thread
+    std::vector<unsigned char> compressBuffer_;
+
+    std::thread thread_;
+};
+
+} // namespace CACHETRACER
+} // namespace SST
+
+#endif //_CACHETRACER_TRACEWRITER_H
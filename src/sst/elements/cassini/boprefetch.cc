@@ -0,0 +1,109 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "boprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+const int64_t BestOffsetPrefetcher::offsets[BestOffsetPrefetcher::numOffsets] = {
+    1, 2, 3, 4, 5, 6, 8, 9, 10, 12, 15, 16, 18, 20, 24, 25, 27, 30, 32, 36, 40, 45, 48, 50, 54, 60 };
+
+
+BestOffsetPrefetcher::BestOffsetPrefetcher(ComponentId_t id, Params& params) : ThrottledPrefetcher(id, params, "BestOffsetPrefetcher") {
+    scoreMax = params.find<uint32_t>("score_max", 31);
+    roundMax = params.find<uint32_t>("round_max", 100);
+    badScore = params.find<uint32_t>("bad_score", 1);
+
+    if (scoreMax == 0 || scoreMax > 255)
+        output->fatal(CALL_INFO, -1, "%s, Error: score_max must be between 1 and 255, got %" PRIu32 "\n", getName().c_str(), scoreMax);
+
+    for (uint32_t i = 0; i < rrEntries; i++)
+        recentRequests[i] = (Addr) -1;
+    for (uint32_t i = 0; i < numOffsets; i++)
+        scores[i] = 0;
+    testIndex = 0;
+    round = 0;
+
+    // Start with next-line prefetching until the first phase ends
+    bestOffset = 1;
+    prefetchOn = true;
+
+    statLearningPhases = registerStatistic<uint64_t>("learning_phases");
+    statBestOffset = registerStatistic<uint64_t>("best_offset");
+}
+
+BestOffsetPrefetcher::~BestOffsetPrefetcher() {}
+
+void BestOffsetPrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+
+    if ((notifyType != READ && notifyType != WRITE) || notify.getResultType() != MISS)
+        return;
+
+    train(notify.getPhysicalAddress());
+}
+
+void BestOffsetPrefetcher::prefetchUsed(Addr addr) {
+    train(addr);
+}
+
+void BestOffsetPrefetcher::train(Addr addr) {
+    Addr line = addr / blockSize;
+
+    // Test one candidate offset
+    Addr base = line - offsets[testIndex];
+    if (recentRequests[rrIndex(base)] == base && ++scores[testIndex] >= scoreMax) {
+        endPhase();
+    } else if (++testIndex == numOffsets) {
+        testIndex = 0;
+        if (++round >= roundMax)
+            endPhase();
+    }
+
+    recentRequests[rrIndex(line)] = line;
+
+    if (!prefetchOn)
+        return;
+
+    uint32_t degree = getDegree();
+    for (uint32_t k = 1; k <= degree; k++) {
+        issuePrefetch(addr, (line + k * bestOffset) * blockSize);
+    }
+}
+
+void BestOffsetPrefetcher::endPhase() {
+    uint32_t best = 0;
+    for (uint32_t i = 1; i < numOffsets; i++) {
+        if (scores[i] > scores[best])
+            best = i;
+    }
+
+    prefetchOn = scores[best] > badScore;
+    bestOffset = offsets[best];
+
+    output->verbose(CALL_INFO, 1, 0, "Learning phase done: best offset %" PRId64 ", score %u, prefetch %s\n",
+            bestOffset, (unsigned) scores[best], prefetchOn ? "on" : "off");
+    statLearningPhases->addData(1);
+    statBestOffset->addData(prefetchOn ? bestOffset : 0);
+
+    for (uint32_t i = 0; i < numOffsets; i++)
+        scores[i] = 0;
+    testIndex = 0;
+    round = 0;
+}
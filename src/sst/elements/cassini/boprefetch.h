@@ -0,0 +1,102 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_BEST_OFFSET_PREFETCH
+#define _H_SST_BEST_OFFSET_PREFETCH
+
+#include "throttledprefetch.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Best-Offset prefetcher (Michaud, HPCA 2016)
+ *
+ * Learns the line offset D for which an access to line X most often
+ * follows a recent access to line X - D, by testing one candidate offset
+ * per access against a table of recent accesses. A learning phase ends
+ * after 'round_max' rounds over the candidates or when a candidate reaches
+ * 'score_max'. The best offset is then used until the next phase ends;
+ * if its score is at most 'bad_score', prefetching is off.
+ *
+ * Misses and hits on prefetched lines (reported by the cache) train and
+ * trigger prefetches of X + D, X + 2D, ... up to the current degree.
+ * Recent accesses are recorded when they train, not when their prefetch
+ * fills, so timeliness is learned through the late-prefetch feedback
+ * instead of the recent request table.
+ */
+class BestOffsetPrefetcher : public ThrottledPrefetcher {
+public:
+    BestOffsetPrefetcher(ComponentId_t id, Params& params);
+    ~BestOffsetPrefetcher();
+
+    void notifyAccess(const CacheListenerNotification& notify);
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        BestOffsetPrefetcher,
+        "cassini",
+        "BestOffsetPrefetcher",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Best-Offset Prefetcher [Michaud 2016] with feedback throttling",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_THROTTLED_PREFETCHER_ELI_PARAMS,
+        { "score_max", "Score at which a candidate offset ends the learning phase", "31" },
+        { "round_max", "Maximum rounds over all candidate offsets per learning phase", "100" },
+        { "bad_score", "Best score at or below which prefetching is turned off until the next phase", "1" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_THROTTLED_PREFETCHER_ELI_STATS,
+        { "learning_phases", "Number of completed learning phases", "phases", 2 },
+        { "best_offset", "Offset selected at the end of each learning phase, 0 if prefetching was turned off", "lines", 2 }
+    )
+
+protected:
+    void prefetchUsed(Addr addr);
+
+private:
+    static const uint32_t numOffsets = 26;
+    static const uint32_t rrEntries = 256;
+
+    /* Candidate offsets in lines: products of powers of 2, 3 and 5 below 64 */
+    static const int64_t offsets[numOffsets];
+
+    void train(Addr addr);
+    void endPhase();
+    uint32_t rrIndex(Addr line) const { return (line ^ (line >> 8)) % rrEntries; }
+
+    Addr recentRequests[rrEntries];
+    uint8_t scores[numOffsets];
+    uint32_t testIndex;
+    uint32_t round;
+    uint32_t scoreMax;
+    uint32_t roundMax;
+    uint32_t badScore;
+
+    int64_t bestOffset;
+    bool prefetchOn;
+
+    Statistic<uint64_t>* statLearningPhases;
+    Statistic<uint64_t>* statBestOffset;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -0,0 +1,226 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "impprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+/* Candidate element sizes of the indirectly accessed array: 1, 4, 8 and 16 bytes */
+const uint32_t IndirectMemoryPrefetcher::shifts[IndirectMemoryPrefetcher::numShifts] = { 0, 2, 3, 4 };
+
+
+IndirectMemoryPrefetcher::IndirectMemoryPrefetcher(ComponentId_t id, Params& params) : ThrottledPrefetcher(id, params, "IndirectMemoryPrefetcher") {
+    uint32_t ptEntries = params.find<uint32_t>("pt_entries", 16);
+    ipdMisses = params.find<uint32_t>("ipd_misses", 4);
+    streamConfThreshold = params.find<uint32_t>("stream_confidence", 2);
+    indirectConfThreshold = params.find<uint32_t>("indirect_confidence", 2);
+
+    if (ptEntries == 0 || ipdMisses == 0)
+        output->fatal(CALL_INFO, -1, "%s, Error: pt_entries and ipd_misses must be at least 1\n", getName().c_str());
+
+    streamTable.resize(ptEntries);
+    for (uint32_t i = 0; i < ptEntries; i++) {
+        reset(streamTable[i], 0);
+        streamTable[i].valid = false;
+    }
+    missTable.resize(ptEntries * 2 * ipdMisses, 0);
+
+    learningEntry = -1;
+    accessCount = 0;
+
+    statPatternsDetected = registerStatistic<uint64_t>("patterns_detected");
+    statIndirectPrefetches = registerStatistic<uint64_t>("indirect_prefetches");
+    statIndexPrefetches = registerStatistic<uint64_t>("index_prefetches");
+}
+
+IndirectMemoryPrefetcher::~IndirectMemoryPrefetcher() {}
+
+void IndirectMemoryPrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+
+    if (notifyType != READ && notifyType != WRITE)
+        return;
+
+    accessCount++;
+
+    Addr addr = notify.getTargetAddress();
+    uint32_t size = notify.getSize();
+
+    // Candidate index load: a read with an instruction pointer and an integer size
+    if (notifyType == READ && notify.getInstructionPointer() != 0 && (size == 1 || size == 2 || size == 4 || size == 8)) {
+        StreamEntry* entry = findEntry(notify.getInstructionPointer());
+        uint32_t entryIndex = entry - &streamTable[0];
+
+        int64_t stride = (int64_t) (addr - entry->lastAddr);
+        if (stride == (int64_t) size && stride == entry->stride) {
+            if (entry->streamConf < streamConfThreshold)
+                entry->streamConf++;
+        } else {
+            Addr ip = entry->ip;
+            reset(*entry, ip);
+            entry->stride = stride;
+            if (learningEntry == (int32_t) entryIndex)
+                learningEntry = -1;
+        }
+        entry->lastAddr = addr;
+
+        if (entry->streamConf >= streamConfThreshold) {
+            uint64_t value;
+            const std::vector<uint8_t>* data = notify.getData();
+            if (data && readIndex(*data, addr - notify.getPhysicalAddress(), size, value)) {
+                if (entry->enabled)
+                    prefetchIndirect(*entry, notify);
+                else
+                    recordIndex(*entry, entryIndex, value);
+            }
+            return;
+        }
+    }
+
+    // Pair misses with the latest index value of the stream being learned
+    if (notify.getResultType() == MISS && learningEntry >= 0) {
+        StreamEntry& entry = streamTable[learningEntry];
+        uint32_t which = entry.numIndices - 1;
+        if (entry.numMisses[which] < ipdMisses) {
+            missSlot(learningEntry, which, entry.numMisses[which]) = addr;
+            entry.numMisses[which]++;
+        }
+    }
+}
+
+IndirectMemoryPrefetcher::StreamEntry* IndirectMemoryPrefetcher::findEntry(Addr ip) {
+    uint32_t victim = 0;
+    for (uint32_t i = 0; i < streamTable.size(); i++) {
+        if (streamTable[i].valid && streamTable[i].ip == ip) {
+            streamTable[i].lastUse = accessCount;
+            return &streamTable[i];
+        }
+        if (!streamTable[victim].valid)
+            continue;
+        if (!streamTable[i].valid || streamTable[i].lastUse < streamTable[victim].lastUse)
+            victim = i;
+    }
+
+    if (learningEntry == (int32_t) victim)
+        learningEntry = -1;
+    reset(streamTable[victim], ip);
+    streamTable[victim].lastAddr = 0;
+    return &streamTable[victim];
+}
+
+void IndirectMemoryPrefetcher::reset(StreamEntry& entry, Addr ip) {
+    entry.valid = true;
+    entry.ip = ip;
+    entry.stride = 0;
+    entry.streamConf = 0;
+    entry.lastUse = accessCount;
+    entry.enabled = false;
+    entry.base = 0;
+    entry.shift = 0;
+    entry.indirectConf = 0;
+    entry.numIndices = 0;
+    entry.numMisses[0] = 0;
+    entry.numMisses[1] = 0;
+}
+
+/* Read a little-endian index value from the line data, if it lies within the line */
+bool IndirectMemoryPrefetcher::readIndex(const std::vector<uint8_t>& data, int64_t offset, uint32_t size, uint64_t& value) const {
+    if (offset < 0 || offset + size > data.size())
+        return false;
+
+    value = 0;
+    for (uint32_t i = 0; i < size; i++)
+        value |= ((uint64_t) data[offset + i]) << (8 * i);
+    return true;
+}
+
+void IndirectMemoryPrefetcher::recordIndex(StreamEntry& entry, uint32_t entryIndex, uint64_t value) {
+    if (entry.numIndices == 2) {
+        // Misses after both index values are in, try to solve for a base address
+        detectPattern(entry, entryIndex);
+        if (entry.enabled) {
+            learningEntry = -1;
+            return;
+        }
+
+        entry.index[0] = entry.index[1];
+        entry.numMisses[0] = entry.numMisses[1];
+        for (uint32_t i = 0; i < entry.numMisses[1]; i++)
+            missSlot(entryIndex, 0, i) = missSlot(entryIndex, 1, i);
+        entry.numIndices = 1;
+    }
+
+    entry.index[entry.numIndices] = value;
+    entry.numMisses[entry.numIndices] = 0;
+    entry.numIndices++;
+    learningEntry = entryIndex;
+}
+
+void IndirectMemoryPrefetcher::detectPattern(StreamEntry& entry, uint32_t entryIndex) {
+    if (entry.index[0] == entry.index[1])
+        return;
+
+    for (uint32_t s = 0; s < numShifts; s++) {
+        for (uint32_t i = 0; i < entry.numMisses[0]; i++) {
+            Addr base = missSlot(entryIndex, 0, i) - (entry.index[0] << shifts[s]);
+            for (uint32_t j = 0; j < entry.numMisses[1]; j++) {
+                if (missSlot(entryIndex, 1, j) - (entry.index[1] << shifts[s]) != base)
+                    continue;
+
+                if (entry.indirectConf != 0 && entry.base == base && entry.shift == shifts[s]) {
+                    entry.indirectConf++;
+                } else {
+                    entry.base = base;
+                    entry.shift = shifts[s];
+                    entry.indirectConf = 1;
+                }
+
+                if (entry.indirectConf >= indirectConfThreshold) {
+                    entry.enabled = true;
+                    output->verbose(CALL_INFO, 1, 0, "Indirect pattern for ip 0x%" PRIx64 ": base 0x%" PRIx64 ", shift %" PRIu32 "\n",
+                            entry.ip, entry.base, entry.shift);
+                    statPatternsDetected->addData(1);
+                }
+                return;
+            }
+        }
+    }
+}
+
+void IndirectMemoryPrefetcher::prefetchIndirect(const StreamEntry& entry, const CacheListenerNotification& notify) {
+    const std::vector<uint8_t>& data = *notify.getData();
+    Addr addr = notify.getTargetAddress();
+    int64_t offset = addr - notify.getPhysicalAddress();
+    uint32_t degree = getDegree();
+
+    for (uint32_t k = 1; k <= degree; k++) {
+        uint64_t value;
+        if (!readIndex(data, offset + k * entry.stride, notify.getSize(), value)) {
+            // Next index values are in the following line of the index array
+            issuePrefetch(addr, addr + k * entry.stride);
+            statIndexPrefetches->addData(1);
+            break;
+        }
+
+        // Indirect targets are unrelated to the trigger page, so check them against themselves
+        Addr target = entry.base + (value << entry.shift);
+        issuePrefetch(target, target);
+        statIndirectPrefetches->addData(1);
+    }
+}
@@ -0,0 +1,125 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_INDIRECT_MEMORY_PREFETCH
+#define _H_SST_INDIRECT_MEMORY_PREFETCH
+
+#include "throttledprefetch.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Indirect Memory Prefetcher (Yu et al., MICRO 2015)
+ *
+ * Detects A[B[i]] access patterns. A prefetch table, indexed by
+ * instruction pointer, finds loads that stream through an index array B.
+ * For each such stream, the index values read are paired with the misses
+ * that follow them; a pattern is confirmed once two consecutive index
+ * values yield the same base address for one of the candidate element
+ * shifts, i.e., miss = base + (B[i] << shift) for both.
+ *
+ * Once confirmed, each index load prefetches base + (B[i+k] << shift) for
+ * k = 1..degree, plus the next lines of B.
+ *
+ * Index values are taken from the line data the cache attaches to read hit
+ * notifications (L1 caches only). Index loads that miss train the stream
+ * but cannot provide a value.
+ */
+class IndirectMemoryPrefetcher : public ThrottledPrefetcher {
+public:
+    IndirectMemoryPrefetcher(ComponentId_t id, Params& params);
+    ~IndirectMemoryPrefetcher();
+
+    void notifyAccess(const CacheListenerNotification& notify);
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        IndirectMemoryPrefetcher,
+        "cassini",
+        "IndirectMemoryPrefetcher",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Indirect Memory Prefetcher [Yu 2015] with feedback throttling",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_THROTTLED_PREFETCHER_ELI_PARAMS,
+        { "pt_entries", "Number of index streams tracked, by instruction pointer", "16" },
+        { "ipd_misses", "Number of misses recorded after each index value while detecting a pattern", "4" },
+        { "stream_confidence", "Number of repeated strides before a load is considered an index stream", "2" },
+        { "indirect_confidence", "Number of matching base addresses before indirect prefetching is enabled", "2" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_THROTTLED_PREFETCHER_ELI_STATS,
+        { "patterns_detected", "Number of indirect patterns confirmed", "patterns", 1 },
+        { "indirect_prefetches", "Number of prefetch candidates generated from index values", "prefetches", 2 },
+        { "index_prefetches", "Number of prefetch candidates generated for the index array", "prefetches", 2 }
+    )
+
+private:
+    static const uint32_t numShifts = 4;
+    static const uint32_t shifts[numShifts];
+
+    struct StreamEntry {
+        bool valid;
+        Addr ip;
+        Addr lastAddr;
+        int64_t stride;
+        uint32_t streamConf;
+        uint64_t lastUse;
+
+        /* Confirmed pattern */
+        bool enabled;
+        Addr base;
+        uint32_t shift;
+        uint32_t indirectConf;
+
+        /* Pattern detection: two consecutive index values and the misses after each */
+        uint32_t numIndices;
+        uint64_t index[2];
+        uint32_t numMisses[2];
+    };
+
+    StreamEntry* findEntry(Addr ip);
+    void reset(StreamEntry& entry, Addr ip);
+    bool readIndex(const std::vector<uint8_t>& data, int64_t offset, uint32_t size, uint64_t& value) const;
+    void recordIndex(StreamEntry& entry, uint32_t entryIndex, uint64_t value);
+    void detectPattern(StreamEntry& entry, uint32_t entryIndex);
+    void prefetchIndirect(const StreamEntry& entry, const CacheListenerNotification& notify);
+    Addr& missSlot(uint32_t entryIndex, uint32_t which, uint32_t i) {
+        return missTable[(entryIndex * 2 + which) * ipdMisses + i];
+    }
+
+    std::vector<StreamEntry> streamTable;
+    std::vector<Addr> missTable;    // pt_entries x 2 x ipd_misses miss addresses
+    uint32_t ipdMisses;
+    uint32_t streamConfThreshold;
+    uint32_t indirectConfThreshold;
+
+    /* Stream entry whose latest index value is collecting misses, or -1 */
+    int32_t learningEntry;
+    uint64_t accessCount;
+
+    Statistic<uint64_t>* statPatternsDetected;
+    Statistic<uint64_t>* statIndirectPrefetches;
+    Statistic<uint64_t>* statIndexPrefetches;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -0,0 +1,153 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sppprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+
+SignaturePathPrefetcher::SignaturePathPrefetcher(ComponentId_t id, Params& params) : ThrottledPrefetcher(id, params, "SignaturePathPrefetcher") {
+    uint32_t stEntries = params.find<uint32_t>("st_entries", 256);
+    uint32_t ptEntries = params.find<uint32_t>("pt_entries", 512);
+    threshold = params.find<double>("prefetch_threshold", 0.25);
+
+    if (stEntries == 0 || ptEntries == 0)
+        output->fatal(CALL_INFO, -1, "%s, Error: st_entries and pt_entries must be at least 1\n", getName().c_str());
+    if (pageSize < blockSize || pageSize % blockSize != 0)
+        output->fatal(CALL_INFO, -1, "%s, Error: page_size (%" PRIu64 ") must be a multiple of cache_line_size (%" PRIu64 ")\n",
+                getName().c_str(), pageSize, blockSize);
+
+    linesPerPage = pageSize / blockSize;
+
+    SignatureEntry emptySig = { (Addr) -1, 0, 0 };
+    signatureTable.resize(stEntries, emptySig);
+
+    PatternEntry emptyPattern;
+    emptyPattern.sigCount = 0;
+    for (uint32_t i = 0; i < deltaSlots; i++) {
+        emptyPattern.deltaCount[i] = 0;
+        emptyPattern.delta[i] = 0;
+    }
+    patternTable.resize(ptEntries, emptyPattern);
+
+    statLookaheadDepth = registerStatistic<uint64_t>("lookahead_depth");
+}
+
+SignaturePathPrefetcher::~SignaturePathPrefetcher() {}
+
+void SignaturePathPrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+
+    if (notifyType != READ && notifyType != WRITE)
+        return;
+
+    Addr line = notify.getPhysicalAddress() / blockSize;
+    Addr page = line / linesPerPage;
+    uint32_t offset = line % linesPerPage;
+
+    SignatureEntry& entry = signatureTable[page % signatureTable.size()];
+
+    if (entry.page != page) {
+        entry.page = page;
+        entry.lastOffset = offset;
+        entry.signature = 0;
+        return;
+    }
+
+    int32_t delta = (int32_t) offset - (int32_t) entry.lastOffset;
+    if (delta == 0)
+        return;
+
+    updatePattern(entry.signature, delta);
+    entry.signature = nextSignature(entry.signature, delta);
+    entry.lastOffset = offset;
+
+    lookahead(notify.getPhysicalAddress(), page, offset, entry.signature);
+}
+
+/* Deltas are folded into the signature in sign-magnitude form */
+uint32_t SignaturePathPrefetcher::nextSignature(uint32_t signature, int32_t delta) const {
+    uint32_t encoded = delta < 0 ? (((uint32_t) -delta) | 0x40) : (uint32_t) delta;
+    return ((signature << 3) ^ encoded) & ((1u << signatureBits) - 1);
+}
+
+void SignaturePathPrefetcher::updatePattern(uint32_t signature, int32_t delta) {
+    PatternEntry& entry = patternTable[signature % patternTable.size()];
+
+    // Find the delta, or replace the least confident one
+    uint32_t slot = 0;
+    bool found = false;
+    for (uint32_t i = 0; i < deltaSlots; i++) {
+        if (entry.deltaCount[i] != 0 && entry.delta[i] == delta) {
+            slot = i;
+            found = true;
+            break;
+        }
+        if (entry.deltaCount[i] < entry.deltaCount[slot])
+            slot = i;
+    }
+    if (!found) {
+        entry.delta[slot] = delta;
+        entry.deltaCount[slot] = 0;
+    }
+
+    // Halve all counters on saturation so they keep tracking recent behavior
+    if (entry.sigCount == counterMax || entry.deltaCount[slot] == counterMax) {
+        entry.sigCount >>= 1;
+        for (uint32_t i = 0; i < deltaSlots; i++)
+            entry.deltaCount[i] >>= 1;
+    }
+    entry.sigCount++;
+    entry.deltaCount[slot]++;
+}
+
+void SignaturePathPrefetcher::lookahead(Addr triggerAddr, Addr page, uint32_t offset, uint32_t signature) {
+    uint32_t degree = getDegree();
+    double confidence = 1.0;
+    int64_t current = offset;
+    uint32_t depth = 0;
+
+    while (depth < degree) {
+        const PatternEntry& entry = patternTable[signature % patternTable.size()];
+        if (entry.sigCount == 0)
+            break;
+
+        uint32_t best = 0;
+        for (uint32_t i = 1; i < deltaSlots; i++) {
+            if (entry.deltaCount[i] > entry.deltaCount[best])
+                best = i;
+        }
+        if (entry.deltaCount[best] == 0)
+            break;
+
+        confidence *= (double) entry.deltaCount[best] / entry.sigCount;
+        if (confidence < threshold)
+            break;
+
+        current += entry.delta[best];
+        if (current < 0 || current >= (int64_t) linesPerPage)
+            break;
+
+        issuePrefetch(triggerAddr, (page * linesPerPage + current) * blockSize);
+        signature = nextSignature(signature, entry.delta[best]);
+        depth++;
+    }
+
+    statLookaheadDepth->addData(depth);
+}
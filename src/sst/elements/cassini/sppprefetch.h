@@ -0,0 +1,99 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_SIGNATURE_PATH_PREFETCH
+#define _H_SST_SIGNATURE_PATH_PREFETCH
+
+#include "throttledprefetch.h"
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Signature Path Prefetcher (Kim et al., MICRO 2016)
+ *
+ * A signature table tracks, per page, the last line offset accessed and a
+ * compressed history (signature) of the line deltas seen in that page.
+ * A pattern table indexed by signature counts which deltas followed it.
+ * On each access, the prefetcher walks the most likely delta path ahead
+ * of the access, multiplying the per-step confidences, and stops when the
+ * path confidence drops below 'prefetch_threshold', the path leaves the
+ * page, or the current degree is reached.
+ *
+ * Both tables are fixed-size and allocated at construction.
+ */
+class SignaturePathPrefetcher : public ThrottledPrefetcher {
+public:
+    SignaturePathPrefetcher(ComponentId_t id, Params& params);
+    ~SignaturePathPrefetcher();
+
+    void notifyAccess(const CacheListenerNotification& notify);
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        SignaturePathPrefetcher,
+        "cassini",
+        "SignaturePathPrefetcher",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Signature Path Prefetcher [Kim 2016] with feedback throttling",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        CASSINI_THROTTLED_PREFETCHER_ELI_PARAMS,
+        { "st_entries", "Number of entries in the signature table (pages tracked)", "256" },
+        { "pt_entries", "Number of entries in the pattern table", "512" },
+        { "prefetch_threshold", "Path confidence below which lookahead stops", "0.25" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        CASSINI_THROTTLED_PREFETCHER_ELI_STATS,
+        { "lookahead_depth", "Number of lookahead steps taken per trigger", "steps", 2 }
+    )
+
+private:
+    static const uint32_t deltaSlots = 4;
+    static const uint8_t counterMax = 15;
+    static const uint32_t signatureBits = 12;
+
+    struct SignatureEntry {
+        Addr page;
+        uint32_t lastOffset;
+        uint32_t signature;
+    };
+
+    struct PatternEntry {
+        uint8_t sigCount;
+        uint8_t deltaCount[deltaSlots];
+        int32_t delta[deltaSlots];
+    };
+
+    uint32_t nextSignature(uint32_t signature, int32_t delta) const;
+    void updatePattern(uint32_t signature, int32_t delta);
+    void lookahead(Addr triggerAddr, Addr page, uint32_t offset, uint32_t signature);
+
+    std::vector<SignatureEntry> signatureTable;
+    std::vector<PatternEntry> patternTable;
+
+    uint64_t linesPerPage;
+    double threshold;
+
+    Statistic<uint64_t>* statLookaheadDepth;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -0,0 +1,287 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "streamProfiler.h"
+
+#include <stdint.h>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "sst/core/params.h"
+#include <sst/core/unitAlgebra.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::Cassini;
+
+/* SHARDS hash modulus */
+static const uint64_t shardsModulus = 1ULL << 24;
+static const uint64_t initialPositions = 1ULL << 16;
+
+static inline uint64_t hashLine(Addr line) {
+    // splitmix64 finalizer
+    uint64_t x = line + 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    x = x ^ (x >> 31);
+    return x & (shardsModulus - 1);
+}
+
+StreamProfiler::StreamProfiler(ComponentId_t id, Params& params) : CacheListener(id, params) {
+    Output out("", 1, 0, Output::STDOUT);
+
+    std::string cutoff_s = params.find<std::string>("addr_cutoff", "16GiB");
+    UnitAlgebra cutoff_u(cutoff_s);
+    cutoff = cutoff_u.getRoundedValue();
+
+    captureVirtual = params.find<bool>("virtual_addr", 0);
+    includePrefetches = params.find<bool>("include_prefetches", 0);
+
+    lineSize = params.find<Addr>("line_size", 64);
+    if (lineSize == 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: line_size must be greater than 0\n", getName().c_str());
+
+    topK = params.find<size_t>("top_k", 16);
+    hotCapacity = std::max(topK, params.find<size_t>("hot_capacity", 64));
+    hotHeap.reserve(hotCapacity);
+    hotIndex.reserve(hotCapacity);
+
+    double rate = params.find<double>("reuse_sample_rate", 0.01);
+    if (rate <= 0.0 || rate > 1.0)
+        out.fatal(CALL_INFO, -1, "%s, Error: reuse_sample_rate must be in (0, 1], got %f\n", getName().c_str(), rate);
+    threshold = std::max((uint64_t)1, (uint64_t)std::llround(rate * shardsModulus));
+    maxSampledLines = params.find<uint64_t>("reuse_max_lines", 0);
+
+    position = 0;
+    fenwick.assign(initialPositions + 1, 0);
+    weightCarry = 0.0;
+    mrcAccesses = 0.0;
+
+    std::vector<std::string> sizes;
+    params.find_array<std::string>("mrc_sizes", sizes);
+    for (std::vector<std::string>::iterator it = sizes.begin(); it != sizes.end(); it++) {
+        UnitAlgebra size_u(*it);
+        uint64_t bytes = size_u.getRoundedValue();
+        mrcLines.push_back((bytes + lineSize - 1) / lineSize);
+        missRatio.push_back(registerStatistic<double>("miss_ratio", std::to_string(bytes)));
+    }
+    mrcMisses.assign(mrcLines.size(), 0.0);
+
+    accesses = registerStatistic<uint64_t>("accesses");
+    reuseDistance = registerStatistic<uint64_t>("reuse_distance");
+    coldAccesses = registerStatistic<uint64_t>("cold_accesses");
+    sampledLines = registerStatistic<uint64_t>("sampled_lines");
+    for (size_t i = 0; i < topK; i++) {
+        hotLineAddr.push_back(registerStatistic<uint64_t>("hot_line_addr", std::to_string(i)));
+        hotLineCount.push_back(registerStatistic<uint64_t>("hot_line_count", std::to_string(i)));
+        hotLineError.push_back(registerStatistic<uint64_t>("hot_line_error", std::to_string(i)));
+    }
+
+    std::string interval = params.find<std::string>("emit_interval", "0");
+    UnitAlgebra interval_u(interval);
+    if (interval_u.getRoundedValue() != 0)
+        registerClock(interval, new Clock::Handler<StreamProfiler>(this, &StreamProfiler::emit));
+}
+
+void StreamProfiler::notifyAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+
+    if (notifyType == EVICT || (notifyType == PREFETCH && !includePrefetches)) return;
+
+    Addr addr = captureVirtual ? notify.getVirtualAddress() : notify.getPhysicalAddress();
+    if (addr >= cutoff) return;
+
+    Addr line = addr / lineSize;
+    accesses->addData(1);
+    updateHot(line);
+    updateReuse(line);
+}
+
+void StreamProfiler::registerResponseCallback(Event::HandlerBase *handler) {
+    registeredCallbacks.push_back(handler);
+}
+
+void StreamProfiler::finish() {
+    emit(0);
+}
+
+/* Copy the current estimates into the statistics */
+bool StreamProfiler::emit(Cycle_t cycle) {
+    std::vector<HotCounter> ranked(hotHeap);
+    size_t count = std::min(topK, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(),
+            [](const HotCounter& a, const HotCounter& b) { return a.count > b.count; });
+    for (size_t i = 0; i < count; i++) {
+        hotLineAddr[i]->addData(ranked[i].line * lineSize);
+        hotLineCount[i]->addData(ranked[i].count);
+        hotLineError[i]->addData(ranked[i].error);
+    }
+
+    if (mrcAccesses > 0.0) {
+        for (size_t i = 0; i < mrcLines.size(); i++)
+            missRatio[i]->addData(mrcMisses[i] / mrcAccesses);
+    }
+    sampledLines->addData(lastPosition.size());
+    return false;
+}
+
+/******************** Space-saving hot lines ********************/
+
+void StreamProfiler::updateHot(Addr line) {
+    std::unordered_map<Addr, size_t>::iterator it = hotIndex.find(line);
+    if (it != hotIndex.end()) {
+        hotHeap[it->second].count++;
+        hotSiftDown(it->second);
+        return;
+    }
+
+    if (hotHeap.size() < hotCapacity) {
+        hotHeap.push_back({line, 1, 0});
+        hotIndex[line] = hotHeap.size() - 1;
+        hotSiftUp(hotHeap.size() - 1);
+        return;
+    }
+
+    // Replace the smallest counter
+    HotCounter& min = hotHeap[0];
+    hotIndex.erase(min.line);
+    min.error = min.count;
+    min.count++;
+    min.line = line;
+    hotIndex[line] = 0;
+    hotSiftDown(0);
+}
+
+void StreamProfiler::hotSwap(size_t a, size_t b) {
+    std::swap(hotHeap[a], hotHeap[b]);
+    hotIndex[hotHeap[a].line] = a;
+    hotIndex[hotHeap[b].line] = b;
+}
+
+void StreamProfiler::hotSiftUp(size_t idx) {
+    while (idx > 0) {
+        size_t parent = (idx - 1) / 2;
+        if (hotHeap[parent].count <= hotHeap[idx].count) return;
+        hotSwap(parent, idx);
+        idx = parent;
+    }
+}
+
+void StreamProfiler::hotSiftDown(size_t idx) {
+    size_t size = hotHeap.size();
+    while (true) {
+        size_t smallest = idx;
+        size_t left = 2 * idx + 1;
+        size_t right = left + 1;
+        if (left < size && hotHeap[left].count < hotHeap[smallest].count) smallest = left;
+        if (right < size && hotHeap[right].count < hotHeap[smallest].count) smallest = right;
+        if (smallest == idx) return;
+        hotSwap(smallest, idx);
+        idx = smallest;
+    }
+}
+
+/******************** SHARDS reuse distances ********************/
+
+void StreamProfiler::updateReuse(Addr line) {
+    uint64_t hash = hashLine(line);
+    if (hash >= threshold) return;
+
+    if (position + 1 >= fenwick.size())
+        compact();
+    uint64_t pos = ++position;
+
+    std::unordered_map<Addr, uint64_t>::iterator it = lastPosition.find(line);
+    if (it != lastPosition.end()) {
+        // Distinct sampled lines accessed since the last access to this one
+        uint64_t distance = fenwickSum(pos - 1) - fenwickSum(it->second);
+        fenwickAdd(it->second, -1);
+        it->second = pos;
+        recordReuse(distance, false);
+    } else {
+        lastPosition[line] = pos;
+        if (maxSampledLines != 0)
+            sampledByHash.insert(std::make_pair(hash, line));
+        recordReuse(0, true);
+    }
+    fenwickAdd(pos, 1);
+
+    if (maxSampledLines != 0 && lastPosition.size() > maxSampledLines)
+        evictSampledLine();
+}
+
+void StreamProfiler::recordReuse(uint64_t distance, bool cold) {
+    double scale = (double)shardsModulus / threshold;
+    double scaledDistance = distance * scale;
+
+    mrcAccesses += scale;
+    for (size_t i = 0; i < mrcLines.size(); i++) {
+        if (cold || scaledDistance >= mrcLines[i])
+            mrcMisses[i] += scale;
+    }
+
+    weightCarry += scale;
+    uint64_t count = (uint64_t)weightCarry;
+    if (count == 0) return;
+    weightCarry -= count;
+    if (cold)
+        coldAccesses->addData(count);
+    else
+        reuseDistance->addDataNTimes(count, (uint64_t)scaledDistance);
+}
+
+/* Lower the threshold to drop the line with the largest hash, along with any
+ * line that shares its hash */
+void StreamProfiler::evictSampledLine() {
+    threshold = sampledByHash.rbegin()->first;
+    while (!sampledByHash.empty() && sampledByHash.rbegin()->first >= threshold) {
+        std::set<std::pair<uint64_t, Addr> >::iterator last = std::prev(sampledByHash.end());
+        std::unordered_map<Addr, uint64_t>::iterator it = lastPosition.find(last->second);
+        fenwickAdd(it->second, -1);
+        lastPosition.erase(it);
+        sampledByHash.erase(last);
+    }
+}
+
+/* Renumber the live positions 1..N in access order and resize the tree */
+void StreamProfiler::compact() {
+    std::vector<std::pair<uint64_t, Addr> > order;
+    order.reserve(lastPosition.size());
+    for (std::unordered_map<Addr, uint64_t>::iterator it = lastPosition.begin(); it != lastPosition.end(); it++)
+        order.push_back(std::make_pair(it->second, it->first));
+    std::sort(order.begin(), order.end());
+
+    uint64_t size = std::max(initialPositions, 2 * (uint64_t)order.size() + 2);
+    fenwick.assign(size + 1, 0);
+    position = 0;
+    for (std::vector<std::pair<uint64_t, Addr> >::iterator it = order.begin(); it != order.end(); it++) {
+        lastPosition[it->second] = ++position;
+        fenwickAdd(position, 1);
+    }
+}
+
+void StreamProfiler::fenwickAdd(uint64_t pos, int32_t val) {
+    for (; pos < fenwick.size(); pos += pos & (~pos + 1))
+        fenwick[pos] += val;
+}
+
+uint64_t StreamProfiler::fenwickSum(uint64_t pos) {
+    int64_t sum = 0;
+    for (; pos > 0; pos -= pos & (~pos + 1))
+        sum += fenwick[pos];
+    return sum;
+}
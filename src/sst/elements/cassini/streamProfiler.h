@@ -0,0 +1,152 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_STREAM_PROFILER
+#define _H_SST_STREAM_PROFILER
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/clock.h>
+#include <sst/core/output.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Bounded-memory access profiler.
+ *
+ * Hot lines are tracked with the space-saving algorithm: 'hot_capacity'
+ * counters, where an untracked line replaces the smallest counter and
+ * inherits its count as an error bound. Any line accessed more often than
+ * accesses/hot_capacity is guaranteed to be tracked.
+ *
+ * Reuse distances are measured with SHARDS spatial sampling: a line is
+ * sampled when hash(line) mod P < T, and the distances of sampled lines are
+ * scaled by P/T. Stack distances among the sampled lines are computed with a
+ * Fenwick tree over the position of each line's last access. With
+ * 'reuse_max_lines' set, T is lowered as needed so that no more than that
+ * many lines are tracked.
+ */
+class StreamProfiler : public SST::MemHierarchy::CacheListener {
+public:
+    StreamProfiler(ComponentId_t, Params& params);
+    ~StreamProfiler() {};
+
+    void notifyAccess(const SST::MemHierarchy::CacheListenerNotification& notify);
+    void registerResponseCallback(Event::HandlerBase *handler);
+    void finish();
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        StreamProfiler,
+        "cassini",
+        "StreamProfiler",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Streaming hot-line and sampled reuse-distance profiler",
+        SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "line_size", "Size of the lines that are profiled, in bytes", "64" },
+        { "top_k", "Number of hot lines reported", "16" },
+        { "hot_capacity", "Number of space-saving counters. Values below top_k are raised to top_k", "64" },
+        { "reuse_sample_rate", "Fraction of lines sampled for reuse distances (0, 1]", "0.01" },
+        { "reuse_max_lines", "If non-zero, lower the sampling rate as needed to track at most this many lines", "0" },
+        { "mrc_sizes", "Cache sizes, in bytes, at which the miss-ratio curve is reported. Example: [32KiB, 1MiB, 32MiB]", "[]" },
+        { "emit_interval", "Period at which the hot line and miss-ratio statistics are updated, 0 to update only at the end of simulation. "
+            "Statistics should be output at the same rate with resetOnOutput set", "0" },
+        { "include_prefetches", "Profile prefetch accesses as well as demand accesses", "0" },
+        { "addr_cutoff", "Addresses above this cutoff won't be recorded", "16GiB" },
+        { "virtual_addr", "Record virtual addresses (1) or physical (0)", "0" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "accesses", "Accesses profiled", "accesses", 1 },
+        { "hot_line_addr", "Address of the hot line of each rank, subId is the rank", "address", 1 },
+        { "hot_line_count", "Estimated access count of the hot line of each rank, subId is the rank", "accesses", 1 },
+        { "hot_line_error", "Upper bound on the overestimate of hot_line_count, subId is the rank", "accesses", 1 },
+        { "reuse_distance", "Reuse distance of each access in distinct lines, scaled up from the sampled lines", "lines", 1 },
+        { "cold_accesses", "First accesses to a line, scaled up from the sampled lines", "accesses", 1 },
+        { "miss_ratio", "Estimated miss ratio of a fully associative LRU cache, subId is the size in bytes", "ratio", 1 },
+        { "sampled_lines", "Lines currently tracked by the reuse-distance sampler", "lines", 1 }
+    )
+
+private:
+    struct HotCounter {
+        SST::MemHierarchy::Addr line;
+        uint64_t count;
+        uint64_t error;
+    };
+
+    void updateHot(SST::MemHierarchy::Addr line);
+    void hotSiftUp(size_t idx);
+    void hotSiftDown(size_t idx);
+    void hotSwap(size_t a, size_t b);
+
+    void updateReuse(SST::MemHierarchy::Addr line);
+    void recordReuse(uint64_t distance, bool cold);
+    void evictSampledLine();
+    void compact();
+    void fenwickAdd(uint64_t pos, int32_t val);
+    uint64_t fenwickSum(uint64_t pos);
+
+    bool emit(Cycle_t cycle);
+
+    std::vector<Event::HandlerBase*> registeredCallbacks;
+    bool captureVirtual;
+    bool includePrefetches;
+    SST::MemHierarchy::Addr cutoff;
+    SST::MemHierarchy::Addr lineSize;
+    size_t topK;
+    size_t hotCapacity;
+
+    // Space-saving counters, a min-heap on count
+    std::vector<HotCounter> hotHeap;
+    std::unordered_map<SST::MemHierarchy::Addr, size_t> hotIndex;
+
+    // SHARDS state. Positions are 1-based indices into the Fenwick tree.
+    uint64_t threshold;                 // sample if (hash mod P) < threshold
+    uint64_t maxSampledLines;
+    uint64_t position;
+    std::vector<int32_t> fenwick;
+    std::unordered_map<SST::MemHierarchy::Addr, uint64_t> lastPosition;
+    std::set<std::pair<uint64_t, SST::MemHierarchy::Addr> > sampledByHash;
+    double weightCarry;                 // fractional accesses not yet added to statistics
+
+    // Miss-ratio curve, in scaled accesses
+    std::vector<uint64_t> mrcLines;
+    std::vector<double> mrcMisses;
+    double mrcAccesses;
+
+    Statistic<uint64_t>* accesses;
+    std::vector<Statistic<uint64_t>*> hotLineAddr;
+    std::vector<Statistic<uint64_t>*> hotLineCount;
+    std::vector<Statistic<uint64_t>*> hotLineError;
+    Statistic<uint64_t>* reuseDistance;
+    Statistic<uint64_t>* coldAccesses;
+    std::vector<Statistic<double>*> missRatio;
+    Statistic<uint64_t>* sampledLines;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,83 @@
+import sst
+
+# Profiles the accesses to a fully associative LRU L1 with three
+# cassini.StreamProfiler listeners:
+#   listener 0: every line sampled and enough hot-line counters for every
+#               line, so its estimates are exact
+#   listener 1: a quarter of the lines sampled and 16 hot-line counters
+#   listener 2: at most 64 lines sampled
+# The CPU has one read outstanding at a time, so the L1 misses exactly when
+# an LRU cache of its size would and listener 0's miss ratio at 8KiB must
+# match the L1's.
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+
+# Tell SST what statistics handling we want
+sst.setStatisticLoadLevel(4)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+# Define the simulation components
+comp_cpu = sst.Component("cpu", "memHierarchy.standardCPU")
+comp_cpu.addParams({
+      "memFreq" : 2,
+      "memSize" : "32KiB",
+      "verbose" : 0,
+      "clock" : "2GHz",
+      "rngseed" : 19,
+      "maxOutstanding" : 1,
+      "opCount" : 20000,
+      "reqsPerIssue" : 1,
+      "write_freq" : 0,
+      "read_freq" : 100,
+})
+
+iface = comp_cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+comp_l1cache.addParams({
+      "access_latency_cycles" : "2",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "128",
+      "cache_line_size" : "64",
+      "L1" : "1",
+      "cache_size" : "8KiB"
+})
+comp_l1cache.enableStatistics(["CacheHits", "CacheMisses"])
+
+profiler_params = {
+      "line_size" : 64,
+      "top_k" : 4,
+      "mrc_sizes" : "[4KiB, 8KiB, 16KiB, 32KiB]",
+}
+
+exact = comp_l1cache.setSubComponent("listener", "cassini.StreamProfiler", 0)
+exact.addParams(profiler_params)
+exact.addParams({ "reuse_sample_rate" : 1.0, "hot_capacity" : 512 })
+
+sampled = comp_l1cache.setSubComponent("listener", "cassini.StreamProfiler", 1)
+sampled.addParams(profiler_params)
+sampled.addParams({ "reuse_sample_rate" : 0.25, "hot_capacity" : 16 })
+
+bounded = comp_l1cache.setSubComponent("listener", "cassini.StreamProfiler", 2)
+bounded.addParams(profiler_params)
+bounded.addParams({ "reuse_sample_rate" : 1.0, "reuse_max_lines" : 64 })
+
+for profiler in [exact, sampled, bounded]:
+    profiler.enableAllStatistics({"type":"sst.AccumulatorStatistic"})
+
+comp_memory = sst.Component("memory", "memHierarchy.MemController")
+comp_memory.addParams({ "clock" : "1GHz", "addr_range_start" : 0 })
+backend = comp_memory.setSubComponent("backend", "memHierarchy.simpleMem")
+backend.addParams({
+      "access_time" : "100 ns",
+      "mem_size" : "32KiB",
+})
+
+# Define the simulation links
+link_cpu_cache_link = sst.Link("link_cpu_cache_link")
+link_cpu_cache_link.connect( (iface, "lowlink", "1000ps"), (comp_l1cache, "highlink", "1000ps") )
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (comp_l1cache, "lowlink", "50ps"), (comp_memory, "highlink", "50ps") )
@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import re
+
 
 class testcase_cassini_prefetch(SSTTestCase):
 
@@ -28,6 +30,54 @@ class testcase_cassini_prefetch(SSTTestCase):
     def test_cassini_prefetch_nextblock(self):
         self.cassini_prefetch_test_template("nbp")
 
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_prefetch: test_cassini_prefetch_feedback_bop skipped if threads > 3")
+    def test_cassini_prefetch_feedback_bop(self):
+        self.cassini_prefetch_feedback_template("bop", "cassini.BestOffsetPrefetcher")
+
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_prefetch: test_cassini_prefetch_feedback_spp skipped if threads > 3")
+    def test_cassini_prefetch_feedback_spp(self):
+        self.cassini_prefetch_feedback_template("spp", "cassini.SignaturePathPrefetcher")
+
+#####
+
+    def cassini_prefetch_feedback_template(self, testcase, prefetcher, testtimeout=180):
+        # The prefetcher counts the results the cache reports to it. They must add
+        # up to the cache's own prefetch statistics, one useful result per prefetched
+        # line hit or upgraded and one useless result per prefetched line evicted
+        # or invalidated unused.
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_cassini_prefetch_feedback_{0}".format(testcase)
+
+        sdlfile = "{0}/streamcpu-feedback.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        otherargs = '--model-options="{0}"'.format(prefetcher)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("cassini_prefetch test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        sums = {}
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = re.search(r"\.(\w+) : Accumulator : Sum\.u64 = (\d+);", line)
+                if m:
+                    sums[m.group(1)] = sums.get(m.group(1), 0) + int(m.group(2))
+
+        for stat in ["feedback_useful", "feedback_useless", "prefetches_issued", "prefetch_useful", "prefetch_evict"]:
+            self.assertTrue(stat in sums, "Statistic {0} not found in {1}".format(stat, outfile))
+
+        self.assertTrue(sums["prefetches_issued"] > 0, "{0} issued no prefetches".format(prefetcher))
+        self.assertTrue(sums["feedback_useful"] > 0, "{0} was never told a prefetch was useful".format(prefetcher))
+        self.assertEqual(sums["feedback_useful"], sums["prefetch_useful"] + sums.get("prefetch_coherence_miss", 0),
+                         "Useful feedback does not match the cache's useful prefetches in {0}".format(outfile))
+        self.assertEqual(sums["feedback_useless"], sums["prefetch_evict"] + sums.get("prefetch_inv", 0),
+                         "Useless feedback does not match the cache's unused evicted prefetches in {0}".format(outfile))
+
 #####
 
     def cassini_prefetch_test_template(self, testcase, testtimeout=180):
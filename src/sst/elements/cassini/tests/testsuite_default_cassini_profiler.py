@@ -0,0 +1,107 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+import re
+
+
+class testcase_cassini_profiler(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    @unittest.skipIf(testing_check_get_num_threads() > 3, "cassini_profiler: test_cassini_profiler skipped if threads > 3")
+    def test_cassini_profiler(self):
+        # The exact profiler is checked against the L1's own hits and misses and
+        # against the definition of a miss ratio curve. The sampled and bounded
+        # profilers are checked against the exact one.
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName = "test_cassini_profiler"
+
+        sdlfile = "{0}/streamcpu-profiler.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, timeout_sec=180)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("cassini_profiler test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        l1, listeners = self._readStats(outfile)
+        self.assertEqual(sorted(listeners.keys()), [0, 1, 2], "Did not find statistics for three profilers in {0}".format(outfile))
+        exact, sampled, bounded = listeners[0], listeners[1], listeners[2]
+        sizes = [ 4096, 8192, 16384, 32768 ]
+
+        # Every profiler sees every access the L1 counts
+        l1Accesses = l1["CacheHits"] + l1["CacheMisses"]
+        self.assertTrue(l1Accesses > 0, "L1 statistics not found in {0}".format(outfile))
+        for rank, profile in listeners.items():
+            self.assertEqual(profile["accesses"], l1Accesses, "Profiler {0} did not see every L1 access".format(rank))
+
+        # The L1 is an 8KiB fully associative LRU cache
+        l1MissRatio = float(l1["CacheMisses"]) / l1Accesses
+        self.assertAlmostEqual(exact["miss_ratio.8192"], l1MissRatio, delta=1e-4,
+                msg="Exact 8KiB miss ratio does not match the L1's in {0}".format(outfile))
+
+        # All of memory fits in 32KiB, so only first accesses miss
+        self.assertAlmostEqual(exact["miss_ratio.32768"], float(exact["cold_accesses"]) / exact["accesses"], delta=1e-4,
+                msg="Exact 32KiB miss ratio is not the cold miss ratio in {0}".format(outfile))
+
+        for rank, profile in listeners.items():
+            ratios = [ profile["miss_ratio.{0}".format(size)] for size in sizes ]
+            self.assertEqual(ratios, sorted(ratios, reverse=True),
+                    "Profiler {0} miss ratio increases with cache size: {1}".format(rank, ratios))
+            if profile is exact:
+                continue
+            for size in sizes:
+                stat = "miss_ratio.{0}".format(size)
+                self.assertAlmostEqual(profile[stat], exact[stat], delta=0.1,
+                        msg="Profiler {0} {1} is {2}, exact is {3}".format(rank, stat, profile[stat], exact[stat]))
+
+        # Hot lines are ranked by count. Every line has a counter in the exact
+        # profiler, so its counts have no error. The sampled profiler's counts
+        # overestimate by at most their error, and its top line is at least
+        # as hot as the average over its 16 counters.
+        for profile, name in [ (exact, "exact"), (sampled, "sampled") ]:
+            counts = [ profile["hot_line_count.{0}".format(rank)] for rank in range(4) ]
+            self.assertEqual(counts, sorted(counts, reverse=True), "{0} hot line counts are not ranked: {1}".format(name, counts))
+            for rank in range(4):
+                self.assertTrue(profile["hot_line_error.{0}".format(rank)] <= counts[rank],
+                        "{0} hot line {1} error is larger than its count".format(name, rank))
+        for rank in range(4):
+            self.assertEqual(exact["hot_line_error.{0}".format(rank)], 0, "Exact hot line {0} has an error".format(rank))
+        self.assertTrue(sampled["hot_line_count.0"] * 16 >= sampled["accesses"],
+                "Sampled top hot line count {0} is below the average of its counters".format(sampled["hot_line_count.0"]))
+
+#####
+
+    # Returns the L1's statistics and each profiler's, keyed by its listener
+    # slot, as { stat[.subId] : sum }
+    def _readStats(self, outfile):
+        pattern = re.compile(r"^\s*(\S+?)\.(\w+)(?:\.(\w+))? : Accumulator : Sum\.(?:u64|f64) = ([-+.\deE]+);")
+        l1 = {}
+        listeners = {}
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = pattern.search(line)
+                if not m:
+                    continue
+                stat = m.group(2) if m.group(3) is None else "{0}.{1}".format(m.group(2), m.group(3))
+                value = float(m.group(4)) if "." in m.group(4) or "e" in m.group(4) else int(m.group(4))
+                slot = re.search(r"listener\[(\d+)\]", m.group(1))
+                if slot:
+                    listeners.setdefault(int(slot.group(1)), {})[stat] = value
+                elif m.group(1) == "l1cache":
+                    l1[stat] = value
+        return l1, listeners
@@ -0,0 +1,147 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "throttledprefetch.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+
+ThrottledPrefetcher::ThrottledPrefetcher(ComponentId_t id, Params& params, const std::string& name) : CacheListener(id, params) {
+    requireLibrary("memHierarchy");
+
+    uint32_t verbosity = params.find<uint32_t>("verbose", 0);
+    output = new Output(name + "[" + getName() + " | @f:@p:@l] ", verbosity, 0, Output::STDOUT);
+
+    blockSize = params.find<uint64_t>("cache_line_size", 64);
+    pageSize = params.find<uint64_t>("page_size", 4096);
+    overrunPageBoundary = params.find<uint32_t>("overrun_page_boundaries", 0) != 0;
+
+    uint32_t historyCount = params.find<uint32_t>("history", 64);
+    if (historyCount == 0)
+        historyCount = 1;
+    history.resize(historyCount, (Addr) -1);
+
+    throttle = params.find<bool>("throttle", true);
+    degree = params.find<uint32_t>("degree", 2);
+    minDegree = params.find<uint32_t>("min_degree", 1);
+    maxDegree = params.find<uint32_t>("max_degree", 8);
+    interval = params.find<uint32_t>("throttle_interval", 64);
+    accuracyHigh = params.find<double>("throttle_accuracy_high", 0.75);
+    accuracyLow = params.find<double>("throttle_accuracy_low", 0.40);
+    latenessThreshold = params.find<double>("throttle_lateness", 0.10);
+
+    if (minDegree > maxDegree)
+        output->fatal(CALL_INFO, -1, "%s, Error: min_degree (%" PRIu32 ") must not be greater than max_degree (%" PRIu32 ")\n",
+                getName().c_str(), minDegree, maxDegree);
+    if (interval == 0)
+        output->fatal(CALL_INFO, -1, "%s, Error: throttle_interval must be at least 1\n", getName().c_str());
+    degree = std::min(std::max(degree, minDegree), maxDegree);
+
+    usefulCount = 0;
+    lateCount = 0;
+    uselessCount = 0;
+
+    statPrefetchEventsIssued = registerStatistic<uint64_t>("prefetches_issued");
+    statPrefetchIssueCanceledByPageBoundary = registerStatistic<uint64_t>("prefetches_canceled_by_page_boundary");
+    statPrefetchIssueCanceledByHistory = registerStatistic<uint64_t>("prefetches_canceled_by_history");
+    statPrefetchUseful = registerStatistic<uint64_t>("feedback_useful");
+    statPrefetchLate = registerStatistic<uint64_t>("feedback_late");
+    statPrefetchUseless = registerStatistic<uint64_t>("feedback_useless");
+    statPrefetchDegree = registerStatistic<uint64_t>("prefetch_degree");
+}
+
+ThrottledPrefetcher::~ThrottledPrefetcher() {
+    delete output;
+}
+
+bool ThrottledPrefetcher::issuePrefetch(Addr triggerAddr, Addr addr) {
+    Addr lineAddr = getLineAddr(addr);
+
+    if (!overrunPageBoundary && (triggerAddr / pageSize) != (lineAddr / pageSize)) {
+        output->verbose(CALL_INFO, 4, 0, "Cancel prefetch 0x%" PRIx64 ", crosses page boundary from 0x%" PRIx64 "\n", lineAddr, triggerAddr);
+        statPrefetchIssueCanceledByPageBoundary->addData(1);
+        return false;
+    }
+
+    Addr& slot = history[(lineAddr / blockSize) % history.size()];
+    if (slot == lineAddr) {
+        statPrefetchIssueCanceledByHistory->addData(1);
+        return false;
+    }
+    slot = lineAddr;
+
+    output->verbose(CALL_INFO, 2, 0, "Issue prefetch 0x%" PRIx64 ", trigger 0x%" PRIx64 ", degree %" PRIu32 "\n", lineAddr, triggerAddr, degree);
+    statPrefetchEventsIssued->addData(1);
+
+    // Create a new read request, we cannot issue a write because the data will get
+    // overwritten and corrupt memory (even if we really do want to do a write)
+    for (std::vector<Event::HandlerBase*>::iterator it = registeredCallbacks.begin(); it != registeredCallbacks.end(); it++) {
+        MemEvent* ev = new MemEvent(getName(), lineAddr, lineAddr, Command::GetS);
+        ev->setSize(blockSize);
+        ev->setPrefetchFlag(true);
+        (*(*it))(ev);
+    }
+    return true;
+}
+
+void ThrottledPrefetcher::notifyPrefetchResult(Addr addr, NotifyPrefetchResult result) {
+    switch (result) {
+        case PREFETCH_USEFUL:
+            statPrefetchUseful->addData(1);
+            usefulCount++;
+            prefetchUsed(addr);
+            break;
+        case PREFETCH_LATE:
+            statPrefetchLate->addData(1);
+            lateCount++;
+            return; // Also reported useful later
+        case PREFETCH_USELESS:
+            statPrefetchUseless->addData(1);
+            uselessCount++;
+            break;
+    }
+
+    if (throttle && usefulCount + uselessCount >= interval)
+        adjustDegree();
+}
+
+void ThrottledPrefetcher::adjustDegree() {
+    double accuracy = (double) usefulCount / (usefulCount + uselessCount);
+    double lateness = usefulCount ? (double) lateCount / usefulCount : 0.0;
+
+    if (accuracy < accuracyLow) {
+        if (degree > minDegree) degree--;
+    } else if (accuracy >= accuracyHigh || lateness >= latenessThreshold) {
+        if (degree < maxDegree) degree++;
+    }
+
+    output->verbose(CALL_INFO, 1, 0, "Throttle: accuracy %.2f, lateness %.2f, degree now %" PRIu32 "\n", accuracy, lateness, degree);
+    statPrefetchDegree->addData(degree);
+
+    usefulCount = 0;
+    lateCount = 0;
+    uselessCount = 0;
+}
+
+void ThrottledPrefetcher::registerResponseCallback(Event::HandlerBase* handler) {
+    registeredCallbacks.push_back(handler);
+}
+
+void ThrottledPrefetcher::printStats(Output &out) {
+}
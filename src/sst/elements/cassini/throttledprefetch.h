@@ -0,0 +1,133 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_THROTTLED_PREFETCH
+#define _H_SST_THROTTLED_PREFETCH
+
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/component.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include <sst/core/output.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace std;
+
+namespace SST {
+namespace Cassini {
+
+/* Parameters and statistics common to all prefetchers derived from ThrottledPrefetcher */
+#define CASSINI_THROTTLED_PREFETCHER_ELI_PARAMS \
+        { "verbose",                 "Controls the verbosity of the cassini components", "0" },\
+        { "cache_line_size",         "Size of the cache line the prefetcher is attached to", "64" },\
+        { "page_size",               "Page size for this controller", "4096" },\
+        { "overrun_page_boundaries", "Allow prefetcher to run over page boundaries, 0 is no, 1 is yes", "0" },\
+        { "history",                 "Number of recently issued prefetches remembered to drop duplicates", "64" },\
+        { "degree",                  "Initial number of prefetches issued per trigger", "2" },\
+        { "min_degree",              "Lowest degree throttling can set", "1" },\
+        { "max_degree",              "Highest degree throttling can set", "8" },\
+        { "throttle",                "Adjust the degree using the cache's feedback on useful, late and useless prefetches, 0 is no, 1 is yes", "1" },\
+        { "throttle_interval",       "Number of useful plus useless prefetches between degree adjustments", "64" },\
+        { "throttle_accuracy_high",  "Accuracy (useful / (useful + useless)) at or above which the degree increases", "0.75" },\
+        { "throttle_accuracy_low",   "Accuracy below which the degree decreases", "0.40" },\
+        { "throttle_lateness",       "Fraction of useful prefetches that were late at or above which the degree increases, unless accuracy is low", "0.10" }
+
+#define CASSINI_THROTTLED_PREFETCHER_ELI_STATS \
+        { "prefetches_issued",                    "Number of prefetch requests issued", "prefetches", 1 },\
+        { "prefetches_canceled_by_page_boundary", "Prefetches which would not be executed because they span over a page boundary", "prefetches", 1 },\
+        { "prefetches_canceled_by_history",       "Prefetches which did not get issued because they were recently issued", "prefetches", 1 },\
+        { "feedback_useful",                      "Cache feedback: prefetched lines later accessed", "prefetches", 1 },\
+        { "feedback_late",                        "Cache feedback: demand requests that found their prefetch still outstanding", "prefetches", 1 },\
+        { "feedback_useless",                     "Cache feedback: prefetched lines evicted or invalidated without being accessed", "prefetches", 1 },\
+        { "prefetch_degree",                      "Degree after each throttling adjustment", "prefetches", 2 }
+
+/*
+ * Base for prefetchers that adapt their degree to feedback from the cache
+ *
+ * Every 'throttle_interval' useful or useless prefetches, the degree is
+ * adjusted using accuracy and lateness, similar to feedback-directed
+ * prefetching (Srinath et al., HPCA 2007):
+ *  - low accuracy: decrease
+ *  - high accuracy, or medium accuracy with many late prefetches: increase
+ *  - otherwise: keep
+ * Derived classes issue prefetches through issuePrefetch(), which applies
+ * the page boundary check and drops recent duplicates.
+ */
+class ThrottledPrefetcher : public SST::MemHierarchy::CacheListener {
+public:
+    ThrottledPrefetcher(ComponentId_t id, Params& params, const std::string& name);
+    virtual ~ThrottledPrefetcher();
+
+    void registerResponseCallback(Event::HandlerBase *handler);
+    void notifyPrefetchResult(Addr addr, NotifyPrefetchResult result);
+    void printStats(Output &out);
+
+protected:
+    /* Prefetch the line holding 'addr'. Returns whether a prefetch was issued. */
+    bool issuePrefetch(Addr triggerAddr, Addr addr);
+
+    /* Called when the cache reports a prefetched line was used */
+    virtual void prefetchUsed(Addr addr) { }
+
+    uint32_t getDegree() const { return degree; }
+    Addr getLineAddr(Addr addr) const { return addr - (addr % blockSize); }
+
+    Output* output;
+    uint64_t blockSize;
+    uint64_t pageSize;
+    bool overrunPageBoundary;
+
+private:
+    void adjustDegree();
+
+    std::vector<Event::HandlerBase*> registeredCallbacks;
+
+    /* Direct-mapped filter of recently issued prefetches */
+    std::vector<Addr> history;
+
+    /* Throttling */
+    bool throttle;
+    uint32_t degree;
+    uint32_t minDegree;
+    uint32_t maxDegree;
+    uint32_t interval;
+    double accuracyHigh;
+    double accuracyLow;
+    double latenessThreshold;
+    uint32_t usefulCount;
+    uint32_t lateCount;
+    uint32_t uselessCount;
+
+    Statistic<uint64_t>* statPrefetchEventsIssued;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByPageBoundary;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByHistory;
+    Statistic<uint64_t>* statPrefetchUseful;
+    Statistic<uint64_t>* statPrefetchLate;
+    Statistic<uint64_t>* statPrefetchUseless;
+    Statistic<uint64_t>* statPrefetchDegree;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -76,6 +76,9 @@ public:
 
     virtual void handleCommand(c_BankCommand* x_bankCommandPtr);
     virtual c_BankCommand* clockTic(); // called every cycle
+    bool isIdle() const {
+        return (nullptr == m_cmd);
+    }
 
 
     inline unsigned nRC() const {
@@ -154,6 +154,15 @@ void c_BankInfo::clockTic(SimTime_t x_cycle) {
 
 }
 
+bool c_BankInfo::isQuiescent() {
+    return m_bankState->isQuiescent();
+}
+
+void c_BankInfo::skipCycles(SimTime_t x_cycles) {
+    m_autoPrechargeTimer = (m_autoPrechargeTimer > x_cycles) ? m_autoPrechargeTimer - x_cycles : 0;
+    m_bankState->skipCycles(x_cycles);
+}
+
 std::list<e_BankCommandType> c_BankInfo::getAllowedCommands() {
     return m_bankState->getAllowedCommands();
 }
@@ -56,6 +56,8 @@ public:
     void handleCommand(c_BankCommand* x_bankCommandPtr, SimTime_t x_simCycle);
 
     void clockTic(SimTime_t x_cycle);
+    bool isQuiescent();
+    void skipCycles(SimTime_t x_cycles);
 
     std::list<e_BankCommandType> getAllowedCommands();
 
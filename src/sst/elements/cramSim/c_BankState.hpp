@@ -72,6 +72,15 @@ public:
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr) = 0;
 
+    // returns true if clockTic can only count down timers until a new command arrives
+    virtual bool isQuiescent() {
+        return false;
+    }
+
+    // advance the state by x_cycles clockTic calls. only valid while isQuiescent()
+    virtual void skipCycles(SimTime_t x_cycles) {
+    }
+
     e_BankState getCurrentState() {
         return m_currentState;
     }
@@ -201,3 +201,11 @@ bool c_BankStateActive::isCommandAllowed(c_BankCommand* x_cmdPtr,
     return false;
 
 }
+
+bool c_BankStateActive::isQuiescent() {
+    return (nullptr == m_receivedCommandPtr);
+}
+
+void c_BankStateActive::skipCycles(SimTime_t x_cycles) {
+    m_timer = (m_timer > x_cycles) ? m_timer - x_cycles : 0;
+}
@@ -175,3 +175,13 @@ bool c_BankStateIdle::isCommandAllowed(c_BankCommand* x_cmdPtr,
     return false;
 
 }
+
+// m_timer is only reloaded by handleCommand, so once the received command has
+// been consumed the countdown wraps and does not reach 2 again
+bool c_BankStateIdle::isQuiescent() {
+    return (nullptr == m_receivedCommandPtr) && (2 != m_timer);
+}
+
+void c_BankStateIdle::skipCycles(SimTime_t x_cycles) {
+    m_timer -= x_cycles;
+}
@@ -0,0 +1,497 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+// std includes
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <assert.h>
+
+// local includes
+#include "c_BankTxnScheduler.hpp"
+
+using namespace SST;
+using namespace SST::CramSim;
+using namespace std;
+
+
+c_BankTxnScheduler::c_BankTxnScheduler(SST::ComponentId_t id, SST::Params& x_params, Output* out, unsigned channels, c_TxnConverter* converter, c_CmdScheduler* scheduler) :
+    c_TxnScheduler(id, out, channels, converter, scheduler) {
+
+    assert(m_numChannels>0);
+
+    bool l_found=false;
+
+    string l_policy = (string) x_params.find<std::string>("txnSchedulingPolicy", "FRFCFS", l_found);
+    if (l_policy == "FRFCFS")
+        k_policy = e_bankTxnSchedulingPolicy::FRFCFS;
+    else if (l_policy == "BLISS")
+        k_policy = e_bankTxnSchedulingPolicy::BLISS;
+    else if (l_policy == "PARBS")
+        k_policy = e_bankTxnSchedulingPolicy::PARBS;
+    else
+        output->fatal(CALL_INFO, 1, "unsupported txnSchedulingPolicy (%s) for c_BankTxnScheduler,, exit\n", l_policy.c_str());
+
+    k_numTxnQEntries = x_params.find<unsigned>("numTxnQEntries", 32, l_found);
+    if (!l_found) {
+        output->output("numTxnQEntries value is missing... it will be 32 (default)\n");
+    }
+
+    k_writeDrain = x_params.find<bool>("boolWriteDrain", true);
+
+    float l_highWatermark = x_params.find<float>("writeHighWatermark", 0.8);
+    float l_lowWatermark = x_params.find<float>("writeLowWatermark", 0.2);
+    if (l_highWatermark > 1 || l_highWatermark <= 0)
+        output->fatal(CALL_INFO, 1, "writeHighWatermark should be greater than 0 and less than (or equal to) one\n");
+    if (l_lowWatermark > l_highWatermark || l_lowWatermark < 0)
+        output->fatal(CALL_INFO, 1, "writeLowWatermark should be between 0 and writeHighWatermark\n");
+    m_highWatermark = std::max(1u, (unsigned) ((float) k_numTxnQEntries * l_highWatermark));
+    m_lowWatermark = (unsigned) ((float) k_numTxnQEntries * l_lowWatermark);
+
+    k_numRequestors = x_params.find<unsigned>("numRequestors", 1);
+    if (k_numRequestors == 0)
+        output->fatal(CALL_INFO, 1, "numRequestors should be at least one\n");
+
+    // same [End:Start] format as the dispatcher's lane index
+    string l_requestorIdPos = x_params.find<std::string>("requestorIdPos", "", k_requestorIdFromAddr);
+    if (k_requestorIdFromAddr) {
+        stringstream l_stream(l_requestorIdPos);
+        string l_item;
+        vector<string> l_tokens;
+        while (getline(l_stream, l_item, ':'))
+            l_tokens.push_back(l_item);
+        if (l_tokens.size() != 2)
+            output->fatal(CALL_INFO, 1, "requestorIdPos error! =>%s\n", l_requestorIdPos.c_str());
+
+        uint32_t l_end = atoi(l_tokens[0].c_str());
+        k_requestorIdStart = atoi(l_tokens[1].c_str());
+        if (l_end < k_requestorIdStart || l_end > 63)
+            output->fatal(CALL_INFO, 1, "requestorIdPos error!! End position: %d Start position: %d\n", l_end, k_requestorIdStart);
+        k_requestorIdMask = (l_end == 63) ? ~(uint64_t)0 : ~((uint64_t) -1 << (l_end + 1));
+    } else {
+        k_requestorIdStart = 0;
+        k_requestorIdMask = 0;
+    }
+
+    k_blacklistThreshold = x_params.find<unsigned>("blacklistThreshold", 4);
+    k_blacklistClearInterval = x_params.find<SimTime_t>("blacklistClearInterval", 10000);
+    if (k_blacklistClearInterval == 0)
+        output->fatal(CALL_INFO, 1, "blacklistClearInterval should be greater than 0\n");
+    k_batchMarkingCap = x_params.find<unsigned>("batchMarkingCap", 5);
+
+    m_numBanksPerChannel = m_cmdScheduler->getNumBanks() / m_numChannels;
+    assert(m_numBanksPerChannel > 0);
+
+    m_readQ.resize(m_numChannels);
+    for (auto &l_queue : m_readQ)
+        initChannelQueue(l_queue);
+    if (k_writeDrain) {
+        m_writeQ.resize(m_numChannels);
+        for (auto &l_queue : m_writeQ)
+            initChannelQueue(l_queue);
+    }
+    m_drainWrites.resize(m_numChannels, false);
+    m_addrOrder.resize(m_numChannels);
+    m_pendingWrites.resize(m_numChannels);
+
+    m_arrivalCount = 0;
+    m_simCycle = 0;
+
+    m_blacklisted.resize(k_numRequestors, false);
+    m_numBlacklisted = 0;
+    m_lastRequestor = 0;
+    m_consecutiveServed = 0;
+    m_nextBlacklistClear = k_blacklistClearInterval;
+
+    m_bankLoad.resize(k_numRequestors);
+    m_maxBankLoad.resize(k_numRequestors);
+    m_totalLoad.resize(k_numRequestors);
+
+    for (unsigned l_req = 0; l_req < k_numRequestors; l_req++) {
+        string l_subId = to_string(l_req);
+        s_requestorReadsIssued.push_back(registerStatistic<uint64_t>("requestorReadsIssued", l_subId));
+        s_requestorWritesIssued.push_back(registerStatistic<uint64_t>("requestorWritesIssued", l_subId));
+        s_requestorDataIssued.push_back(registerStatistic<uint64_t>("requestorDataIssued", l_subId));
+        s_requestorQueueLatency.push_back(registerStatistic<uint64_t>("requestorQueueLatency", l_subId));
+        s_requestorRowHits.push_back(registerStatistic<uint64_t>("requestorRowHits", l_subId));
+    }
+    s_blacklistings = registerStatistic<uint64_t>("blacklistings");
+    s_batchesFormed = registerStatistic<uint64_t>("batchesFormed");
+    s_writeDrains = registerStatistic<uint64_t>("writeDrains");
+}
+
+c_BankTxnScheduler::~c_BankTxnScheduler() {
+}
+
+
+void c_BankTxnScheduler::initChannelQueue(ChannelQueue& x_queue) {
+    x_queue.banks.resize(m_numBanksPerChannel);
+    for (auto &l_bank : x_queue.banks)
+        l_bank.busyPos = -1;
+    x_queue.rank.resize(k_numRequestors, 0);
+    x_queue.size = 0;
+    x_queue.marked = 0;
+}
+
+
+void c_BankTxnScheduler::run(SimTime_t simCycle) {
+
+    m_simCycle = simCycle;
+
+    if (k_policy == e_bankTxnSchedulingPolicy::BLISS && simCycle >= m_nextBlacklistClear) {
+        m_blacklisted.assign(k_numRequestors, false);
+        m_numBlacklisted = 0;
+        m_nextBlacklistClear = (simCycle / k_blacklistClearInterval + 1) * k_blacklistClearInterval;
+    }
+
+    for (unsigned l_ch = 0; l_ch < m_numChannels; l_ch++) {
+
+        //0. select queue
+        ChannelQueue* l_first = &m_readQ[l_ch];
+        ChannelQueue* l_second = nullptr;
+        if (k_writeDrain) {
+            updateWriteDrain(l_ch);
+            if (m_drainWrites[l_ch]) {
+                l_first = &m_writeQ[l_ch];
+                l_second = &m_readQ[l_ch];
+            } else
+                l_second = &m_writeQ[l_ch];
+        }
+
+        //1. select a transaction, falling back to the other queue if nothing is issuable
+        ChannelQueue* l_queue = l_first;
+        unsigned l_bank = 0;
+        EntryList::iterator l_entry;
+        bool l_found = false;
+        if (l_queue->size > 0)
+            l_found = pickTxn(*l_queue, l_ch, l_bank, l_entry);
+        if (!l_found && l_second != nullptr && l_second->size > 0) {
+            l_queue = l_second;
+            l_found = pickTxn(*l_queue, l_ch, l_bank, l_entry);
+        }
+        if (!l_found)
+            continue;
+
+        //2. send the selected transaction to transaction converter
+        c_Transaction* l_txn = l_entry->txn;
+        unsigned l_req = l_entry->requestor;
+
+        if (isRowHit(*l_entry))
+            s_requestorRowHits[l_req]->addData(1);
+        if (l_txn->isRead())
+            s_requestorReadsIssued[l_req]->addData(1);
+        else
+            s_requestorWritesIssued[l_req]->addData(1);
+        s_requestorDataIssued[l_req]->addData(l_txn->getDataWidth());
+        s_requestorQueueLatency[l_req]->addData(simCycle - l_entry->enqueueCycle);
+
+        if (k_policy == e_bankTxnSchedulingPolicy::BLISS)
+            updateBlacklist(l_req);
+
+        m_txnConverter->push(l_txn);
+
+        #ifdef __SST_DEBUG_OUTPUT__
+        l_txn->print(output, "[c_BankTxnScheduler]",simCycle);
+        #endif
+
+        removeEntry(*l_queue, l_bank, l_entry, l_ch);
+    }
+}
+
+
+bool c_BankTxnScheduler::push(c_Transaction* newTxn) {
+    unsigned l_ch = newTxn->getHashedAddress().getChannel();
+    bool l_isWrite = newTxn->isWrite();
+
+    ChannelQueue& l_queue = (k_writeDrain && l_isWrite) ? m_writeQ.at(l_ch) : m_readQ.at(l_ch);
+    if (l_queue.size >= k_numTxnQEntries)
+        return false;
+
+    TxnEntry l_entry;
+    l_entry.txn = newTxn;
+    l_entry.arrival = m_arrivalCount++;
+    l_entry.enqueueCycle = m_simCycle + 1; // pushed ahead of this cycle's run()
+    l_entry.requestor = getRequestor(newTxn);
+    l_entry.row = newTxn->getHashedAddress().getRow();
+    l_entry.marked = false;
+
+    unsigned l_bank = newTxn->getHashedAddress().getBankId() % m_numBanksPerChannel;
+    BankQueue& l_bankQ = l_queue.banks[l_bank];
+    l_bankQ.entries.push_back(l_entry);
+    RowList& l_row = l_bankQ.rows[l_entry.row];
+    l_row.push_back(std::prev(l_bankQ.entries.end()));
+    l_bankQ.entries.back().rowPos = std::prev(l_row.end());
+    if (l_bankQ.busyPos < 0) {
+        l_bankQ.busyPos = l_queue.busyBanks.size();
+        l_queue.busyBanks.push_back(l_bank);
+    }
+    l_queue.size++;
+
+    m_addrOrder[l_ch][newTxn->getAddress()].push_back(l_entry.arrival);
+    if (l_isWrite)
+        m_pendingWrites[l_ch][newTxn->getAddress()]++;
+
+    return true;
+}
+
+
+//Check if read transactions get data from the transaction queue
+bool c_BankTxnScheduler::isHit(c_Transaction* x_txn) {
+    if (!x_txn->isRead())
+        return false;
+
+    unsigned l_ch = x_txn->getHashedAddress().getChannel();
+    return m_pendingWrites.at(l_ch).count(x_txn->getAddress()) > 0;
+}
+
+
+bool c_BankTxnScheduler::isEmpty() {
+    for (auto &l_queue : m_readQ)
+        if (l_queue.size > 0)
+            return false;
+    for (auto &l_queue : m_writeQ)
+        if (l_queue.size > 0)
+            return false;
+    return true;
+}
+
+
+void c_BankTxnScheduler::skipCycles(SimTime_t x_cycles) {
+    // blacklist clears are aligned to absolute cycles, so only the cycle count moves
+    m_simCycle += x_cycles;
+}
+
+
+unsigned c_BankTxnScheduler::getRequestor(c_Transaction* x_txn) {
+    if (k_requestorIdFromAddr)
+        x_txn->setRequestorId((x_txn->getAddress() & k_requestorIdMask) >> k_requestorIdStart);
+    return x_txn->getRequestorId() % k_numRequestors;
+}
+
+
+bool c_BankTxnScheduler::isRowHit(const TxnEntry& x_entry) {
+    c_BankInfo *l_bankInfo = m_txnConverter->getBankInfo(x_entry.txn->getHashedAddress().getBankId());
+    return l_bankInfo->isRowOpen() && l_bankInfo->getOpenRowNum() == x_entry.row;
+}
+
+
+// a transaction may only issue once every older transaction to its address has issued
+bool c_BankTxnScheduler::isIssuable(const TxnEntry& x_entry, unsigned x_ch) {
+    return m_addrOrder[x_ch][x_entry.txn->getAddress()].front() == x_entry.arrival;
+}
+
+
+c_BankTxnScheduler::Priority c_BankTxnScheduler::getPriority(const TxnEntry& x_entry, const ChannelQueue& x_queue) {
+    Priority l_prio;
+    l_prio.rowHit = isRowHit(x_entry);
+    l_prio.arrival = x_entry.arrival;
+    l_prio.rank = 0;
+    switch (k_policy) {
+        case e_bankTxnSchedulingPolicy::FRFCFS:
+            l_prio.first = true;
+            break;
+        case e_bankTxnSchedulingPolicy::BLISS:
+            l_prio.first = !m_blacklisted[x_entry.requestor];
+            break;
+        case e_bankTxnSchedulingPolicy::PARBS:
+            l_prio.first = x_entry.marked;
+            l_prio.rank = x_queue.rank[x_entry.requestor];
+            break;
+    }
+    return l_prio;
+}
+
+
+// choose the best candidate of every busy bank, then the best one across banks
+bool c_BankTxnScheduler::pickTxn(ChannelQueue& x_queue, unsigned x_ch, unsigned& x_bank, EntryList::iterator& x_entry) {
+
+    if (k_policy == e_bankTxnSchedulingPolicy::PARBS && x_queue.marked == 0)
+        formBatch(x_queue);
+
+    bool l_found = false;
+    Priority l_best;
+    for (auto &l_bank : x_queue.busyBanks) {
+        BankQueue& l_bankQ = x_queue.banks[l_bank];
+
+        // all transactions of a bank share its command queue
+        if (m_cmdScheduler->getToken(l_bankQ.entries.front().txn->getHashedAddress()) < 3)
+            continue;
+
+        EntryList::iterator l_cand;
+        if (!pickTxnInBank(l_bankQ, x_queue, x_ch, l_cand))
+            continue;
+
+        Priority l_prio = getPriority(*l_cand, x_queue);
+        if (!l_found || l_prio > l_best) {
+            l_found = true;
+            l_best = l_prio;
+            x_bank = l_bank;
+            x_entry = l_cand;
+        }
+    }
+    return l_found;
+}
+
+
+bool c_BankTxnScheduler::pickTxnInBank(BankQueue& x_bankQ, const ChannelQueue& x_queue, unsigned x_ch, EntryList::iterator& x_entry) {
+
+    // FR-FCFS, and BLISS while nobody is blacklisted: the oldest row hit, else the oldest transaction
+    bool l_indexed = (k_policy == e_bankTxnSchedulingPolicy::FRFCFS)
+            || (k_policy == e_bankTxnSchedulingPolicy::BLISS && m_numBlacklisted == 0);
+
+    if (l_indexed) {
+        c_BankInfo *l_bankInfo = m_txnConverter->getBankInfo(x_bankQ.entries.front().txn->getHashedAddress().getBankId());
+        if (l_bankInfo->isRowOpen()) {
+            auto l_rowIt = x_bankQ.rows.find(l_bankInfo->getOpenRowNum());
+            if (l_rowIt != x_bankQ.rows.end() && isIssuable(*l_rowIt->second.front(), x_ch)) {
+                x_entry = l_rowIt->second.front();
+                return true;
+            }
+        }
+        if (isIssuable(x_bankQ.entries.front(), x_ch)) {
+            x_entry = x_bankQ.entries.begin();
+            return true;
+        }
+    }
+
+    // ranked policies, or the oldest transactions wait for an older access to their address
+    bool l_found = false;
+    Priority l_best;
+    for (auto l_it = x_bankQ.entries.begin(); l_it != x_bankQ.entries.end(); l_it++) {
+        if (!isIssuable(*l_it, x_ch))
+            continue;
+        Priority l_prio = getPriority(*l_it, x_queue);
+        if (!l_found || l_prio > l_best) {
+            l_found = true;
+            l_best = l_prio;
+            x_entry = l_it;
+        }
+    }
+    return l_found;
+}
+
+
+void c_BankTxnScheduler::removeEntry(ChannelQueue& x_queue, unsigned x_bank, EntryList::iterator x_entry, unsigned x_ch) {
+    BankQueue& l_bankQ = x_queue.banks[x_bank];
+    ulong l_addr = x_entry->txn->getAddress();
+
+    auto l_rowIt = l_bankQ.rows.find(x_entry->row);
+    assert(l_rowIt != l_bankQ.rows.end());
+    RowList& l_row = l_rowIt->second;
+    l_row.erase(x_entry->rowPos);
+    if (l_row.empty())
+        l_bankQ.rows.erase(l_rowIt);
+
+    std::deque<uint64_t>& l_order = m_addrOrder[x_ch][l_addr];
+    assert(l_order.front() == x_entry->arrival);
+    l_order.pop_front();
+    if (l_order.empty())
+        m_addrOrder[x_ch].erase(l_addr);
+
+    if (x_entry->txn->isWrite()) {
+        auto l_writeIt = m_pendingWrites[x_ch].find(l_addr);
+        if (--l_writeIt->second == 0)
+            m_pendingWrites[x_ch].erase(l_writeIt);
+    }
+
+    if (x_entry->marked)
+        x_queue.marked--;
+
+    l_bankQ.entries.erase(x_entry);
+    x_queue.size--;
+
+    if (l_bankQ.entries.empty()) {
+        unsigned l_last = x_queue.busyBanks.back();
+        x_queue.busyBanks[l_bankQ.busyPos] = l_last;
+        x_queue.banks[l_last].busyPos = l_bankQ.busyPos;
+        x_queue.busyBanks.pop_back();
+        l_bankQ.busyPos = -1;
+    }
+}
+
+
+void c_BankTxnScheduler::updateWriteDrain(unsigned x_ch) {
+    unsigned l_writes = m_writeQ[x_ch].size;
+    unsigned l_reads = m_readQ[x_ch].size;
+
+    if (m_drainWrites[x_ch]) {
+        if (l_writes == 0 || (l_writes <= m_lowWatermark && l_reads > 0))
+            m_drainWrites[x_ch] = false;
+    } else if (l_writes >= m_highWatermark) {
+        m_drainWrites[x_ch] = true;
+        s_writeDrains->addData(1);
+    } else if (l_reads == 0 && l_writes > 0) {
+        // nothing else to do, drain opportunistically
+        m_drainWrites[x_ch] = true;
+    }
+}
+
+
+// BLISS: blacklist a requestor served too many times in a row
+void c_BankTxnScheduler::updateBlacklist(unsigned x_requestor) {
+    if (x_requestor == m_lastRequestor) {
+        m_consecutiveServed++;
+    } else {
+        m_lastRequestor = x_requestor;
+        m_consecutiveServed = 1;
+    }
+
+    if (m_consecutiveServed >= k_blacklistThreshold && !m_blacklisted[x_requestor]) {
+        m_blacklisted[x_requestor] = true;
+        m_numBlacklisted++;
+        m_consecutiveServed = 0;
+        s_blacklistings->addData(1);
+    }
+}
+
+
+// PARBS: mark the oldest transactions of every requestor in every bank and
+// rank requestors by their maximum per-bank load (shortest job first)
+void c_BankTxnScheduler::formBatch(ChannelQueue& x_queue) {
+    if (x_queue.size == 0)
+        return;
+
+    m_maxBankLoad.assign(k_numRequestors, 0);
+    m_totalLoad.assign(k_numRequestors, 0);
+
+    for (auto &l_bank : x_queue.busyBanks) {
+        m_bankLoad.assign(k_numRequestors, 0);
+        for (auto &l_entry : x_queue.banks[l_bank].entries) {
+            if (m_bankLoad[l_entry.requestor] < k_batchMarkingCap) {
+                l_entry.marked = true;
+                m_bankLoad[l_entry.requestor]++;
+                x_queue.marked++;
+            }
+        }
+        for (unsigned l_req = 0; l_req < k_numRequestors; l_req++) {
+            m_maxBankLoad[l_req] = std::max(m_maxBankLoad[l_req], m_bankLoad[l_req]);
+            m_totalLoad[l_req] += m_bankLoad[l_req];
+        }
+    }
+
+    std::vector<unsigned> l_order(k_numRequestors);
+    std::iota(l_order.begin(), l_order.end(), 0);
+    std::stable_sort(l_order.begin(), l_order.end(), [this](unsigned a, unsigned b) {
+        if (m_maxBankLoad[a] != m_maxBankLoad[b])
+            return m_maxBankLoad[a] < m_maxBankLoad[b];
+        return m_totalLoad[a] < m_totalLoad[b];
+    });
+    for (unsigned l_pos = 0; l_pos < k_numRequestors; l_pos++)
+        x_queue.rank[l_order[l_pos]] = l_pos;
+
+    s_batchesFormed->addData(1);
+}
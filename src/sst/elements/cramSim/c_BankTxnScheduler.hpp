@@ -0,0 +1,196 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef C_BANKTXNSCHEDULER_HPP
+#define C_BANKTXNSCHEDULER_HPP
+
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "c_TxnScheduler.hpp"
+
+namespace SST {
+    namespace CramSim {
+
+        enum class e_bankTxnSchedulingPolicy {FRFCFS, BLISS, PARBS};
+
+        /*
+         * Transaction scheduler that keeps one queue per bank.
+         * Each bank queue is indexed by row, so the oldest row hit and the
+         * oldest transaction of a bank are found without scanning.
+         * Writes can be buffered separately and drained between watermarks.
+         */
+        class c_BankTxnScheduler : public c_TxnScheduler {
+        public:
+
+            SST_ELI_REGISTER_SUBCOMPONENT(
+                c_BankTxnScheduler,
+                "cramSim",
+                "c_BankTxnScheduler",
+                SST_ELI_ELEMENT_VERSION(1,0,0),
+                "Transaction Scheduler with per-bank queues, BLISS/PAR-BS fairness and write draining",
+                SST::CramSim::c_TxnScheduler
+            )
+
+            SST_ELI_DOCUMENT_PARAMS(
+                {"txnSchedulingPolicy", "Transaction scheduling policy: FRFCFS, BLISS or PARBS", "FRFCFS"},
+                {"numTxnQEntries", "The number of read (and write) transaction queue entries per channel", "32"},
+                {"boolWriteDrain", "Buffer writes in a separate queue and drain them between watermarks", "1"},
+                {"writeHighWatermark", "Fraction of the write queue at which writes start draining", "0.8"},
+                {"writeLowWatermark", "Fraction of the write queue at which write draining stops", "0.2"},
+                {"numRequestors", "Number of requestors tracked for fairness and statistics. Ids are folded modulo this value", "1"},
+                {"requestorIdPos", "Bit position of the requestor id in the address [End:Start]. If unset, the id carried by the transaction is used; memHierarchy's cramsim backend numbers requestors in the order they first reach memory", ""},
+                {"blacklistThreshold", "BLISS: consecutive transactions served from one requestor before it is blacklisted", "4"},
+                {"blacklistClearInterval", "BLISS: cycles between clearing the blacklist", "10000"},
+                {"batchMarkingCap", "PARBS: transactions per requestor per bank marked into a batch", "5"},
+            )
+
+            SST_ELI_DOCUMENT_PORTS(
+            )
+
+            SST_ELI_DOCUMENT_STATISTICS(
+                {"requestorReadsIssued", "Read transactions issued per requestor", "transactions", 1},
+                {"requestorWritesIssued", "Write transactions issued per requestor", "transactions", 1},
+                {"requestorDataIssued", "Data width of the transactions issued per requestor", "units", 1},
+                {"requestorQueueLatency", "Cycles a transaction waited in the transaction queue, per requestor", "cycles", 1},
+                {"requestorRowHits", "Transactions issued to an open row, per requestor", "transactions", 1},
+                {"blacklistings", "BLISS: number of times a requestor was blacklisted", "events", 1},
+                {"batchesFormed", "PARBS: number of batches formed", "batches", 1},
+                {"writeDrains", "Number of times the write queue reached its high watermark", "events", 1},
+            )
+
+            c_BankTxnScheduler(SST::ComponentId_t id, SST::Params &x_params, Output* out, unsigned channels, c_TxnConverter* converter, c_CmdScheduler* scheduler);
+            ~c_BankTxnScheduler();
+
+            virtual void run(SimTime_t simCycle) override;
+            virtual bool push(c_Transaction* newTxn) override;
+            virtual bool isHit(c_Transaction* newTxn) override;
+            virtual bool isEmpty() override;
+            virtual void skipCycles(SimTime_t x_cycles) override;
+
+        private:
+
+            struct TxnEntry;
+            typedef std::list<TxnEntry> EntryList;
+            typedef std::list<EntryList::iterator> RowList;
+
+            struct TxnEntry {
+                c_Transaction* txn;
+                uint64_t arrival;       // scheduler-wide arrival order
+                SimTime_t enqueueCycle;
+                unsigned requestor;
+                unsigned row;
+                bool marked;            // PARBS batch membership
+                RowList::iterator rowPos;   // position in its bank's row list
+            };
+
+            struct BankQueue {
+                EntryList entries;                                  // arrival order
+                std::unordered_map<unsigned, RowList> rows;         // arrival order per row
+                int busyPos;                                        // position in busyBanks, -1 if empty
+            };
+
+            struct ChannelQueue {
+                std::vector<BankQueue> banks;
+                std::vector<unsigned> busyBanks;    // banks holding at least one transaction
+                std::vector<unsigned> rank;         // PARBS requestor ranking, lower is better
+                unsigned size;
+                unsigned marked;                    // PARBS marked transactions left in the batch
+            };
+
+            // priority of a candidate, compared lexicographically
+            struct Priority {
+                bool first;         // not blacklisted (BLISS) or marked (PARBS)
+                bool rowHit;
+                unsigned rank;      // PARBS requestor rank
+                uint64_t arrival;
+
+                bool operator>(const Priority& x) const {
+                    if (first != x.first) return first;
+                    if (rowHit != x.rowHit) return rowHit;
+                    if (rank != x.rank) return rank < x.rank;
+                    return arrival < x.arrival;
+                }
+            };
+
+            void initChannelQueue(ChannelQueue& x_queue);
+            unsigned getRequestor(c_Transaction* x_txn);
+            bool isRowHit(const TxnEntry& x_entry);
+            bool isIssuable(const TxnEntry& x_entry, unsigned x_ch);
+            Priority getPriority(const TxnEntry& x_entry, const ChannelQueue& x_queue);
+
+            bool pickTxn(ChannelQueue& x_queue, unsigned x_ch, unsigned& x_bank, EntryList::iterator& x_entry);
+            bool pickTxnInBank(BankQueue& x_bankQ, const ChannelQueue& x_queue, unsigned x_ch, EntryList::iterator& x_entry);
+            void removeEntry(ChannelQueue& x_queue, unsigned x_bank, EntryList::iterator x_entry, unsigned x_ch);
+
+            void updateWriteDrain(unsigned x_ch);
+            void updateBlacklist(unsigned x_requestor);
+            void formBatch(ChannelQueue& x_queue);
+
+            std::vector<ChannelQueue> m_readQ;     // unified queue when write draining is disabled
+            std::vector<ChannelQueue> m_writeQ;
+            std::vector<bool> m_drainWrites;
+
+            // arrival order of pending transactions per address, for read/write ordering
+            std::vector<std::unordered_map<ulong, std::deque<uint64_t>>> m_addrOrder;
+            // pending writes per address, for quick read responses
+            std::vector<std::unordered_map<ulong, unsigned>> m_pendingWrites;
+
+            uint64_t m_arrivalCount;
+            SimTime_t m_simCycle;
+            unsigned m_numBanksPerChannel;
+            unsigned m_highWatermark;
+            unsigned m_lowWatermark;
+
+            // BLISS state
+            std::vector<bool> m_blacklisted;
+            unsigned m_numBlacklisted;
+            unsigned m_lastRequestor;
+            unsigned m_consecutiveServed;
+            SimTime_t m_nextBlacklistClear;
+
+            // PARBS scratch space, per requestor
+            std::vector<unsigned> m_bankLoad;
+            std::vector<unsigned> m_maxBankLoad;
+            std::vector<unsigned> m_totalLoad;
+
+            // parameters
+            e_bankTxnSchedulingPolicy k_policy;
+            unsigned k_numTxnQEntries;
+            bool k_writeDrain;
+            unsigned k_numRequestors;
+            bool k_requestorIdFromAddr;
+            uint32_t k_requestorIdStart;
+            uint64_t k_requestorIdMask;
+            unsigned k_blacklistThreshold;
+            SimTime_t k_blacklistClearInterval;
+            unsigned k_batchMarkingCap;
+
+            // statistics
+            std::vector<Statistic<uint64_t>*> s_requestorReadsIssued;
+            std::vector<Statistic<uint64_t>*> s_requestorWritesIssued;
+            std::vector<Statistic<uint64_t>*> s_requestorDataIssued;
+            std::vector<Statistic<uint64_t>*> s_requestorQueueLatency;
+            std::vector<Statistic<uint64_t>*> s_requestorRowHits;
+            Statistic<uint64_t>* s_blacklistings;
+            Statistic<uint64_t>* s_batchesFormed;
+            Statistic<uint64_t>* s_writeDrains;
+        };
+    }
+}
+
+#endif //C_BANKTXNSCHEDULER_HPP
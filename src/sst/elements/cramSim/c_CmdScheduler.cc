@@ -154,3 +154,32 @@ unsigned c_CmdScheduler::getToken(const c_HashedAddress &x_addr)
     return k_numCmdQEntries-m_cmdQueues[l_ch].at(l_bank).size();
 
 }
+
+
+bool c_CmdScheduler::isEmpty()
+{
+    for (auto &l_chQueues : m_cmdQueues)
+        for (auto &l_cmdQueue : l_chQueues)
+            if (!l_cmdQueue.empty())
+                return false;
+    return true;
+}
+
+
+// advance the round robin pointers as x_cycles runs over empty queues would
+void c_CmdScheduler::skipCycles(SimTime_t x_cycles)
+{
+    if (x_cycles == 0)
+        return;
+
+    for (unsigned l_ch = 0; l_ch < m_numChannels; l_ch++) {
+        if (m_schedulingPolicy == e_SchedulingPolicy::BANK) {
+            unsigned l_mod = m_numBanksPerChannel;
+            m_nextCmdQIdx.at(l_ch) = (m_nextCmdQIdx.at(l_ch) + x_cycles % l_mod) % l_mod;
+        } else if (m_schedulingPolicy == e_SchedulingPolicy::RANK) {
+            unsigned l_mod = m_numBanksPerChannel - 1;
+            SimTime_t l_step = ((x_cycles % l_mod) * (m_numBanksPerRank % l_mod)) % l_mod;
+            m_nextCmdQIdx.at(l_ch) = (m_nextCmdQIdx.at(l_ch) + l_step) % l_mod;
+        }
+    }
+}
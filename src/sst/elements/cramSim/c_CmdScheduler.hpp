@@ -72,6 +72,9 @@ namespace SST{
             void run(SimTime_t simCycle);
             bool push(c_BankCommand* x_cmd);
             unsigned getToken(const c_HashedAddress &x_addr);
+            unsigned getNumBanks() { return m_numBanks; }
+            bool isEmpty();
+            void skipCycles(SimTime_t x_cycles);
 
 
         private:
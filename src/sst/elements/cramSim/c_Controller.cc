@@ -35,6 +35,8 @@
 #include "c_CmdResEvent.hpp"
 #include "c_HashedAddress.hpp"
 
+#include <limits>
+
 using namespace SST;
 using namespace SST::CramSim;
 
@@ -116,6 +118,8 @@ c_Controller::c_Controller(ComponentId_t id, Params &params) :
         output->output("boolEnableQuickRes param value is missing... disabled\n");
     }
 
+    k_enableClockGating = (uint32_t)params.find<uint32_t>("boolClockGating", 1);
+
     // get configured clock frequency
     k_controllerClockFreqStr = (std::string)params.find<std::string>("strControllerClockFrequency", "1GHz", l_found);
 
@@ -123,8 +127,10 @@ c_Controller::c_Controller(ComponentId_t id, Params &params) :
     configure_link();
 
     //set our clock
-    registerClock(k_controllerClockFreqStr,
-                  new Clock::Handler<c_Controller>(this, &c_Controller::clockTic));
+    m_clockHandler = new Clock::Handler<c_Controller>(this, &c_Controller::clockTic);
+    m_clockTC = registerClock(k_controllerClockFreqStr, m_clockHandler);
+    m_clockOn = true;
+    m_lastClockCycle = 0;
 
 
 
@@ -147,6 +153,10 @@ void c_Controller::configure_link() {
     m_memLink = configureLink("memLink",
                                        new Event::Handler<c_Controller>(this,
                                                                         &c_Controller::handleInDeviceResPtrEvent));
+    // Controller -> Controller (refresh wake up)
+    m_clockWakeLink = configureSelfLink("clockWakeLink", k_controllerClockFreqStr,
+                                       new Event::Handler<c_Controller>(this,
+                                                                        &c_Controller::handleClockWakeEvent));
 }
 
 
@@ -219,11 +229,57 @@ bool c_Controller::clockTic(SST::Cycle_t clock) {
     // 6. run device driver
     m_deviceDriver->run();
 
+    // 7. turn the clock off until the next refresh if nothing can change state before then
+    if (k_enableClockGating && isIdle()) {
+        SimTime_t l_idleCycles = m_deviceDriver->getIdleCycles();
+        if (l_idleCycles > 0) {
+            m_clockOn = false;
+            m_lastClockCycle = clock;
+            if (l_idleCycles != std::numeric_limits<SimTime_t>::max())
+                m_clockWakeLink->send(l_idleCycles, nullptr);
+            return true;
+        }
+    }
 
     return false;
 }
 
 
+bool c_Controller::isIdle() {
+    return m_ReqQ.empty() && m_ResQ.empty()
+        && m_txnScheduler->isEmpty()
+        && m_txnConverter->isEmpty()
+        && m_cmdScheduler->isEmpty()
+        && m_deviceDriver->isIdle();
+}
+
+
+// Re-enable the clock and catch up on the cycles slept through.
+// The sleep never outlasts the idle window reported by the device driver,
+// so the skipped cycles only count down timers.
+void c_Controller::turnClockOn() {
+    if (m_clockOn)
+        return;
+
+    Cycle_t l_cycle = reregisterClock(m_clockTC, m_clockHandler) - 1;
+    SimTime_t l_skipped = l_cycle - m_lastClockCycle;
+
+    m_simCycle += l_skipped;
+    m_txnScheduler->skipCycles(l_skipped);
+    m_txnConverter->skipCycles(l_skipped);
+    m_cmdScheduler->skipCycles(l_skipped);
+    m_deviceDriver->skipCycles(l_skipped);
+
+    m_clockOn = true;
+}
+
+
+void c_Controller::handleClockWakeEvent(SST::Event *ev) {
+    // the wake up may be stale if an incoming transaction already turned the clock on
+    turnClockOn();
+}
+
+
 void c_Controller::sendCommand(c_BankCommand* cmd)
 {
      c_CmdReqEvent *l_cmdReqEventPtr = new c_CmdReqEvent();
@@ -269,6 +325,8 @@ void c_Controller::handleIncomingTransaction(SST::Event *ev){
     c_TxnReqEvent* l_txnReqEventPtr = dynamic_cast<c_TxnReqEvent*>(ev);
 
     if (l_txnReqEventPtr) {
+        turnClockOn();
+
         c_Transaction* newTxn=l_txnReqEventPtr->m_payload;
 
         #ifdef __SST_DEBUG_OUTPUT__
@@ -289,6 +347,8 @@ void c_Controller::handleIncomingTransaction(SST::Event *ev){
 void c_Controller::handleInDeviceResPtrEvent(SST::Event *ev){
     c_CmdResEvent* l_cmdResEventPtr = dynamic_cast<c_CmdResEvent*>(ev);
     if (l_cmdResEventPtr) {
+        turnClockOn();
+
         ulong l_resSeqNum = l_cmdResEventPtr->m_payload->getSeqNum();
         // need to find which txn matches the command seq number in the txnResQ
         c_Transaction* l_txnRes = nullptr;
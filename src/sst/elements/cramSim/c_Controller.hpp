@@ -65,7 +65,8 @@ namespace SST {
 
             SST_ELI_DOCUMENT_PARAMS(
                 {"verbose", "Output verbosity", "0"},
-                {"strControllerClockFrequency", "Controller clock frequency, with units", "1GHz" }
+                {"strControllerClockFrequency", "Controller clock frequency, with units", "1GHz" },
+                {"boolClockGating", "Turn the clock off while all queues are empty and banks are idle", "1"}
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -101,6 +102,10 @@ namespace SST {
 
             virtual bool clockTic(SST::Cycle_t); // called every cycle
 
+            // clock gating
+            bool isIdle();
+            void turnClockOn();
+            void handleClockWakeEvent(SST::Event *ev);
 
             void sendResponse();
             void sendRequest();
@@ -128,10 +133,18 @@ namespace SST {
 
             // params for system configuration
             int k_enableQuickResponse;
+            bool k_enableClockGating;
 
             // clock frequency
             std::string k_controllerClockFreqStr;
 
+            // clock gating
+            Clock::HandlerBase *m_clockHandler;
+            TimeConverter *m_clockTC;
+            bool m_clockOn;
+            Cycle_t m_lastClockCycle;
+            SST::Link *m_clockWakeLink; // self link used to wake up for the next refresh
+
             // Transaction Generator <-> Controller Links
             SST::Link *m_txngenLink;
             // Controller <-> Memory device Links
@@ -33,6 +33,7 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <limits>
 #include <assert.h>
 
 // CramSim includes
@@ -477,6 +478,87 @@ void c_DeviceDriver::update(SimTime_t simCycle) {
 }
 
 
+/*!
+ * @return "true" if no command is queued or in flight and every bank only counts down timers
+ */
+bool c_DeviceDriver::isIdle() {
+    if (!m_inputQ.empty() || !m_outputQ.empty())
+        return false;
+
+    if (k_useRefresh) {
+        for (auto &l_cmdQ : m_refreshCmdQ)
+            if (!l_cmdQ.empty())
+                return false;
+    }
+
+    for (auto &l_bank : m_banks)
+        if (!l_bank->isQuiescent())
+            return false;
+
+    return true;
+}
+
+/*!
+ * @return the number of upcoming cycles for which run() and update() only
+ * count down timers. Only meaningful while isIdle() is true.
+ */
+SimTime_t c_DeviceDriver::getIdleCycles() {
+    SimTime_t l_idleCycles = std::numeric_limits<SimTime_t>::max();
+
+    // a rank creates its refresh commands on the cycle its REFI counter is already 0
+    if (k_useRefresh) {
+        for (auto &l_count : m_currentREFICount)
+            l_idleCycles = std::min(l_idleCycles, (SimTime_t) l_count);
+    }
+    return l_idleCycles;
+}
+
+/*!
+ * Apply the effect of x_cycles idle update()/run() calls at once
+ * @param x_cycles must not exceed getIdleCycles()
+ */
+void c_DeviceDriver::skipCycles(SimTime_t x_cycles) {
+    if (x_cycles == 0)
+        return;
+
+    m_simCycle += x_cycles;
+
+    for (auto &l_bank : m_banks)
+        l_bank->skipCycles(x_cycles);
+
+    // the first skipped update records the ACTs issued in the last active cycle, the rest record none
+    for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
+        std::list<unsigned> &l_tracker = m_cmdACTFAWtrackers[l_rankNum];
+        l_tracker.push_back(m_isACTIssued[l_rankNum] ? static_cast<unsigned>(1) : static_cast<unsigned>(0));
+        l_tracker.pop_front();
+
+        SimTime_t l_shifts = std::min((SimTime_t) l_tracker.size(), x_cycles - 1);
+        for (SimTime_t l_i = 0; l_i < l_shifts; l_i++) {
+            l_tracker.push_back(0);
+            l_tracker.pop_front();
+        }
+    }
+
+    m_inflightWrites.clear();
+    m_blockBank.clear();
+    m_blockBank.resize(m_numBanks, false);
+    m_isACTIssued.clear();
+    m_isACTIssued.resize(m_numRanks, false);
+
+    // both update() and run() release the command bus
+    for (auto &l_value : m_blockColCmd)
+        l_value = (l_value > 2 * x_cycles) ? l_value - 2 * x_cycles : 0;
+    for (auto &l_value : m_blockRowCmd)
+        l_value = (l_value > 2 * x_cycles) ? l_value - 2 * x_cycles : 0;
+
+    if (k_useRefresh) {
+        for (auto &l_count : m_currentREFICount) {
+            assert(l_count >= x_cycles);
+            l_count -= x_cycles;
+        }
+    }
+}
+
 
 
 /*!
@@ -136,6 +136,9 @@ public:
     virtual bool isCmdAllowed(c_BankCommand* x_bankCommandPtr);
     virtual c_BankInfo* getBankInfo(unsigned x_bankId);
     void update(SimTime_t simCycle);
+    virtual bool isIdle();
+    virtual SimTime_t getIdleCycles();
+    virtual void skipCycles(SimTime_t x_cycles);
 
     unsigned getNumChannel(){return k_numChannels;}
     unsigned getNumPChPerChannel(){return k_numPChannelsPerChannel;}
@@ -100,6 +100,8 @@ c_Dimm::c_Dimm(SST::ComponentId_t x_id, SST::Params& x_params) :
     }
 
 
+    k_enableClockGating = (uint32_t)x_params.find<uint32_t>("boolClockGating", 1);
+
     m_numRanks = k_numChannels * k_numPChannelsPerChannel * k_numRanksPerChannel;
     m_numBanks = m_numRanks* k_numBankGroupsPerRank * k_numBanksPerBankGroup;
 
@@ -204,7 +206,9 @@ c_Dimm::c_Dimm(SST::ComponentId_t x_id, SST::Params& x_params) :
 
     //set our clock
     m_clockHandler=new Clock::Handler<c_Dimm>(this, &c_Dimm::clockTic);
-    registerClock(l_clockFreqStr, m_clockHandler);
+    m_clockTC = registerClock(l_clockFreqStr, m_clockHandler);
+    m_clockOn = true;
+    m_lastClockCycle = 0;
 
     // Statistics setup
     s_actCmdsRecvd     = registerStatistic<uint64_t>("actCmdsRecvd");
@@ -254,7 +258,7 @@ void c_Dimm::printQueues() {
         (l_cmdPtr)->print(m_simCycle);
 }
 
-bool c_Dimm::clockTic(SST::Cycle_t) {
+bool c_Dimm::clockTic(SST::Cycle_t x_cycle) {
     m_simCycle++;
     for (int l_i = 0; l_i != m_banks.size(); ++l_i) {
 
@@ -269,13 +273,51 @@ bool c_Dimm::clockTic(SST::Cycle_t) {
     if(k_boolPowerCalc)
         updateBackgroundEnergy();
 
+    // nothing changes state until the controller sends the next command
+    if (k_enableClockGating && isIdle()) {
+        m_clockOn = false;
+        m_lastClockCycle = x_cycle;
+        return true;
+    }
+
     return false;
 }
 
+bool c_Dimm::isIdle() {
+    if (!m_cmdResQ.empty())
+        return false;
+
+    for (auto &l_bank : m_banks)
+        if (!l_bank->isIdle())
+            return false;
+
+    return true;
+}
+
+void c_Dimm::turnClockOn() {
+    if (m_clockOn)
+        return;
+
+    addSkippedCycles(reregisterClock(m_clockTC, m_clockHandler) - 1);
+    m_clockOn = true;
+}
+
+// credit the cycles the clock was off up to and including x_cycle
+void c_Dimm::addSkippedCycles(Cycle_t x_cycle) {
+    SimTime_t l_skipped = x_cycle - m_lastClockCycle;
+
+    m_simCycle += l_skipped;
+    if(k_boolPowerCalc)
+        updateBackgroundEnergy(l_skipped);
+
+    m_lastClockCycle = x_cycle;
+}
+
 void c_Dimm::handleInCmdUnitReqPtrEvent(SST::Event *ev) {
 
     c_CmdReqEvent* l_cmdReqEventPtr = dynamic_cast<c_CmdReqEvent*>(ev);
     if (l_cmdReqEventPtr) {
+        turnClockOn();
 
         c_BankCommand* l_cmdReq = l_cmdReqEventPtr->m_payload;
         unsigned l_rank=l_cmdReq->getHashedAddress()->getRankId();
@@ -367,13 +409,14 @@ void c_Dimm::updateDynamicEnergy(c_BankCommand* x_bankCommandPtr)
     }
 }
 
-void c_Dimm::updateBackgroundEnergy()
+void c_Dimm::updateBackgroundEnergy(SimTime_t x_cycles)
 {
     //Todo: update background energy depeding on bank status
 
+    // background power is constant per cycle, so n idle cycles cost n times one
     for(unsigned i=0;i<m_numRanks;i++)
     {
-        m_backgroundEnergy[i]+= k_IDD3N * k_VDD * k_numDevices;
+        m_backgroundEnergy[i]+= x_cycles * (k_IDD3N * k_VDD * k_numDevices);
     }
 }
 void c_Dimm::sendToBank(c_BankCommand* x_bankCommandPtr) {
@@ -409,6 +452,10 @@ void c_Dimm::sendResponse() {
 
 void c_Dimm::finish(){
 
+    // account for the cycles slept through at the end of simulation
+    if (!m_clockOn)
+        addSkippedCycles(getCurrentSimTime(m_clockTC));
+
     double l_actprePower=0;
     double l_readPower =0;
     double l_writePower =0;
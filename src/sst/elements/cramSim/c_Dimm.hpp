@@ -80,6 +80,7 @@ public:
         {"boolAllocateCmdResWRITE", "Allocate space in Controller Res Q for WRITE Cmds", NULL},
         {"boolAllocateCmdResWRITEA", "Allocate space in Controller Res Q for WRITEA Cmds", NULL},
         {"boolAllocateCmdResPRE", "Allocate space in Controller Res Q for PRE Cmds", NULL},
+        {"boolClockGating", "Turn the clock off while no bank holds a command", "1"},
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -112,6 +113,9 @@ private:
     void operator=(const c_Dimm&); // do not implement
 
     virtual bool clockTic(SST::Cycle_t); // called every cycle
+    bool isIdle();
+    void turnClockOn();
+    void addSkippedCycles(Cycle_t x_cycle);
 
     // BankReceiver <-> CmdUnit Handlers
     void handleInCmdUnitReqPtrEvent(SST::Event *ev); // receive a cmd req from CmdUnit
@@ -120,13 +124,16 @@ private:
     void sendResponse();
     void sendToBank(c_BankCommand* x_bankCommandPtr);
     void updateDynamicEnergy(c_BankCommand* x_bankCommandPtr);
-    void updateBackgroundEnergy();
+    void updateBackgroundEnergy(SimTime_t x_cycles = 1);
 
     // Links
     SST::Link* m_ctrlLink;
 
     // Clock Handler
     Clock::HandlerBase *m_clockHandler;
+    TimeConverter *m_clockTC;
+    bool m_clockOn;
+    Cycle_t m_lastClockCycle;
 
     // params
     int k_numChannels;
@@ -137,6 +144,7 @@ private:
     int k_numDevices;
 
     bool k_boolPowerCalc;
+    bool k_enableClockGating;
     int k_IDD0;
     int k_IDD2P;
     int k_IDD2N;
@@ -97,6 +97,7 @@ void c_MemhBridge::createTxn() {
                 mTxn = new c_Transaction(event->getReqId(), e_TransactionType::WRITE, addr, 1);
         else
                 mTxn = new c_Transaction(event->getReqId(), e_TransactionType::READ, addr, 1);
+        mTxn->setRequestorId(event->getRequestor());
 
 
         std::pair<c_Transaction*, uint64_t > l_entry = std::make_pair(mTxn,l_cycle);
@@ -45,6 +45,7 @@ c_Transaction::c_Transaction(ulong x_seqNum, e_TransactionType x_txnMnemonic,
                 false) {
 
     m_hasHashedAddr= false;
+    m_requestorId = 0;
 
 }
 
@@ -154,5 +155,6 @@ void c_Transaction::serialize_order(SST::Core::Serialization::serializer &ser)
   ser & m_dataWidth;
   ser & m_processed;
     ser & m_hasHashedAddr;
+    ser & m_requestorId;
 
 }
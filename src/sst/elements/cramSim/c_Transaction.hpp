@@ -74,6 +74,7 @@ private:
   std::list<ulong> m_cmdSeqNumList; //<! list of c_BankCommand Sequence numbers that compose this c_Transaction
     c_HashedAddress m_hashedAddr;
     bool m_hasHashedAddr;
+    unsigned m_requestorId; //<! source of the transaction, used by fairness-aware schedulers
 
 public:
 
@@ -126,6 +127,13 @@ public:
             return m_txnMnemonic==e_TransactionType ::WRITE;
         }
 
+        unsigned getRequestorId() const {
+            return m_requestorId;
+        }
+        void setRequestorId(unsigned x_requestorId) {
+            m_requestorId = x_requestorId;
+        }
+
 
   void serialize_order(SST::Core::Serialization::serializer &ser) override ;
 
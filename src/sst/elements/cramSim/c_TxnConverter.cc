@@ -162,6 +162,16 @@ void c_TxnConverter::run(SimTime_t simCycle){
 
 
 
+void c_TxnConverter::skipCycles(SimTime_t x_cycles) {
+    //For psuedo open page policy, keep the auto precharge timers running
+    if(k_bankPolicy==2) {
+        for (auto &it:m_bankInfo)
+            if(it->isRowOpen())
+                it->skipCycles(x_cycles);
+    }
+}
+
+
 void c_TxnConverter::push(c_Transaction* newTxn) {
 
     // make sure the internal req q has at least one empty entry
@@ -95,6 +95,8 @@ public:
     void run(SimTime_t simCycle);
     void push(c_Transaction* newTxn); // receive txns from txnGen into req q
     c_BankInfo* getBankInfo(unsigned x_bankId);
+    bool isEmpty() { return m_inputQ.empty(); }
+    void skipCycles(SimTime_t x_cycles);
 
 private:
 
@@ -82,10 +82,13 @@ c_TxnDispatcher::c_TxnDispatcher(ComponentId_t x_id, Params &params):Component(x
     }
     std::string l_clockFreqStr = (std::string)params.find<std::string>("ClockFreq", "1GHz", l_found);
 
+    k_enableClockGating = (uint32_t)params.find<uint32_t>("boolClockGating", 1);
 
     //set our clock
-    registerClock(l_clockFreqStr,
-                  new Clock::Handler<c_TxnDispatcher>(this, &c_TxnDispatcher::clockTic));
+    m_clockHandler = new Clock::Handler<c_TxnDispatcher>(this, &c_TxnDispatcher::clockTic);
+    m_clockTC = registerClock(l_clockFreqStr, m_clockHandler);
+    m_clockOn = true;
+    m_lastClockCycle = 0;
 
 
     //---- configure link ----//
@@ -131,15 +134,34 @@ bool c_TxnDispatcher::clockTic(Cycle_t clock)
         m_resQ.pop_front();
     }
 
+    // both queues are drained every cycle, so sleep until the next event arrives
+    if (k_enableClockGating) {
+        m_clockOn = false;
+        m_lastClockCycle = clock;
+        return true;
+    }
+
     return false;
 }
 
 
+void c_TxnDispatcher::turnClockOn()
+{
+    if (m_clockOn)
+        return;
+
+    Cycle_t l_cycle = reregisterClock(m_clockTC, m_clockHandler) - 1;
+    m_simCycle += l_cycle - m_lastClockCycle;
+    m_clockOn = true;
+}
+
+
 void c_TxnDispatcher::handleTxnGenEvent(SST::Event *ev)
 {
     //get a lane index
     c_TxnReqEvent* l_newReq=dynamic_cast<c_TxnReqEvent*>(ev);
     m_reqQ.push_back(l_newReq);
+    turnClockOn();
 
     #ifdef __SST_DEBUG_OUTPUT__
     l_newReq->m_payload->print(&dbg,"[c_TxnDispatcher.handleTxnGenEvent]",m_simCycle);
@@ -151,6 +173,7 @@ void c_TxnDispatcher::handleCtrlEvent(SST::Event *ev)
 {
     c_TxnResEvent* l_newRes=dynamic_cast<c_TxnResEvent*>(ev);
     m_resQ.push_back(l_newRes);
+    turnClockOn();
 }
 
 
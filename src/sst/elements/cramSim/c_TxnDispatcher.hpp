@@ -54,6 +54,7 @@ namespace SST{
             SST_ELI_DOCUMENT_PARAMS(
                 {"numLanes", "Total number of lanes", NULL},
                 {"laneIdxPosition", "Bit posiiton of the lane index in the address.. [End:Start]", NULL},
+                {"boolClockGating", "Turn the clock off while the request and response queues are empty", "1"},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -68,6 +69,7 @@ namespace SST{
              c_TxnDispatcher();
 
              virtual bool clockTic(Cycle_t);
+             void turnClockOn();
              void handleTxnGenEvent(SST::Event *ev);
              void handleCtrlEvent(SST::Event *ev);
              void sendRequest(c_TxnReqEvent *ev);
@@ -88,6 +90,13 @@ namespace SST{
              uint64_t m_laneIdxMask;
 
              uint32_t k_numLanes;
+             bool k_enableClockGating;
+
+             Clock::HandlerBase *m_clockHandler;
+             TimeConverter *m_clockTC;
+             bool m_clockOn;
+             Cycle_t m_lastClockCycle;
+
              Output dbg;
              Output* output;
          };
@@ -261,6 +261,29 @@ bool c_TxnScheduler::push(c_Transaction* newTxn)
 }
 
 
+bool c_TxnScheduler::isEmpty()
+{
+    for (auto &l_queue : m_txnQ)
+        if (!l_queue.empty())
+            return false;
+    for (auto &l_queue : m_txnReadQ)
+        if (!l_queue.empty())
+            return false;
+    for (auto &l_queue : m_txnWriteQ)
+        if (!l_queue.empty())
+            return false;
+    return true;
+}
+
+
+void c_TxnScheduler::skipCycles(SimTime_t x_cycles)
+{
+    // with an empty read queue, run() always selects the write queue
+    if (k_isReadFirstScheduling && x_cycles > 0)
+        m_flushWriteQueue = true;
+}
+
+
 //Check if read transactions get data from the transaction queue
 bool c_TxnScheduler::isHit(c_Transaction* x_txn)
 {
@@ -75,23 +75,33 @@ namespace SST {
 
             c_TxnScheduler(SST::ComponentId_t id, SST::Params &x_params, Output* out, unsigned channels, c_TxnConverter* converter, c_CmdScheduler* scheduler);
             void build(Params &x_params); // Temporary
-            ~c_TxnScheduler();
+            virtual ~c_TxnScheduler();
 
             virtual void run(SimTime_t simCycle);
             virtual bool push(c_Transaction* newTxn);
             virtual bool isHit(c_Transaction* newTxn);
+            virtual bool isEmpty();
+            virtual void skipCycles(SimTime_t x_cycles);
 
 
-        private:
-            virtual c_Transaction* getNextTxn(TxnQueue& x_queue, int x_ch);
-            virtual bool hasDependancy(c_Transaction* x_txn, int x_ch);
-            virtual void popTxn(TxnQueue& x_queue, c_Transaction* x_txn);
+        protected:
+            // for schedulers that parse their own parameters
+            c_TxnScheduler(SST::ComponentId_t id, Output* out, unsigned channels, c_TxnConverter* converter, c_CmdScheduler* scheduler) :
+                SubComponent(id), m_txnConverter(converter), m_cmdScheduler(scheduler), output(out), m_numChannels(channels), m_out(nullptr) {}
 
             //**transaction converter
             c_TxnConverter* m_txnConverter;
             //**command Scheduler
             c_CmdScheduler* m_cmdScheduler;
 
+            Output *output;
+            unsigned m_numChannels;
+
+        private:
+            virtual c_Transaction* getNextTxn(TxnQueue& x_queue, int x_ch);
+            virtual bool hasDependancy(c_Transaction* x_txn, int x_ch);
+            virtual void popTxn(TxnQueue& x_queue, c_Transaction* x_txn);
+
             //**per-channel transaction queue
             std::vector<TxnQueue> m_txnQ;      // unified queue
             //**per-channel tranaction queues for read-first scheduling
@@ -100,9 +110,7 @@ namespace SST {
             unsigned m_maxNumPendingWrite;
             unsigned m_minNumPendingWrite;
 
-            Output *output;
             Output *m_out;
-            unsigned m_numChannels;
             bool m_flushWriteQueue;
 
             //parameters
@@ -31,8 +31,8 @@ typedef uint64_t ReqId;
 
 class MemReqEvent : public SST::Event {
   public:
-    MemReqEvent(ReqId id, Addr addr, bool isWrite, unsigned numBytes, uint32_t flags) :
-        SST::Event(), reqId(id), addr(addr), isWrite(isWrite), numBytes(numBytes), flags(flags)
+    MemReqEvent(ReqId id, Addr addr, bool isWrite, unsigned numBytes, uint32_t flags, uint32_t requestor = 0) :
+        SST::Event(), reqId(id), addr(addr), isWrite(isWrite), numBytes(numBytes), flags(flags), requestor(requestor)
     {
         eventID  = generateUniqueId();
     }
@@ -42,6 +42,7 @@ class MemReqEvent : public SST::Event {
     bool getIsWrite() { return isWrite; }
     unsigned  getNumBytes() { return numBytes; }
     uint32_t getFlags() { return flags; }
+    uint32_t getRequestor() { return requestor; }
     id_type getID(void) const { return eventID; }
 
   private:
@@ -52,6 +53,7 @@ class MemReqEvent : public SST::Event {
     bool isWrite;
     unsigned numBytes;
     uint32_t flags;
+    uint32_t requestor;     // small integer id of the component that issued the request
     id_type eventID;
 
   public:
@@ -62,6 +64,7 @@ class MemReqEvent : public SST::Event {
         ser & isWrite;
         ser & numBytes;
         ser & flags;
+        ser & requestor;
         ser & eventID;
     }
 
@@ -0,0 +1,124 @@
+import sst
+import sys
+
+# Four cores share a cramSim memory through memHierarchy. The controller uses
+# c_BankTxnScheduler, which sees the L1 that issued each request as its
+# requestor.
+#   --configfile=<cramSim config>  device and timing parameters
+#   <param>=<value>                overrides, e.g. txnSchedulingPolicy=BLISS
+
+config_file = "../ddr4_verimem.cfg"
+overrides = {}
+for arg in sys.argv[1:]:
+    if arg.startswith("--configfile="):
+        config_file = arg[len("--configfile="):]
+    elif arg.find("=") != -1:
+        key, value = arg.split("=", 1)
+        overrides[key] = value
+    else:
+        print("Malformed config override found!: ", arg)
+        sys.exit(-1)
+
+g_params = {}
+with open(config_file) as l_configFile:
+    for l_line in l_configFile:
+        l_tokens = l_line.split()
+        if len(l_tokens) > 1:
+            g_params[l_tokens[0]] = l_tokens[1]
+g_params["txnSchedulingPolicy"] = "FRFCFS"
+g_params.update(overrides)
+
+numCores = 4
+
+sst.setProgramOption("stop-at", g_params["stopAtCycle"])
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2 Ghz" })
+
+for core in range(numCores):
+    cpu = sst.Component("core%d" % core, "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : "10",
+        "rngseed" : str(101 + 200 * core),
+        "clock" : "2GHz",
+        "memSize" : "1MiB",
+        "verbose" : 0,
+        "maxOutstanding" : 16,
+        "opCount" : 5000,
+        "reqsPerIssue" : 4,
+        "write_freq" : 40,
+        "read_freq" : 60,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1 = sst.Component("l1cache%d" % core, "memHierarchy.Cache")
+    l1.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "2 Ghz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MSI",
+        "associativity" : "4",
+        "cache_line_size" : "64",
+        "cache_size" : "4 KB",
+        "L1" : "1",
+    })
+
+    link = sst.Link("link_cpu_l1_%d" % core)
+    link.connect( (iface, "lowlink", "1000ps"), (l1, "highlink", "1000ps") )
+    link = sst.Link("link_l1_bus_%d" % core)
+    link.connect( (l1, "lowlink", "1000ps"), (bus, "highlink%d" % core, "1000ps") )
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams({
+    "access_latency_cycles" : "10",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MSI",
+    "associativity" : "8",
+    "cache_line_size" : "64",
+    "cache_size" : "32 KB",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "request_width" : "64",
+    "addr_range_end" : 512*1024*1024-1,
+})
+backend = memctrl.setSubComponent("backend", "memHierarchy.cramsim")
+backend.addParams({
+    "access_time" : "2 ns",
+    "mem_size" : "512MiB",
+})
+
+bridge = sst.Component("memh_bridge", "cramSim.c_MemhBridge")
+bridge.addParams(g_params)
+bridge.addParams({ "numTxnPerCycle" : g_params["numChannels"] })
+
+controller = sst.Component("MemController0", "cramSim.c_Controller")
+controller.addParams(g_params)
+scheduler = controller.setSubComponent("TxnScheduler", "cramSim.c_BankTxnScheduler")
+scheduler.addParams(g_params)
+scheduler.addParams({ "numRequestors" : numCores + 1 })    # the L1s and the L2's writebacks
+for slot, name in [ ("TxnConverter", "c_TxnConverter"), ("AddrMapper", "c_AddressHasher"),
+                    ("CmdScheduler", "c_CmdScheduler"), ("DeviceDriver", "c_DeviceDriver") ]:
+    sub = controller.setSubComponent(slot, "cramSim." + name)
+    sub.addParams(g_params)
+
+dimm = sst.Component("Dimm0", "cramSim.c_Dimm")
+dimm.addParams(g_params)
+
+scheduler.enableAllStatistics()
+
+link = sst.Link("link_bus_l2")
+link.connect( (bus, "lowlink0", "1000ps"), (l2, "highlink", "1000ps") )
+link = sst.Link("link_l2_mem")
+link.connect( (l2, "lowlink", "1000ps"), (memctrl, "highlink", "1000ps") )
+link = sst.Link("link_mem_bridge")
+link.connect( (backend, "cramsim_link", "2ns"), (bridge, "cpuLink", "2ns") )
+link = sst.Link("link_bridge_controller")
+link.connect( (bridge, "memLink", g_params["clockCycle"]), (controller, "txngenLink", g_params["clockCycle"]) )
+link = sst.Link("link_controller_dimm")
+link.connect( (controller, "memLink", g_params["clockCycle"]), (dimm, "ctrlLink", g_params["clockCycle"]) )
@@ -4,6 +4,7 @@ from sst_unittest import *
 from sst_unittest_support import *
 
 import os
+import re
 import shutil
 
 
@@ -52,6 +53,101 @@ class testcase_cramSim_Component(SSTTestCase):
     def test_cramSim_6_W(self):
         self.cramSim_test_template("6_W")
 
+    def test_cramSim_clock_gating(self):
+        self.cramSim_clock_gating_template("1_RW")
+
+    def test_cramSim_bank_scheduler_FRFCFS(self):
+        self.cramSim_bank_scheduler_template("FRFCFS")
+
+    def test_cramSim_bank_scheduler_BLISS(self):
+        self.cramSim_bank_scheduler_template("BLISS")
+
+    def test_cramSim_bank_scheduler_PARBS(self):
+        self.cramSim_bank_scheduler_template("PARBS")
+
+#####
+
+    def cramSim_clock_gating_template(self, testcase):
+        # Runs the same trace with and without clock gating (refresh and power
+        # calculation enabled) and checks that the command traces and the
+        # reported power are identical
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        testcramSimDir = "{0}/testcramSim".format(tmpdir)
+        testcramSimTestsDir = "{0}/tests".format(testcramSimDir)
+
+        sdlfile    = "{0}/test_txntrace.py".format(testcramSimTestsDir)
+        tracefile  = "{0}/sst-CramSim-trace_verimem_{1}.trc".format(testcramSimTestsDir, testcase)
+        configfile = "{0}/ddr4_verimem.cfg".format(testcramSimDir)
+
+        # DDR3 currents from ddr3_power.cfg, ddr4_verimem.cfg has none
+        powerargs = "boolPowerCalc=1 VDD=1.5 IDD0=130 IDD2N=70 IDD3N=90 IDD4W=300 IDD4R=255 IDD5=305 numDevices=8"
+
+        cmdtraces = []
+        powerreports = []
+        for gating in [0, 1]:
+            testDataFileName = "test_cramSim_clock_gating_{0}_{1}".format(testcase, gating)
+            outfile  = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile  = "{0}/{1}.err".format(outdir, testDataFileName)
+            cmdtrace = "{0}/{1}.cmdtrace".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+            otherargs = '--model-options=\"--configfile={0} --traceFile={1} boolUseRefresh=1 boolPrintCmdTrace=1 strCmdTraceFile={2} boolClockGating={3} {4}\"'.format(configfile, tracefile, cmdtrace, gating, powerargs)
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+            cmdtraces.append(cmdtrace)
+
+            with open(outfile, 'r') as f:
+                powerreports.append([line for line in f if "Power (mW)" in line])
+
+        cmp_result = testing_compare_diff("test_cramSim_clock_gating_{0}".format(testcase), cmdtraces[1], cmdtraces[0])
+        self.assertTrue(cmp_result, "Command trace with clock gating {0} does not match trace without gating {1}".format(cmdtraces[1], cmdtraces[0]))
+
+        self.assertTrue(len(powerreports[0]) > 0, "No power report found in output without clock gating")
+        self.assertEqual(powerreports[1], powerreports[0], "Power reported with clock gating does not match power reported without gating")
+
+#####
+
+    def cramSim_bank_scheduler_template(self, policy):
+        # Four cores share memory through memHierarchy. Every L1 must show up
+        # as its own requestor in c_BankTxnScheduler's statistics, and the
+        # fairness policies must actually act on them
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        testcramSimDir = "{0}/testcramSim".format(tmpdir)
+        testcramSimTestsDir = "{0}/tests".format(testcramSimDir)
+
+        testDataFileName = "test_cramSim_bank_scheduler_{0}".format(policy)
+        sdlfile    = "{0}/test_memh_bankscheduler.py".format(testcramSimTestsDir)
+        configfile = "{0}/ddr4_verimem.cfg".format(testcramSimDir)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        otherargs = '--model-options=\"--configfile={0} txnSchedulingPolicy={1} blacklistThreshold=2 blacklistClearInterval=1000\"'.format(configfile, policy)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+        reads = {}
+        stats = {}
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = re.search(r"\.requestorReadsIssued\.(\d+) : Accumulator : Sum\.u64 = (\d+);", line)
+                if m:
+                    reads[int(m.group(1))] = int(m.group(2))
+                m = re.search(r"\.(blacklistings|batchesFormed) : Accumulator : Sum\.u64 = (\d+);", line)
+                if m:
+                    stats[m.group(1)] = int(m.group(2))
+
+        busy = [req for req in reads if reads[req] > 0]
+        self.assertTrue(len(busy) >= 4, "Expected reads from at least 4 requestors, found {0} in {1}".format(reads, outfile))
+
+        if policy == "BLISS":
+            self.assertTrue(stats.get("blacklistings", 0) > 0, "BLISS never blacklisted a requestor, see {0}".format(outfile))
+        if policy == "PARBS":
+            self.assertTrue(stats.get("batchesFormed", 0) > 0, "PAR-BS never formed a batch, see {0}".format(outfile))
+
 #####
 
     def cramSim_test_template(self, testcase):
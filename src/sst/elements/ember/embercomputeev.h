@@ -19,6 +19,7 @@
 
 #include "emberevent.h"
 #include "emberconstdistrib.h"
+#include "embertrace.h"
 
 namespace SST {
 namespace Ember {
@@ -60,6 +61,10 @@ public:
                 "distribution to give: %" PRIu64 "ns\n", m_completeDelayNS );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.compute( m_completeDelayNS );
+    }
+
 protected:
 	uint64_t m_nanoSecondDelay;
     EmberComputeDistribution* m_computeDistrib;
@@ -21,6 +21,7 @@
 #include "emberengine.h"
 #include "embergen.h"
 #include "embermotiflog.h"
+#include "embertrace.h"
 #include "libs/misc.h"
 
 using namespace std;
@@ -31,6 +32,7 @@ EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
     Component( id ),
 	currentMotif(0),
 	m_motifDone(false),
+	m_traceWriter(NULL),
 	m_detailedCompute(NULL)
 {
 	// Get the level of verbosity the user is asking to print out, default is 1
@@ -61,6 +63,8 @@ EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
     } else {
         m_motifLogger = nullptr;
     }
+
+    m_tracePrefix = params.find<std::string>("traceRecord", "");
 	output.verbose(CALL_INFO, 2, ENGINE_MASK, "\n");
 
 	// create a map of all the available API's
@@ -110,6 +114,8 @@ EmberEngine::~EmberEngine() {
 	if(NULL != m_motifLogger) {
 		delete m_motifLogger;
 	}
+
+	delete m_traceWriter;
 }
 
 EmberEngine::ApiMap EmberEngine::createApiMap( OS* os,
@@ -220,6 +226,13 @@ void EmberEngine::finish() {
     }
 
 	m_os->finish();
+
+    if ( m_traceWriter ) {
+        output.verbose(CALL_INFO, 1, ENGINE_MASK, "Trace: %" PRIu64 " records, %" PRIu64 " bytes\n",
+                m_traceWriter->numRecords(), m_traceWriter->numBytes() );
+        delete m_traceWriter;
+        m_traceWriter = NULL;
+    }
 }
 
 void EmberEngine::setup() {
@@ -243,6 +256,10 @@ void EmberEngine::setup() {
         m_motifLogger->setRank(m_os->getRank());
     }
 
+    if ( ! m_tracePrefix.empty() ) {
+        m_traceWriter = new EmberTraceWriter( &output, m_tracePrefix, m_os->getRank() );
+    }
+
 	// Prime the event queue
 	issueNextEvent(0);
 }
@@ -315,11 +332,21 @@ void EmberEngine::handleEvent(Event* ev) {
     output.debug(CALL_INFO, 2, ENGINE_MASK, "%s %s Event\n",
               eEv->stateName( eEv->state() ).c_str(), eEv->getName().c_str());
 
+    // Record calls before they are issued, issuing may release the request being waited on
+    if ( m_traceWriter && EmberEvent::Issue != eEv->state() && EmberEvent::Complete != eEv->state() ) {
+        eEv->trace( *m_traceWriter );
+    }
+
     switch ( eEv->state() ) {
       case EmberEvent::Issue:
 
         eEv->issue( getCurrentSimTimeNano() );
 
+        // The compute time is only known once the event has been issued
+        if ( m_traceWriter ) {
+            eEv->trace( *m_traceWriter );
+        }
+
 	    selfEventLink->send( eEv->completeDelayNS() * 1000, ev );
         break;
 
@@ -34,6 +34,7 @@ namespace SST {
 namespace Ember {
 
 class EmberEvent;
+class EmberTraceWriter;
 
 class EmberEngine : public SST::Component {
 public:
@@ -54,6 +55,7 @@ public:
         { "motif_count", "Sets the number of motifs which will be run in this simulation, default is 1", "1"},
         { "rankmapper", "Sets the rank mapping SST module to load to rank translations, default is linear mapping", "ember.LinearMap" },
         { "mapFile", "Sets the name of the input file for custom map", "mapFile.txt" },
+        { "traceRecord", "Sets a file prefix, each rank writes its message passing calls to <prefix>.<rank>.etr for replay by ember.TraceReplayMotif, empty = no trace", "" },
 
         { "motif%(motif_count)d", "Sets the event generator or motif for the engine", "ember.EmberPingPongGenerator" },
     )
@@ -147,6 +149,8 @@ private:
 	SST::Link*          selfEventLink;
 	SST::TimeConverter* nanoTimeConverter;
 	EmberMotifLog*      m_motifLogger;
+	std::string         m_tracePrefix;
+	EmberTraceWriter*   m_traceWriter;
 
 	std::vector<SST::Params> motifParams;
 	Thornhill::DetailedCompute* m_detailedCompute;
@@ -43,6 +43,8 @@ typedef Hermes::Callback Callback;
 
 typedef Statistic<uint32_t> EmberEventTimeStatistic;
 
+class EmberTraceWriter;
+
 class EmberEvent : public SST::Event {
 
 public:
@@ -112,6 +114,9 @@ public:
         return m_completeDelayNS;
     }
 
+    /* Record this event in a call trace, events that are not recorded do nothing */
+    virtual void trace( EmberTraceWriter& ) {}
+
 
   protected:
     static const char*  m_enumName[];
@@ -0,0 +1,545 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string.h>
+
+#include "embertrace.h"
+
+using namespace SST;
+using namespace SST::Ember;
+
+static const char   traceMagic[4] = { 'E', 'T', 'R', 'C' };
+static const size_t traceHeaderSize = 12;
+static const size_t traceFlushSize = 64 * 1024;
+
+std::string SST::Ember::emberTraceFileName( const std::string& prefix, int rank )
+{
+    return prefix + "." + std::to_string( rank ) + ".etr";
+}
+
+EmberTraceWriter::EmberTraceWriter( Output* output, const std::string& prefix, int rank ) :
+    m_output( output ),
+    m_rank( rank ),
+    m_lastCount( 0 ),
+    m_lastCompute( 0 ),
+    m_numRecords( 0 ),
+    m_numBytes( 0 ),
+    m_numSlots( 0 )
+{
+    std::string fileName = emberTraceFileName( prefix, rank );
+
+    m_file = fopen( fileName.c_str(), "wb" );
+    if ( NULL == m_file ) {
+        m_output->fatal( CALL_INFO, -1, "Error: could not open trace file %s for writing\n", fileName.c_str() );
+    }
+
+    m_buffer.reserve( traceFlushSize + 256 );
+    m_buffer.insert( m_buffer.end(), traceMagic, traceMagic + 4 );
+    for ( int i = 0; i < 4; i++ ) {
+        m_buffer.push_back( ( EmberTraceVersion >> ( 8 * i ) ) & 0xff );
+    }
+    for ( int i = 0; i < 4; i++ ) {
+        m_buffer.push_back( ( (uint32_t) rank >> ( 8 * i ) ) & 0xff );
+    }
+}
+
+EmberTraceWriter::~EmberTraceWriter()
+{
+    flush();
+    fclose( m_file );
+}
+
+void EmberTraceWriter::flush()
+{
+    if ( m_buffer.empty() ) {
+        return;
+    }
+    if ( fwrite( &m_buffer[0], 1, m_buffer.size(), m_file ) != m_buffer.size() ) {
+        m_output->fatal( CALL_INFO, -1, "Error: failed to write trace for rank %d\n", m_rank );
+    }
+    m_numBytes += m_buffer.size();
+    m_buffer.clear();
+}
+
+void EmberTraceWriter::op( EmberTraceOp op )
+{
+    if ( m_buffer.size() >= traceFlushSize ) {
+        flush();
+    }
+    m_buffer.push_back( op );
+    ++m_numRecords;
+}
+
+void EmberTraceWriter::putVar( uint64_t value )
+{
+    while ( value >= 0x80 ) {
+        m_buffer.push_back( ( value & 0x7f ) | 0x80 );
+        value >>= 7;
+    }
+    m_buffer.push_back( value );
+}
+
+void EmberTraceWriter::putCount( uint32_t count )
+{
+    putSigned( (int64_t) count - m_lastCount );
+    m_lastCount = count;
+}
+
+void EmberTraceWriter::putArray( const int* array, int length )
+{
+    int64_t last = 0;
+    for ( int i = 0; i < length; i++ ) {
+        putSigned( (int64_t) array[i] - last );
+        last = array[i];
+    }
+}
+
+uint32_t EmberTraceWriter::slot( MessageRequest* req )
+{
+    std::map<MessageRequest*, uint32_t>::iterator iter = m_slots.find( req );
+    if ( iter != m_slots.end() ) {
+        return iter->second;
+    }
+
+    uint32_t slot;
+    if ( m_freeSlots.empty() ) {
+        slot = m_numSlots++;
+    } else {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    m_slots[req] = slot;
+    return slot;
+}
+
+void EmberTraceWriter::release( MessageRequest* req )
+{
+    std::map<MessageRequest*, uint32_t>::iterator iter = m_slots.find( req );
+    if ( iter != m_slots.end() ) {
+        m_freeSlots.push_back( iter->second );
+        m_slots.erase( iter );
+    }
+}
+
+int EmberTraceWriter::size( Communicator comm )
+{
+    std::map<Communicator, int*>::iterator iter = m_commSizePtrs.find( comm );
+    if ( iter != m_commSizePtrs.end() && *iter->second > 0 ) {
+        return *iter->second;
+    }
+    for ( size_t i = 0; i < m_createdComms.size(); i++ ) {
+        if ( *m_createdComms[i].first == comm ) {
+            return m_createdComms[i].second;
+        }
+    }
+    m_output->fatal( CALL_INFO, -1, "Error: rank %d cannot trace count arrays on communicator %" PRIu32 " of unknown size\n",
+            m_rank, comm );
+    return 0;
+}
+
+void EmberTraceWriter::compute( uint64_t nanoDelay )
+{
+    op( TraceCompute );
+    putSigned( (int64_t) nanoDelay - m_lastCompute );
+    m_lastCompute = nanoDelay;
+}
+
+void EmberTraceWriter::send( EmberTraceOp code, RankID peer, uint32_t count, PayloadDataType dtype, uint32_t tag, Communicator comm )
+{
+    op( code );
+    putSigned( (int64_t) peer - m_rank );
+    putCount( count );
+    putVar( dtype );
+    putVar( tag );
+    putVar( comm );
+}
+
+void EmberTraceWriter::isend( EmberTraceOp code, RankID peer, uint32_t count, PayloadDataType dtype, uint32_t tag, Communicator comm,
+            MessageRequest* req )
+{
+    send( code, peer, count, dtype, tag, comm );
+    putVar( slot( req ) );
+}
+
+void EmberTraceWriter::wait( MessageRequest* req )
+{
+    op( TraceWait );
+    putVar( slot( req ) );
+    release( req );
+}
+
+void EmberTraceWriter::waitall( EmberTraceOp code, int count, MessageRequest* req )
+{
+    op( code );
+    putVar( count );
+    for ( int i = 0; i < count; i++ ) {
+        putVar( slot( &req[i] ) );
+    }
+    // Released in reverse so the next batch of requests gets the same slots
+    if ( TraceWaitall == code ) {
+        for ( int i = count - 1; i >= 0; i-- ) {
+            release( &req[i] );
+        }
+    }
+}
+
+void EmberTraceWriter::test( MessageRequest* req )
+{
+    op( TraceTest );
+    putVar( slot( req ) );
+}
+
+void EmberTraceWriter::barrier( Communicator comm )
+{
+    op( TraceBarrier );
+    putVar( comm );
+}
+
+void EmberTraceWriter::bcast( uint32_t count, PayloadDataType dtype, int root, Communicator comm )
+{
+    op( TraceBcast );
+    putCount( count );
+    putVar( dtype );
+    putSigned( (int64_t) root - m_rank );
+    putVar( comm );
+}
+
+void EmberTraceWriter::reduce( EmberTraceOp code, uint32_t count, PayloadDataType dtype, ReductionOperation rop, int root, Communicator comm )
+{
+    op( code );
+    putCount( count );
+    putVar( dtype );
+    putVar( rop->type );
+    if ( TraceReduce == code ) {
+        putSigned( (int64_t) root - m_rank );
+    }
+    putVar( comm );
+}
+
+void EmberTraceWriter::alltoall( EmberTraceOp code, uint32_t sendCnt, PayloadDataType sendType, uint32_t recvCnt, PayloadDataType recvType,
+            Communicator comm )
+{
+    op( code );
+    putCount( sendCnt );
+    putVar( sendType );
+    putCount( recvCnt );
+    putVar( recvType );
+    putVar( comm );
+}
+
+void EmberTraceWriter::alltoallv( const int* sendCnts, const int* sendDsp, PayloadDataType sendType,
+            const int* recvCnts, const int* recvDsp, PayloadDataType recvType, Communicator comm )
+{
+    int length = size( comm );
+
+    op( TraceAlltoallv );
+    putVar( sendType );
+    putVar( recvType );
+    putVar( comm );
+    putVar( length );
+    putArray( sendCnts, length );
+    putArray( sendDsp, length );
+    putArray( recvCnts, length );
+    putArray( recvDsp, length );
+}
+
+void EmberTraceWriter::allgatherv( uint32_t sendCnt, PayloadDataType sendType,
+            const int* recvCnts, const int* recvDsp, PayloadDataType recvType, Communicator comm )
+{
+    int length = size( comm );
+
+    op( TraceAllgatherv );
+    putCount( sendCnt );
+    putVar( sendType );
+    putVar( recvType );
+    putVar( comm );
+    putVar( length );
+    putArray( recvCnts, length );
+    putArray( recvDsp, length );
+}
+
+void EmberTraceWriter::scatter( uint32_t sendCnt, PayloadDataType sendType, uint32_t recvCnt, PayloadDataType recvType, int root,
+            Communicator comm )
+{
+    op( TraceScatter );
+    putCount( sendCnt );
+    putVar( sendType );
+    putCount( recvCnt );
+    putVar( recvType );
+    putSigned( (int64_t) root - m_rank );
+    putVar( comm );
+}
+
+void EmberTraceWriter::commSplit( Communicator oldComm, int color, int key )
+{
+    op( TraceCommSplit );
+    putVar( oldComm );
+    putSigned( color );
+    putSigned( key );
+}
+
+void EmberTraceWriter::commCreate( Communicator oldComm, const std::vector<int>& ranks, Communicator* newComm )
+{
+    op( TraceCommCreate );
+    putVar( oldComm );
+    putVar( ranks.size() );
+    putArray( ranks.empty() ? NULL : &ranks[0], ranks.size() );
+
+    m_createdComms.push_back( std::make_pair( newComm, (int) ranks.size() ) );
+}
+
+void EmberTraceWriter::commDestroy( Communicator comm )
+{
+    op( TraceCommDestroy );
+    putVar( comm );
+}
+
+void EmberTraceWriter::commSize( Communicator comm, int* size )
+{
+    m_commSizePtrs[comm] = size;
+}
+
+
+EmberTraceReader::EmberTraceReader( Output* output, const std::string& prefix, int rank ) :
+    m_output( output ),
+    m_fileName( emberTraceFileName( prefix, rank ) ),
+    m_data( NULL ),
+    m_length( 0 ),
+    m_pos( traceHeaderSize ),
+    m_rank( rank ),
+    m_lastCount( 0 ),
+    m_lastCompute( 0 ),
+    m_numRecords( 0 )
+{
+    int fd = open( m_fileName.c_str(), O_RDONLY );
+    if ( fd < 0 ) {
+        m_output->fatal( CALL_INFO, -1, "Error: could not open trace file %s\n", m_fileName.c_str() );
+    }
+
+    struct stat info;
+    if ( fstat( fd, &info ) != 0 || (size_t) info.st_size < traceHeaderSize ) {
+        m_output->fatal( CALL_INFO, -1, "Error: trace file %s is truncated\n", m_fileName.c_str() );
+    }
+    m_length = info.st_size;
+
+    void* map = mmap( NULL, m_length, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( MAP_FAILED == map ) {
+        m_output->fatal( CALL_INFO, -1, "Error: could not map trace file %s\n", m_fileName.c_str() );
+    }
+    m_data = (const uint8_t*) map;
+    madvise( map, m_length, MADV_SEQUENTIAL );
+
+    uint32_t version = 0, fileRank = 0;
+    for ( int i = 0; i < 4; i++ ) {
+        version |= (uint32_t) m_data[4 + i] << ( 8 * i );
+        fileRank |= (uint32_t) m_data[8 + i] << ( 8 * i );
+    }
+    if ( memcmp( m_data, traceMagic, 4 ) != 0 || version != EmberTraceVersion ) {
+        m_output->fatal( CALL_INFO, -1, "Error: %s is not a version %" PRIu32 " ember trace\n", m_fileName.c_str(), EmberTraceVersion );
+    }
+    if ( (int) fileRank != rank ) {
+        m_output->fatal( CALL_INFO, -1, "Error: trace file %s was recorded by rank %" PRIu32 "\n", m_fileName.c_str(), fileRank );
+    }
+}
+
+EmberTraceReader::~EmberTraceReader()
+{
+    if ( m_data ) {
+        munmap( (void*) m_data, m_length );
+    }
+}
+
+uint64_t EmberTraceReader::getVar()
+{
+    uint64_t value = 0;
+    for ( int shift = 0; shift < 64; shift += 7 ) {
+        if ( m_pos == m_length ) {
+            m_output->fatal( CALL_INFO, -1, "Error: trace file %s ends inside a record\n", m_fileName.c_str() );
+        }
+        uint8_t byte = m_data[m_pos++];
+        value |= (uint64_t) ( byte & 0x7f ) << shift;
+        if ( ! ( byte & 0x80 ) ) {
+            break;
+        }
+    }
+    return value;
+}
+
+uint32_t EmberTraceReader::getCount()
+{
+    m_lastCount += getSigned();
+    return m_lastCount;
+}
+
+void EmberTraceReader::getArray( std::vector<int>& array )
+{
+    int64_t last = 0;
+    for ( size_t i = 0; i < array.size(); i++ ) {
+        last += getSigned();
+        array[i] = last;
+    }
+}
+
+static ReductionOperation reductionOp( uint64_t type )
+{
+    switch ( type ) {
+      case Nop: return MP::NOP;
+      case Min: return MP::MIN;
+      case Max: return MP::MAX;
+      // User functions are not recorded, any operation has the same cost
+      default:  return MP::SUM;
+    }
+}
+
+bool EmberTraceReader::next( Record& rec )
+{
+    if ( m_pos == m_length ) {
+        return false;
+    }
+
+    uint8_t code = m_data[m_pos++];
+    if ( code == 0 || code >= TraceNumOps ) {
+        m_output->fatal( CALL_INFO, -1, "Error: invalid record %u at offset %zu of %s\n", code, m_pos - 1, m_fileName.c_str() );
+    }
+    rec.op = (EmberTraceOp) code;
+    ++m_numRecords;
+
+    switch ( rec.op ) {
+      case TraceCompute:
+        m_lastCompute += getSigned();
+        rec.nanoDelay = m_lastCompute;
+        break;
+
+      case TraceSend:
+      case TraceRecv:
+      case TraceIsend:
+      case TraceIrecv:
+        rec.peer = m_rank + getSigned();
+        rec.count = getCount();
+        rec.dtype = (PayloadDataType) getVar();
+        rec.tag = getVar();
+        rec.comm = getVar();
+        if ( TraceIsend == rec.op || TraceIrecv == rec.op ) {
+            rec.slots.assign( 1, getVar() );
+        }
+        break;
+
+      case TraceWait:
+      case TraceTest:
+        rec.slots.assign( 1, getVar() );
+        break;
+
+      case TraceWaitall:
+      case TraceWaitany:
+      case TraceTestany:
+        rec.slots.resize( getVar() );
+        for ( size_t i = 0; i < rec.slots.size(); i++ ) {
+            rec.slots[i] = getVar();
+        }
+        break;
+
+      case TraceBarrier:
+      case TraceCommDestroy:
+        rec.comm = getVar();
+        break;
+
+      case TraceBcast:
+        rec.count = getCount();
+        rec.dtype = (PayloadDataType) getVar();
+        rec.root = m_rank + getSigned();
+        rec.comm = getVar();
+        break;
+
+      case TraceReduce:
+      case TraceAllreduce:
+        rec.count = getCount();
+        rec.dtype = (PayloadDataType) getVar();
+        rec.rop = reductionOp( getVar() );
+        if ( TraceReduce == rec.op ) {
+            rec.root = m_rank + getSigned();
+        }
+        rec.comm = getVar();
+        break;
+
+      case TraceAlltoall:
+      case TraceAllgather:
+        rec.count = getCount();
+        rec.dtype = (PayloadDataType) getVar();
+        rec.recvCount = getCount();
+        rec.recvType = (PayloadDataType) getVar();
+        rec.comm = getVar();
+        break;
+
+      case TraceAlltoallv:
+        rec.dtype = (PayloadDataType) getVar();
+        rec.recvType = (PayloadDataType) getVar();
+        rec.comm = getVar();
+        {
+            size_t length = getVar();
+            for ( int i = 0; i < 4; i++ ) {
+                rec.arrays[i].resize( length );
+                getArray( rec.arrays[i] );
+            }
+        }
+        break;
+
+      case TraceAllgatherv:
+        rec.count = getCount();
+        rec.dtype = (PayloadDataType) getVar();
+        rec.recvType = (PayloadDataType) getVar();
+        rec.comm = getVar();
+        {
+            size_t length = getVar();
+            for ( int i = 2; i < 4; i++ ) {
+                rec.arrays[i].resize( length );
+                getArray( rec.arrays[i] );
+            }
+        }
+        break;
+
+      case TraceScatter:
+        rec.count = getCount();
+        rec.dtype = (PayloadDataType) getVar();
+        rec.recvCount = getCount();
+        rec.recvType = (PayloadDataType) getVar();
+        rec.root = m_rank + getSigned();
+        rec.comm = getVar();
+        break;
+
+      case TraceCommSplit:
+        rec.comm = getVar();
+        rec.color = getSigned();
+        rec.key = getSigned();
+        break;
+
+      case TraceCommCreate:
+        rec.comm = getVar();
+        rec.arrays[0].resize( getVar() );
+        getArray( rec.arrays[0] );
+        break;
+
+      case TraceNumOps:
+        break;
+    }
+
+    return true;
+}
@@ -0,0 +1,194 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_EMBER_TRACE
+#define _H_EMBER_TRACE
+
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sst/core/output.h>
+#include <sst/elements/hermes/msgapi.h>
+
+using namespace Hermes;
+using namespace Hermes::MP;
+
+namespace SST {
+namespace Ember {
+
+/*
+ * Binary trace of the Hermes message passing calls issued by one rank.
+ *
+ * File: <prefix>.<rank>.etr
+ *   header:  "ETRC", uint32 version, uint32 rank (little endian)
+ *   records: uint8 opcode followed by LEB128 varints
+ *
+ * Fields are delta encoded to keep records small:
+ *   - peers and roots are relative to the recording rank (zigzag)
+ *   - counts are relative to the previous count in the trace (zigzag)
+ *   - compute times are relative to the previous compute time (zigzag)
+ *   - count/displacement arrays are relative to the previous element (zigzag)
+ * Requests are small slot numbers, reused once a wait completes them.
+ * Communicators are recorded by value, so replay relies on communicator
+ * creation returning the same handles in the same order.
+ * Buffers and user-defined reduction functions are not recorded.
+ */
+enum EmberTraceOp {
+    TraceCompute = 1,
+    TraceSend,
+    TraceRecv,
+    TraceIsend,
+    TraceIrecv,
+    TraceWait,
+    TraceWaitall,
+    TraceWaitany,
+    TraceTest,
+    TraceTestany,
+    TraceBarrier,
+    TraceBcast,
+    TraceReduce,
+    TraceAllreduce,
+    TraceAlltoall,
+    TraceAlltoallv,
+    TraceAllgather,
+    TraceAllgatherv,
+    TraceScatter,
+    TraceCommSplit,
+    TraceCommCreate,
+    TraceCommDestroy,
+    TraceNumOps
+};
+
+static const uint32_t EmberTraceVersion = 1;
+
+std::string emberTraceFileName( const std::string& prefix, int rank );
+
+class EmberTraceWriter {
+  public:
+    EmberTraceWriter( Output* output, const std::string& prefix, int rank );
+    ~EmberTraceWriter();
+
+    void compute( uint64_t nanoDelay );
+    void send( EmberTraceOp op, RankID peer, uint32_t count, PayloadDataType dtype, uint32_t tag, Communicator comm );
+    void isend( EmberTraceOp op, RankID peer, uint32_t count, PayloadDataType dtype, uint32_t tag, Communicator comm,
+                MessageRequest* req );
+    void wait( MessageRequest* req );
+    void waitall( EmberTraceOp op, int count, MessageRequest* req );
+    void test( MessageRequest* req );
+    void barrier( Communicator comm );
+    void bcast( uint32_t count, PayloadDataType dtype, int root, Communicator comm );
+    void reduce( EmberTraceOp op, uint32_t count, PayloadDataType dtype, ReductionOperation rop, int root, Communicator comm );
+    void alltoall( EmberTraceOp op, uint32_t sendCnt, PayloadDataType sendType, uint32_t recvCnt, PayloadDataType recvType,
+                Communicator comm );
+    void alltoallv( const int* sendCnts, const int* sendDsp, PayloadDataType sendType,
+                const int* recvCnts, const int* recvDsp, PayloadDataType recvType, Communicator comm );
+    void allgatherv( uint32_t sendCnt, PayloadDataType sendType,
+                const int* recvCnts, const int* recvDsp, PayloadDataType recvType, Communicator comm );
+    void scatter( uint32_t sendCnt, PayloadDataType sendType, uint32_t recvCnt, PayloadDataType recvType, int root,
+                Communicator comm );
+    void commSplit( Communicator oldComm, int color, int key );
+    void commCreate( Communicator oldComm, const std::vector<int>& ranks, Communicator* newComm );
+    void commDestroy( Communicator comm );
+
+    /* Size of a communicator, needed to record count arrays */
+    void commSize( Communicator comm, int* size );
+
+    uint64_t numRecords() const { return m_numRecords; }
+    uint64_t numBytes() const { return m_numBytes + m_buffer.size(); }
+
+  private:
+    void op( EmberTraceOp op );
+    void putVar( uint64_t value );
+    void putSigned( int64_t value ) { putVar( ( (uint64_t) value << 1 ) ^ (uint64_t) ( value >> 63 ) ); }
+    void putCount( uint32_t count );
+    void putArray( const int* array, int length );
+    uint32_t slot( MessageRequest* req );
+    void release( MessageRequest* req );
+    int size( Communicator comm );
+    void flush();
+
+    Output*     m_output;
+    FILE*       m_file;
+    int         m_rank;
+    int64_t     m_lastCount;
+    int64_t     m_lastCompute;
+    uint64_t    m_numRecords;
+    uint64_t    m_numBytes;
+    std::vector<uint8_t> m_buffer;
+
+    std::map<MessageRequest*, uint32_t> m_slots;
+    std::vector<uint32_t>               m_freeSlots;
+    uint32_t                            m_numSlots;
+
+    /* Communicator sizes, resolved when first needed since handles are only valid once created */
+    std::map<Communicator, int*>                m_commSizePtrs;
+    std::vector<std::pair<Communicator*, int> > m_createdComms;
+};
+
+/*
+ * Sequential reader over a memory-mapped trace. Only the record being
+ * decoded is copied out, so memory use does not grow with the trace.
+ */
+class EmberTraceReader {
+  public:
+    struct Record {
+        EmberTraceOp        op;
+        RankID              peer;
+        int                 root;
+        uint32_t            count;
+        uint32_t            recvCount;
+        uint32_t            tag;
+        PayloadDataType     dtype;
+        PayloadDataType     recvType;
+        ReductionOperation  rop;
+        Communicator        comm;
+        int                 color;
+        int                 key;
+        uint64_t            nanoDelay;
+        std::vector<uint32_t>   slots;
+        std::vector<int>        arrays[4];
+    };
+
+    EmberTraceReader( Output* output, const std::string& prefix, int rank );
+    ~EmberTraceReader();
+
+    /* Decode the next record, returns false at the end of the trace */
+    bool next( Record& record );
+
+    uint64_t numRecords() const { return m_numRecords; }
+
+  private:
+    uint64_t getVar();
+    int64_t getSigned() { uint64_t v = getVar(); return (int64_t) ( v >> 1 ) ^ -(int64_t) ( v & 1 ); }
+    uint32_t getCount();
+    void getArray( std::vector<int>& array );
+
+    Output*         m_output;
+    std::string     m_fileName;
+    const uint8_t*  m_data;
+    size_t          m_length;
+    size_t          m_pos;
+    int             m_rank;
+    int64_t         m_lastCount;
+    int64_t         m_lastCompute;
+    uint64_t        m_numRecords;
+};
+
+}
+}
+
+#endif
@@ -44,6 +44,10 @@ public:
                                                     m_newComm, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.commCreate( m_oldComm, m_ranks, m_newComm );
+    }
+
 private:
 	Communicator m_oldComm;
     std::vector<int>& m_ranks;
@@ -41,6 +41,10 @@ public:
         m_api.comm_destroy( m_comm, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.commDestroy( m_comm );
+    }
+
 private:
 	Communicator m_comm;
 };
@@ -45,6 +45,10 @@ public:
         m_api.comm_split( m_oldComm, m_color, m_key, m_newComm, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.commSplit( m_oldComm, m_color, m_key );
+    }
+
 
 private:
 	Communicator m_oldComm;
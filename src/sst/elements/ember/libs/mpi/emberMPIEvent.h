@@ -19,6 +19,7 @@
 
 #include <sst/core/statapi/statbase.h>
 #include "emberevent.h"
+#include "embertrace.h"
 
 using namespace Hermes;
 using namespace Hermes::MP;
@@ -56,6 +56,10 @@ public:
                       m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.allgatherv( m_sendcnts, m_senddtype, (int*) m_recvcnts, (int*) m_recvdsp, m_recvdtype, m_group );
+    }
+
 private:
     Hermes::MemAddr     m_senddata;
     int                 m_sendcnts;
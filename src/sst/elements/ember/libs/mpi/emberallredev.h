@@ -51,6 +51,10 @@ public:
                                                     m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.reduce( TraceAllreduce, m_count, m_dtype, m_op, 0, m_group );
+    }
+
 private:
     Hermes::MemAddr     m_mydata;
     Hermes::MemAddr     m_result;
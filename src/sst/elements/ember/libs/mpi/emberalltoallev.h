@@ -54,6 +54,10 @@ public:
                         m_recvdata, m_recvcnts, m_recvdtype, m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.alltoall( TraceAlltoall, m_sendcnts, m_senddtype, m_recvcnts, m_recvdtype, m_group );
+    }
+
 private:
     Hermes::MemAddr     m_senddata;
     int                 m_sendcnts;
@@ -57,6 +57,11 @@ public:
                                                     m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.alltoallv( (int*) m_sendcnts, (int*) m_senddsp, m_senddtype,
+                (int*) m_recvcnts, (int*) m_recvdsp, m_recvdtype, m_group );
+    }
+
 private:
     Hermes::MemAddr     m_senddata;
     Addr                m_sendcnts;
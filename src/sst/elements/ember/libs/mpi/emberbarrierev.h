@@ -40,6 +40,10 @@ class EmberBarrierEvent : public EmberMPIEvent {
         m_api.barrier( m_comm, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.barrier( m_comm );
+    }
+
   private:
     Communicator m_comm;
 };
@@ -48,6 +48,10 @@ public:
         m_api.bcast( m_mydata, m_count, m_dtype, m_root, m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.bcast( m_count, m_dtype, m_root, m_group );
+    }
+
 private:
     Hermes::MemAddr     m_mydata;
     uint32_t            m_count;
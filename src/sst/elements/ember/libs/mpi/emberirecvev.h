@@ -52,6 +52,10 @@ public:
                                                     m_group, m_req, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.isend( TraceIrecv, m_dest, m_count, m_dtype, m_tag, m_group, m_req );
+    }
+
 protected:
     Hermes::MemAddr m_payload;
     uint32_t        m_count;
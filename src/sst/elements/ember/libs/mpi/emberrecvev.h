@@ -50,6 +50,10 @@ class EmberRecvEvent : public EmberMPIEvent {
                                                     m_group, m_resp, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.send( TraceRecv, m_src, m_count, m_dtype, m_tag, m_group );
+    }
+
 	~EmberRecvEvent() {}
 
   private:
@@ -50,6 +50,10 @@ public:
                                          m_root, m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.reduce( TraceReduce, m_count, m_dtype, m_op, m_root, m_group );
+    }
+
 	~EmberReduceEvent() {}
 
 private:
@@ -50,6 +50,10 @@ public:
         m_api.scatter( m_sendData, m_sendCnt, m_sendDtype, m_recvData, m_recvCnt, m_recvDtype, m_root, m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.scatter( m_sendCnt, m_sendDtype, m_recvCnt, m_recvDtype, m_root, m_group );
+    }
+
 private:
     Hermes::MemAddr     m_sendData;
     uint32_t            m_sendCnt;
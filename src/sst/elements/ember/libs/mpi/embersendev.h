@@ -51,6 +51,10 @@ class EmberSendEvent : public EmberMPIEvent {
                                                     m_group, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.send( TraceSend, m_dest, m_count, m_dtype, m_tag, m_group );
+    }
+
 
   private:
     Hermes::MemAddr m_payload;
@@ -44,6 +44,10 @@ public:
         m_api.size( m_comm, m_sizePtr, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.commSize( m_comm, m_sizePtr );
+    }
+
 private:
     Communicator m_comm;
     int*         m_sizePtr;
@@ -49,6 +49,10 @@ public:
        	m_api.testany( m_cnt, m_req, m_indx, m_flag, m_respPtr, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.waitall( TraceTestany, m_cnt, m_req );
+    }
+
 private:
     MessageRequest* 	m_req;
 	MessageResponse*	m_respPtr;
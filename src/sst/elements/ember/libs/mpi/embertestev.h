@@ -45,6 +45,10 @@ public:
        	m_api.test( *m_req, m_flag, m_respPtr, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.test( m_req );
+    }
+
 private:
     MessageRequest*		m_req;
 	int*				m_flag;
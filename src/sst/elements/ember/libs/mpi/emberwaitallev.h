@@ -45,6 +45,10 @@ public:
         m_api.waitall( m_count, m_req, m_resp, functor );
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.waitall( TraceWaitall, m_count, m_req );
+    }
+
 private:
     int m_count;
     MessageRequest* m_req;
@@ -45,6 +45,10 @@ class EmberWaitanyEvent : public EmberMPIEvent {
         	m_api.waitany( m_count, m_req, m_indx, m_resp, functor );
     	}
 
+    	void trace( EmberTraceWriter& writer ) {
+        	writer.waitall( TraceWaitany, m_count, m_req );
+    	}
+
 	private:
 		MessageRequest* m_req;
 		MessageResponse* m_resp;
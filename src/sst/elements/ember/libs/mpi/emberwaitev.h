@@ -48,6 +48,10 @@ public:
 		}
     }
 
+    void trace( EmberTraceWriter& writer ) {
+        writer.wait( m_req );
+    }
+
 private:
     MessageRequest* 	m_req;
 	MessageResponse*	m_respPtr;
@@ -51,3 +51,67 @@ EmberMessagePassingGenerator::~EmberMessagePassingGenerator()
 {
     verbose(CALL_INFO, 2, 0, "\n");
 }
+
+bool EmberMessagePassingGenerator::enQ_program( Queue& evQ, EmberProgramCursor& cursor )
+{
+    const EmberEventProgram& program = cursor.program();
+    const size_t start = evQ.size();
+    bool blocking = false;
+
+    while ( ! cursor.done() && ! blocking ) {
+        const EmberEventProgram::Op& op = program.op( cursor.pc() );
+
+        if ( cursor.peerActive( op.peer ) ) {
+            blocking = true;
+
+            switch ( op.opcode ) {
+              case EmberEventProgram::Compute:
+                enQ_compute( evQ, op.nanoDelay );
+                break;
+              case EmberEventProgram::GetTime:
+                enQ_getTime( evQ, cursor.time( op.slot ) );
+                blocking = false;
+                break;
+              case EmberEventProgram::Irecv:
+                enQ_irecv( evQ, NULL, op.count, op.dtype, cursor.peer( op.peer ), op.tag,
+                                cursor.comm( op.comm ), cursor.request( op.slot ) );
+                blocking = false;
+                break;
+              case EmberEventProgram::Isend:
+                enQ_isend( evQ, NULL, op.count, op.dtype, cursor.peer( op.peer ), op.tag,
+                                cursor.comm( op.comm ), cursor.request( op.slot ) );
+                blocking = false;
+                break;
+              case EmberEventProgram::Send:
+                enQ_send( evQ, NULL, op.count, op.dtype, cursor.peer( op.peer ), op.tag, cursor.comm( op.comm ) );
+                break;
+              case EmberEventProgram::Recv:
+                enQ_recv( evQ, NULL, op.count, op.dtype, cursor.peer( op.peer ), op.tag, cursor.comm( op.comm ) );
+                break;
+              case EmberEventProgram::Wait:
+                enQ_wait( evQ, cursor.request( op.slot ) );
+                break;
+              case EmberEventProgram::Barrier:
+                enQ_barrier( evQ, cursor.comm( op.comm ) );
+                break;
+              case EmberEventProgram::Allreduce:
+                enQ_allreduce( evQ, NULL, NULL, op.count, op.dtype, op.op, cursor.comm( op.comm ) );
+                break;
+              case EmberEventProgram::Alltoallv:
+                enQ_alltoallv( evQ,
+                        NULL, (Addr) program.array( op.array ), (Addr) program.array( op.array + 1 ), op.dtype,
+                        NULL, (Addr) program.array( op.array + 2 ), (Addr) program.array( op.array + 3 ), op.dtype,
+                        cursor.comm( op.comm ) );
+                break;
+            }
+        }
+
+        // Stop at the end of an iteration, unless every op in it was skipped;
+        // the engine takes an empty queue to mean the motif is done
+        if ( cursor.advance() && evQ.size() > start ) {
+            break;
+        }
+    }
+
+    return cursor.done();
+}
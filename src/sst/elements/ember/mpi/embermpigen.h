@@ -18,6 +18,7 @@
 
 #include "embergen.h"
 #include "libs/emberMpiLib.h"
+#include "mpi/emberprogram.h"
 
 namespace SST {
 namespace Ember {
@@ -126,6 +127,11 @@ protected:
 
 	EmberRankMap* getRankMap() { return m_rankMap; }
 
+	// Enqueue the ops of a shared program up to and including the next
+	// blocking one, or up to the end of the iteration. Returns true once
+	// the cursor has run all iterations.
+	bool enQ_program( Queue& evQ, EmberProgramCursor& cursor );
+
 	void memSetBacked() {
 		EmberGenerator::memSetBacked();
 		mpi().setBacked();
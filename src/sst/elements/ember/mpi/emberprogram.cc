@@ -0,0 +1,194 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "emberprogram.h"
+
+using namespace SST::Ember;
+
+std::mutex EmberProgramCache::s_lock;
+std::map<std::string, std::weak_ptr<const EmberEventProgram> > EmberProgramCache::s_programs;
+
+EmberEventProgram::Op& EmberEventProgram::push( Opcode opcode )
+{
+    Op op;
+    op.opcode = opcode;
+    op.peer = -1;
+    op.comm = -1;
+    op.slot = -1;
+    op.count = 0;
+    op.tag = 0;
+    op.dtype = CHAR;
+    op.op = NULL;
+    op.nanoDelay = 0;
+    op.array = 0;
+    m_ops.push_back( op );
+    return m_ops.back();
+}
+
+void EmberEventProgram::compute( uint64_t nanoDelay )
+{
+    push( Compute ).nanoDelay = nanoDelay;
+}
+
+void EmberEventProgram::getTime( int32_t timeSlot )
+{
+    push( GetTime ).slot = timeSlot;
+    m_numTimes = std::max( m_numTimes, timeSlot + 1 );
+}
+
+void EmberEventProgram::irecv( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm, int32_t request )
+{
+    Op& op = push( Irecv );
+    op.peer = peer;
+    op.count = count;
+    op.dtype = dtype;
+    op.tag = tag;
+    op.comm = comm;
+    op.slot = request;
+    usePeer( peer );
+    useComm( comm );
+    m_requestPeer[request] = peer;
+    m_numRequests = std::max( m_numRequests, request + 1 );
+}
+
+void EmberEventProgram::isend( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm, int32_t request )
+{
+    irecv( peer, count, dtype, tag, comm, request );
+    m_ops.back().opcode = Isend;
+}
+
+void EmberEventProgram::send( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm )
+{
+    Op& op = push( Send );
+    op.peer = peer;
+    op.count = count;
+    op.dtype = dtype;
+    op.tag = tag;
+    op.comm = comm;
+    usePeer( peer );
+    useComm( comm );
+}
+
+void EmberEventProgram::recv( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm )
+{
+    send( peer, count, dtype, tag, comm );
+    m_ops.back().opcode = Recv;
+}
+
+void EmberEventProgram::wait( int32_t request )
+{
+    std::map<int32_t,int32_t>::iterator iter = m_requestPeer.find( request );
+    assert( iter != m_requestPeer.end() );
+
+    // The wait is skipped along with the request when its peer is inactive
+    Op& op = push( Wait );
+    op.slot = request;
+    op.peer = iter->second;
+}
+
+void EmberEventProgram::barrier( int32_t comm )
+{
+    push( Barrier ).comm = comm;
+    useComm( comm );
+}
+
+void EmberEventProgram::allreduce( uint32_t count, PayloadDataType dtype, ReductionOperation rop, int32_t comm )
+{
+    Op& op = push( Allreduce );
+    op.count = count;
+    op.dtype = dtype;
+    op.op = rop;
+    op.comm = comm;
+    useComm( comm );
+}
+
+void EmberEventProgram::alltoallv( const std::vector<int>& sendCnts, const std::vector<int>& sendDsp,
+                const std::vector<int>& recvCnts, const std::vector<int>& recvDsp,
+                PayloadDataType dtype, int32_t comm )
+{
+    Op& op = push( Alltoallv );
+    op.dtype = dtype;
+    op.comm = comm;
+    op.array = m_arrays.size();
+    useComm( comm );
+
+    m_arrays.push_back( sendCnts );
+    m_arrays.push_back( sendDsp );
+    m_arrays.push_back( recvCnts );
+    m_arrays.push_back( recvDsp );
+}
+
+size_t EmberEventProgram::bytes() const
+{
+    size_t total = sizeof(*this) + m_ops.capacity() * sizeof(Op);
+    for ( size_t i = 0; i < m_arrays.size(); i++ ) {
+        total += sizeof(m_arrays[i]) + m_arrays[i].capacity() * sizeof(int);
+    }
+    return total;
+}
+
+EmberProgramCache::Program EmberProgramCache::get( const std::string& key,
+                std::function<void(EmberEventProgram&)> build )
+{
+    std::lock_guard<std::mutex> lock( s_lock );
+
+    Program program = s_programs[key].lock();
+    if ( ! program ) {
+        EmberEventProgram* tmp = new EmberEventProgram;
+        build( *tmp );
+        program = Program( tmp );
+        s_programs[key] = program;
+    }
+    return program;
+}
+
+size_t EmberProgramCache::numPrograms()
+{
+    std::lock_guard<std::mutex> lock( s_lock );
+
+    size_t count = 0;
+    for ( std::map<std::string, std::weak_ptr<const EmberEventProgram> >::iterator iter = s_programs.begin();
+            iter != s_programs.end(); ++iter ) {
+        if ( ! iter->second.expired() ) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void EmberProgramCursor::bind( EmberProgramCache::Program program, uint32_t iterations )
+{
+    m_program = program;
+    m_pc = 0;
+    m_iteration = 0;
+    m_iterations = iterations;
+
+    m_peers.assign( program->numPeers(), -1 );
+    m_comms.assign( program->numComms(), NULL );
+    m_times.assign( program->numTimes(), NULL );
+    m_requests.assign( program->numRequests(), NULL );
+}
+
+bool EmberProgramCursor::advance()
+{
+    if ( ++m_pc == m_program->size() ) {
+        m_pc = 0;
+        ++m_iteration;
+        return true;
+    }
+    return false;
+}
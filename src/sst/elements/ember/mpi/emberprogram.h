@@ -0,0 +1,171 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_EMBER_PROGRAM
+#define _H_EMBER_PROGRAM
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <sst/elements/hermes/msgapi.h>
+
+using namespace Hermes;
+using namespace Hermes::MP;
+
+namespace SST {
+namespace Ember {
+
+/*
+ * An event program is one iteration of a motif recorded as a list of
+ * operations with rank-relative operands. Peers, communicators and time
+ * stamps are slots that each rank binds in its own EmberProgramCursor, so
+ * every rank whose motif parameters produce the same operation list can
+ * share one program instead of building its own events up front.
+ *
+ * Programs are built once per key through EmberProgramCache and are
+ * immutable afterwards; they are freed when the last cursor drops them.
+ */
+class EmberEventProgram {
+  public:
+
+    enum Opcode { Compute, GetTime, Irecv, Isend, Send, Recv, Wait, Barrier, Allreduce, Alltoallv };
+
+    struct Op {
+        Opcode              opcode;
+        int32_t             peer;       // peer slot, -1 if none
+        int32_t             comm;       // communicator slot, -1 for GroupWorld
+        int32_t             slot;       // request slot (Irecv/Isend/Wait) or time slot (GetTime)
+        uint32_t            count;
+        uint32_t            tag;
+        PayloadDataType     dtype;
+        ReductionOperation  op;
+        uint64_t            nanoDelay;
+        uint32_t            array;      // first of the 4 count/displacement arrays (Alltoallv)
+    };
+
+    EmberEventProgram() : m_numRequests(0), m_numPeers(0), m_numComms(0), m_numTimes(0) {}
+
+    /* Recording, only while the program is being built */
+    void compute( uint64_t nanoDelay );
+    void getTime( int32_t timeSlot );
+    void irecv( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm, int32_t request );
+    void isend( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm, int32_t request );
+    void send( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm );
+    void recv( int32_t peer, uint32_t count, PayloadDataType dtype, uint32_t tag, int32_t comm );
+    void wait( int32_t request );
+    void barrier( int32_t comm );
+    void allreduce( uint32_t count, PayloadDataType dtype, ReductionOperation op, int32_t comm );
+    void alltoallv( const std::vector<int>& sendCnts, const std::vector<int>& sendDsp,
+                    const std::vector<int>& recvCnts, const std::vector<int>& recvDsp,
+                    PayloadDataType dtype, int32_t comm );
+
+    size_t size() const { return m_ops.size(); }
+    const Op& op( size_t pc ) const { return m_ops[pc]; }
+    const int* array( uint32_t index ) const { return &m_arrays[index][0]; }
+
+    int32_t numRequests() const { return m_numRequests; }
+    int32_t numPeers() const { return m_numPeers; }
+    int32_t numComms() const { return m_numComms; }
+    int32_t numTimes() const { return m_numTimes; }
+
+    /* Approximate heap footprint, for reporting */
+    size_t bytes() const;
+
+  private:
+    Op& push( Opcode opcode );
+    void usePeer( int32_t peer ) { m_numPeers = std::max( m_numPeers, peer + 1 ); }
+    void useComm( int32_t comm ) { m_numComms = std::max( m_numComms, comm + 1 ); }
+
+    std::vector<Op>                 m_ops;
+    std::vector<std::vector<int> >  m_arrays;
+    std::map<int32_t,int32_t>       m_requestPeer;
+    int32_t                         m_numRequests;
+    int32_t                         m_numPeers;
+    int32_t                         m_numComms;
+    int32_t                         m_numTimes;
+};
+
+/*
+ * Process-wide registry of programs, keyed by a string built from every
+ * motif parameter that affects the operation list. Lookups are thread safe.
+ */
+class EmberProgramCache {
+  public:
+    typedef std::shared_ptr<const EmberEventProgram> Program;
+
+    /* Return the program for 'key', calling 'build' to record it if it does not exist */
+    static Program get( const std::string& key, std::function<void(EmberEventProgram&)> build );
+
+    /* Number of programs currently shared, for reporting */
+    static size_t numPrograms();
+
+  private:
+    static std::mutex                                   s_lock;
+    static std::map<std::string, std::weak_ptr<const EmberEventProgram> > s_programs;
+};
+
+/*
+ * Per-rank walk over a shared program: the position, the iteration count
+ * and the bindings of the program's slots for this rank. A peer bound to a
+ * negative rank disables the operations that use it, e.g., halo exchanges
+ * on a domain boundary.
+ */
+class EmberProgramCursor {
+  public:
+    EmberProgramCursor() : m_pc(0), m_iteration(0), m_iterations(0) {}
+
+    void bind( EmberProgramCache::Program program, uint32_t iterations );
+    bool bound() const { return m_program != nullptr; }
+
+    void setPeer( int32_t slot, int32_t rank ) { m_peers.at(slot) = rank; }
+    void setComm( int32_t slot, Communicator* comm ) { m_comms.at(slot) = comm; }
+    void setTime( int32_t slot, uint64_t* time ) { m_times.at(slot) = time; }
+
+    const EmberEventProgram& program() const { return *m_program; }
+    size_t pc() const { return m_pc; }
+    uint32_t iteration() const { return m_iteration; }
+    bool atStart() const { return 0 == m_pc && 0 == m_iteration; }
+    bool done() const { return m_iteration >= m_iterations; }
+
+    /* Move past the current op, wrapping to the next iteration. Returns true at an iteration boundary. */
+    bool advance();
+
+    bool peerActive( int32_t slot ) const { return slot < 0 || m_peers[slot] >= 0; }
+    RankID peer( int32_t slot ) const { return m_peers[slot]; }
+    Communicator comm( int32_t slot ) const { return slot < 0 ? GroupWorld : *m_comms[slot]; }
+    uint64_t* time( int32_t slot ) const { return m_times[slot]; }
+    MessageRequest* request( int32_t slot ) { return &m_requests[slot]; }
+
+  private:
+    EmberProgramCache::Program      m_program;
+    size_t                          m_pc;
+    uint32_t                        m_iteration;
+    uint32_t                        m_iterations;
+    std::vector<int32_t>            m_peers;
+    std::vector<Communicator*>      m_comms;
+    std::vector<uint64_t*>          m_times;
+    std::vector<MessageRequest>     m_requests;
+};
+
+}
+}
+
+#endif
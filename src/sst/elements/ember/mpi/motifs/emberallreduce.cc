@@ -38,6 +38,22 @@ EmberAllreduceGenerator::EmberAllreduceGenerator(SST::ComponentId_t id,
 	} else {
 		m_op = Hermes::MP::SUM;
 	}
+	m_verify = params.find<bool>("arg.verify", false) && m_op == Hermes::MP::SUM;
+
+	m_sharedProgram = params.find<bool>("arg.sharedProgram", false);
+	if ( m_sharedProgram ) {
+		m_verify = false;
+		std::ostringstream key;
+		key << getMotifName() << ":" << m_compute << ":" << m_count << ":" << params.find<bool>("arg.doUserFunc", false);
+
+		ReductionOperation op = m_op;
+		uint64_t compute = m_compute;
+		uint32_t count = m_count;
+		m_cursor.bind( EmberProgramCache::get( key.str(), [=]( EmberEventProgram& program ) {
+				program.compute( compute );
+				program.allreduce( count, DOUBLE, op, -1 );
+			} ), m_iterations );
+	}
 }
 
 bool EmberAllreduceGenerator::generate( std::queue<EmberEvent*>& evQ) {
@@ -49,12 +65,37 @@ bool EmberAllreduceGenerator::generate( std::queue<EmberEvent*>& evQ) {
             output( "%s: ranks %d, loop %d, %d double(s), latency %.3f us\n",
                     getMotifName().c_str(), size(), m_iterations, m_count, latency * 1000000.0  );
         }
+
+        if ( m_verify ) {
+            // every rank contributed rank()+1
+            double want = (double) size() * ( size() + 1 ) / 2;
+            for ( uint32_t i = 0; i < m_count; i++ ) {
+                if ( want != ((double*)m_recvBuf)[i] ) {
+                    fatal( CALL_INFO, -1, "Error: Rank %d index %d verification failed, want %.1f got %.1f\n", rank(), i, want, ((double*)m_recvBuf)[i] );
+                }
+            }
+        }
         return true;
     }
+
+    if ( m_sharedProgram ) {
+        if ( m_cursor.atStart() ) {
+            enQ_getTime( evQ, &m_startTime );
+        }
+        if ( enQ_program( evQ, m_cursor ) ) {
+            enQ_getTime( evQ, &m_stopTime );
+            m_loopIndex = m_iterations;
+        }
+        return false;
+    }
+
     if ( 0 == m_loopIndex ) {
 		memSetBacked();
 		m_sendBuf = memAlloc(sizeofDataType(DOUBLE)*m_count);
 		m_recvBuf = memAlloc(sizeofDataType(DOUBLE)*m_count);
+		for ( uint32_t i = 0; i < m_count; i++ ) {
+			((double*)m_sendBuf)[i] = rank() + 1;
+		}
         enQ_getTime( evQ, &m_startTime );
     }
 
@@ -39,6 +39,8 @@ public:
         {   "arg.compute",      "Sets the time spent computing",        "1"},
         {   "arg.count",        "Sets the number of elements to reduce",        "1"},
         {   "arg.doUserFunc",   "Test reduce operation",        "false"},
+        {   "arg.verify",       "Check the result of the last allreduce, ignored with doUserFunc or sharedProgram", "false"},
+        {   "arg.sharedProgram", "Share one recorded iteration between all ranks with the same parameters instead of generating events per rank, buffers are not backed", "0"},
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -79,6 +81,9 @@ private:
     void*    m_recvBuf;
     uint32_t m_loopIndex;
 	_ReductionOperation* m_op;
+    bool     m_sharedProgram;
+    bool     m_verify;
+    EmberProgramCursor m_cursor;
 };
 
 }
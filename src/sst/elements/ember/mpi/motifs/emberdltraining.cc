@@ -0,0 +1,525 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <sst/core/rng/mersenne.h>
+
+#include "emberdltraining.h"
+
+using namespace SST::Ember;
+
+#define TAG_FORWARD     0xD100
+#define TAG_BACKWARD    0xD200
+#define TAG_BUCKET      0xD300
+
+EmberDLTrainingGenerator::EmberDLTrainingGenerator(SST::ComponentId_t id, Params& params) :
+	EmberMessagePassingGenerator(id, params, "DLTraining"),
+    m_batch(1),
+    m_microbatches(1),
+    m_dataParallel(1),
+    m_pipelineParallel(1),
+    m_expertParallel(1),
+    m_bytesPerElement(4),
+    m_backwardRatio(2.0),
+    m_setup(false),
+    m_iteration(0),
+    m_expertComm(GroupWorld),
+    m_allreduceBytes(0),
+    m_alltoallBytes(0)
+{
+    m_modelFile  = params.find<std::string>("arg.modelFile", "");
+    m_iterations = params.find<uint32_t>("arg.iterations", 1);
+    m_bucketSize = params.find<uint64_t>("arg.bucketSize", 25 * 1024 * 1024);
+    m_overlap    = params.find<bool>("arg.overlap", true);
+    m_moeSkew    = params.find<double>("arg.moeSkew", 1.0);
+    m_seed       = params.find<uint32_t>("arg.seed", 1);
+
+    std::string algorithm = params.find<std::string>("arg.algorithm", "ring");
+    if ( algorithm == "ring" ) {
+        m_algorithm = Ring;
+    } else if ( algorithm == "halving" ) {
+        m_algorithm = Halving;
+    } else if ( algorithm == "tree" ) {
+        m_algorithm = Tree;
+    } else {
+        fatal( CALL_INFO, -1, "Error: unknown allreduce algorithm %s, use ring, halving or tree\n", algorithm.c_str() );
+    }
+
+    if ( m_modelFile.empty() ) {
+        fatal( CALL_INFO, -1, "Error: no model was specified by the \"arg.modelFile\" parameter.\n" );
+    }
+    if ( 0 == m_iterations ) {
+        fatal( CALL_INFO, -1, "Error: arg.iterations must be at least 1\n" );
+    }
+    if ( 0 == m_bucketSize ) {
+        fatal( CALL_INFO, -1, "Error: arg.bucketSize must be at least 1\n" );
+    }
+
+    readModel( m_modelFile );
+
+    memSetNotBacked();
+}
+
+void EmberDLTrainingGenerator::readModel( const std::string& fileName )
+{
+    std::ifstream file( fileName );
+    if ( ! file.good() ) {
+        fatal( CALL_INFO, -1, "Error: could not open model file %s\n", fileName.c_str() );
+    }
+
+    std::string line;
+    int lineNum = 0;
+    while ( std::getline( file, line ) ) {
+        ++lineNum;
+        line = line.substr( 0, line.find( '#' ) );
+
+        std::istringstream iss( line );
+        std::string key;
+        if ( ! ( iss >> key ) ) {
+            continue;
+        }
+
+        bool ok = true;
+        if ( key == "batch" ) {
+            ok = bool( iss >> m_batch );
+        } else if ( key == "microbatches" ) {
+            ok = bool( iss >> m_microbatches );
+        } else if ( key == "dataParallel" ) {
+            ok = bool( iss >> m_dataParallel );
+        } else if ( key == "pipelineParallel" ) {
+            ok = bool( iss >> m_pipelineParallel );
+        } else if ( key == "expertParallel" ) {
+            ok = bool( iss >> m_expertParallel );
+        } else if ( key == "bytesPerElement" ) {
+            ok = bool( iss >> m_bytesPerElement );
+        } else if ( key == "backwardRatio" ) {
+            ok = bool( iss >> m_backwardRatio );
+        } else if ( key == "layer" ) {
+            Layer layer;
+            layer.experts = 0;
+            layer.topK = 0;
+            ok = bool( iss >> layer.name >> layer.params >> layer.activations >> layer.forwardNs );
+            std::string moe;
+            if ( ok && iss >> moe ) {
+                ok = moe == "moe" && iss >> layer.experts >> layer.topK && layer.experts > 0 && layer.topK > 0;
+            }
+            m_layers.push_back( layer );
+        } else {
+            ok = false;
+        }
+
+        if ( ! ok ) {
+            fatal( CALL_INFO, -1, "Error: %s line %d: cannot parse \"%s\"\n", fileName.c_str(), lineNum, line.c_str() );
+        }
+    }
+
+    if ( m_dataParallel < 1 || m_pipelineParallel < 1 || m_expertParallel < 1 || 0 == m_microbatches ) {
+        fatal( CALL_INFO, -1, "Error: %s: parallel degrees and microbatches must be at least 1\n", fileName.c_str() );
+    }
+    if ( m_batch % m_microbatches ) {
+        fatal( CALL_INFO, -1, "Error: %s: batch %" PRIu32 " is not a multiple of %" PRIu32 " microbatches\n",
+                fileName.c_str(), m_batch, m_microbatches );
+    }
+    if ( m_layers.size() < (size_t) m_pipelineParallel ) {
+        fatal( CALL_INFO, -1, "Error: %s: %zu layers cannot fill %d pipeline stages\n",
+                fileName.c_str(), m_layers.size(), m_pipelineParallel );
+    }
+    if ( m_dataParallel % m_expertParallel ) {
+        fatal( CALL_INFO, -1, "Error: %s: expertParallel must divide dataParallel\n", fileName.c_str() );
+    }
+    for ( size_t i = 0; i < m_layers.size(); i++ ) {
+        if ( m_layers[i].experts % m_expertParallel ) {
+            fatal( CALL_INFO, -1, "Error: %s: layer %s has %" PRIu32 " experts, not a multiple of expertParallel\n",
+                    fileName.c_str(), m_layers[i].name.c_str(), m_layers[i].experts );
+        }
+    }
+
+    m_microbatchSamples = m_batch / m_microbatches;
+}
+
+void EmberDLTrainingGenerator::setup()
+{
+    if ( size() != m_dataParallel * m_pipelineParallel ) {
+        fatal( CALL_INFO, -1, "Error: the model needs %d ranks (dataParallel x pipelineParallel), job has %d\n",
+                m_dataParallel * m_pipelineParallel, size() );
+    }
+
+    m_stage = rank() / m_dataParallel;
+    m_replica = rank() % m_dataParallel;
+    m_firstLayer = m_layers.size() * m_stage / m_pipelineParallel;
+    m_lastLayer = m_layers.size() * ( m_stage + 1 ) / m_pipelineParallel;
+
+    m_denseGroup.size = m_dataParallel;
+    m_denseGroup.index = m_replica;
+    m_denseGroup.base = m_stage * m_dataParallel;
+    m_denseGroup.stride = 1;
+
+    // replicas holding the same experts
+    m_expertGroup.size = m_dataParallel / m_expertParallel;
+    m_expertGroup.index = m_replica / m_expertParallel;
+    m_expertGroup.base = m_stage * m_dataParallel + m_replica % m_expertParallel;
+    m_expertGroup.stride = m_expertParallel;
+
+    if ( Halving == m_algorithm && ( ( m_denseGroup.size & ( m_denseGroup.size - 1 ) ) ||
+                ( m_expertGroup.size & ( m_expertGroup.size - 1 ) ) ) ) {
+        fatal( CALL_INFO, -1, "Error: recursive halving needs power of 2 data parallel groups\n" );
+    }
+
+    // Pack gradients in the order backward produces them, dense and expert gradients in separate buckets
+    Bucket open[2];
+    for ( int kind = 0; kind < 2; kind++ ) {
+        open[kind].bytes = 0;
+        open[kind].expert = kind;
+    }
+    for ( size_t i = m_lastLayer; i-- > m_firstLayer; ) {
+        const Layer& layer = m_layers[i];
+        bool expert = layer.experts > 0;
+        uint64_t bytes = layer.params * m_bytesPerElement;
+        if ( expert ) {
+            bytes /= m_expertParallel;
+        }
+        if ( 0 == bytes ) {
+            continue;
+        }
+
+        Bucket& bucket = open[expert];
+        bucket.bytes += bytes;
+        bucket.readyLayer = i;
+        if ( bucket.bytes >= m_bucketSize ) {
+            m_buckets.push_back( bucket );
+            bucket.bytes = 0;
+        }
+    }
+    for ( int kind = 0; kind < 2; kind++ ) {
+        if ( open[kind].bytes ) {
+            m_buckets.push_back( open[kind] );
+        }
+    }
+    for ( size_t b = 0; b < m_buckets.size(); b++ ) {
+        buildSteps( m_buckets[b].expert ? m_expertGroup : m_denseGroup, m_buckets[b].bytes, m_buckets[b].steps );
+    }
+
+    m_pipeReqs.resize( 2 * m_microbatches );
+
+    verbose( CALL_INFO, 1, 0, "stage %d, replica %d, layers %zu-%zu, %zu gradient buckets\n",
+            m_stage, m_replica, m_firstLayer, m_lastLayer - 1, m_buckets.size() );
+}
+
+void EmberDLTrainingGenerator::buildSteps( const Group& group, uint64_t bytes, std::vector<Step>& steps )
+{
+    int num = group.size;
+    int me = group.index;
+
+    if ( bytes > UINT32_MAX ) {
+        fatal( CALL_INFO, -1, "Error: gradient bucket of %" PRIu64 " bytes is too large for one message, split the layer\n", bytes );
+    }
+
+    switch ( m_algorithm ) {
+      case Ring:
+        {
+            uint32_t chunk = ( bytes + num - 1 ) / num;
+            Step step = { group.rank( ( me + 1 ) % num ), chunk, group.rank( ( me + num - 1 ) % num ), chunk };
+            // reduce-scatter followed by allgather
+            steps.assign( 2 * ( num - 1 ), step );
+        }
+        break;
+
+      case Halving:
+        {
+            std::vector<Step> reduceScatter;
+            uint64_t chunk = bytes;
+            for ( int mask = num / 2; mask > 0; mask /= 2 ) {
+                chunk = ( chunk + 1 ) / 2;
+                Step step = { group.rank( me ^ mask ), (uint32_t) chunk, group.rank( me ^ mask ), (uint32_t) chunk };
+                reduceScatter.push_back( step );
+            }
+            // the allgather retraces the reduce-scatter
+            steps = reduceScatter;
+            steps.insert( steps.end(), reduceScatter.rbegin(), reduceScatter.rend() );
+        }
+        break;
+
+      case Tree:
+        {
+            // Binomial reduce to index 0 and binomial broadcast, one step per tree level
+            // on every rank, idle or not, so partners always post in the same progress call
+            int levels = 0;
+            while ( ( 1 << levels ) < num ) {
+                levels++;
+            }
+            for ( int level = 0; level < levels; level++ ) {
+                int mask = 1 << level;
+                Step step = { -1, 0, -1, 0 };
+                if ( ( me & ( 2 * mask - 1 ) ) == mask ) {
+                    step.sendPeer = group.rank( me - mask );
+                    step.sendBytes = bytes;
+                } else if ( ( me & ( 2 * mask - 1 ) ) == 0 && me + mask < num ) {
+                    step.recvPeer = group.rank( me + mask );
+                    step.recvBytes = bytes;
+                }
+                steps.push_back( step );
+            }
+            for ( int level = levels; level-- > 0; ) {
+                int mask = 1 << level;
+                Step step = { -1, 0, -1, 0 };
+                if ( ( me & ( 2 * mask - 1 ) ) == 0 && me + mask < num ) {
+                    step.sendPeer = group.rank( me + mask );
+                    step.sendBytes = bytes;
+                } else if ( ( me & ( 2 * mask - 1 ) ) == mask ) {
+                    step.recvPeer = group.rank( me - mask );
+                    step.recvBytes = bytes;
+                }
+                steps.push_back( step );
+            }
+        }
+        break;
+    }
+}
+
+bool EmberDLTrainingGenerator::generate( std::queue<EmberEvent*>& evQ )
+{
+    if ( ! m_setup ) {
+        m_setup = true;
+        setup();
+
+        // Every rank takes part in the split, the expert groups are only needed by MoE layers
+        bool moe = false;
+        for ( size_t i = 0; i < m_layers.size(); i++ ) {
+            moe |= m_layers[i].experts > 0;
+        }
+        if ( moe && m_expertParallel > 1 ) {
+            enQ_commSplit( evQ, GroupWorld, rank() / m_expertParallel, m_replica % m_expertParallel, &m_expertComm );
+            return false;
+        }
+    }
+
+    if ( m_iteration == m_iterations ) {
+        if ( 0 == rank() ) {
+            double stepTime = (double)(m_stopTime - m_startTime) / (double) m_iterations / 1000000.0;
+            output( "%s: ranks %d, dp %d, pp %d, ep %d, step time %.3f ms, per step %.1f MB allreduced, %.1f MB alltoallv\n",
+                    getMotifName().c_str(), size(), m_dataParallel, m_pipelineParallel, m_expertParallel, stepTime,
+                    m_allreduceBytes / (double) m_iterations / 1048576.0,
+                    m_alltoallBytes / (double) m_iterations / 1048576.0 );
+        }
+        return true;
+    }
+
+    if ( 0 == m_iteration ) {
+        enQ_getTime( evQ, &m_startTime );
+    }
+
+    // storage of the previous step's events is free once the queue has drained
+    m_arrays.clear();
+    for ( size_t b = 0; b < m_buckets.size(); b++ ) {
+        m_buckets[b].next = 0;
+        m_buckets[b].launched = false;
+        m_buckets[b].numReqs = 0;
+    }
+
+    Addr buf = NULL;
+    int numPipeReqs = 0;
+    int prev = rank() - m_dataParallel;
+    int next = rank() + m_dataParallel;
+    bool first = 0 == m_stage;
+    bool last = m_pipelineParallel - 1 == m_stage;
+
+    for ( uint32_t mb = 0; mb < m_microbatches; mb++ ) {
+        if ( ! first ) {
+            enQ_recv( evQ, buf, activationBytes( m_firstLayer - 1 ), CHAR, prev, TAG_FORWARD, GroupWorld );
+        }
+        for ( size_t i = m_firstLayer; i < m_lastLayer; i++ ) {
+            forwardLayer( evQ, i, mb );
+        }
+        if ( ! last ) {
+            enQ_isend( evQ, buf, activationBytes( m_lastLayer - 1 ), CHAR, next, TAG_FORWARD, GroupWorld,
+                    &m_pipeReqs[numPipeReqs++] );
+        }
+    }
+
+    for ( uint32_t mb = m_microbatches; mb-- > 0; ) {
+        if ( ! last ) {
+            enQ_recv( evQ, buf, activationBytes( m_lastLayer - 1 ), CHAR, next, TAG_BACKWARD, GroupWorld );
+        }
+        for ( size_t i = m_lastLayer; i-- > m_firstLayer; ) {
+            backwardLayer( evQ, i, mb );
+
+            // gradients are complete once the last microbatch has gone through the layer
+            if ( 0 == mb ) {
+                for ( size_t b = 0; b < m_buckets.size(); b++ ) {
+                    m_buckets[b].launched |= m_buckets[b].readyLayer == i;
+                }
+                if ( m_overlap ) {
+                    progress( evQ );
+                }
+            }
+        }
+        if ( ! first ) {
+            enQ_isend( evQ, buf, activationBytes( m_firstLayer - 1 ), CHAR, prev, TAG_BACKWARD, GroupWorld,
+                    &m_pipeReqs[numPipeReqs++] );
+        }
+    }
+
+    while ( progress( evQ ) );
+
+    if ( numPipeReqs ) {
+        enQ_waitall( evQ, numPipeReqs, &m_pipeReqs[0] );
+    }
+
+    if ( ++m_iteration == m_iterations ) {
+        enQ_getTime( evQ, &m_stopTime );
+    }
+    return false;
+}
+
+void EmberDLTrainingGenerator::forwardLayer( std::queue<EmberEvent*>& evQ, size_t layer, uint32_t microbatch )
+{
+    const Layer& l = m_layers[layer];
+
+    if ( 0 == l.experts ) {
+        enQ_compute( evQ, l.forwardNs * m_microbatchSamples );
+        return;
+    }
+
+    uint64_t tokens;
+    moeExchange( evQ, layer, microbatch, false, tokens );
+    enQ_compute( evQ, l.forwardNs * tokens );
+    moeExchange( evQ, layer, microbatch, true, tokens );
+}
+
+void EmberDLTrainingGenerator::backwardLayer( std::queue<EmberEvent*>& evQ, size_t layer, uint32_t microbatch )
+{
+    const Layer& l = m_layers[layer];
+
+    if ( 0 == l.experts ) {
+        enQ_compute( evQ, l.forwardNs * m_microbatchSamples * m_backwardRatio );
+        return;
+    }
+
+    // output gradients go to the experts the tokens were routed to, input gradients come back
+    uint64_t tokens;
+    moeExchange( evQ, layer, microbatch, false, tokens );
+    enQ_compute( evQ, l.forwardNs * tokens * m_backwardRatio );
+    moeExchange( evQ, layer, microbatch, true, tokens );
+}
+
+/*
+ * Route this microbatch's tokens to experts. Expert popularity is a Zipf
+ * distribution over a permutation of the experts that only depends on the
+ * seed, step, layer and microbatch, so every rank of the expert group
+ * computes the same token counts and the alltoallv counts match.
+ */
+void EmberDLTrainingGenerator::moeExchange( std::queue<EmberEvent*>& evQ, size_t layer, uint32_t microbatch, bool combine,
+            uint64_t& tokens )
+{
+    const Layer& l = m_layers[layer];
+    int numRanks = m_expertParallel;
+    uint32_t expertsPerRank = l.experts / numRanks;
+    uint64_t routed = (uint64_t) m_microbatchSamples * l.topK;
+
+    if ( 1 == numRanks ) {
+        tokens = routed;
+        return;
+    }
+
+    SST::RNG::MersenneRNG rng( m_seed + ( ( m_iteration * m_layers.size() + layer ) * m_microbatches + microbatch ) * 7919 );
+    std::vector<uint32_t> order( l.experts );
+    for ( uint32_t e = 0; e < l.experts; e++ ) {
+        order[e] = e;
+    }
+    for ( uint32_t e = l.experts - 1; e > 0; e-- ) {
+        std::swap( order[e], order[rng.generateNextUInt32() % ( e + 1 )] );
+    }
+
+    std::vector<double> share( numRanks, 0.0 );
+    double total = 0;
+    for ( uint32_t k = 0; k < l.experts; k++ ) {
+        double weight = 1.0 / pow( k + 1, m_moeSkew );
+        share[order[k] / expertsPerRank] += weight;
+        total += weight;
+    }
+
+    int me = m_replica % m_expertParallel;
+    uint64_t bytesPerToken = l.activations * m_bytesPerElement;
+    uint64_t toMe = routed * share[me] / total;
+
+    m_arrays.push_back( std::vector<int>( numRanks ) );
+    std::vector<int>& toCnts = m_arrays.back();
+    m_arrays.push_back( std::vector<int>( numRanks ) );
+    std::vector<int>& toDsp = m_arrays.back();
+    m_arrays.push_back( std::vector<int>( numRanks ) );
+    std::vector<int>& fromCnts = m_arrays.back();
+    m_arrays.push_back( std::vector<int>( numRanks ) );
+    std::vector<int>& fromDsp = m_arrays.back();
+
+    uint64_t toOffset = 0, fromOffset = 0;
+    for ( int j = 0; j < numRanks; j++ ) {
+        toCnts[j] = (uint64_t)( routed * share[j] / total ) * bytesPerToken;
+        fromCnts[j] = toMe * bytesPerToken;
+        toDsp[j] = toOffset;
+        fromDsp[j] = fromOffset;
+        toOffset += toCnts[j];
+        fromOffset += fromCnts[j];
+    }
+
+    Addr buf = NULL;
+    if ( combine ) {
+        enQ_alltoallv( evQ, buf, &fromCnts[0], &fromDsp[0], CHAR, buf, &toCnts[0], &toDsp[0], CHAR, m_expertComm );
+    } else {
+        enQ_alltoallv( evQ, buf, &toCnts[0], &toDsp[0], CHAR, buf, &fromCnts[0], &fromDsp[0], CHAR, m_expertComm );
+    }
+    m_alltoallBytes += toOffset;
+
+    tokens = toMe * numRanks;
+}
+
+/* Complete the current step of every launched bucket and start its next one, returns true while any step is in flight */
+bool EmberDLTrainingGenerator::progress( std::queue<EmberEvent*>& evQ )
+{
+    Addr buf = NULL;
+    bool active = false;
+
+    for ( size_t b = 0; b < m_buckets.size(); b++ ) {
+        Bucket& bucket = m_buckets[b];
+        if ( ! bucket.launched ) {
+            continue;
+        }
+
+        if ( bucket.numReqs ) {
+            enQ_waitall( evQ, bucket.numReqs, bucket.reqs );
+            bucket.numReqs = 0;
+        }
+
+        if ( bucket.next == bucket.steps.size() ) {
+            continue;
+        }
+
+        const Step& step = bucket.steps[bucket.next++];
+        if ( step.recvPeer >= 0 ) {
+            enQ_irecv( evQ, buf, step.recvBytes, CHAR, step.recvPeer, TAG_BUCKET + b, GroupWorld, &bucket.reqs[bucket.numReqs++] );
+        }
+        if ( step.sendPeer >= 0 ) {
+            enQ_isend( evQ, buf, step.sendBytes, CHAR, step.sendPeer, TAG_BUCKET + b, GroupWorld, &bucket.reqs[bucket.numReqs++] );
+            m_allreduceBytes += step.sendBytes;
+        }
+        active = true;
+    }
+
+    return active;
+}
@@ -0,0 +1,197 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_EMBER_DL_TRAINING
+#define _H_EMBER_DL_TRAINING
+
+#include <deque>
+
+#include "mpi/embermpigen.h"
+
+namespace SST {
+namespace Ember {
+
+/*
+ * Communication of one deep-learning training step, derived from a model
+ * description file:
+ *
+ *   # comment
+ *   batch             <samples per data parallel replica per step>
+ *   microbatches      <pipeline microbatches per step>
+ *   dataParallel      <data parallel degree>
+ *   pipelineParallel  <pipeline stages>
+ *   expertParallel    <ranks an MoE layer's experts are spread over>
+ *   bytesPerElement   <bytes per parameter/activation element>
+ *   backwardRatio     <backward compute time relative to forward>
+ *   layer <name> <parameters> <activations per sample> <forward ns per sample> [moe <experts> <topk>]
+ *
+ * Ranks are laid out stage major: rank = stage * dataParallel + replica.
+ * Layers are split evenly over the stages. Each step runs a GPipe schedule:
+ * all microbatches forward, then all backward, with activations and their
+ * gradients sent point to point between neighboring stages. MoE layers
+ * dispatch and combine tokens with alltoallv over their expert parallel
+ * group; expert popularity follows a Zipf distribution that is reshuffled
+ * for every layer and microbatch.
+ *
+ * Gradients are packed into buckets in reverse layer order. A bucket is
+ * allreduced once the backward pass of its earliest layer is done for the
+ * last microbatch, and the allreduce advances one step per layer of
+ * backward compute when overlap is enabled. Allreduces are built from
+ * point to point messages so they can overlap compute. Dense gradients are
+ * reduced over the stage's data parallel group, expert gradients over the
+ * replicas holding the same experts.
+ */
+class EmberDLTrainingGenerator : public EmberMessagePassingGenerator {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        EmberDLTrainingGenerator,
+        "ember",
+        "DLTrainingMotif",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Models data, pipeline and expert parallel deep-learning training communication",
+        SST::Ember::EmberGenerator
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {   "arg.modelFile",    "Sets the model description file", "" },
+        {   "arg.iterations",   "Sets the number of training steps, at least 1", "1" },
+        {   "arg.bucketSize",   "Sets the gradient bucket size in bytes", "26214400" },
+        {   "arg.algorithm",    "Sets the bucket allreduce algorithm: ring, halving (recursive halving, power of 2 groups) or tree", "ring" },
+        {   "arg.overlap",      "Overlap bucket allreduces with backward compute", "1" },
+        {   "arg.moeSkew",      "Sets the Zipf exponent of the expert popularity, 0 is uniform", "1.0" },
+        {   "arg.seed",         "Sets the seed of the expert popularity, must be the same on every rank", "1" },
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "time-Init", "Time spent in Init event",          "ns",  0},
+        { "time-Finalize", "Time spent in Finalize event",  "ns", 0},
+        { "time-Rank", "Time spent in Rank event",          "ns", 0},
+        { "time-Size", "Time spent in Size event",          "ns", 0},
+        { "time-Send", "Time spent in Recv event",          "ns", 0},
+        { "time-Recv", "Time spent in Recv event",          "ns", 0},
+        { "time-Irecv", "Time spent in Irecv event",        "ns", 0},
+        { "time-Isend", "Time spent in Isend event",        "ns", 0},
+        { "time-Wait", "Time spent in Wait event",          "ns", 0},
+        { "time-Waitall", "Time spent in Waitall event",    "ns", 0},
+        { "time-Waitany", "Time spent in Waitany event",    "ns", 0},
+        { "time-Compute", "Time spent in Compute event",    "ns", 0},
+        { "time-Barrier", "Time spent in Barrier event",    "ns", 0},
+        { "time-Alltoallv", "Time spent in Alltoallv event", "ns", 0},
+        { "time-Alltoall", "Time spent in Alltoall event",  "ns", 0},
+        { "time-Allreduce", "Time spent in Allreduce event", "ns", 0},
+        { "time-Reduce", "Time spent in Reduce event",      "ns", 0},
+        { "time-Bcast", "Time spent in Bcast event",        "ns", 0},
+        { "time-Gettime", "Time spent in Gettime event",    "ns", 0},
+        { "time-Commsplit", "Time spent in Commsplit event", "ns", 0},
+        { "time-Commcreate", "Time spent in Commcreate event", "ns", 0},
+    )
+
+public:
+	EmberDLTrainingGenerator(SST::ComponentId_t, Params& params);
+    bool generate( std::queue<EmberEvent*>& evQ );
+
+private:
+    enum Algorithm { Ring, Halving, Tree };
+
+    struct Layer {
+        std::string name;
+        uint64_t    params;
+        uint64_t    activations;
+        uint64_t    forwardNs;
+        uint32_t    experts;
+        uint32_t    topK;
+    };
+
+    /* Ranks base + j * stride, j = 0 .. size - 1 */
+    struct Group {
+        int         size;
+        int         index;
+        int         base;
+        int         stride;
+        int rank( int j ) const { return base + j * stride; }
+    };
+
+    /* One allreduce step, a peer of -1 means no message in that direction */
+    struct Step {
+        int         sendPeer;
+        uint32_t    sendBytes;
+        int         recvPeer;
+        uint32_t    recvBytes;
+    };
+
+    struct Bucket {
+        uint64_t            bytes;
+        size_t              readyLayer;     // index into m_layers
+        bool                expert;
+        std::vector<Step>   steps;
+        size_t              next;
+        bool                launched;
+        int                 numReqs;
+        MessageRequest      reqs[2];
+    };
+
+    void readModel( const std::string& fileName );
+    void setup();
+    void buildSteps( const Group& group, uint64_t bytes, std::vector<Step>& steps );
+    void forwardLayer( std::queue<EmberEvent*>& evQ, size_t layer, uint32_t microbatch );
+    void backwardLayer( std::queue<EmberEvent*>& evQ, size_t layer, uint32_t microbatch );
+    void moeExchange( std::queue<EmberEvent*>& evQ, size_t layer, uint32_t microbatch, bool combine, uint64_t& tokens );
+    bool progress( std::queue<EmberEvent*>& evQ );
+    uint64_t activationBytes( size_t layer ) { return m_layers[layer].activations * m_bytesPerElement * m_microbatchSamples; }
+
+    std::string         m_modelFile;
+    std::vector<Layer>  m_layers;
+    uint32_t            m_batch;
+    uint32_t            m_microbatches;
+    uint32_t            m_microbatchSamples;
+    int                 m_dataParallel;
+    int                 m_pipelineParallel;
+    int                 m_expertParallel;
+    uint32_t            m_bytesPerElement;
+    double              m_backwardRatio;
+
+    uint32_t            m_iterations;
+    uint64_t            m_bucketSize;
+    Algorithm           m_algorithm;
+    bool                m_overlap;
+    double              m_moeSkew;
+    uint32_t            m_seed;
+
+    bool                m_setup;
+    uint32_t            m_iteration;
+    int                 m_stage;
+    int                 m_replica;
+    size_t              m_firstLayer;
+    size_t              m_lastLayer;
+    Group               m_denseGroup;
+    Group               m_expertGroup;
+    Communicator        m_expertComm;
+    std::vector<Bucket> m_buckets;
+    uint64_t            m_allreduceBytes;
+    uint64_t            m_alltoallBytes;
+
+    std::vector<MessageRequest>     m_pipeReqs;
+    std::deque<std::vector<int> >   m_arrays;
+
+    uint64_t            m_startTime;
+    uint64_t            m_stopTime;
+};
+
+}
+}
+
+#endif
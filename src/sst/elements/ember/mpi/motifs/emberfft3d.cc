@@ -55,7 +55,72 @@ EmberFFT3DGenerator::EmberFFT3DGenerator(SST::ComponentId_t id, Params& params)
     m_transCostPer[4] = params.find<float>("arg.bwd_fft2",1);
     m_transCostPer[5] = params.find<float>("arg.bwd_fft3",1);
 
+    m_sharedProgram = params.find<bool>("arg.sharedProgram", false);
+
 	configure();
+
+    if ( m_sharedProgram ) {
+        setupProgram();
+    }
+}
+
+void EmberFFT3DGenerator::setupProgram()
+{
+    // The count and displacement arrays only depend on the global
+    // decomposition and this rank's local extents
+    std::ostringstream key;
+    key << getMotifName() << ":" << m_data.np0 << ":" << m_data.np1 << ":" << m_data.np2 << ":" << m_data.nprow <<
+        ":" << m_data.np0loc << ":" << m_data.np1locf << ":" << m_data.np1locb << ":" << m_data.np2loc;
+    for ( unsigned i = 0; i < 3; i++ ) {
+        key << ":" << m_fwdTime[i] << ":" << m_bwdTime[i];
+    }
+
+    m_cursor.bind( EmberProgramCache::get( key.str(),
+            std::bind( &EmberFFT3DGenerator::buildProgram, this, std::placeholders::_1 ) ), m_iterations );
+
+    m_cursor.setComm( 0, &m_rowComm );
+    m_cursor.setComm( 1, &m_colComm );
+    m_cursor.setTime( 0, &m_forwardStart );
+    m_cursor.setTime( 1, &m_forwardStop );
+    m_cursor.setTime( 2, &m_backwardStop );
+
+    // The program holds its own copy of the arrays
+    std::vector<int>().swap( m_rowSendCnts );
+    std::vector<int>().swap( m_rowSendDsp );
+    std::vector<int>().swap( m_rowRecvCnts );
+    std::vector<int>().swap( m_rowRecvDsp );
+    std::vector<int>().swap( m_colSendCnts_f );
+    std::vector<int>().swap( m_colSendDsp_f );
+    std::vector<int>().swap( m_colRecvCnts_f );
+    std::vector<int>().swap( m_colRecvDsp_f );
+    std::vector<int>().swap( m_colSendCnts_b );
+    std::vector<int>().swap( m_colSendDsp_b );
+    std::vector<int>().swap( m_colRecvCnts_b );
+    std::vector<int>().swap( m_colRecvDsp_b );
+}
+
+// One iteration of generate() with the row and column communicators as
+// slots 0 and 1, and the forward start, forward stop and backward stop
+// times as slots 0-2
+void EmberFFT3DGenerator::buildProgram( EmberEventProgram& program )
+{
+    program.getTime( 0 );
+
+    program.compute( calcFwdFFT1() );
+    program.alltoallv( m_colSendCnts_f, m_colSendDsp_f, m_colRecvCnts_f, m_colRecvDsp_f, DOUBLE, 1 );
+    program.compute( calcFwdFFT2() );
+    program.alltoallv( m_rowSendCnts, m_rowSendDsp, m_rowRecvCnts, m_rowRecvDsp, DOUBLE, 0 );
+    program.compute( calcFwdFFT3() );
+    program.barrier( -1 );
+    program.getTime( 1 );
+
+    program.compute( calcBwdFFT1() );
+    program.alltoallv( m_rowSendCnts, m_rowSendDsp, m_rowRecvCnts, m_rowRecvDsp, DOUBLE, 0 );
+    program.compute( calcBwdFFT2() );
+    program.alltoallv( m_colSendCnts_b, m_colSendDsp_b, m_colRecvCnts_b, m_colRecvDsp_b, DOUBLE, 1 );
+    program.compute( calcBwdFFT3() );
+    program.barrier( -1 );
+    program.getTime( 2 );
 }
 
 void EmberFFT3DGenerator::configure()
@@ -288,19 +353,6 @@ bool EmberFFT3DGenerator::generate( std::queue<EmberEvent*>& evQ )
 {
     verbose(CALL_INFO, 1, 0, "loop=%d\n", m_loopIndex );
 
-    m_forwardTotal += (m_forwardStop - m_forwardStart);
-    m_backwardTotal += (m_backwardStop - m_forwardStop);
-
-    if (  m_loopIndex == (signed) m_iterations ) {
-        if ( 0 == rank() ) {
-            output("%s: nRanks=%d fwd time %f sec\n", getMotifName().c_str(), size(),
-                ((double) m_forwardTotal / 1000000000.0) / m_iterations );
-            output("%s: rRanks=%d bwd time %f sec\n", getMotifName().c_str(), size(),
-                ((double) m_backwardTotal / 1000000000.0) / m_iterations );
-        }
-        return true;
-    }
-
     if (  m_loopIndex < 0 ) {
         enQ_commCreate( evQ, GroupWorld, m_rowGrpRanks, &m_rowComm );
         enQ_commCreate( evQ, GroupWorld, m_colGrpRanks, &m_colComm );
@@ -308,6 +360,18 @@ bool EmberFFT3DGenerator::generate( std::queue<EmberEvent*>& evQ )
         return false;
     }
 
+    if ( m_sharedProgram ) {
+        return generateShared( evQ );
+    }
+
+    m_forwardTotal += (m_forwardStop - m_forwardStart);
+    m_backwardTotal += (m_backwardStop - m_forwardStop);
+
+    if (  m_loopIndex == (signed) m_iterations ) {
+        report();
+        return true;
+    }
+
     enQ_getTime( evQ, &m_forwardStart );
 
     enQ_compute( evQ, (uint64_t) ((double) calcFwdFFT1() ) );
@@ -353,3 +417,35 @@ bool EmberFFT3DGenerator::generate( std::queue<EmberEvent*>& evQ )
 
     return false;
 }
+
+bool EmberFFT3DGenerator::generateShared( std::queue<EmberEvent*>& evQ )
+{
+    // The queue only drains once all events issued so far have completed,
+    // so the times of the previous iteration are final here
+    if ( m_cursor.iteration() != (unsigned) m_loopIndex ) {
+        m_forwardTotal += (m_forwardStop - m_forwardStart);
+        m_backwardTotal += (m_backwardStop - m_forwardStop);
+        m_loopIndex = m_cursor.iteration();
+    }
+
+    if (  m_loopIndex == (signed) m_iterations ) {
+        report();
+        return true;
+    }
+
+    if ( enQ_program( evQ, m_cursor ) ) {
+        enQ_commDestroy( evQ, m_rowComm );
+        enQ_commDestroy( evQ, m_colComm );
+    }
+    return false;
+}
+
+void EmberFFT3DGenerator::report()
+{
+    if ( 0 == rank() ) {
+        output("%s: nRanks=%d fwd time %f sec\n", getMotifName().c_str(), size(),
+            ((double) m_forwardTotal / 1000000000.0) / m_iterations );
+        output("%s: rRanks=%d bwd time %f sec\n", getMotifName().c_str(), size(),
+            ((double) m_backwardTotal / 1000000000.0) / m_iterations );
+    }
+}
@@ -47,6 +47,7 @@ public:
         { "arg.bwd_fft1",  "", "" },
         { "arg.bwd_fft2",  "", "" },
         { "arg.bwd_fft3",  "", "" },
+        { "arg.sharedProgram", "Share one recorded iteration between all ranks with the same local decomposition instead of generating events per rank", "0" },
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -80,6 +81,13 @@ public:
 	bool generate( std::queue<EmberEvent*>& evQ );
 
 private:
+    void setupProgram();
+    void buildProgram( EmberEventProgram& program );
+    bool generateShared( std::queue<EmberEvent*>& evQ );
+    void report();
+
+    bool                m_sharedProgram;
+    EmberProgramCursor  m_cursor;
 
     struct Data {
         int np0;
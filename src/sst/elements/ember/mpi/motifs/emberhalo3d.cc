@@ -57,7 +57,56 @@ EmberHalo3DGenerator::EmberHalo3DGenerator(SST::ComponentId_t id, Params& params
 
     jobId        = params.find<int>("_jobId"); //NetworkSim
 
+	m_sharedProgram = params.find<bool>("arg.sharedProgram", false);
+
 	configure();
+
+	if ( m_sharedProgram ) {
+		std::ostringstream key;
+		key << getMotifName() << ":" << nx << ":" << ny << ":" << nz << ":" << items_per_cell << ":" << sizeof_cell <<
+			":" << nsCompute << ":" << nsCopyTime << ":" << performReduction;
+
+		m_cursor.bind( EmberProgramCache::get( key.str(),
+				std::bind( &EmberHalo3DGenerator::buildProgram, this, std::placeholders::_1 ) ), iterations );
+
+		m_cursor.setPeer( 0, x_down );
+		m_cursor.setPeer( 1, x_up );
+		m_cursor.setPeer( 2, y_down );
+		m_cursor.setPeer( 3, y_up );
+		m_cursor.setPeer( 4, z_down );
+		m_cursor.setPeer( 5, z_up );
+	}
+}
+
+// One iteration of generate() with the neighbors as peer slots 0-5 (x-, x+, y-, y+, z-, z+)
+void EmberHalo3DGenerator::buildProgram( EmberEventProgram& program )
+{
+	const uint32_t faceBytes[3] = {
+		items_per_cell * sizeof_cell * ny * nz,
+		items_per_cell * sizeof_cell * nx * nz,
+		items_per_cell * sizeof_cell * ny * nx };
+
+	program.compute( nsCompute );
+
+	for ( int dim = 0; dim < 3; dim++ ) {
+		const int down = 2 * dim;
+		const int up = 2 * dim + 1;
+
+		program.irecv( down, faceBytes[dim], CHAR, 0, -1, down );
+		program.irecv( up, faceBytes[dim], CHAR, 0, -1, up );
+		program.send( down, faceBytes[dim], CHAR, 0, -1 );
+		program.send( up, faceBytes[dim], CHAR, 0, -1 );
+		program.wait( down );
+		program.wait( up );
+
+		if ( nsCopyTime > 0 ) {
+			program.compute( nsCopyTime );
+		}
+	}
+
+	if ( performReduction ) {
+		program.allreduce( 1, DOUBLE, MP::SUM, -1 );
+	}
 }
 
 
@@ -144,6 +193,10 @@ void EmberHalo3DGenerator::configure()
 
 bool EmberHalo3DGenerator::generate( std::queue<EmberEvent*>& evQ )
 {
+    if ( m_sharedProgram ) {
+        return enQ_program( evQ, m_cursor );
+    }
+
     verbose(CALL_INFO, 1, 0, "loop=%d\n", m_loopIndex );
 
     	//NetworkSim: record motif start time
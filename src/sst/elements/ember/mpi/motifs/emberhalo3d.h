@@ -49,6 +49,7 @@ public:
         {   "arg.computetime",      "Sets the number of nanoseconds to compute for",    "10"},
         {   "arg.copytime",     "Sets the time spent copying data between messages",    "5"},
         {   "arg.iterations",       "Sets the number of halo3d operations to perform",  "10"},
+        {   "arg.sharedProgram",    "Share one recorded iteration between all ranks with the same parameters instead of generating events per rank", "0"},
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -83,8 +84,13 @@ public:
 	bool generate( std::queue<EmberEvent*>& evQ );
 
 private:
+	void buildProgram( EmberEventProgram& program );
+
 	uint32_t m_loopIndex;
 
+	bool m_sharedProgram;
+	EmberProgramCursor m_cursor;
+
 	bool performReduction;
 
 	uint32_t iterations;
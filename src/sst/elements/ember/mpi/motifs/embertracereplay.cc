@@ -0,0 +1,199 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include "embertracereplay.h"
+
+using namespace SST::Ember;
+
+EmberTraceReplayGenerator::EmberTraceReplayGenerator(SST::ComponentId_t id, Params& params) :
+	EmberMessagePassingGenerator(id, params, "TraceReplay"),
+    m_reader(NULL)
+{
+    m_tracePrefix = params.find<std::string>("arg.tracePrefix", "");
+    m_window = params.find<uint32_t>("arg.window", 256);
+
+    if ( m_tracePrefix.empty() ) {
+        fatal( CALL_INFO, -1, "Error: no trace was specified by the \"arg.tracePrefix\" parameter.\n" );
+    }
+    if ( 0 == m_window ) {
+        fatal( CALL_INFO, -1, "Error: arg.window must be at least 1\n" );
+    }
+
+    memSetNotBacked();
+}
+
+EmberTraceReplayGenerator::~EmberTraceReplayGenerator()
+{
+    delete m_reader;
+}
+
+MessageRequest* EmberTraceReplayGenerator::request( uint32_t slot )
+{
+    if ( slot >= m_requests.size() ) {
+        m_requests.resize( slot + 1 );
+    }
+    return &m_requests[slot];
+}
+
+bool EmberTraceReplayGenerator::generate( std::queue<EmberEvent*>& evQ )
+{
+    // the rank is only known once the Init motif has run
+    if ( NULL == m_reader ) {
+        m_reader = new EmberTraceReader( &getOutput(), m_tracePrefix, rank() );
+    }
+
+    // every event of the previous window has completed
+    m_arrays.clear();
+    m_flags.clear();
+
+    for ( uint32_t i = 0; i < m_window; i++ ) {
+        if ( ! m_reader->next( m_record ) ) {
+            if ( 0 == rank() ) {
+                output( "%s: replayed %" PRIu64 " records\n", getMotifName().c_str(), m_reader->numRecords() );
+            }
+            return true;
+        }
+        replay( evQ, m_record );
+    }
+    return false;
+}
+
+void EmberTraceReplayGenerator::replay( std::queue<EmberEvent*>& evQ, const EmberTraceReader::Record& rec )
+{
+    Addr buf = NULL;
+
+    switch ( rec.op ) {
+      case TraceCompute:
+        enQ_compute( evQ, rec.nanoDelay );
+        break;
+
+      case TraceSend:
+        enQ_send( evQ, buf, rec.count, rec.dtype, rec.peer, rec.tag, rec.comm );
+        break;
+
+      case TraceRecv:
+        enQ_recv( evQ, buf, rec.count, rec.dtype, rec.peer, rec.tag, rec.comm );
+        break;
+
+      case TraceIsend:
+        enQ_isend( evQ, buf, rec.count, rec.dtype, rec.peer, rec.tag, rec.comm, request( rec.slots[0] ) );
+        break;
+
+      case TraceIrecv:
+        enQ_irecv( evQ, buf, rec.count, rec.dtype, rec.peer, rec.tag, rec.comm, request( rec.slots[0] ) );
+        break;
+
+      case TraceWait:
+        enQ_wait( evQ, request( rec.slots[0] ) );
+        break;
+
+      // Slots are not contiguous, so a waitall completes its requests one at a time
+      case TraceWaitall:
+        for ( size_t i = 0; i < rec.slots.size(); i++ ) {
+            enQ_wait( evQ, request( rec.slots[i] ) );
+        }
+        break;
+
+      // Which request completed was not recorded, wait for the first one
+      case TraceWaitany:
+      case TraceTestany:
+        if ( ! rec.slots.empty() ) {
+            enQ_wait( evQ, request( rec.slots[0] ) );
+        }
+        break;
+
+      case TraceTest:
+        m_flags.push_back( 0 );
+        enQ_test( evQ, request( rec.slots[0] ), &m_flags.back() );
+        break;
+
+      case TraceBarrier:
+        enQ_barrier( evQ, rec.comm );
+        break;
+
+      case TraceBcast:
+        enQ_bcast( evQ, buf, rec.count, rec.dtype, rec.root, rec.comm );
+        break;
+
+      case TraceReduce:
+        enQ_reduce( evQ, buf, buf, rec.count, rec.dtype, rec.rop, rec.root, rec.comm );
+        break;
+
+      case TraceAllreduce:
+        enQ_allreduce( evQ, buf, buf, rec.count, rec.dtype, rec.rop, rec.comm );
+        break;
+
+      case TraceAlltoall:
+        enQ_alltoall( evQ, buf, rec.count, rec.dtype, buf, rec.recvCount, rec.recvType, rec.comm );
+        break;
+
+      case TraceAllgather:
+        {
+            Hermes::MemAddr sendData( buf ), recvData( buf );
+            enQ_allgather( evQ, sendData, rec.count, rec.dtype, recvData, rec.recvCount, rec.recvType, rec.comm );
+        }
+        break;
+
+      case TraceAlltoallv:
+        {
+            for ( int i = 0; i < 4; i++ ) {
+                m_arrays.push_back( rec.arrays[i] );
+            }
+            size_t first = m_arrays.size() - 4;
+            enQ_alltoallv( evQ, buf, &m_arrays[first][0], &m_arrays[first + 1][0], rec.dtype,
+                    buf, &m_arrays[first + 2][0], &m_arrays[first + 3][0], rec.recvType, rec.comm );
+        }
+        break;
+
+      case TraceAllgatherv:
+        {
+            m_arrays.push_back( rec.arrays[2] );
+            m_arrays.push_back( rec.arrays[3] );
+            size_t first = m_arrays.size() - 2;
+            Hermes::MemAddr sendData( buf ), recvData( buf );
+            enQ_allgatherv( evQ, sendData, rec.count, rec.dtype,
+                    recvData, &m_arrays[first][0], &m_arrays[first + 1][0], rec.recvType, rec.comm );
+        }
+        break;
+
+      case TraceScatter:
+        {
+            Hermes::MemAddr sendData( buf ), recvData( buf );
+            enQ_scatter( evQ, sendData, rec.count, rec.dtype, recvData, rec.recvCount, rec.recvType, rec.root, rec.comm );
+        }
+        break;
+
+      // New communicators get the same handles as when recorded since they are created in the same order
+      case TraceCommSplit:
+        m_newComms.push_back( 0 );
+        enQ_commSplit( evQ, rec.comm, rec.color, rec.key, &m_newComms.back() );
+        break;
+
+      case TraceCommCreate:
+        m_arrays.push_back( rec.arrays[0] );
+        m_newComms.push_back( 0 );
+        enQ_commCreate( evQ, rec.comm, m_arrays.back(), &m_newComms.back() );
+        break;
+
+      case TraceCommDestroy:
+        enQ_commDestroy( evQ, rec.comm );
+        break;
+
+      case TraceNumOps:
+        break;
+    }
+}
@@ -0,0 +1,99 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_EMBER_TRACE_REPLAY
+#define _H_EMBER_TRACE_REPLAY
+
+#include <deque>
+
+#include "mpi/embermpigen.h"
+#include "embertrace.h"
+
+namespace SST {
+namespace Ember {
+
+/*
+ * Replays a binary call trace written by an EmberEngine with the
+ * "traceRecord" parameter set. Records are decoded a window at a time
+ * from the memory-mapped trace, so only the events of the current
+ * window are held in memory. Message buffers are not backed.
+ */
+class EmberTraceReplayGenerator : public EmberMessagePassingGenerator {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        EmberTraceReplayGenerator,
+        "ember",
+        "TraceReplayMotif",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Replays a binary trace recorded with the engine traceRecord parameter",
+        SST::Ember::EmberGenerator
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {   "arg.tracePrefix",  "Sets the file prefix the trace was recorded with, rank N reads <prefix>.N.etr", "" },
+        {   "arg.window",       "Sets the number of records decoded per refill of the event queue", "256" },
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "time-Init", "Time spent in Init event",          "ns",  0},
+        { "time-Finalize", "Time spent in Finalize event",  "ns", 0},
+        { "time-Rank", "Time spent in Rank event",          "ns", 0},
+        { "time-Size", "Time spent in Size event",          "ns", 0},
+        { "time-Send", "Time spent in Recv event",          "ns", 0},
+        { "time-Recv", "Time spent in Recv event",          "ns", 0},
+        { "time-Irecv", "Time spent in Irecv event",        "ns", 0},
+        { "time-Isend", "Time spent in Isend event",        "ns", 0},
+        { "time-Wait", "Time spent in Wait event",          "ns", 0},
+        { "time-Waitall", "Time spent in Waitall event",    "ns", 0},
+        { "time-Waitany", "Time spent in Waitany event",    "ns", 0},
+        { "time-Compute", "Time spent in Compute event",    "ns", 0},
+        { "time-Barrier", "Time spent in Barrier event",    "ns", 0},
+        { "time-Alltoallv", "Time spent in Alltoallv event", "ns", 0},
+        { "time-Alltoall", "Time spent in Alltoall event",  "ns", 0},
+        { "time-Allreduce", "Time spent in Allreduce event", "ns", 0},
+        { "time-Reduce", "Time spent in Reduce event",      "ns", 0},
+        { "time-Bcast", "Time spent in Bcast event",        "ns", 0},
+        { "time-Gettime", "Time spent in Gettime event",    "ns", 0},
+        { "time-Commsplit", "Time spent in Commsplit event", "ns", 0},
+        { "time-Commcreate", "Time spent in Commcreate event", "ns", 0},
+    )
+
+public:
+	EmberTraceReplayGenerator(SST::ComponentId_t, Params& params);
+	~EmberTraceReplayGenerator();
+    bool generate( std::queue<EmberEvent*>& evQ );
+
+private:
+    void replay( std::queue<EmberEvent*>& evQ, const EmberTraceReader::Record& rec );
+    MessageRequest* request( uint32_t slot );
+
+    std::string         m_tracePrefix;
+    uint32_t            m_window;
+    EmberTraceReader*   m_reader;
+    EmberTraceReader::Record m_record;
+
+    /* Storage referenced by queued events, stable until the next refill */
+    std::deque<MessageRequest>      m_requests;
+    std::deque<std::vector<int> >   m_arrays;
+    std::deque<int>                 m_flags;
+    std::deque<Communicator>        m_newComms;
+};
+
+}
+}
+
+#endif
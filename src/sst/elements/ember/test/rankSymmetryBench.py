@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+#
+# Compare host memory and run time of Halo3D, Allreduce and FFT3D with and
+# without arg.sharedProgram, where ranks with identical motif parameters
+# walk one shared event program instead of generating their own events.
+#
+# Run from this directory:
+#   ./rankSymmetryBench.py --shape=32x32x32 --numCores=4
+#
+# Each configuration runs in its own sst process; peak RSS comes from the
+# child's resource usage.
+
+import getopt
+import os
+import subprocess
+import sys
+import time
+
+shape = '16x16x16'
+numCores = 4
+iterations = 10
+motifs = ['Halo3D', 'Allreduce', 'FFT3D']
+sst = 'sst'
+
+def usage():
+    print('usage: rankSymmetryBench.py [--shape=XxYxZ] [--numCores=N] [--iterations=N] [--motif=NAME] [--sst=PATH]')
+    sys.exit(1)
+
+try:
+    opts, args = getopt.getopt(sys.argv[1:], '', ['shape=', 'numCores=', 'iterations=', 'motif=', 'sst='])
+except getopt.GetoptError as err:
+    print(str(err))
+    usage()
+
+for o, a in opts:
+    if o == '--shape':
+        shape = a
+    elif o == '--numCores':
+        numCores = int(a)
+    elif o == '--iterations':
+        iterations = int(a)
+    elif o == '--motif':
+        motifs = [a]
+    elif o == '--sst':
+        sst = a
+    else:
+        usage()
+
+dims = [int(x) for x in shape.split('x')]
+if len(dims) != 3:
+    usage()
+numRanks = dims[0] * dims[1] * dims[2] * numCores
+
+def halo3dArgs():
+    # Fix the decomposition, automatic search is cubic in the number of ranks
+    return 'nx=32 ny=32 nz=32 pex={0} pey={1} pez={2} iterations={3}'.format(
+            dims[0] * numCores, dims[1], dims[2], iterations)
+
+def allreduceArgs():
+    return 'iterations={0} count=1'.format(iterations)
+
+def fft3dArgs():
+    npRow = 1
+    while npRow * npRow < numRanks:
+        npRow *= 2
+    while numRanks % npRow:
+        npRow //= 2
+    n = max(64, numRanks // npRow)
+    return 'nx={0} ny={0} nz={0} npRow={1} iterations={2}'.format(n, npRow, iterations)
+
+motifArgs = {
+    'Halo3D': halo3dArgs,
+    'Allreduce': allreduceArgs,
+    'FFT3D': fft3dArgs,
+}
+
+def run(motif, shared):
+    cmdLine = '{0} {1} sharedProgram={2}'.format(motif, motifArgs[motif](), 1 if shared else 0)
+    modelOptions = '--topo=torus --shape={0} --numCores={1} --cmdLine="Init" --cmdLine="{2}" --cmdLine="Fini"'.format(
+            shape, numCores, cmdLine)
+
+    start = time.time()
+    proc = subprocess.Popen([sst, '--model-options=' + modelOptions, 'emberLoad.py'],
+            stdout=subprocess.DEVNULL)
+    pid, status, rusage = os.wait4(proc.pid, 0)
+    elapsed = time.time() - start
+
+    if status != 0:
+        sys.exit('Error: {0} failed'.format(cmdLine))
+
+    # ru_maxrss is in KB on Linux
+    return elapsed, rusage.ru_maxrss / 1024.0
+
+print('{0} ranks, shape {1}, {2} cores per node, {3} iterations'.format(numRanks, shape, numCores, iterations))
+print('{0:<10} {1:>12} {2:>12} {3:>12} {4:>12} {5:>8} {6:>8}'.format(
+        'motif', 'time (s)', 'shared (s)', 'RSS (MB)', 'shared (MB)', 'speedup', 'memory'))
+
+for motif in motifs:
+    baseTime, baseRss = run(motif, False)
+    sharedTime, sharedRss = run(motif, True)
+    print('{0:<10} {1:>12.2f} {2:>12.2f} {3:>12.1f} {4:>12.1f} {5:>7.2f}x {6:>7.2f}x'.format(
+            motif, baseTime, sharedTime, baseRss, sharedRss, baseTime / sharedTime, baseRss / sharedRss))
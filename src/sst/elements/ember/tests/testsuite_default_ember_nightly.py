@@ -3,7 +3,10 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import filecmp
+import glob
 import os
+import re
 
 
 class testcase_EmberNightly(SSTTestCase):
@@ -26,10 +29,119 @@ class testcase_EmberNightly(SSTTestCase):
         otherargs = '--verbose --model-options \"--topo=torus --shape=4x4x4 --cmdLine=\"Init\" --cmdLine=\"Allreduce\" --cmdLine=\"Fini\" \"'
         self.Ember_test_template("test_emberparams", otherargs = otherargs, testoutput = False)
 
+    # Allreduce with and without NIC offload, with and without combining in
+    # the leaf routers. All of them verify their sums and fail the run on a
+    # wrong one. The offloaded runs must take a different amount of time
+    # than the software tree, otherwise the offload was not used, and
+    # combining must change the time of the offload, otherwise the reducer
+    # did not combine any packets.
+    def test_Ember_NicCollectives(self):
+        net_args = "--topo=torus --shape=2x2x2 --hostsPerRtr=4"
+        cmd_args = "--cmdLine=\\\"Init\\\" --cmdLine=\\\"Allreduce count=8 iterations=4 verify=1\\\" --cmdLine=\\\"Fini\\\""
+        nic_args = "--param=hermes:hermesParams.functionSM.nicCollectiveSize=64 --param=nic:coll.hostsPerRouter=4"
+        reducer_args = "--param=merlin:packet_reducer=firefly.collReducer"
+
+        variants = [ ("software", ""),
+                     ("offload", nic_args),
+                     ("offload_combine", "{0} {1}".format(nic_args, reducer_args)) ]
+
+        latency = {}
+        for name, args in variants:
+            otherargs = '--model-options=\"{0} {1} {2}\"'.format(net_args, cmd_args, args)
+            outfile = self.Ember_test_template("test_embernic_{0}".format(name), otherargs = otherargs, testoutput = False)
+
+            with open(outfile) as f:
+                output = f.read()
+            match = re.search(r"Allreduce: ranks 32, loop 4, 8 double\(s\), latency ([0-9.]+) us", output)
+            self.assertTrue(match is not None, "Allreduce {0} did not report its latency, see {1}".format(name, outfile))
+            latency[name] = float(match.group(1))
+
+        self.assertNotEqual(latency["offload"], latency["software"], "NIC offload was not used")
+        self.assertNotEqual(latency["offload_combine"], latency["software"], "NIC offload with combining was not used")
+        self.assertNotEqual(latency["offload_combine"], latency["offload"], "The leaf routers did not combine any packets")
+
+    # Record the calls of Ring and Allreduce, replay them with TraceReplay
+    # and record the replay. The replay must issue exactly the recorded
+    # calls, so every rank's two traces must be identical.
+    def test_Ember_TraceReplay(self):
+        tmpdir = self.get_test_output_tmp_dir()
+        net_args = "--topo=torus --shape=2x2x2"
+        recorded = "{0}/test_embertrace_recorded".format(tmpdir)
+        replayed = "{0}/test_embertrace_replayed".format(tmpdir)
+        for prefix in [ recorded, replayed ]:
+            for f in glob.glob("{0}.*.etr".format(prefix)):
+                os.remove(f)
+
+        cmd_args = "--cmdLine=\\\"Init\\\" --cmdLine=\\\"Ring iterations=4\\\" --cmdLine=\\\"Allreduce count=8 iterations=2\\\" --cmdLine=\\\"Fini\\\""
+        otherargs = '--model-options=\"{0} {1} --param=ember:traceRecord={2}\"'.format(net_args, cmd_args, recorded)
+        self.Ember_test_template("test_embertrace_record", otherargs = otherargs, testoutput = False)
+
+        cmd_args = "--cmdLine=\\\"Init\\\" --cmdLine=\\\"TraceReplay tracePrefix={0} window=16\\\" --cmdLine=\\\"Fini\\\"".format(recorded)
+        otherargs = '--model-options=\"{0} {1} --param=ember:traceRecord={2}\"'.format(net_args, cmd_args, replayed)
+        outfile = self.Ember_test_template("test_embertrace_replay", otherargs = otherargs, testoutput = False)
+
+        with open(outfile) as f:
+            output = f.read()
+        self.assertTrue(re.search(r"TraceReplay: replayed [1-9]\d* records", output), "TraceReplay did not replay the trace, see {0}".format(outfile))
+
+        traces = sorted(glob.glob("{0}.*.etr".format(recorded)))
+        self.assertEqual(len(traces), 8, "Expected a trace for each of 8 ranks, found {0}".format(traces))
+        for trace in traces:
+            replay = replayed + trace[len(recorded):]
+            self.assertTrue(os.path.isfile(replay), "Replay of {0} was not recorded".format(trace))
+            self.assertTrue(filecmp.cmp(trace, replay, shallow=False), "Replay trace {0} does not match the recorded trace {1}".format(replay, trace))
+
+    # Run Halo3D, Allreduce and FFT3D with and without a shared event
+    # program. Halo3D is not periodic, so its boundary ranks skip faces.
+    # The shared program has to issue the same operations as the per rank
+    # generator, so the motif output and the simulated time must match.
+    def test_Ember_SharedProgram(self):
+        net_args = "--topo=torus --shape=2x2x2 --hostsPerRtr=2"
+        motifs = [ ("halo3d", "Halo3D", "nx=16 ny=16 nz=16 pex=4 pey=2 pez=2 iterations=4 doreduce=1"),
+                   ("allreduce", "Allreduce", "count=8 iterations=4"),
+                   ("fft3d", "FFT3D", "nx=32 ny=32 nz=32 npRow=4 iterations=2") ]
+
+        for name, motif, args in motifs:
+            results = []
+            for shared in [ 0, 1 ]:
+                testcase = "test_embershared_{0}_{1}".format(name, shared)
+                cmd_args = "--cmdLine=\\\"Init\\\" --cmdLine=\\\"{0} {1} sharedProgram={2}\\\" --cmdLine=\\\"Fini\\\"".format(motif, args, shared)
+                otherargs = '--model-options=\"{0} {1}\"'.format(net_args, cmd_args)
+                outfile = self.Ember_test_template(testcase, otherargs = otherargs, testoutput = False)
+
+                with open(outfile) as f:
+                    lines = [ line.strip() for line in f if motif in line or line.startswith("Simulation is complete") ]
+                self.assertTrue(any(line.startswith("Simulation is complete") for line in lines),
+                        "{0} sharedProgram={1} did not complete, see {2}".format(motif, shared, outfile))
+                results.append((lines, outfile))
+
+            self.assertEqual(results[0][0], results[1][0],
+                    "{0} with a shared program {1} does not match the per rank run {2}".format(motif, results[1][1], results[0][1]))
+
+    # Run the bundled model with every gradient allreduce algorithm, with
+    # and without overlapping it with the backward pass. Each run has to
+    # finish and report a step time for its 32 ranks.
+    def test_Ember_DLTraining(self):
+        modelfile = "{0}/../test/dlTraining.model".format(self.get_testsuite_dir())
+        net_args = "--topo=torus --shape=2x2x2 --hostsPerRtr=4"
+        for algorithm in [ "ring", "halving", "tree" ]:
+            for overlap in [ 0, 1 ]:
+                name = "test_emberdltraining_{0}_{1}".format(algorithm, "overlap" if overlap else "serial")
+                cmd_args = "--cmdLine=\\\"Init\\\" --cmdLine=\\\"DLTraining modelFile={0} iterations=1 algorithm={1} overlap={2}\\\" --cmdLine=\\\"Fini\\\"".format(modelfile, algorithm, overlap)
+                otherargs = '--model-options=\"{0} {1}\"'.format(net_args, cmd_args)
+                outfile = self.Ember_test_template(name, otherargs = otherargs, testoutput = False, testtimeout = 600)
+
+                with open(outfile) as f:
+                    output = f.read()
+                match = re.search(r"DLTraining: ranks 32, dp 8, pp 4, ep 4, step time ([0-9.]+) ms", output)
+                self.assertTrue(match is not None, "DLTraining {0} did not report a step time, see {1}".format(name, outfile))
+                self.assertTrue(float(match.group(1)) > 0, "DLTraining {0} reported a zero step time, see {1}".format(name, outfile))
+                self.assertTrue(re.search(r"Simulation is complete", output), "DLTraining {0} did not complete, see {1}".format(name, outfile))
+
 
 #####
 
-    def Ember_test_template(self, testcase, otherargs, testoutput):
+    def Ember_test_template(self, testcase, otherargs, testoutput, testtimeout = 120):
 
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
@@ -49,7 +161,7 @@ class testcase_EmberNightly(SSTTestCase):
         sdlfile = "{0}/../test/emberLoad.py".format(test_path)
 
         # Run SST
-        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, set_cwd=self.emberSweep_Folder, mpi_out_files=mpioutfiles)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, set_cwd=self.emberSweep_Folder, mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
 
 #        testing_remove_component_warning_from_file(outfile)
 
@@ -68,6 +180,8 @@ class testcase_EmberNightly(SSTTestCase):
         if os_test_file(errfile, "-s"):
             log_testing_note("Ember Nightly test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
 
+        return outfile
+
 
 ###############################################
 
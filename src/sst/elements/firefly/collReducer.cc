@@ -0,0 +1,116 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+
+#include "collReducer.h"
+#include "nic.h"
+#include "funcSM/collectiveOps.h"
+
+using namespace SST;
+using namespace SST::Firefly;
+using namespace SST::Interfaces;
+
+std::map< int, CollReducer::EntryMap* > CollReducer::m_routerMap;
+SST::Core::ThreadSafe::Spinlock CollReducer::m_mapLock;
+
+CollReducer::CollReducer( ComponentId_t id, Params& params, int rtrId ) :
+    PacketReducer( id )
+{
+    m_dbg.init("@t:CollReducer::@p():@l ", params.find<uint32_t>("verboseLevel",0), 0, Output::STDOUT );
+
+    m_packetsCombined = registerStatistic<uint64_t>("packetsCombined");
+
+    // all the host ports of a router share one map
+    m_mapLock.lock();
+    EntryMap*& held = m_routerMap[rtrId];
+    if ( NULL == held ) {
+        held = new EntryMap;
+    }
+    m_held = held;
+    m_mapLock.unlock();
+}
+
+CollReducer::~CollReducer()
+{
+    m_mapLock.lock();
+    for ( auto& x : m_routerMap ) {
+        if ( x.second == m_held ) {
+            for ( auto& y : *m_held ) {
+                delete y.second;
+            }
+            delete m_held;
+            m_routerMap.erase( x.first );
+            break;
+        }
+    }
+    m_mapLock.unlock();
+}
+
+SimpleNetwork::Request* CollReducer::reduce( SimpleNetwork::Request* req )
+{
+    FireflyNetworkEvent* ev = dynamic_cast<FireflyNetworkEvent*>( req->inspectPayload() );
+
+    // only single packet collective messages going up the tree
+    if ( NULL == ev || ! ev->isHdr() || ! ev->isTail() ) {
+        return req;
+    }
+
+    Nic::MsgHdr* msgHdr = (Nic::MsgHdr*) ev->bufPtr();
+    if ( NULL == msgHdr || msgHdr->op != Nic::MsgHdr::Coll ) {
+        return req;
+    }
+
+    Nic::CollMsgHdr* hdr = (Nic::CollMsgHdr*) ev->bufPtr( sizeof(Nic::MsgHdr) );
+    if ( NULL == hdr || hdr->phase != Nic::CollMsgHdr::Up || hdr->fanin <= hdr->contribs ) {
+        return req;
+    }
+
+    Key key( req->dest, ev->getDestPid(), hdr->key );
+
+    auto iter = m_held->find( key );
+    if ( iter == m_held->end() ) {
+        m_dbg.verbose(CALL_INFO,1,0,"hold dest=%" PRIi64 ":%d key=%#x fanin=%d\n",
+                req->dest, ev->getDestPid(), hdr->key, hdr->fanin );
+        (*m_held)[key] = req;
+        return nullptr;
+    }
+
+    SimpleNetwork::Request* accReq = iter->second;
+    FireflyNetworkEvent* accEv = static_cast<FireflyNetworkEvent*>( accReq->inspectPayload() );
+    Nic::CollMsgHdr* accHdr = (Nic::CollMsgHdr*) accEv->bufPtr( sizeof(Nic::MsgHdr) );
+
+    if ( hdr->length ) {
+        size_t offset = sizeof(Nic::MsgHdr) + sizeof(Nic::CollMsgHdr);
+        void* input[2] = { accEv->bufPtr( offset ), ev->bufPtr( offset ) };
+        Hermes::MP::_ReductionOperation op( (Hermes::MP::ReductionOpType) hdr->redOp );
+        collectiveOp( input, 2, input[0], hdr->count, (Hermes::MP::PayloadDataType) hdr->dataType, &op );
+    }
+    accHdr->contribs += hdr->contribs;
+    m_packetsCombined->addData(1);
+
+    m_dbg.verbose(CALL_INFO,1,0,"combine dest=%" PRIi64 ":%d key=%#x contribs=%d fanin=%d\n",
+            req->dest, ev->getDestPid(), hdr->key, accHdr->contribs, accHdr->fanin );
+
+    delete req;
+
+    if ( accHdr->contribs < accHdr->fanin ) {
+        return nullptr;
+    }
+
+    m_held->erase( iter );
+    return accReq;
+}
@@ -0,0 +1,75 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_FIREFLY_COLL_REDUCER_H
+#define COMPONENTS_FIREFLY_COLL_REDUCER_H
+
+#include <map>
+#include <tuple>
+
+#include <sst/core/output.h>
+#include <sst/core/threadsafe.h>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Firefly {
+
+// Combines the upward packets of NIC offloaded collectives as they enter
+// a router. Every host port of a router gets its own reducer, they share
+// the packets being held so contributions from different hosts meet.
+class CollReducer : public SST::Merlin::PacketReducer {
+
+  public:
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        CollReducer,
+        "firefly",
+        "collReducer",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Combines firefly NIC collective packets in the router",
+        SST::Merlin::PacketReducer
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"verboseLevel","Sets the output verbosity of the component","0"},
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "packetsCombined", "number of packets folded into another packet", "packets", 1 },
+    )
+
+    CollReducer( ComponentId_t id, Params& params, int rtrId );
+    ~CollReducer();
+
+    SST::Interfaces::SimpleNetwork::Request* reduce( SST::Interfaces::SimpleNetwork::Request* req );
+
+  private:
+    // destination node, destination core, collective key
+    typedef std::tuple< int, int, uint32_t > Key;
+    typedef std::map< Key, SST::Interfaces::SimpleNetwork::Request* > EntryMap;
+
+    static std::map< int, EntryMap* > m_routerMap;
+    static SST::Core::ThreadSafe::Spinlock m_mapLock;
+
+    EntryMap*   m_held;
+    Output      m_dbg;
+    Statistic<uint64_t>* m_packetsCombined;
+};
+
+}
+}
+
+#endif
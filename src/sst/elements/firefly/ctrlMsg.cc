@@ -327,6 +327,16 @@ void API::cancel( MP::MessageRequest req )
     m_processQueuesState->enterCancel( req );
 }
 
+void API::collective( uint32_t key, bool up, bool down, MP::RankID parent,
+        std::vector<MP::RankID>& children, std::vector<MP::RankID>& siblings,
+        const Hermes::MemAddr& src, const Hermes::MemAddr& dest, uint32_t count,
+        MP::PayloadDataType dtype, MP::ReductionOpType op, size_t length, MP::Communicator group )
+{
+    m_dbg.debug(CALL_INFO,1,1,"key=%#x\n",key);
+    m_processQueuesState->enterCollective( key, up, down, parent, children, siblings,
+                        src, dest, count, dtype, op, length, group );
+}
+
 void API::test( MP::MessageRequest req, int* flag, MP::MessageResponse* resp )
 {
     m_dbg.debug(CALL_INFO,1,1,"%p %p\n",req,resp);
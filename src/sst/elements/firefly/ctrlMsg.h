@@ -124,6 +124,12 @@ class API : public ProtocolAPI {
         MP::Communicator group, MP::MessageRequest* req );
 
 	void cancel( MP::MessageRequest );
+
+    // hand a collective tree off to the NIC, parent is -1 at the root
+    void collective( uint32_t key, bool up, bool down, MP::RankID parent,
+        std::vector<MP::RankID>& children, std::vector<MP::RankID>& siblings,
+        const Hermes::MemAddr& src, const Hermes::MemAddr& dest, uint32_t count,
+        MP::PayloadDataType dtype, MP::ReductionOpType op, size_t length, MP::Communicator group );
 	void test( MP::MessageRequest, int* flag, MP::MessageResponse* resp );
 	void testany( int count, MP::MessageRequest req[], int *index, int* flag,
 		MP::MessageResponse* resp );
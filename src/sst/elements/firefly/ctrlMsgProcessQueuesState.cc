@@ -421,6 +421,41 @@ void ProcessQueuesState::enterCancel( MP::MessageRequest req, uint64_t exitDelay
     enterMakeProgress(m_exitDelay);
 }
 
+void ProcessQueuesState::enterCollective( uint32_t key, bool up, bool down, MP::RankID parent,
+        std::vector<MP::RankID>& children, std::vector<MP::RankID>& siblings,
+        const Hermes::MemAddr& src, const Hermes::MemAddr& dest, uint32_t count,
+        MP::PayloadDataType dtype, MP::ReductionOpType op, size_t length, MP::Communicator group )
+{
+    dbg().debug(CALL_INFO,1,DBG_MSK_PQS_APP_SIDE,"key=%#x parent=%d numChildren=%zu\n",
+                                key, parent, children.size() );
+    m_exitDelay = 0;
+
+    if ( m_nic->isBlocked() ) {
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"nic is blocked\n");
+        m_nic->setBlockedCallback(
+            std::bind( &ProcessQueuesState::enterCollective, this, key, up, down, parent,
+                children, siblings, src, dest, count, dtype, op, length, group ) );
+        return;
+    }
+
+    Group* grp = m_info->getGroup( group );
+
+    nid_t parentNid = -1 == parent ? -1 : grp->getMapping( parent );
+    std::vector<int> childNids;
+    for ( unsigned i = 0; i < children.size(); i++ ) {
+        childNids.push_back( grp->getMapping( children[i] ) );
+    }
+    std::vector<int> siblingNids;
+    for ( unsigned i = 0; i < siblings.size(); i++ ) {
+        siblingNids.push_back( grp->getMapping( siblings[i] ) );
+    }
+
+    Hermes::MemAddr srcAddr = src;
+    Hermes::MemAddr destAddr = dest;
+    m_nic->collective( key, up, down, parentNid, childNids, siblingNids, srcAddr, destAddr,
+                count, dtype, op, length, [=]() { exit(); } );
+}
+
 void ProcessQueuesState::enterTest( WaitReq* req, int* flag, uint64_t exitDelay  )
 {
 	dbg().debug(CALL_INFO,1,DBG_MSK_PQS_APP_SIDE,"\n");
@@ -156,6 +156,10 @@ class ProcessQueuesState : public SubComponent
     void enterMakeProgress( uint64_t exitDelay = 0 );
     void enterCancel( MP::MessageRequest, uint64_t exitDelay = 0 );
     void enterTest( WaitReq*, int* flag, uint64_t exitDelay = 0 );
+    void enterCollective( uint32_t key, bool up, bool down, MP::RankID parent,
+        std::vector<MP::RankID>& children, std::vector<MP::RankID>& siblings,
+        const Hermes::MemAddr& src, const Hermes::MemAddr& dest, uint32_t count,
+        MP::PayloadDataType, MP::ReductionOpType, size_t length, MP::Communicator );
 
     void needRecv( int, size_t );
 
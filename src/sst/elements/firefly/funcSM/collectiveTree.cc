@@ -66,10 +66,12 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
     }
 
 
+    bool nic = useNic();
+
     m_bufV[0] = m_event->mydata.getBacking();
 
     for ( unsigned int i = 0; i < m_yyy->numChildren(); i++ ) {
-        if ( m_event->mydata.getBacking() ) {
+        if ( ! nic && m_event->mydata.getBacking() ) {
             m_bufV[i+1] = malloc( m_bufLen );
             assert( m_bufV[i+1] );
         } else {
@@ -79,6 +81,11 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
 
     m_waitUpState.init();
     m_sendDownState.init();
+    if ( nic ) {
+        m_state = Exit;
+        startNic();
+        return;
+    }
     if ( m_event->type == CollectiveStartEvent::Bcast ) {
         m_state = WaitDown;
     } else {
@@ -87,6 +94,51 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
     handleEnterEvent( retval );
 }
 
+bool CollectiveTreeFuncSM::useNic()
+{
+    return m_nicCollectiveSize && m_bufLen <= (size_t) m_nicCollectiveSize &&
+            m_event->op->type != MP::ReductionOpType::Func;
+}
+
+// The NIC runs its own tree, which can be wider than the software one, and
+// calls us back once this rank's part of the collective is done.
+void CollectiveTreeFuncSM::startNic()
+{
+    Group* group = m_info->getGroup( m_event->group );
+    YYY tree( m_nicCollectiveRadix, group->getMyRank(), group->getSize(), m_event->root );
+
+    std::vector<MP::RankID> children;
+    for ( unsigned int i = 0; i < tree.numChildren(); i++ ) {
+        children.push_back( tree.calcChild( i ) );
+    }
+
+    std::vector<MP::RankID> siblings;
+    if ( -1 != tree.parent() ) {
+        YYY parent( m_nicCollectiveRadix, tree.parent(), group->getSize(), m_event->root );
+        for ( unsigned int i = 0; i < parent.numChildren(); i++ ) {
+            siblings.push_back( parent.calcChild( i ) );
+        }
+    }
+
+    // barrier runs in its own function state machine and has its own
+    // sequence, the zero length keeps it apart from allreduce
+    uint32_t seq = m_nicSeq[ m_event->group ]++;
+    uint32_t key = ( m_event->group & 0xff ) << 24 | m_event->type << 22 |
+                        ( 0 == m_bufLen ) << 21 | ( seq & 0x1fffff );
+
+    bool up = m_event->type != CollectiveStartEvent::Bcast;
+    bool down = m_event->type != CollectiveStartEvent::Reduce;
+
+    m_dbg.debug(CALL_INFO,1,0,"offload key=%#x parent=%d numChildren=%zu\n",
+                        key, tree.parent(), children.size() );
+
+    proto()->collective( key, up, down, tree.parent(), children, siblings,
+            m_event->mydata, up ? m_event->result : m_event->mydata,
+            m_event->count, m_event->dtype,
+            up ? m_event->op->type : MP::ReductionOpType::Nop,
+            m_bufLen, m_event->group );
+}
+
 void CollectiveTreeFuncSM::handleEnterEvent( Retval& retval )
 {
 	Hermes::MemAddr addr;
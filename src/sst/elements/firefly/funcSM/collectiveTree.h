@@ -143,6 +143,8 @@ private:
     {
         m_smallCollectiveVN = params.find<int>( "smallCollectiveVN", 0);
         m_smallCollectiveSize = params.find<int>( "smallCollectiveSize", 0);
+        m_nicCollectiveSize = params.find<int>( "nicCollectiveSize", 0);
+        m_nicCollectiveRadix = params.find<int>( "nicCollectiveRadix", 2);
     }
 
     virtual void handleStartEvent( SST::Event*, Retval& );
@@ -156,6 +158,9 @@ private:
 
     CtrlMsg::API* proto() { return static_cast<CtrlMsg::API*>(m_proto); }
 
+    bool useNic();
+    void startNic();
+
     WaitUpState         m_waitUpState;
     SendDownState       m_sendDownState;
 
@@ -172,6 +177,12 @@ private:
     int m_vn;
     int m_smallCollectiveVN;
     int m_smallCollectiveSize;
+    int m_nicCollectiveSize;
+    int m_nicCollectiveRadix;
+
+    // every member of a group sees the same sequence of offloaded
+    // collectives, the count is kept per group so the NIC keys match
+    std::map< MP::Communicator, uint32_t > m_nicSeq;
 };
 
 }
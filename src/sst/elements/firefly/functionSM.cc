@@ -100,6 +100,10 @@ void FunctionSM::setup( Info* info )
                         m_params.find<std::string>("smallCollectiveVN","0"), true );
     defaultParams.insert( "smallCollectiveSize",
                         m_params.find<std::string>("smallCollectiveSize","0"), true );
+    defaultParams.insert( "nicCollectiveSize",
+                        m_params.find<std::string>("nicCollectiveSize","0"), true );
+    defaultParams.insert( "nicCollectiveRadix",
+                        m_params.find<std::string>("nicCollectiveRadix","2"), true );
     defaultParams.insert( "verboseLevel", m_params.find<std::string>("verboseLevel","0"), true );
     std::ostringstream tmp;
     tmp <<  nodeId;
@@ -147,6 +151,12 @@ void FunctionSM::initFunction( Info* info,
     if ( params.find<std::string>("smallCollectiveSize").empty() ) {
         params.insert( "smallCollectiveSize", defaultParams.find<std::string>( "smallCollectiveSize" ), true );
     }
+    if ( params.find<std::string>("nicCollectiveSize").empty() ) {
+        params.insert( "nicCollectiveSize", defaultParams.find<std::string>( "nicCollectiveSize" ), true );
+    }
+    if ( params.find<std::string>("nicCollectiveRadix").empty() ) {
+        params.insert( "nicCollectiveRadix", defaultParams.find<std::string>( "nicCollectiveRadix" ), true );
+    }
 
     params.insert( "nodeId", defaultParams.find<std::string>( "nodeId" ), true );
 
@@ -86,6 +86,8 @@ class FunctionSM : public SubComponent {
 		{"defaultReturnLatency","Sets the default latency to return from a function","0"},
 		{"smallCollectiveVN","Sets the VN to use for small collectives","0"},
 		{"smallCollectiveSize","Sets the size of small collectives","0"},
+		{"nicCollectiveSize","Collectives up to this many bytes are offloaded to the NIC, 0 disables offload","0"},
+		{"nicCollectiveRadix","Sets the degree of the tree used by NIC offloaded collectives","2"},
 		{"nodeId","Sets the node ID",""},
 	)
 	/* PARAMS
@@ -192,6 +192,9 @@ Nic::Nic(ComponentId_t id, Params &params) :
 		m_shmem->regMem( 0, 0, FAM_memSizeBytes, backing );
 	}
 
+	Params collParams = params.get_scoped_params( "coll" );
+	m_coll = new Coll( *this, collParams, m_myNodeId, m_num_vNics, m_dbg, packetSizeInBytes - packetOverhead, getDelay_ns() );
+
     if ( params.find<int>( "useSimpleMemoryModel", 0 ) ) {
         Params smmParams = params.get_scoped_params( "simpleMemoryModel" );
         smmParams.insert( "busLatency",  std::to_string(m_nic2host_lat_ns), false );
@@ -328,6 +331,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
 Nic::~Nic()
 {
 	delete m_shmem;
+	delete m_coll;
 	delete m_unitPool;
  	delete m_linkSendWidget;
 	delete m_linkRecvWidget;
@@ -392,6 +396,10 @@ void Nic::handleVnicEvent( Event* ev, int id )
 		m_shmem->handleEvent( static_cast<NicShmemCmdEvent*>(event), id );
 		break;
 
+      case NicCmdBaseEvent::Coll:
+		m_coll->handleEvent( static_cast<NicCollCmdEvent*>(event), id );
+		break;
+
 	  default:
 		assert(0);
 	}
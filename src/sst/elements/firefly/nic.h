@@ -26,6 +26,7 @@
 #include <sst/core/link.h>
 
 #include "sst/elements/hermes/shmemapi.h"
+#include "sst/elements/hermes/msgapi.h"
 #include "sst/elements/thornhill/detailedCompute.h"
 #include "ioVec.h"
 #include "merlinEvent.h"
@@ -52,9 +53,14 @@ namespace Firefly {
 #define NIC_DBG_RECV_STREAM  (1<<8)
 #define NIC_DBG_RECV_MOVE    (1<<9)
 #define NIC_DBG_LINK_CTRL    (1<<10)
+#define NIC_DBG_COLL         (1<<11)
+
+class CollReducer;
 
 class Nic : public SST::Component  {
 
+    friend class CollReducer;
+
 public:
     SST_ELI_REGISTER_COMPONENT(
         Nic,
@@ -110,6 +116,11 @@ public:
         { "shmem.nicCmdLatency", "Latency for posting shmem command on NIC", "10"},
         { "shmem.hostCmdLatency", "Host latency for posting shmem command", "10"},
 
+        { "coll.nicCmdLatency", "Latency for posting a collective descriptor on NIC", "10"},
+        { "coll.reduceLatency", "Latency of the NIC reduction engine for combining one contribution", "10"},
+        { "coll.vn", "VN to send offloaded collective packets on", "0"},
+        { "coll.hostsPerRouter", "Nodes per leaf router, used to let routers with a firefly.collReducer combine packets, 0 disables", "0"},
+
         { "FAM_memsize", "", "0"},
         { "FAM_backed", "Controls whether FAM memory is backed in the simlation", "yes"},
 
@@ -127,6 +138,7 @@ public:
 
 	/* PARAMS
 		shmem.*
+		coll.*
 		simpleMemoryModel.*
 		detailedCompute.*
 	*/
@@ -205,7 +217,7 @@ public:
 private:
 
     struct __attribute__ ((packed)) MsgHdr {
-        enum Op : unsigned char { Msg, Rdma, Shmem } op;
+        enum Op : unsigned char { Msg, Rdma, Shmem, Coll } op;
     };
 
     struct __attribute__ ((packed)) MatchMsgHdr {
@@ -247,6 +259,18 @@ private:
         }
     };
 
+    // Offloaded collectives fit in a single packet, the data follows the header
+    struct __attribute__ ((packed)) CollMsgHdr {
+        enum Phase : unsigned char { Up, Down } phase;
+        uint8_t  dataType;  // Hermes::MP::PayloadDataType
+        uint8_t  redOp;     // Hermes::MP::ReductionOpType
+        uint32_t key;
+        uint16_t contribs;  // child contributions combined into this packet
+        uint16_t fanin;     // contributions a router may combine before delivery
+        uint32_t count;
+        uint32_t length;
+    };
+
     struct RdmaMsgHdr {
         enum { Put, Get, GetResp } op;
         uint16_t    rgnNum;
@@ -328,6 +352,7 @@ private:
     #include "nicEntryBase.h"
     #include "nicSendEntry.h"
     #include "nicShmemSendEntry.h"
+    #include "nicColl.h"
     #include "nicRecvEntry.h"
     #include "nicSendMachine.h"
     #include "nicRecvMachine.h"
@@ -518,6 +543,7 @@ struct X {
 	DetailedInterface* m_detailedInterface;
 	bool m_useDetailedCompute;
     Shmem* m_shmem;
+    Coll* m_coll;
 	SimTime_t m_nic2host_lat_ns;
 	SimTime_t m_shmemRxDelay_ns;
 
@@ -0,0 +1,240 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "nic.h"
+#include "funcSM/collectiveOps.h"
+
+using namespace SST;
+using namespace SST::Firefly;
+
+void Nic::Coll::handleEvent( NicCollCmdEvent* event, int id )
+{
+    m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_COLL,"core=%d key=%#x up=%d down=%d parent=%d:%d numChildren=%zu length=%zu\n",
+            id, event->key, event->up, event->down, event->parent.node, event->parent.vNic, event->children.size(), event->length );
+
+    if ( event->length > m_maxLength ) {
+        m_dbg.fatal(CALL_INFO,-1,"offloaded collective of %zu bytes does not fit in a packet, max %zu bytes\n",
+                event->length, m_maxLength );
+    }
+
+    m_nic.schedCallback( std::bind( &Nic::Coll::start, this, event, id ), m_nicCmdLatency );
+}
+
+void Nic::Coll::start( NicCollCmdEvent* event, int id )
+{
+    Op* op = getOp( id, event->key );
+    op->cmd = event;
+
+    // only the root of a broadcast and the nodes that contribute to a
+    // reduction need their data from the host
+    if ( ! event->up && -1 != event->parent.node ) {
+        progress( id, event->key );
+        return;
+    }
+
+    if ( 0 == event->length ) {
+        localData( id, event->key );
+        return;
+    }
+
+    std::vector< MemOp >* vec = new std::vector< MemOp >;
+    vec->push_back( MemOp( event->src.getSimVAddr(), event->length, MemOp::Op::BusDmaFromHost ) );
+    m_nic.dmaRead( m_nic.allocNicSendUnit(), id, vec, std::bind( &Nic::Coll::localData, this, id, event->key ) );
+}
+
+void Nic::Coll::localData( int vNic, uint32_t key )
+{
+    Op* op = findOp( vNic, key );
+    NicCollCmdEvent* cmd = op->cmd;
+
+    std::vector<unsigned char> data( cmd->length, 0 );
+    if ( cmd->length && cmd->src.getBacking() ) {
+        memcpy( &data[0], cmd->src.getBacking(), cmd->length );
+    }
+
+    m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_COLL,"core=%d key=%#x\n", vNic, key );
+
+    op->haveLocal = true;
+    if ( cmd->up ) {
+        SimTime_t delay = fold( op, data.empty() ? NULL : &data[0], cmd->length, cmd->count, cmd->dtype, cmd->op );
+        m_nic.schedCallback( std::bind( &Nic::Coll::progress, this, vNic, key ), delay );
+    } else {
+        op->down = data;
+        op->haveDown = true;
+        progress( vNic, key );
+    }
+}
+
+void Nic::Coll::recv( int vNic, const CollMsgHdr& hdr, const void* data )
+{
+    m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_COLL,"core=%d key=%#x %s contribs=%d length=%d\n",
+            vNic, hdr.key, hdr.phase == CollMsgHdr::Up ? "Up" : "Down", hdr.contribs, hdr.length );
+
+    // the host may not have posted its descriptor yet
+    Op* op = getOp( vNic, hdr.key );
+
+    if ( hdr.phase == CollMsgHdr::Up ) {
+        op->contribs += hdr.contribs;
+        SimTime_t delay = fold( op, data, hdr.length, hdr.count,
+                (Hermes::MP::PayloadDataType) hdr.dataType, (Hermes::MP::ReductionOpType) hdr.redOp );
+        m_nic.schedCallback( std::bind( &Nic::Coll::progress, this, vNic, hdr.key ), delay );
+    } else {
+        op->down.assign( (const unsigned char*) data, (const unsigned char*) data + hdr.length );
+        op->haveDown = true;
+        progress( vNic, hdr.key );
+    }
+}
+
+SimTime_t Nic::Coll::fold( Op* op, const void* data, size_t length, uint32_t count,
+        Hermes::MP::PayloadDataType dtype, Hermes::MP::ReductionOpType type )
+{
+    if ( ! op->haveAcc ) {
+        op->acc.assign( (const unsigned char*) data, (const unsigned char*) data + length );
+        op->haveAcc = true;
+        return 0;
+    }
+
+    if ( length ) {
+        Hermes::MP::_ReductionOperation redOp( type );
+        void* input[2] = { &op->acc[0], const_cast<void*>(data) };
+        collectiveOp( input, 2, &op->acc[0], count, dtype, &redOp );
+    }
+    return reserveEngine();
+}
+
+void Nic::Coll::progress( int vNic, uint32_t key )
+{
+    Op* op = findOp( vNic, key );
+    if ( NULL == op || NULL == op->cmd ) {
+        return;
+    }
+    NicCollCmdEvent* cmd = op->cmd;
+
+    m_dbg.verbosePrefix( prefix(),CALL_INFO,2,NIC_DBG_COLL,"core=%d key=%#x haveLocal=%d contribs=%u haveDown=%d\n",
+            vNic, key, op->haveLocal, op->contribs, op->haveDown );
+
+    if ( cmd->up && ! op->upDone ) {
+        if ( ! op->haveLocal || op->contribs < cmd->children.size() ) {
+            return;
+        }
+        op->upDone = true;
+
+        if ( -1 != cmd->parent.node ) {
+            send( vNic, cmd, CollMsgHdr::Up, cmd->parent, op->acc, calcFanin( cmd ) );
+            if ( ! cmd->down ) {
+                finish( vNic, op, false );
+                return;
+            }
+        } else {
+            op->down = op->acc;
+            op->haveDown = true;
+        }
+    }
+
+    if ( ! cmd->down ) {
+        finish( vNic, op, true );
+        return;
+    }
+
+    if ( ! op->haveDown ) {
+        return;
+    }
+
+    for ( unsigned i = 0; i < cmd->children.size(); i++ ) {
+        send( vNic, cmd, CollMsgHdr::Down, cmd->children[i], op->down, 0 );
+    }
+
+    // the root of a broadcast already has the data
+    finish( vNic, op, cmd->up || -1 != cmd->parent.node );
+}
+
+void Nic::Coll::send( int vNic, NicCollCmdEvent* cmd, CollMsgHdr::Phase phase,
+        NicCollCmdEvent::Peer& dst, std::vector<unsigned char>& data, int fanin )
+{
+    CollMsgHdr hdr;
+    hdr.phase = phase;
+    hdr.dataType = cmd->dtype;
+    hdr.redOp = cmd->op;
+    hdr.key = cmd->key;
+    hdr.contribs = phase == CollMsgHdr::Up ? 1 : 0;
+    hdr.fanin = fanin;
+    hdr.count = cmd->count;
+    hdr.length = cmd->length;
+
+    m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_COLL,"core=%d key=%#x %s to %d:%d fanin=%d\n",
+            vNic, cmd->key, phase == CollMsgHdr::Up ? "Up" : "Down", dst.node, dst.vNic, fanin );
+
+    if ( dst.node == m_nic.getNodeId() ) {
+        // both ends are on this NIC, skip the network
+        int dst_vNic = dst.vNic;
+        std::vector<unsigned char> copy = data;
+        m_nic.schedCallback(
+            [=]() {
+                recv( dst_vNic, hdr, copy.empty() ? NULL : &copy[0] );
+            }
+        );
+    } else {
+        m_nic.qSendEntry( new CollSendEntry( vNic, m_nic.getSendStreamNum(vNic), dst.node, dst.vNic, m_vn, hdr, data ) );
+    }
+}
+
+void Nic::Coll::finish( int vNic, Op* op, bool writeResult )
+{
+    NicCollCmdEvent* cmd = op->cmd;
+
+    m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_COLL,"core=%d key=%#x\n", vNic, cmd->key );
+
+    m_ops[vNic].erase( cmd->key );
+
+    auto notify = [=]() {
+        m_nic.getVirtNic(vNic)->notifyShmem( m_nic2HostDelay_ns, cmd->callback );
+        delete cmd;
+    };
+
+    if ( writeResult && cmd->length ) {
+        if ( cmd->dest.getBacking() ) {
+            memcpy( cmd->dest.getBacking(), &op->down[0], cmd->length );
+        }
+        std::vector< MemOp >* vec = new std::vector< MemOp >;
+        vec->push_back( MemOp( cmd->dest.getSimVAddr(), cmd->length, MemOp::Op::BusDmaToHost ) );
+        m_nic.dmaWrite( m_nic.allocNicRecvUnit( vNic ), vNic, vec, notify );
+    } else {
+        notify();
+    }
+
+    delete op;
+}
+
+// The children of our parent that hang off the same router can have their
+// packets combined by that router before they reach the parent. This assumes
+// node ids are handed out to routers in contiguous blocks.
+int Nic::Coll::calcFanin( NicCollCmdEvent* cmd )
+{
+    if ( 0 == m_hostsPerRouter ) {
+        return 1;
+    }
+
+    int myRouter = m_nic.getNodeId() / m_hostsPerRouter;
+    int fanin = 0;
+    for ( unsigned i = 0; i < cmd->siblings.size(); i++ ) {
+        int node = cmd->siblings[i];
+        if ( node != cmd->parent.node && node / m_hostsPerRouter == myRouter ) {
+            ++fanin;
+        }
+    }
+    return fanin;
+}
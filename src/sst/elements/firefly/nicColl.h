@@ -0,0 +1,142 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+class CollSendEntry: public SendEntryBase {
+  public:
+    CollSendEntry( int local_vNic, int streamNum, int destNode, int dest_vNic, int vn,
+            const CollMsgHdr& hdr, const std::vector<unsigned char>& data ) :
+        SendEntryBase( local_vNic, streamNum ), m_destNode(destNode), m_dest_vNic(dest_vNic),
+        m_vn(vn), m_hdr(hdr), m_data(data), m_done(false)
+    {
+        m_isCtrl = true;
+    }
+
+    MsgHdr::Op getOp()  { return MsgHdr::Coll; }
+    size_t totalBytes() { return m_data.size(); }
+    bool isDone()       { return m_done; }
+    int dst_vNic()      { return m_dest_vNic; }
+    int dest()          { return m_destNode; }
+    int vn()            { return m_vn; }
+    void* hdr()         { return &m_hdr; }
+    size_t hdrSize()    { return sizeof(m_hdr); }
+
+    // the data is already on the NIC and goes out with the header
+    void copyOut( Output&, int numBytes, FireflyNetworkEvent& event, std::vector<MemOp>& ) {
+        if ( ! m_data.empty() ) {
+            event.bufAppend( &m_data[0], m_data.size() );
+        }
+        m_done = true;
+    }
+
+  private:
+    int         m_destNode;
+    int         m_dest_vNic;
+    int         m_vn;
+    CollMsgHdr  m_hdr;
+    std::vector<unsigned char> m_data;
+    bool        m_done;
+};
+
+// Runs a collective tree on the NIC. The host posts one descriptor and is
+// notified when its part of the collective is done. Contributions from the
+// children are folded into an accumulator by the reduction engine as they
+// arrive, the result goes to the parent and the root's data comes back down
+// the tree without involving the host.
+class Coll {
+
+    struct Op {
+        Op() : cmd(NULL), contribs(0), haveAcc(false), haveLocal(false), haveDown(false), upDone(false) {}
+        NicCollCmdEvent*            cmd;    // NULL until the host posts the descriptor
+        std::vector<unsigned char>  acc;
+        std::vector<unsigned char>  down;
+        unsigned int                contribs;
+        bool                        haveAcc;
+        bool                        haveLocal;
+        bool                        haveDown;
+        bool                        upDone;
+    };
+
+	std::string m_prefix;
+	const char* prefix() { return m_prefix.c_str(); }
+
+  public:
+    Coll( Nic& nic, Params& params, int id, int numVnics, Output& output, int maxPayload, SimTime_t nic2HostDelay_ns ) :
+        m_nic( nic ), m_dbg( output ), m_nic2HostDelay_ns( nic2HostDelay_ns ), m_engineFree( 0 )
+    {
+        m_prefix = "@t:" + std::to_string(id) + ":Nic::Coll::@p():@l ";
+
+        m_ops.resize( numVnics );
+        m_nicCmdLatency =  params.find<int>( "nicCmdLatency", 10 );
+        m_reduceLatency =  params.find<int>( "reduceLatency", 10 );
+        m_vn =             params.find<int>( "vn", 0 );
+        m_hostsPerRouter = params.find<int>( "hostsPerRouter", 0 );
+        m_maxLength = maxPayload - sizeof(MsgHdr) - sizeof(CollMsgHdr);
+    }
+    ~Coll() {
+        for ( unsigned i = 0; i < m_ops.size(); i++ ) {
+            for ( auto& x : m_ops[i] ) {
+                delete x.second->cmd;
+                delete x.second;
+            }
+        }
+    }
+
+    void handleEvent( NicCollCmdEvent* event, int id );
+    void recv( int vNic, const CollMsgHdr& hdr, const void* data );
+
+  private:
+    void start( NicCollCmdEvent* event, int id );
+    void localData( int vNic, uint32_t key );
+    void progress( int vNic, uint32_t key );
+    void send( int vNic, NicCollCmdEvent*, CollMsgHdr::Phase, NicCollCmdEvent::Peer&, std::vector<unsigned char>&, int fanin );
+    void finish( int vNic, Op*, bool writeResult );
+    SimTime_t fold( Op*, const void* data, size_t length, uint32_t count,
+            Hermes::MP::PayloadDataType, Hermes::MP::ReductionOpType );
+    int calcFanin( NicCollCmdEvent* );
+
+    Op* findOp( int vNic, uint32_t key ) {
+        auto iter = m_ops[vNic].find( key );
+        return iter == m_ops[vNic].end() ? NULL : iter->second;
+    }
+    Op* getOp( int vNic, uint32_t key ) {
+        Op*& op = m_ops[vNic][key];
+        if ( NULL == op ) {
+            op = new Op;
+        }
+        return op;
+    }
+
+    // the reduction engine combines one contribution at a time
+    SimTime_t reserveEngine() {
+        SimTime_t now = m_nic.getCurrentSimTimeNano();
+        if ( m_engineFree < now ) {
+            m_engineFree = now;
+        }
+        m_engineFree += m_reduceLatency;
+        return m_engineFree - now;
+    }
+
+    Nic&        m_nic;
+    Output&     m_dbg;
+    std::vector< std::map< uint32_t, Op* > > m_ops;
+
+    SimTime_t   m_nic2HostDelay_ns;
+    SimTime_t   m_nicCmdLatency;
+    SimTime_t   m_reduceLatency;
+    SimTime_t   m_engineFree;
+    int         m_vn;
+    int         m_hostsPerRouter;
+    size_t      m_maxLength;
+};
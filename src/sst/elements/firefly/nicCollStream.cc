@@ -0,0 +1,38 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "nic.h"
+
+using namespace SST;
+using namespace SST::Firefly;
+
+Nic::RecvMachine::CollStream::CollStream( Output& output, Ctx* ctx,
+        int srcNode, int srcPid, int destPid, FireflyNetworkEvent* ev) :
+    StreamBase(output, ctx, srcNode, srcPid, destPid )
+{
+    CollMsgHdr hdr = *(CollMsgHdr*) ev->bufPtr( sizeof(MsgHdr) );
+
+    ev->bufPop( sizeof(MsgHdr) + sizeof(hdr) );
+
+    m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_STREAM,"core=%d key=%#x srcNode=%d srcCore=%d this=%p\n",
+            m_myPid, hdr.key, ev->getSrcNode(), m_srcPid, this);
+
+    m_ctx->getColl()->recv( m_myPid, hdr, hdr.length ? ev->bufPtr() : NULL );
+
+    delete ev;
+    m_ctx->deleteStream( this );
+}
@@ -0,0 +1,22 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+// collective packets always fit in one packet, the stream hands the
+// contribution to the NIC collective engine and goes away
+class CollStream : public StreamBase {
+  public:
+    CollStream( Output&, Ctx*, int srcNode, int srcPid, int destPid, FireflyNetworkEvent* );
+};
@@ -50,7 +50,7 @@ public:
 class NicCmdBaseEvent : public Event {
 
   public:
-    enum Type { Shmem, Msg } base_type;
+    enum Type { Shmem, Msg, Coll } base_type;
 
     NicCmdBaseEvent( Type type ) : Event(), base_type(type) {}
 
@@ -398,6 +398,42 @@ class NicCmdEvent : public NicCmdBaseEvent {
     NotSerializable(NicCmdEvent)
 };
 
+class NicCollCmdEvent : public NicCmdBaseEvent {
+  public:
+    typedef std::function<void()> Callback;
+
+    struct Peer {
+        Peer( int node = -1, int vNic = -1 ) : node(node), vNic(vNic) {}
+        int node;
+        int vNic;
+    };
+
+    NicCollCmdEvent( uint32_t key, bool up, bool down, Peer parent,
+            std::vector<Peer>& children, std::vector<int>& siblings,
+            const Hermes::MemAddr& src, const Hermes::MemAddr& dest, uint32_t count,
+            Hermes::MP::PayloadDataType dtype, Hermes::MP::ReductionOpType op,
+            size_t length, Callback callback ) :
+        NicCmdBaseEvent( Coll ), key(key), up(up), down(down), parent(parent),
+        children(children), siblings(siblings), src(src), dest(dest), count(count),
+        dtype(dtype), op(op), length(length), callback(callback) {}
+
+    uint32_t            key;
+    bool                up;         // combine contributions towards the root
+    bool                down;       // distribute the root's data to the children
+    Peer                parent;     // node is -1 at the root
+    std::vector<Peer>   children;
+    std::vector<int>    siblings;   // nodes of all the children of our parent, including us
+    Hermes::MemAddr     src;
+    Hermes::MemAddr     dest;
+    uint32_t            count;
+    Hermes::MP::PayloadDataType dtype;
+    Hermes::MP::ReductionOpType op;
+    size_t              length;
+    Callback            callback;
+
+    NotSerializable(NicCollCmdEvent)
+};
+
 class NicRespBaseEvent : public Event {
   public:
     enum Type { Shmem, Msg } base_type;
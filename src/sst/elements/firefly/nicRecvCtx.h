@@ -55,6 +55,10 @@
                 return  m_rm.m_nic.m_shmem;
             }
 
+            Nic::Coll* getColl() {
+                return  m_rm.m_nic.m_coll;
+            }
+
             std::queue<StreamBase*> m_blockedStreamQ;
             void needRecv( StreamBase* stream ) {
 
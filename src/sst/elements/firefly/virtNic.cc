@@ -254,6 +254,26 @@ void VirtNic::shmemFadd( int node, Hermes::Vaddr dest, Hermes::Value& value, Cal
     sendCmd(0, new NicShmemFaddCmdEvent( calcCoreId(node), calcRealNicId(node), dest, value, callback ) );
 }
 
+void VirtNic::collective( uint32_t key, bool up, bool down, int parent, std::vector<int>& children,
+        std::vector<int>& siblings, Hermes::MemAddr& src, Hermes::MemAddr& dest, uint32_t count,
+        Hermes::MP::PayloadDataType dtype, Hermes::MP::ReductionOpType op, size_t length, Callback callback )
+{
+    m_dbg.debug(CALL_INFO,2,0,"key=%#x parent=%d\n",key,parent);
+
+    std::vector<NicCollCmdEvent::Peer> peers;
+    for ( unsigned i = 0; i < children.size(); i++ ) {
+        peers.push_back( NicCollCmdEvent::Peer( calcRealNicId(children[i]), calcCoreId(children[i]) ) );
+    }
+    std::vector<int> nics;
+    for ( unsigned i = 0; i < siblings.size(); i++ ) {
+        nics.push_back( calcRealNicId(siblings[i]) );
+    }
+
+    sendCmd(0, new NicCollCmdEvent( key, up, down,
+                NicCollCmdEvent::Peer( calcRealNicId(parent), calcCoreId(parent) ),
+                peers, nics, src, dest, count, dtype, op, length, callback ) );
+}
+
 void VirtNic::setNotifyOnRecvDmaDone(
                 VirtNic::HandlerBase4Args<int,int,size_t,void*>* functor)
 {
@@ -20,6 +20,7 @@
 #include <sst/core/output.h>
 #include <sst/core/subcomponent.h>
 #include "sst/elements/hermes/shmemapi.h"
+#include "sst/elements/hermes/msgapi.h"
 
 #include "ioVec.h"
 
@@ -196,6 +197,10 @@ class VirtNic : public SST::SubComponent {
     void shmemAdd( int node, Hermes::Vaddr dest, Hermes::Value& );
     void shmemFadd( int node, Hermes::Vaddr dest, Hermes::Value&, CallbackV );
 
+    void collective( uint32_t key, bool up, bool down, int parent, std::vector<int>& children,
+            std::vector<int>& siblings, Hermes::MemAddr& src, Hermes::MemAddr& dest, uint32_t count,
+            Hermes::MP::PayloadDataType, Hermes::MP::ReductionOpType, size_t length, Callback );
+
     void setNotifyOnRecvDmaDone(
         VirtNic::HandlerBase4Args<int,int,size_t,void*>* functor);
     void setNotifyOnSendPioDone(VirtNic::HandlerBase<void*>* functor);
@@ -16,6 +16,7 @@
 #include <sst_config.h>
 #include "gensa.h"
 
+#include <algorithm>
 #include <fstream>
 
 #include <sst/core/params.h>
@@ -38,6 +39,7 @@ gensa::gensa (ComponentId_t id, Params & params)
     syncSent       = false;
     numFirings     = 0;
     numDeliveries  = 0;
+    firingNeuron   = 0;
 
     uint32_t outputLevel = params.find<uint32_t> ("verbose", 0);
     out.init ("gensa:@p:@l: ", outputLevel, 0, Output::STDOUT);
@@ -45,8 +47,11 @@ gensa::gensa (ComponentId_t id, Params & params)
     // get parameters
     modelPath       = params.find<string>("modelPath",       "model");
     steps           = params.find<int>   ("steps",           1000);
-    Neuron::dt      = params.find<float> ("dt",              1);  // In seconds. Don't bother with UnitAlgebra because this is usually specified by wrapper script.
+    NeuronStore::dt = params.find<float> ("dt",              1);  // In seconds. Don't bother with UnitAlgebra because this is usually specified by wrapper script.
     maxRequestDepth = params.find<int>   ("maxRequestDepth", 2);
+    eventDriven     = params.find<bool>  ("eventDriven",     false);
+    decayThreshold  = params.find<float> ("decayThreshold",  1e-6);
+    batchLIF        = params.find<bool>  ("batchLIF",        true);
 
     //set our clock
     string clockFreq = params.find<string> ("clock", "1GHz");
@@ -86,7 +91,6 @@ gensa::gensa ()
 
 gensa::~gensa ()
 {
-    for (auto n : neurons) delete n;
     while (! networkRequests.empty ())
     {
         delete networkRequests.front ();
@@ -124,9 +128,9 @@ gensa::init (unsigned int phase)
 
         char * piece = strtok(const_cast<char *>(line.c_str()), ",");
         int id = atoi(piece);
-        while (neurons.size () <= id) neurons.push_back(nullptr);
+        if (id < 0  ||  id >= (1 << 24)) out.fatal (CALL_INFO, -1, "Neuron index %d out of range\n", id);
+        uint32_t n = id;
 
-        Neuron * n;
         piece = strtok(0, ",");
         if (piece) {
             float Vinit = atof(piece);
@@ -138,9 +142,9 @@ gensa::init (unsigned int phase)
             float leak = 1 - atof(piece);  // The parameter in the file is the portion of voltage to get rid of each cycle. It's simpler for us to compute with (1-decay).
             piece = strtok(0, ",");  // Actually, there should only be one piece left, with no more commas.
             float p = atof(piece);
-            n = neurons[id] = new NeuronLIF(Vinit, Vthreshold, Vreset, leak, p);
+            neurons.setLIF(n, Vinit, Vthreshold, Vreset, leak, p);
         } else {
-            n = neurons[id] = new NeuronInput();
+            neurons.setInput(n);
         }
 
         // Scan indented lines
@@ -156,12 +160,12 @@ gensa::init (unsigned int phase)
             if (c == 'r') {  // spike raster
                 int count = line.size();
                 for (int i = 2; i < count; i++) {
-                    if (line[i] == '1') ((NeuronInput *) n)->spikes.push_back(i - 2);
+                    if (line[i] == '1') neurons.inputs[n].spikes.push_back(i - 2);
                 }
             } else if (c == 't') {  // spike time list
                 char * piece = strtok(const_cast<char *>(line.c_str() + 2), ",");
                 while (piece) {
-                    ((NeuronInput *) n)->spikes.push_back(atoi(piece));
+                    neurons.inputs[n].spikes.push_back(atoi(piece));
                     piece = strtok(0, ",");
                 }
             } else if (c == 'o') {  // output
@@ -195,16 +199,15 @@ gensa::init (unsigned int phase)
                     col = buffer;
                 }
 
-                map<string,OutputHolder *>::iterator it = Neuron::outputs.find(f);
-                if (it == Neuron::outputs.end()) {
+                map<string,OutputHolder *>::iterator it = NeuronStore::outputs.find(f);
+                if (it == NeuronStore::outputs.end()) {
                     OutputHolder * h = new OutputHolder(f);
-                    it = Neuron::outputs.insert(make_pair(f, h)).first;
+                    it = NeuronStore::outputs.insert(make_pair(f, h)).first;
                 }
                 OutputHolder * h = it->second;
 
                 Trace * t = new Trace;
-                t->next = n->traces;
-                n->traces = t;
+                neurons.addTrace(n, t);
                 t->holder = h;
                 t->column = col;
                 if (! m.empty()) t->mode = strdup(m.c_str());
@@ -212,7 +215,7 @@ gensa::init (unsigned int phase)
                 else          t->probe = 0;
             } else {  // synapse
                 // In this pass, just determine memory requirements for each neuron.
-                n->synapseCount++;
+                neurons.synapseCount[n]++;
                 countLinks++;
             }
         }
@@ -224,13 +227,14 @@ gensa::init (unsigned int phase)
     ifs.open (modelPath.c_str());
     assert(sizeof(Synapse) == 8);
     uint64_t startAddr = 0x10000;
+    uint32_t minDelay  = UINT32_MAX;
+    uint32_t maxDelay  = 0;
     while (ifs.good()) {
         getline(ifs, line);
         if (line.empty()) break;
 
         char * piece = strtok (const_cast<char *>(line.c_str()), ",");
-        int id = atoi(piece);
-        Neuron * n = neurons[id];
+        uint32_t n = atoi(piece);
 
         // Scan indented lines
         while (ifs.good()) {
@@ -250,15 +254,19 @@ gensa::init (unsigned int phase)
             float weight = atof(piece);
             piece = strtok(0, ",");
             int delay = atoi(piece);
+            if (target < 0  ||  target >= (1 << 16)) out.fatal (CALL_INFO, -1, "Synapse target %d out of range\n", target);
+            if (delay  < 0  ||  delay  >= (1 << 16)) out.fatal (CALL_INFO, -1, "Synapse delay %d out of range\n",  delay);
+            minDelay = std::min<uint32_t> (minDelay, delay);
+            maxDelay = std::max<uint32_t> (maxDelay, delay);
 
-            if (n->synapseBase == 0)
+            if (neurons.synapseBase[n] == 0)
             {
-                n->synapseBase = startAddr;  // This implies that startAddr must begin higher than 0
-                startAddr += sizeof(Synapse) * n->synapseCount;
-                n->synapseCount = 0;
+                neurons.synapseBase[n] = startAddr;  // This implies that startAddr must begin higher than 0
+                startAddr += sizeof(Synapse) * neurons.synapseCount[n];
+                neurons.synapseCount[n] = 0;
             }
             vector<uint8_t> data(sizeof(Synapse), 0);
-            uint64_t reqAddr = n->synapseBase + sizeof(Synapse) * n->synapseCount++;
+            uint64_t reqAddr = neurons.synapseBase[n] + sizeof(Synapse) * neurons.synapseCount[n]++;
             using namespace Interfaces;
             StandardMem::Write * req = new StandardMem::Write(reqAddr, sizeof(Synapse), data);
             Synapse * synapse = (Synapse *) &req->data[0];
@@ -269,6 +277,9 @@ gensa::init (unsigned int phase)
         }
     }
 
+    if (maxDelay < minDelay) minDelay = maxDelay;  // no synapses
+    neurons.configure (minDelay, maxDelay, eventDriven, decayThreshold, batchLIF);
+
     int numNeurons = neurons.size ();
     printf("Constructed %d neurons with %d links\n", numNeurons, countLinks);
 }
@@ -292,7 +303,7 @@ gensa::finish ()
 {
 	memory->finish ();
 	link  ->finish ();
-    for (auto i : Neuron::outputs) delete i.second;  // flushes last row
+    for (auto i : NeuronStore::outputs) delete i.second;  // flushes last row
 
 	printf ("Completed %d neuron firings\n", numFirings);
     printf ("Completed %d spike deliveries\n", numDeliveries);
@@ -316,7 +327,9 @@ gensa::clockTic (Cycle_t t)
 
     if (synapseIndex < 0)  // Ready for next neuron.
     {
-        int count = neurons.size ();
+        if (neuronIndex < 0) neurons.beginStep (now);  // First cycle of a new step.
+
+        int count = neurons.stepSize ();
         if (neuronIndex >= count)  // Waiting for sync
         {
             if (syncSent) return false;
@@ -338,11 +351,12 @@ gensa::clockTic (Cycle_t t)
         neuronIndex++;
         if (neuronIndex < count)
         {
-            Neuron * n = neurons[neuronIndex];
-            if (n->update (now))
+            uint32_t n = neurons.stepNeuron (neuronIndex);
+            if (neurons.update (n, now))
             {
                 numFirings++;
-                if (n->synapseCount) synapseIndex = 0;  // Start iterating through synapses.
+                firingNeuron = n;
+                if (neurons.synapseCount[n]) synapseIndex = 0;  // Start iterating through synapses.
             }
         }
     }
@@ -352,14 +366,14 @@ gensa::clockTic (Cycle_t t)
         if (networkRequests.size () >= maxRequestDepth) return false;
         if (memoryRequests.size () >= maxRequestDepth) return false;
 
-        Neuron * n = neurons[neuronIndex];
-        uint64_t address = n->synapseBase + synapseIndex * sizeof (Synapse);
+        uint32_t n = firingNeuron;
+        uint64_t address = neurons.synapseBase[n] + synapseIndex * sizeof (Synapse);
         StandardMem::Read * req = new StandardMem::Read (address, sizeof (Synapse));
         memory->send (req);  // Unlike network, it seems that memory has unlimited capacity for requests.
         memoryRequests.insert (address);  // But we still limit the number of outstanding requests.
 
         synapseIndex++;
-        if (synapseIndex >= n->synapseCount) synapseIndex = -1;
+        if (synapseIndex >= neurons.synapseCount[n]) synapseIndex = -1;
     }
 
     return false;  // keep going
@@ -397,7 +411,7 @@ gensa::handleNetwork (int vn)
         if (SpikeEvent * spike = dynamic_cast<SpikeEvent *> (event))
         {
             if (spike->neuron >= neurons.size ()) out.fatal (CALL_INFO, -1, "Invalid Neuron Address\n");
-            neurons[spike->neuron]->deliverSpike (spike->weight, spike->delay+now);
+            neurons.deliverSpike (spike->neuron, spike->weight, spike->delay+now);
             numDeliveries++;
         }
         else if (SyncEvent * sync = dynamic_cast<SyncEvent *> (event))
@@ -51,7 +51,11 @@ public:
         {"clock",          "(string) Clock frequency",                                           "1GHz"},
         {"modelPath",      "(string) Path to neuron file",                                       "model"},
         {"steps",          "(uint) how many ticks the simulation should last",                   "1000"},
-        {"dt",             "(float) duration of one tick in sim time; used for output",          "1"}
+        {"dt",             "(float) duration of one tick in sim time; used for output",          "1"},
+        {"maxRequestDepth","(uint) Outstanding memory reads and queued network sends allowed",  "2"},
+        {"eventDriven",    "(bool) Only spend cycles on neurons with pending input or a voltage that has not decayed", "false"},
+        {"decayThreshold", "(float) In event-driven mode, a neuron whose |V| is at or below this is left alone until it receives input", "1e-6"},
+        {"batchLIF",       "(bool) Update all neurons of a step in one pass when the model has no zero-delay synapses", "true"}
     )
 
     SST_ELI_DOCUMENT_PORTS( {"mem_link", "Connection to memory", { "memHierarchy.MemEventBase" } } )
@@ -69,12 +73,16 @@ public:
     uint32_t    steps;           ///< maximum number of steps the sim should take
     uint32_t    numFirings;      ///< Statistics
     uint32_t    numDeliveries;   ///< Statistics
-    int         neuronIndex;     ///< Current neuron being processed in current cycle
+    int         neuronIndex;     ///< Position in the list of neurons visited during the current step
+    uint32_t    firingNeuron;    ///< Neuron whose synapse list is being worked through
     int         synapseIndex;    ///< Current downstream synapse (associated with current neuron) being sent a spike
     bool        syncSent;
     uint32_t    maxRequestDepth; ///< Shared by memory and network. Should be a pretty small number like 2 or 3.
+    bool        eventDriven;     ///< Skip neurons that have nothing to do this step
+    float       decayThreshold;  ///< |V| below which a neuron with no input counts as at rest
+    bool        batchLIF;        ///< Allow whole-step LIF when no spike can arrive for the present step
 
-    std::vector<Neuron*> neurons;
+    NeuronStore neurons;
 
     TimeConverter *             clockTC;
     Interfaces::StandardMem *   memory;
@@ -17,6 +17,10 @@
 #include <sst_config.h>
 #include "neuron.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
 using namespace SST::gensaComponent;
 using namespace std;
 
@@ -34,108 +38,250 @@ Trace::~Trace()
 }
 
 
-// class Neuron --------------------------------------------------------------
+// class NeuronStore ---------------------------------------------------------
 
-std::map<std::string,OutputHolder *> Neuron::outputs;
-float                                Neuron::dt;
+std::map<std::string,OutputHolder *> NeuronStore::outputs;
+float                                NeuronStore::dt;
+SST::RNG::MarsagliaRNG               NeuronStore::rng(1,13);
 
-Neuron::Neuron()
+NeuronStore::NeuronStore()
 {
-    synapseBase  = 0;
-    synapseCount = 0;
-    traces       = 0;
+    ringSize       = 1;
+    ringMask       = 0;
+    batch          = false;
+    eventDriven    = false;
+    decayThreshold = 0;
+    current        = 0;
+    visited        = -1;
 }
 
-Neuron::~Neuron()
+NeuronStore::~NeuronStore()
 {
-    Trace * t = traces;
-    while (t) {
-        Trace * next = t->next;
-        delete t;
-        t = next;
+    for (auto t : traces) {
+        while (t) {
+            Trace * next = t->next;
+            delete t;
+            t = next;
+        }
     }
 }
 
-void Neuron::deliverSpike(float str, uint when)
+void NeuronStore::resize(uint32_t count)
 {
-    // Do nothing
+    // New slots default to a LIF neuron that never fires on its own.
+    V           .resize(count, 0);
+    Vthreshold  .resize(count, 1);
+    Vreset      .resize(count, 0);
+    leak        .resize(count, 1);
+    p           .resize(count, 1);
+    synapseBase .resize(count, 0);
+    synapseCount.resize(count, 0);
+    traces      .resize(count, nullptr);
+    isInput     .resize(count, 0);
 }
 
+void NeuronStore::setLIF(uint32_t n, float Vinit, float Vthreshold, float Vreset, float leak, float p)
+{
+    if (n >= size()) resize(n + 1);
+    V               [n] = Vinit;
+    this->Vthreshold[n] = Vthreshold;
+    this->Vreset    [n] = Vreset;
+    this->leak      [n] = leak;
+    this->p         [n] = p;
+    isInput         [n] = 0;
+    inputs.erase(n);
+}
 
-// NeuronLIF -----------------------------------------------------------------
+NeuronStore::Input & NeuronStore::setInput(uint32_t n)
+{
+    if (n >= size()) resize(n + 1);
+    isInput[n] = 1;
+    return inputs[n];
+}
 
-SST::RNG::MarsagliaRNG NeuronLIF::rng(1,13);
+void NeuronStore::addTrace(uint32_t n, Trace * t)
+{
+    t->next   = traces[n];
+    traces[n] = t;
+}
 
-NeuronLIF::NeuronLIF(float Vinit, float Vthreshold, float Vreset, float leak, float p)
-:   V          (Vinit),
-    Vthreshold (Vthreshold),
-    Vreset     (Vreset),
-    leak       (leak),
-    p          (p)
+void NeuronStore::configure(uint32_t minDelay, uint32_t maxDelay, bool eventDriven, float decayThreshold, bool allowBatch)
 {
+    // Pending input can be at most maxDelay steps ahead of the step being processed.
+    ringSize = 1;
+    while (ringSize <= maxDelay) ringSize <<= 1;
+    ringMask = ringSize - 1;
+
+    uint32_t count = size();
+    ring    .assign((size_t) count * ringSize, 0);
+    nextStep.assign(count, 0);
+
+    this->eventDriven    = eventDriven;
+    this->decayThreshold = decayThreshold;
+    batch = allowBatch  &&  ! eventDriven  &&  minDelay > 0;
+    if (batch) over.assign(count, 0);
+
+    if (! eventDriven) return;
+    buckets.resize(ringSize);
+    for (uint32_t n = 0; n < count; n++) {
+        if (isInput[n]) {
+            Input & in = inputs[n];
+            if (in.spikes.empty()) continue;
+            uint32_t when = in.spikes[0];
+            if (when < ringSize) buckets[when].push_back(n);
+            else                 inputsDue.insert(std::make_pair(when, n));
+        } else if (! quiescent(n)) {
+            buckets[0].push_back(n);
+        }
+    }
 }
 
-void NeuronLIF::deliverSpike(float str, uint when)
+void NeuronStore::deliverSpike(uint32_t n, float str, uint32_t when)
 {
-    temporalBuffer[when] += str;
+    if (isInput[n]) return;
+
+    // A spike for a step the neuron has already been processed in is lost,
+    // just as it would be when arriving behind the serial sweep.
+    if (when < nextStep[n]) return;
+    if (eventDriven  &&  when == current  &&  (int64_t) n <= visited) return;
+
+    ring[(size_t) (when & ringMask) * size() + n] += str;
+    if (eventDriven) schedule(n, when);
 }
 
-bool NeuronLIF::update(const uint now)
+void NeuronStore::beginStep(uint32_t now)
 {
-    // Add inputs
-    temporalBuffer_t::iterator i = temporalBuffer.find(now);
-    if (i != temporalBuffer.end()) {
-        V += i->second;
-        temporalBuffer.erase(i);
+    visited = -1;
+
+    if (eventDriven) {
+        current = now;
+        std::vector<uint32_t> & bucket = buckets[now & ringMask];
+        active.swap(bucket);
+        bucket.clear();
+        while (! inputsDue.empty ()  &&  inputsDue.begin()->first <= now) {
+            active.push_back(inputsDue.begin()->second);
+            inputsDue.erase(inputsDue.begin());
+        }
+        std::sort(active.begin(), active.end());
+        active.erase(std::unique(active.begin(), active.end()), active.end());
+        return;
+    }
+
+    if (! batch) return;
+
+    // No spike can arrive for this step any more, so the deterministic part of
+    // LIF is done for every neuron up front. Whether a neuron over threshold
+    // actually fires is left to its own cycle in update(), because that may
+    // consume a random number.
+    // The loop is kept free of branches so the compiler can vectorize it. With
+    // default (trapping) FP semantics a float select counts as a branch, so the
+    // leak is applied by masking the bits instead.
+    uint32_t count = size();
+    float *       v  = V.data();
+    const float * th = Vthreshold.data();
+    const float * lk = leak.data();
+    float *       in = ring.data() + (size_t) (now & ringMask) * count;
+    uint8_t *     o  = over.data();
+    for (uint32_t n = 0; n < count; n++) {
+        float x = v[n] + in[n];
+        float y = x * lk[n];
+        uint32_t hot = - (uint32_t) (x > th[n]);
+        uint32_t xi, yi;
+        memcpy(&xi, &x, sizeof(float));
+        memcpy(&yi, &y, sizeof(float));
+        xi = (xi & hot) | (yi & ~hot);
+        memcpy(&v[n], &xi, sizeof(float));
+        o[n]  = hot & 1;
+        in[n] = 0;
     }
+}
 
-    // Check for spike
+bool NeuronStore::update(uint32_t n, uint32_t now)
+{
+    visited = n;
+    if (isInput[n]) return updateInput(n, now);
+
+    float & v = V[n];
     bool spiked = false;
-    if (V > Vthreshold) {
-        if (p >= 1  ||  p > 0  &&  rng.nextUniform() <= p) {
-            V = Vreset;
+    if (batch) {
+        if (over[n]  &&  (p[n] >= 1  ||  p[n] > 0  &&  rng.nextUniform() <= p[n])) {
+            v = Vreset[n];
             spiked = true;
         }
     } else {
-        V *= leak;
-    }
+        // Catch up on the steps this neuron sat out in event-driven mode.
+        uint32_t skipped = now - nextStep[n];
+        if (eventDriven  &&  skipped  &&  leak[n] != 1) v *= powf(leak[n], skipped);
+
+        // Add inputs
+        float & in = ring[(size_t) (now & ringMask) * size() + n];
+        if (in != 0) {
+            v += in;
+            in = 0;
+        }
 
-    // Outputs
-    Trace * t = traces;
-    while (t) {
-        if (t->probe == 0) {
-            if (spiked) t->holder->trace (now*dt, t->column, 1, t->mode);
-        } else if (t->probe == 1) {
-            t->holder->trace(now*dt, t->column, V, t->mode);
+        // Check for spike
+        if (v > Vthreshold[n]) {
+            if (p[n] >= 1  ||  p[n] > 0  &&  rng.nextUniform() <= p[n]) {
+                v = Vreset[n];
+                spiked = true;
+            }
+        } else {
+            v *= leak[n];
         }
-        t = t->next;
     }
+    nextStep[n] = now + 1;
 
+    trace(n, now, spiked);
+    if (eventDriven  &&  ! quiescent(n)) schedule(n, now + 1);
     return spiked;
 }
 
-
-// class NeuronInput ---------------------------------------------------------
-
-NeuronInput::NeuronInput()
+bool NeuronStore::updateInput(uint32_t n, uint32_t now)
 {
-    nextSpike = 0;
+    Input & in = inputs[n];
+    if (in.nextSpike >= in.spikes.size()) return false;
+    if (in.spikes[in.nextSpike] > now)    return false;
+    in.nextSpike++;
+
+    trace(n, now, true);
+    if (eventDriven  &&  in.nextSpike < in.spikes.size()) schedule(n, std::max<uint32_t>(in.spikes[in.nextSpike], now + 1));
+    return true;
 }
 
-bool NeuronInput::update(const uint now)
+void NeuronStore::trace(uint32_t n, uint32_t now, bool spiked)
 {
-    if (nextSpike >= spikes.size()) return false;
-    if (spikes[nextSpike] > now)    return false;
-    nextSpike++;
-
-    // Outputs
-    Trace * t = traces;
+    Trace * t = traces[n];
     while (t) {
-        if (t->probe == 0) t->holder->trace(now*dt, t->column, 1, t->mode);
+        if (t->probe == 0) {
+            if (spiked) t->holder->trace(now*dt, t->column, 1, t->mode);
+        } else if (t->probe == 1  &&  ! isInput[n]) {
+            t->holder->trace(now*dt, t->column, V[n], t->mode);
+        }
         t = t->next;
     }
+}
 
-    return true;
+void NeuronStore::schedule(uint32_t n, uint32_t when)
+{
+    if (when == current) {
+        // Spike arrived ahead of the sweep in the present step.
+        auto it = std::lower_bound(active.begin(), active.end(), n);
+        if (it == active.end()  ||  *it != n) active.insert(it, n);
+    } else if (when - current < ringSize) {
+        buckets[when & ringMask].push_back(n);
+    } else {
+        inputsDue.insert(std::make_pair(when, n));
+    }
+}
+
+bool NeuronStore::quiescent(uint32_t n) const
+{
+    if (V[n] > Vthreshold[n]) return false;
+    for (Trace * t = traces[n]; t; t = t->next) {
+        if (t->probe == 1) return false;  // needs a value every step
+    }
+    return leak[n] == 1  ||  fabsf(V[n]) <= decayThreshold;
 }
 
 
@@ -17,6 +17,7 @@
 #define _NEURON_H
 
 #include <map>
+#include <vector>
 #include <cstdint>
 
 #include <sst/core/interfaces/stdMem.h>  // supplies type uint
@@ -45,50 +46,88 @@ struct Trace {
     ~Trace();
 };
 
-class Neuron {
+/**
+    All neurons of one core, kept as parallel arrays so a whole step of LIF updates
+    runs over contiguous memory. Input neurons occupy a slot in the arrays as well,
+    but are driven by their spike lists instead of the LIF model.
+
+    Pending input lives in a circular buffer per neuron with one slot per step of
+    delay, so delivering a spike and consuming it are both a single array access.
+**/
+class NeuronStore {
 public:
-    uint64_t synapseBase;  // address in memory of synapse list
-    uint32_t synapseCount; // number of entries in synapse list
+    // LIF state
+    std::vector<float> V;          // "voltage"; generally in the normal range [0,1]
+    std::vector<float> Vthreshold; // value of V which triggers a spike
+    std::vector<float> Vreset;     // value of V immediately after a spike
+    std::vector<float> leak;       // fraction of V to retain after present cycle, in [0,1]
+    std::vector<float> p;          // probability of firing when over threshold, in [0,1]
+
+    std::vector<uint64_t> synapseBase;  // address in memory of synapse list
+    std::vector<uint32_t> synapseCount; // number of entries in synapse list
+    std::vector<Trace *>  traces;
+
+    // Input neurons. If we are an input neuron, then spikes is a list of times when we should spike, in ascending order.
+    struct Input {
+        std::vector<uint16_t> spikes;
+        uint32_t              nextSpike;
+        Input() : nextSpike(0) {}
+    };
+    std::vector<uint8_t>       isInput;
+    std::map<uint32_t,Input>   inputs;
 
     static float dt;
     static std::map<std::string,OutputHolder *> outputs;
-    Trace * traces;
-
-    Neuron();
-    virtual ~Neuron();
-
-    virtual void deliverSpike(float str, uint32_t when);
-    virtual bool update      (const uint32_t now) = 0;  ///< performs Leaky Integrate and Fire. Returns true if fired.
-};
-
-class NeuronLIF : public Neuron {
-public:
-    float V;          // "voltage"; generally in the normal range [0,1]
-    float Vthreshold; // value of V which triggers a spike
-    float Vreset;     // value of V immediately after a spike
-    float leak;       // fraction of V to retain after present cycle, in [0,1]
-    float p;          // probability of firing when over threshold, in [0,1]
-
     static SST::RNG::MarsagliaRNG rng;
 
-    // temporal buffer
-    typedef std::map<const uint, float> temporalBuffer_t;
-    temporalBuffer_t temporalBuffer;
-
-    NeuronLIF (float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
-
-    virtual void deliverSpike(float str, uint32_t when);
-    virtual bool update      (const uint32_t now);
-};
-
-class NeuronInput : public Neuron {
-public:
-    std::vector<uint16_t> spikes;  // If we are an input neuron, then this is a list of times when we should spike. List is in ascending order.
-    int nextSpike;
-
-    NeuronInput();
-
-    virtual bool update(const uint32_t now);
+    NeuronStore();
+    ~NeuronStore();
+
+    uint32_t size() const {return V.size();}
+    void     resize    (uint32_t count);
+    void     setLIF    (uint32_t n, float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
+    Input &  setInput  (uint32_t n);
+    void     addTrace  (uint32_t n, Trace * t);
+
+    /// Must be called once the model is loaded and before the first step.
+    /// minDelay and maxDelay are the extremes of the synaptic delays in the model.
+    /// allowBatch permits whole-step LIF when the delays make it safe.
+    void     configure (uint32_t minDelay, uint32_t maxDelay, bool eventDriven, float decayThreshold, bool allowBatch = true);
+
+    void     deliverSpike (uint32_t n, float str, uint32_t when);
+
+    // Per step processing. beginStep() prepares the list of neurons to visit this step,
+    // then stepNeuron(i) for i < stepSize() gives them in ascending order.
+    void     beginStep    (uint32_t now);
+    uint32_t stepSize     () const {return eventDriven ? active.size() : size();}
+    uint32_t stepNeuron   (uint32_t i) const {return eventDriven ? active[i] : i;}
+    bool     update       (uint32_t n, uint32_t now);  ///< performs Leaky Integrate and Fire. Returns true if fired.
+
+protected:
+    bool updateInput (uint32_t n, uint32_t now);
+    void trace       (uint32_t n, uint32_t now, bool spiked);
+    void schedule    (uint32_t n, uint32_t when);
+    bool quiescent   (uint32_t n) const;
+
+    // Delay buffers. Slot (when & ringMask) of neuron n is at (when & ringMask)*size()+n, so one step's input is contiguous.
+    uint32_t           ringSize;
+    uint32_t           ringMask;
+    std::vector<float> ring;
+    std::vector<uint32_t> nextStep;  ///< first step whose input neuron n can still consume
+
+    // Whole-step LIF. Only safe when no spike can arrive for the step being processed (minDelay > 0).
+    bool                 batch;
+    std::vector<uint8_t> over;       ///< V was over threshold after adding input; firing is decided at the neuron's own cycle
+
+    // Event-driven mode. Only neurons with pending input, an input spike due,
+    // or a voltage that has not yet decayed below decayThreshold are visited.
+    bool                                eventDriven;
+    float                               decayThreshold;
+    uint32_t                            current;     ///< step the active list belongs to
+    int64_t                             visited;     ///< last neuron updated in the present step, -1 before the first
+    std::vector<uint32_t>               active;
+    std::vector<std::vector<uint32_t> > buckets;     ///< neurons to visit in future steps, indexed like ring
+    std::multimap<uint32_t,uint32_t>    inputsDue;   ///< input neurons waiting for a spike beyond the bucket horizon
 };
 
 class SpikeEvent : public SST::Event
@@ -8,6 +8,8 @@ cwd = os.path.dirname(__file__)
 op.add_option("-n", "--neurons", action="store", type="string", dest="neurons", default=cwd+"/model")
 op.add_option("-d", "--dt", action="store", type="float", dest="dt", default="1")
 op.add_option("-l", "--steps", action="store", type="int", dest="steps", default="20")
+op.add_option("-e", "--eventDriven", action="store", type="int", dest="eventDriven", default="0")
+op.add_option("-b", "--batchLIF", action="store", type="int", dest="batchLIF", default="1")
 (options, args) = op.parse_args()
 
 
@@ -19,6 +21,8 @@ core.addParams({
     "modelPath" : options.neurons,
     "dt"        : options.dt,
     "steps"     : options.steps,
+    "eventDriven" : options.eventDriven,
+    "batchLIF"  : options.batchLIF,
     "clock"     : "1GHz"
 })
 
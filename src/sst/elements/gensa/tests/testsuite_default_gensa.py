@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import os
+
 
 class testcase_gensa_Component(SSTTestCase):
 
@@ -19,10 +21,18 @@ class testcase_gensa_Component(SSTTestCase):
     def test_gensa_1(self):
         self.gensa_test_template("1")
 
+    def test_gensa_1_event_driven(self):
+        self.gensa_test_template("1", "event_driven", "--eventDriven=1")
+
+    def test_gensa_1_per_neuron(self):
+        self.gensa_test_template("1", "per_neuron", "--batchLIF=0")
+
 #####
 
-    def gensa_test_template(self, testcase):
+    def gensa_test_template(self, testcase, variant="", modeloptions=""):
         # Note: testcase param is ignored for now
+        # A variant runs the same model in another update mode, in its own
+        # directory, and must produce the same output as the default mode.
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -37,7 +47,26 @@ class testcase_gensa_Component(SSTTestCase):
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+        if variant == "":
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+        else:
+            # Run the default mode as the reference, then the variant
+            refdir = "{0}/{1}_default".format(tmpdir, testDataFileName)
+            os.makedirs(refdir, exist_ok=True)
+            self.run_sst(sdlfile, "{0}/{1}.out".format(refdir, testDataFileName), "{0}/{1}.err".format(refdir, testDataFileName),
+                         set_cwd=refdir, mpi_out_files="{0}/{1}.testfile".format(refdir, testDataFileName))
+
+            testDataFileName = "{0}_{1}".format(testDataFileName, variant)
+            outdir = "{0}/{1}".format(tmpdir, testDataFileName)
+            os.makedirs(outdir, exist_ok=True)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+            otherargs = '--model-options="{0}"'.format(modeloptions)
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, set_cwd=outdir, mpi_out_files=mpioutfiles)
+
+            cmp_result = testing_compare_diff(testDataFileName, outdir + "/out", refdir + "/out")
+            self.assertTrue(cmp_result, "Output of {0} mode {1}/out does not match default mode {2}/out".format(variant, outdir, refdir))
 
         testing_remove_component_warning_from_file(outfile)
 
@@ -178,6 +178,14 @@ BruckActor::finalize()
 void
 RingAllgatherActor::initBuffers()
 {
+  void* dst = result_buffer_;
+  void* src = send_buffer_;
+  if (dst != src){
+    //my block goes into its slot in the result, which is where the ring sends it from
+    int block_size = nelems_ * type_size_;
+    my_api_->memcopy(sumi::Message::offset_ptr(dst, dom_me_*block_size), src, block_size);
+  }
+  send_buffer_ = result_buffer_;
   recv_buffer_ = result_buffer_;
 }
 
@@ -127,7 +127,7 @@ class RingAllgatherActor : public DagCollectiveActor
   }
 
   std::string toString() const override {
-    return "bruck allgather actor";
+    return "ring allgather actor";
   }
 
  private:
@@ -19,6 +19,7 @@
 //#include <sprockit/output.h>
 #include <mercury/common/stl_string.h>
 #include <cstring>
+#include <algorithm>
 
 #define divide_by_2_round_up(x) ((x/2) + (x%2))
 
@@ -211,4 +212,116 @@ WilkeAllreduceActor::bufferAction(void *dst_buffer, void *msg_buffer, Action* ac
   }
 }
 
+int
+RingAllreduceActor::maxSegments(int nproc)
+{
+  //a segment uses one round per step and there are 2*(nproc-1) steps
+  return Action::max_round / (2*(nproc - 1));
+}
+
+void
+RingAllreduceActor::finalizeBuffers()
+{
+  long buffer_size = nelems_ * type_size_;
+  my_api_->freeWorkspace(recv_buffer_, buffer_size);
+}
+
+void
+RingAllreduceActor::initBuffers()
+{
+  void* dst = result_buffer_;
+  void* src = send_buffer_;
+  int size = nelems_ * type_size_;
+
+  //same as the Wilke allreduce, work in the dst buffer
+  //and reduce out of a temporary recv buffer
+  if (src != dst)
+    my_api_->memcopy(dst, src, size);
+  recv_buffer_ = my_api_->allocateWorkspace(size, src);
+  send_buffer_ = result_buffer_;
+}
+
+void
+RingAllreduceActor::segment(int chunk, int seg, int& offset, int& nelems) const
+{
+  int chunk_base = nelems_ / dom_nproc_;
+  int chunk_extra = nelems_ % dom_nproc_;
+  int chunk_offset = chunk*chunk_base + std::min(chunk, chunk_extra);
+  int chunk_nelems = chunk_base + (chunk < chunk_extra ? 1 : 0);
+
+  int seg_base = chunk_nelems / nsegs_;
+  int seg_extra = chunk_nelems % nsegs_;
+  offset = chunk_offset + seg*seg_base + std::min(seg, seg_extra);
+  nelems = seg_base + (seg < seg_extra ? 1 : 0);
+}
+
+void
+RingAllreduceActor::initDag()
+{
+  slicer_->fxn = fxn_;
+
+  int max_segs = maxSegments(dom_nproc_);
+  if (max_segs == 0){
+    sst_hg_abort_printf("ring allreduce on %d ranks needs more than %d rounds",
+                        dom_nproc_, Action::max_round);
+  }
+  int min_chunk = nelems_ / dom_nproc_;
+  nsegs_ = std::max(1, std::min(std::min(segments_, max_segs), min_chunk));
+
+  int send_partner = (dom_me_ + 1) % dom_nproc_;
+  int recv_partner = (dom_me_ + dom_nproc_ - 1) % dom_nproc_;
+  int num_steps = 2*(dom_nproc_ - 1);
+
+  output.output("Rank %s configured ring allreduce for tag=%d for nproc=%d with %d segments",
+    rankStr().c_str(), tag_, dom_nproc_, nsegs_);
+
+  RecvAction::buf_type_t gather_recv_type = slicer_->contiguous() ?
+        RecvAction::in_place : RecvAction::unpack_temp_buf;
+
+  for (int seg=0; seg < nsegs_; ++seg){
+    //each segment is its own chain of rounds, the chains only
+    //share the links so segments pipeline through the ring
+    Action *prev_send = nullptr, *prev_recv = nullptr;
+    for (int step=0; step < num_steps; ++step){
+      int rnd = step*nsegs_ + seg;
+      int send_chunk, recv_chunk;
+      Action* recv_ac;
+      if (step < dom_nproc_ - 1){
+        //reduce-scatter: pass on what I just reduced
+        send_chunk = (dom_me_ - step + dom_nproc_) % dom_nproc_;
+        recv_chunk = (send_chunk - 1 + dom_nproc_) % dom_nproc_;
+        recv_ac = new RecvAction(rnd, recv_partner, RecvAction::reduce);
+      } else {
+        //allgather: after the reduce-scatter I own chunk me+1
+        int gather_step = step - dom_nproc_ + 1;
+        send_chunk = (dom_me_ + 1 - gather_step + dom_nproc_) % dom_nproc_;
+        recv_chunk = (send_chunk - 1 + dom_nproc_) % dom_nproc_;
+        recv_ac = new RecvAction(rnd, recv_partner, gather_recv_type);
+      }
+      Action* send_ac = new SendAction(rnd, send_partner, SendAction::in_place);
+      segment(send_chunk, seg, send_ac->offset, send_ac->nelems);
+      segment(recv_chunk, seg, recv_ac->offset, recv_ac->nelems);
+
+      addDependency(prev_send, send_ac);
+      addDependency(prev_send, recv_ac);
+      addDependency(prev_recv, send_ac);
+      addDependency(prev_recv, recv_ac);
+
+      prev_send = send_ac;
+      prev_recv = recv_ac;
+    }
+  }
+}
+
+void
+RingAllreduceActor::bufferAction(void *dst_buffer, void *msg_buffer, Action* ac)
+{
+  int step = ac->round / nsegs_;
+  if (step < dom_nproc_ - 1){
+    (fxn_)(dst_buffer, msg_buffer, ac->nelems);
+  } else {
+    my_api_->memcopy(dst_buffer, msg_buffer, ac->nelems * type_size_);
+  }
+}
+
 }
@@ -87,4 +87,84 @@ class WilkeHalvingAllreduce :
 
 };
 
+/**
+ * Ring allreduce: a reduce-scatter around the ring followed by an allgather.
+ * Each rank's chunk is further cut into segments that move through the ring
+ * independently so that the reduction of one segment overlaps the transfer
+ * of the next. Every rank only ever talks to its two ring neighbors, which
+ * makes this the bandwidth-optimal choice for large messages.
+ */
+class RingAllreduceActor :
+  public DagCollectiveActor
+{
+
+ public:
+  RingAllreduceActor(CollectiveEngine* engine, void* dst, void* src,
+                     int nelems, int type_size, int tag, reduce_fxn fxn,
+                     int segments, int cq_id, Communicator* comm) :
+    DagCollectiveActor(Collective::allreduce, engine, dst, src, type_size, tag, cq_id, comm, fxn),
+    fxn_(fxn), nelems_(nelems), segments_(segments), nsegs_(1)
+  {
+  }
+
+  std::string toString() const override {
+    return "ring allreduce actor";
+  }
+
+  void bufferAction(void *dst_buffer, void *msg_buffer, Action* ac) override;
+
+  /**
+   * @return The most segments per chunk that keep all rounds of a ring
+   *         on nproc ranks below Action::max_round
+   */
+  static int maxSegments(int nproc);
+
+  Output output;
+
+ private:
+  void finalizeBuffers() override;
+  void initBuffers() override;
+  void initDag() override;
+
+  void segment(int chunk, int seg, int& offset, int& nelems) const;
+
+ private:
+  reduce_fxn fxn_;
+
+  int nelems_;
+
+  int segments_;
+
+  int nsegs_;
+
+};
+
+class RingAllreduce :
+  public DagCollective
+{
+ public:
+  RingAllreduce(CollectiveEngine* engine, void* dst, void* src,
+                int nelems, int type_size, int tag, reduce_fxn fxn,
+                int segments, int cq_id, Communicator* comm)
+    : DagCollective(allreduce, engine, dst, src, type_size, tag, cq_id, comm),
+      fxn_(fxn), nelems_(nelems), segments_(segments)
+  {
+  }
+
+  std::string toString() const override {
+    return "ring allreduce";
+  }
+
+  DagCollectiveActor* newActor() const override {
+    return new RingAllreduceActor(engine_, dst_buffer_, src_buffer_,
+                                  nelems_, type_size_, tag_, fxn_, segments_, cq_id_, comm_);
+  }
+
+ private:
+  reduce_fxn fxn_;
+  int nelems_;
+  int segments_;
+
+};
+
 }
@@ -17,6 +17,8 @@
 #include <iris/sumi/bcast.h>
 #include <iris/sumi/communicator.h>
 #include <iris/sumi/transport.h>
+#include <algorithm>
+#include <vector>
 
 namespace SST::Iris::sumi {
 
@@ -140,5 +142,73 @@ BinaryTreeBcastActor::initBuffers()
   result_buffer_ = send_buffer_;
 }
 
+void
+PipelinedBcastActor::bufferAction(void *dst_buffer, void *msg_buffer, Action *ac)
+{
+  ::memcpy(dst_buffer, msg_buffer, ac->nelems*type_size_);
+}
+
+void
+PipelinedBcastActor::finalizeBuffers()
+{
+}
+
+void
+PipelinedBcastActor::initBuffers()
+{
+  //everything happens in place in the one buffer
+  send_buffer_ = result_buffer_;
+  recv_buffer_ = result_buffer_;
+}
+
+void
+PipelinedBcastActor::initDag()
+{
+  int nproc = comm_->nproc();
+  int me = comm_->myCommRank();
+  int offsetMe = (me - root_ + nproc) % nproc;
+
+  //rounds are the segment numbers
+  int nsegs = std::max(1, std::min(std::min(segments_, nelems_), int(Action::max_round)));
+  int seg_base = nelems_ / nsegs;
+  int seg_extra = nelems_ % nsegs;
+
+  int parent = offsetMe == 0 ? -1 : ((offsetMe - 1) / fanout_ + root_) % nproc;
+  std::vector<int> children;
+  for (int c=offsetMe*fanout_ + 1; c <= offsetMe*fanout_ + fanout_ && c < nproc; ++c){
+    children.push_back((c + root_) % nproc); //everything offset by root
+  }
+
+  output.output("Rank %s has parent %d and %d children in %d-ary pipelined bcast of %d segments",
+    rankStr().c_str(), parent, int(children.size()), fanout_, nsegs);
+
+  RecvAction::buf_type_t recv_ty = slicer_->contiguous() ?
+        RecvAction::in_place : RecvAction::unpack_temp_buf;
+
+  std::vector<Action*> prev_sends(children.size(), nullptr);
+  for (int seg=0; seg < nsegs; ++seg){
+    int offset = seg*seg_base + std::min(seg, seg_extra);
+    int nelems = seg_base + (seg < seg_extra ? 1 : 0);
+
+    Action* recv = nullptr;
+    if (parent >= 0){
+      recv = new RecvAction(seg, parent, recv_ty);
+      recv->nelems = nelems;
+      recv->offset = offset;
+      addAction(recv);
+    }
+
+    for (unsigned i=0; i < children.size(); ++i){
+      Action* send = new SendAction(seg, children[i], SendAction::in_place);
+      send->nelems = nelems;
+      send->offset = offset;
+      //forward a segment once I have it, but keep the
+      //segments to one child in order on the link
+      addDependency(recv, send);
+      if (prev_sends[i]) addDependency(prev_sends[i], send);
+      prev_sends[i] = send;
+    }
+  }
+}
 
 }
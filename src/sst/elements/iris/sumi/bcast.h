@@ -78,4 +78,66 @@ class BinaryTreeBcastCollective :
 
 };
 
+/**
+ * Segmented, pipelined bcast down a k-ary tree rooted at the root.
+ * A fanout of 1 gives a chain. Each rank forwards a segment as soon as it
+ * has it, so for large messages the time approaches one message transfer
+ * plus the depth of the tree in segment transfers.
+ */
+class PipelinedBcastActor :
+  public DagCollectiveActor
+{
+ public:
+  PipelinedBcastActor(CollectiveEngine* engine, int root, void *buf, int nelems,
+                      int type_size, int tag, int fanout, int segments,
+                      int cq_id, Communicator* comm)
+    : DagCollectiveActor(Collective::bcast, engine, buf, buf, type_size, tag, cq_id, comm),
+      root_(root), nelems_(nelems), fanout_(fanout), segments_(segments)
+  {}
+
+  std::string toString() const override {
+    return "pipelined bcast actor";
+  }
+
+  Output output;
+
+ private:
+  void finalizeBuffers() override;
+  void initBuffers() override;
+  void initDag() override;
+  void bufferAction(void *dst_buffer, void *msg_buffer, Action *ac) override;
+
+  int root_;
+  int nelems_;
+  int fanout_;
+  int segments_;
+};
+
+class PipelinedBcastCollective :
+  public DagCollective
+{
+ public:
+  PipelinedBcastCollective(CollectiveEngine* engine, int root, void* buf,
+                           int nelems, int type_size, int tag, int fanout, int segments,
+                           int cq_id, Communicator* comm)
+    : DagCollective(Collective::bcast, engine, buf, buf, type_size, tag, cq_id, comm),
+      root_(root), nelems_(nelems), fanout_(fanout), segments_(segments) {}
+
+  std::string toString() const override {
+    return "pipelined bcast";
+  }
+
+  DagCollectiveActor* newActor() const override {
+    return new PipelinedBcastActor(engine_, root_, dst_buffer_, nelems_,
+                                   type_size_, tag_, fanout_, segments_, cq_id_, comm_);
+  }
+
+ private:
+  int root_;
+  int nelems_;
+  int fanout_;
+  int segments_;
+
+};
+
 }
@@ -28,83 +28,17 @@ Communicator::rankResolved(int global_rank, int comm_rank)
 }
 
 void
-Communicator::createSmpCommunicator(const std::set<int>& neighbors, CollectiveEngine *engine,
-                                    int cq_id)
+Communicator::createSmpCommunicator(const std::set<int>& neighbors, CollectiveEngine* /*engine*/,
+                                    int /*cq_id*/)
 {
   if (!supportsSmp()) return;
 
-  if (neighbors.size() == 1) return; //no smp parallelism
-
+  //hierarchical collectives would need ranks that share a node, which the app launcher never creates
   auto neighbors_subset = globalRankSetIntersection(neighbors);
-  if (neighbors_subset.size() == 1) return; //no smp parallelism
-
-
-  int myGlobalRank = commToGlobalRank(my_comm_rank_);
-  if (neighbors_subset.size() > 1){ //there is smp parallelism to be had here
-    int idx = 0;
-    int my_smp_rank = 0;
-    std::vector<int> local_to_global(neighbors_subset.size());
-    for (int glblRank : neighbors_subset){
-      local_to_global[idx] = glblRank;
-      if (glblRank == myGlobalRank){
-        my_smp_rank = idx;
-      }
-      idx++;
-    }
-
-
-
-    smp_comm_ = new MapCommunicator(my_smp_rank, std::move(local_to_global));
-    if (smp_comm_->nproc() == 0){
-      sst_hg_abort_printf("Created SMP communicator of size 0!"
-                        " Neighbor set has size %d, intersection with comm is %d",
-                        int(neighbors.size()), int(neighbors_subset.size()));
-    }
-
-    std::vector<int> smp_ranks(this->nproc());
-    int tag = -2;
-// FIXME
-//    engine->allgather(smp_ranks.data(), &my_smp_rank, 1, sizeof(int), tag, cq_id, this);
-//    engine->blockUntilNext(cq_id);
-
-    std::map<int,int> rank_counts;
-    int my_owner_rank = -1;
-    if (my_smp_rank == 0){
-      std::vector<int> owner_to_global;
-      idx = 0;
-      for (int rank=0; rank < this->nproc(); ++rank){
-        int local_smp_rank = smp_ranks[rank];
-        rank_counts[local_smp_rank]++;
-        if (local_smp_rank == 0){
-          owner_to_global.push_back(commToGlobalRank(rank));
-          if (rank == this->myCommRank()){
-            my_owner_rank = idx;
-          }
-          ++idx;
-        }
-      }
-      int nranks = idx;
-      owner_comm_ = new IndexCommunicator(my_owner_rank, nranks, std::move(owner_to_global));
-      if (owner_comm_->nproc() == 0){
-        sst_hg_abort_printf("Created owner communicator of size 0!"
-                          "Parent comm has size %d, SMP comm has size %d",
-                          nproc(), smp_comm_->nproc());
-      }
-    }
-
-    smp_balanced_ = true;
-    int rank0_smp_count = rank_counts[0];
-    for (auto& pair : rank_counts){
-      if (pair.second != rank0_smp_count){
-        smp_balanced_ = false;
-        break;
-      }
-    }
-
+  if (neighbors_subset.size() > 1){
+    sst_hg_abort_printf("smp_optimize: %d ranks of a communicator share a node,"
+                        " hierarchical collectives are not supported", int(neighbors_subset.size()));
   }
-
-
-
 }
 
 GlobalCommunicator::GlobalCommunicator(Transport *tport) :
@@ -55,23 +55,20 @@ class Communicator {
     return false;
   }
 
-  bool smpBalanced() const {
-    return smp_balanced_;
-  }
-
   static const int unresolved_rank = -1;
 
+  /**
+   * @brief createSmpCommunicator
+   * Checks for ranks of this communicator that share a node. Mercury
+   * launches one rank per node, so collectives always run flat and
+   * there are no SMP or owner communicators to build.
+   * @param neighbors The global ranks on my node
+   * @param engine
+   * @param cq_id
+   */
   void createSmpCommunicator(const std::set<int>& neighbors,
                              CollectiveEngine* engine, int cq_id);
 
-  Communicator* smpComm() const {
-    return smp_comm_;
-  }
-
-  Communicator* ownerComm() const {
-    return owner_comm_;
-  }
-
   void registerRankCallback(RankCallback* cback){
     rank_callbacks_.insert(cback);
   }
@@ -82,10 +79,7 @@ class Communicator {
 
  protected:
   Communicator(int comm_rank) :
-    my_comm_rank_(comm_rank),
-    smp_comm_(nullptr),
-    owner_comm_(nullptr),
-    smp_balanced_(false)
+    my_comm_rank_(comm_rank)
   {}
 
   void rankResolved(int global_rank, int comm_rank);
@@ -99,10 +93,6 @@ class Communicator {
   */
   std::set<RankCallback*> rank_callbacks_;
 
-  Communicator* smp_comm_;
-  Communicator* owner_comm_;
-  bool smp_balanced_;
-
 };
 
 class GlobalCommunicator :
@@ -45,6 +45,7 @@
 #include <mercury/operating_system/launch/app_launcher.h>
 
 #include <cstring>
+#include <algorithm>
 
 using SST::Hg::TimeDelta;
 
@@ -470,9 +471,21 @@ CollectiveEngine::CollectiveEngine(SST::Params& params, Transport *tport) :
   global_domain_ = new GlobalCommunicator(tport);
   eager_cutoff_ = params.find<int>("eager_cutoff", 512);
   use_put_protocol_ = params.find<bool>("use_put_protocol", false);
+  allreduce_type_ = params.find<std::string>("allreduce", "wilke");
+  bcast_type_ = params.find<std::string>("bcast", "btree");
   alltoall_type_ = params.find<std::string>("alltoall", "bruck");
   allgather_type_ = params.find<std::string>("allgather", "bruck");
 
+  //the selection table used by the "auto" algorithms
+  ring_cutoff_ = params.find<SST::UnitAlgebra>("ring_cutoff", "64KiB").getRoundedValue();
+  ring_max_nproc_ = params.find<int>("ring_max_nproc", 64);
+  pipeline_cutoff_ = params.find<SST::UnitAlgebra>("pipeline_cutoff", "64KiB").getRoundedValue();
+  segment_size_ = params.find<SST::UnitAlgebra>("segment_size", "16KiB").getRoundedValue();
+  bcast_fanout_ = params.find<int>("bcast_fanout", 2);
+  if (bcast_fanout_ < 1){
+    sst_hg_abort_printf("bcast_fanout must be at least 1, got %d", bcast_fanout_);
+  }
+
   int default_qos = params.find<int>("default_qos", 0);
   rdma_get_qos_ = params.find<int>("collective_rdma_get_qos", default_qos);
   rdma_header_qos_ = params.find<int>("collective_rdma_header_qos", default_qos);
@@ -544,41 +557,7 @@ CollectiveEngine::allreduce(void* dst, void *src, int nelems, int type_size, int
 
   if (!comm) comm = global_domain_;
 
-  Collective* coll = nullptr;
-  if (comm->smpComm()){
-    //tags are restricted to 28 bits - the front 4 bits are mine for various internal operations
-    int intra_reduce_tag = 1<<28 | tag;
-    auto* intra_reduce = new WilkeHalvingAllreduce(this, dst, src, nelems,
-                                   type_size, intra_reduce_tag, fxn, cq_id, comm->smpComm());
-
-    int root = comm->smpComm()->commToGlobalRank(0);
-    Collective* prev;
-    if (comm->myCommRank() == root){
-      if (!comm->ownerComm()){
-        sst_hg_abort_printf("Bad owner comm configuration - rank 0 in SMP comm should 'own' node");
-      }
-      //I am the owner!
-      int inter_reduce_tag = 2<<28 | tag;
-      auto* inter_reduce = new WilkeHalvingAllreduce(this, dst, dst, nelems,
-                                     type_size, inter_reduce_tag, fxn, cq_id, comm->ownerComm());
-
-
-      intra_reduce->setSubsequent(inter_reduce);
-      prev = inter_reduce;
-    } else {
-      prev = intra_reduce;
-    }
-    auto* intra_bcast = new BinaryTreeBcastCollective(this, root, dst, nelems, type_size, tag,
-                                                      cq_id, comm->smpComm());
-    prev->setSubsequent(intra_bcast);
-    //this should report back as done on the original communicator!
-    coll = new DoNothingCollective(this, tag, cq_id, comm);
-    intra_bcast->setSubsequent(coll);
-  } else {
-    coll = new WilkeHalvingAllreduce(this, dst, src, nelems, type_size, tag, fxn, cq_id, comm);
-  }
-
-  return startCollective(coll);
+  return startCollective(newAllreduce(dst, src, nelems, type_size, tag, fxn, cq_id, comm));
 }
 
 sumi::CollectiveDoneMessage*
@@ -626,8 +605,8 @@ CollectiveEngine::bcast(int root, void *buf, int nelems, int type_size, int tag,
   if (msg) return msg;
 
   if (!comm) comm = global_domain_;
-  DagCollective* coll = new BinaryTreeBcastCollective(this, root, buf, nelems, type_size, tag, cq_id, comm);
-  return startCollective(coll);
+
+  return startCollective(newBcast(root, buf, nelems, type_size, tag, cq_id, comm));
 }
 
 CollectiveDoneMessage*
@@ -692,56 +671,18 @@ CollectiveEngine::alltoall(void *dst, void *src, int nelems, int type_size, int
 
   if (!comm) comm = global_domain_;
 
-  if (comm->smpComm() && comm->smpBalanced()){
-    int smpSize = comm->smpComm()->nproc();
-    void* intraDst = dst ? new char[nelems*type_size*smpSize] : nullptr;
-    int intra_tag = 1<<28 | tag;
-
-    BtreeGather* intra = new BtreeGather(this, 0, intraDst, src, smpSize*nelems,
-                                         type_size, intra_tag, cq_id, comm->smpComm());
-    DagCollective* prev;
-    if (comm->ownerComm()){
-      int inter_tag = 2<<28 | tag;
-      AllToAllCollective* inter;
-      if (alltoall_type_ == "bruck") {
-        inter = (AllToAllCollective*) new BruckAlltoallCollective(this, dst, intraDst,
-                                                             smpSize*nelems, type_size, inter_tag, cq_id, comm->ownerComm());
-      }
-      else if (alltoall_type_ == "direct") {
-        inter = (AllToAllCollective*) new DirectAlltoallCollective(this, dst, intraDst, smpSize*nelems,
-                                                              type_size, inter_tag, cq_id, comm->ownerComm());
-      }
-      else {
-        sst_hg_abort_printf("unrecognized alltoall type");
-      }
-      intra->setSubsequent(inter);
-      prev = inter;
-    } else {
-      std::cerr << "prev = intra = " << intra << std::endl;
-      prev = intra;
-    }
-    int bcast_tag = 3<<28 | tag;
-    auto* bcast = new BinaryTreeBcastCollective(this, 0, dst, comm->nproc()*nelems,
-                                                type_size, bcast_tag, cq_id, comm->smpComm());
-    prev->setSubsequent(bcast);
-    auto* final = new DoNothingCollective(this, tag, cq_id, comm);
-    bcast->setSubsequent(final);
-    return startCollective(intra);
-  } else {
-    AllToAllCollective* coll;
-    if (alltoall_type_ == "bruck") {
-      coll = (AllToAllCollective*) new BruckAlltoallCollective(this, dst, src, nelems, type_size, tag, cq_id, comm);
-    }
-    else if (alltoall_type_ == "direct") {
-      coll = (AllToAllCollective*) new DirectAlltoallCollective(this, dst, src, nelems,
-                                                            type_size, tag, cq_id, comm);
-    }
-    else {
-      sst_hg_abort_printf("unrecognized alltoall type");
-    }
-    return startCollective(coll);
+  AllToAllCollective* coll;
+  if (alltoall_type_ == "bruck") {
+    coll = (AllToAllCollective*) new BruckAlltoallCollective(this, dst, src, nelems, type_size, tag, cq_id, comm);
   }
-  return nullptr;
+  else if (alltoall_type_ == "direct") {
+    coll = (AllToAllCollective*) new DirectAlltoallCollective(this, dst, src, nelems,
+                                                          type_size, tag, cq_id, comm);
+  }
+  else {
+    sst_hg_abort_printf("unrecognized alltoall type");
+  }
+  return startCollective(coll);
 }
 
 CollectiveDoneMessage*
@@ -765,69 +706,84 @@ CollectiveEngine::allgather(void *dst, void *src, int nelems, int type_size, int
 
   if (!comm) comm = global_domain_;
 
-  if (comm->smpComm() && comm->smpBalanced()){
-    int smpSize = comm->smpComm()->nproc();
-    void* intraDst = dst ? new char[nelems*type_size*smpSize] : nullptr;
+  return startCollective(newAllgather(dst, src, nelems, type_size, tag, cq_id, comm));
+}
 
-    int intra_tag = 1<<28 | tag;
+DagCollective*
+CollectiveEngine::newAllreduce(void* dst, void* src, int nelems, int type_size, int tag,
+                               reduce_fxn fxn, int cq_id, Communicator* comm)
+{
+  std::string type = allreduce_type_;
+  uint64_t bytes = uint64_t(nelems) * type_size;
+  int nproc = comm->nproc();
+  if (type == "auto"){
+    //the ring has 2*(nproc-1) steps, only worth it for large messages on smaller comms
+    bool ring_fits = nproc <= ring_max_nproc_ && nelems >= nproc
+                     && RingAllreduceActor::maxSegments(nproc) > 0;
+    type = ring_fits && bytes >= ring_cutoff_ ? "ring" : "wilke";
+  }
 
-    AllgatherCollective* intra;
-    if (allgather_type_ == "bruck") {
-      intra = (AllgatherCollective*) new BruckAllgatherCollective(this, intraDst, src, nelems, type_size,
-                                                                intra_tag, cq_id, comm->smpComm());
-    }
-    else if (allgather_type_ == "ring") {
-      intra = (AllgatherCollective*) new RingAllgatherCollective(this, intraDst, src, nelems, type_size,
-                                                                intra_tag, cq_id, comm->smpComm());
-    }
-    else {
-      sst_hg_abort_printf("unrecognized allgather type");
-    }
+  if (type == "wilke"){
+    return new WilkeHalvingAllreduce(this, dst, src, nelems, type_size, tag, fxn, cq_id, comm);
+  } else if (type == "ring"){
+    return new RingAllreduce(this, dst, src, nelems, type_size, tag, fxn,
+                             numSegments(bytes / nproc), cq_id, comm);
+  } else {
+    sst_hg_abort_printf("unrecognized allreduce type %s", type.c_str());
+  }
+  return nullptr;
+}
 
-    DagCollective* prev;
-    if (comm->ownerComm()){
-      int inter_tag = 2<<28 | tag;
-      AllgatherCollective* inter;
-      if (allgather_type_ == "bruck") {
-        intra = (AllgatherCollective*) new BruckAllgatherCollective(this, dst, intraDst, smpSize*nelems, type_size,
-                                                                  inter_tag, cq_id, comm->ownerComm());
-      }
-      else if (allgather_type_ == "ring") {
-        intra = (AllgatherCollective*) new RingAllgatherCollective(this, dst, intraDst, smpSize*nelems, type_size,
-                                                                 inter_tag, cq_id, comm->ownerComm());
-      }
-      else {
-        sst_hg_abort_printf("unrecognized allgather type");
-      }
-      intra->setSubsequent(inter);
-      prev = inter;
-    } else {
-      prev = intra;
-    }
-    int bcast_tag = 3<<28 | tag;
-    auto* bcast = new BinaryTreeBcastCollective(this, 0, dst, comm->nproc()*nelems,
-                                                type_size, bcast_tag, cq_id, comm->smpComm());
-    prev->setSubsequent(bcast);
-    auto* final = new DoNothingCollective(this, tag, cq_id, comm);
-    bcast->setSubsequent(final);
-    return startCollective(intra);
+DagCollective*
+CollectiveEngine::newBcast(int root, void* buf, int nelems, int type_size, int tag,
+                           int cq_id, Communicator* comm)
+{
+  std::string type = bcast_type_;
+  uint64_t bytes = uint64_t(nelems) * type_size;
+  if (type == "auto"){
+    type = bytes >= pipeline_cutoff_ ? "pipeline" : "btree";
   }
-  else {
-    AllgatherCollective* coll;
-    if (allgather_type_ == "bruck") {
-      coll = (AllgatherCollective*) new BruckAllgatherCollective(this, dst, src, nelems, type_size, tag, cq_id, comm);
-    }
-    else if (allgather_type_ == "ring") {
-      coll = (AllgatherCollective*) new RingAllgatherCollective(this, dst, src, nelems, type_size, tag, cq_id, comm);
-    }
-    else {
-      sst_hg_abort_printf("unrecognized allgather type");
-    }
-    return startCollective(coll);
+
+  if (type == "btree"){
+    return new BinaryTreeBcastCollective(this, root, buf, nelems, type_size, tag, cq_id, comm);
+  } else if (type == "pipeline"){
+    return new PipelinedBcastCollective(this, root, buf, nelems, type_size, tag,
+                                        bcast_fanout_, numSegments(bytes), cq_id, comm);
+  } else {
+    sst_hg_abort_printf("unrecognized bcast type %s", type.c_str());
   }
   return nullptr;
 }
 
+DagCollective*
+CollectiveEngine::newAllgather(void* dst, void* src, int nelems, int type_size, int tag,
+                               int cq_id, Communicator* comm)
+{
+  std::string type = allgather_type_;
+  uint64_t bytes = uint64_t(nelems) * type_size * comm->nproc();
+  if (type == "auto"){
+    type = comm->nproc() <= ring_max_nproc_ && bytes >= ring_cutoff_ ? "ring" : "bruck";
+  }
+
+  if (type == "bruck"){
+    return new BruckAllgatherCollective(this, dst, src, nelems, type_size, tag, cq_id, comm);
+  } else if (type == "ring"){
+    return new RingAllgatherCollective(this, dst, src, nelems, type_size, tag, cq_id, comm);
+  } else {
+    sst_hg_abort_printf("unrecognized allgather type %s", type.c_str());
+  }
+  return nullptr;
+}
+
+int
+CollectiveEngine::numSegments(uint64_t bytes) const
+{
+  if (segment_size_ == 0) return 1;
+  uint64_t nsegs = (bytes + segment_size_ - 1) / segment_size_;
+  //the actors cap this further, a segment needs at least one round
+  return std::max<uint64_t>(1, std::min<uint64_t>(nsegs, Action::max_round));
+}
+
 CollectiveDoneMessage*
 CollectiveEngine::allgatherv(void *dst, void *src, int* recv_counts, int type_size, int tag,
                               int cq_id, Communicator* comm)
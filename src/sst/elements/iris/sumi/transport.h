@@ -530,6 +530,21 @@ class CollectiveEngine
 
   CollectiveDoneMessage* deliverPending(Collective* coll, int tag, Collective::type_t ty);
 
+  /**
+   * The algorithm selection table. These pick the flat algorithm
+   * for a given (sub)communicator and message size.
+   */
+  DagCollective* newAllreduce(void* dst, void* src, int nelems, int type_size, int tag,
+                              reduce_fxn fxn, int cq_id, Communicator* comm);
+
+  DagCollective* newBcast(int root, void* buf, int nelems, int type_size, int tag,
+                          int cq_id, Communicator* comm);
+
+  DagCollective* newAllgather(void* dst, void* src, int nelems, int type_size, int tag,
+                              int cq_id, Communicator* comm);
+
+  int numSegments(uint64_t bytes) const;
+
  private:
   Transport* tport_;
 
@@ -554,9 +569,17 @@ class CollectiveEngine
 
   int system_collective_tag_;
 
+  std::string allreduce_type_;
+  std::string bcast_type_;
   std::string alltoall_type_;
   std::string allgather_type_;
 
+  uint64_t ring_cutoff_;
+  int ring_max_nproc_;
+  uint64_t pipeline_cutoff_;
+  uint64_t segment_size_;
+  int bcast_fanout_;
+
   int rdma_header_qos_;
   int rdma_get_qos_;
   int smsg_qos_;
@@ -0,0 +1,898 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "noc_mesh_tile.h"
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+#include <sst/core/timeLord.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "nocEvents.h"
+
+using namespace SST::Kingsley;
+using namespace SST::Interfaces;
+using namespace std;
+
+static const int north_port = noc_mesh::north_port;
+static const int south_port = noc_mesh::south_port;
+static const int east_port = noc_mesh::east_port;
+static const int west_port = noc_mesh::west_port;
+static const int local_port_start = noc_mesh::local_port_start;
+
+static const int north_mask = noc_mesh::north_mask;
+static const int south_mask = noc_mesh::south_mask;
+static const int east_mask = noc_mesh::east_mask;
+static const int west_mask = noc_mesh::west_mask;
+
+static const char* dir_names[] = { "north", "south", "east", "west" };
+
+// A credit for this vn is sent over every link to a neighboring tile
+// during setup to check that the link has the mesh link latency
+static const int latency_probe_vn = -1;
+
+
+noc_mesh_tile::~noc_mesh_tile()
+{
+    for ( auto& q : port_queues ) {
+        while ( !q.empty() ) {
+            delete q.front();
+            q.pop();
+        }
+    }
+    for ( auto& t : in_transit ) {
+        if ( t.event != NULL ) delete t.event;
+    }
+}
+
+noc_mesh_tile::noc_mesh_tile(ComponentId_t cid, Params& params) :
+    Component(cid),
+    init_state(0),
+    total_endpoints(0),
+    output(getSimulationOutput())
+{
+    // Get the options for the routers
+    local_ports = params.find<int>("local_ports",1);
+    num_ports = local_port_start + local_ports;
+
+    use_dense_map = params.find<bool>("use_dense_map",false);
+
+    port_priority_equal = params.find<bool>("port_priority_equal",false);
+
+    route_y_first = params.find<bool>("route_y_first",false);
+
+    // Geometry
+    int mesh_x = params.find<int>("mesh_x",0);
+    int mesh_y = params.find<int>("mesh_y",0);
+    if ( mesh_x <= 0 || mesh_y <= 0 ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_tile requires mesh_x and mesh_y to be specified\n");
+    }
+    tile_x = params.find<int>("tile_x",0);
+    tile_y = params.find<int>("tile_y",0);
+    tile_width = params.find<int>("tile_width",mesh_x - tile_x);
+    tile_height = params.find<int>("tile_height",mesh_y - tile_y);
+    if ( tile_x < 0 || tile_y < 0 || tile_width <= 0 || tile_height <= 0 ||
+         tile_x + tile_width > mesh_x || tile_y + tile_height > mesh_y ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_tile: tile of %dx%d routers at (%d,%d) does not fit in a %dx%d mesh\n",
+                     tile_width, tile_height, tile_x, tile_y, mesh_x, mesh_y);
+    }
+    // Add the halo
+    x_size = mesh_x + 2;
+    y_size = mesh_y + 2;
+    num_routers = tile_width * tile_height;
+
+    // Parse all the timing parameters
+
+    bool found = false;
+
+    // Flit size
+    UnitAlgebra flit_size_ua = params.find<UnitAlgebra>("flit_size",found);
+    if ( !found ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_tile requires flit_size to be specified\n");
+    }
+    if ( flit_size_ua.hasUnits("B") ) {
+        // Need to convert to bits per second
+        flit_size_ua *= UnitAlgebra("8b/B");
+    }
+    flit_size = flit_size_ua.getRoundedValue();
+
+    UnitAlgebra input_buf_size_ua = params.find<UnitAlgebra>("input_buf_size",flit_size_ua * 2);
+    if ( input_buf_size_ua.hasUnits("B") ) {
+        // Need to convert to bits per second
+        input_buf_size_ua *= UnitAlgebra("8b/B");
+    }
+    input_buf_size = input_buf_size_ua.getRoundedValue();
+
+
+    UnitAlgebra link_bw_ua = params.find<UnitAlgebra>("link_bw",found);
+    if ( !found ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_tile requires link_bw to be specified\n");
+    }
+    if ( link_bw_ua.hasUnits("B/s") ) {
+        // Need to convert to bits per second
+        link_bw_ua *= UnitAlgebra("8b/B");
+    }
+
+    UnitAlgebra clock_freq = link_bw_ua / flit_size_ua;
+
+    UnitAlgebra latency_ua = params.find<UnitAlgebra>("mesh_link_latency","800ps");
+    if ( !latency_ua.hasUnits("s") ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_tile: mesh_link_latency must be specified in units of s\n");
+    }
+    mesh_link_latency = getTimeConverter(latency_ua)->getFactor();
+
+    // Register the clock.  Every router starts with its clock on,
+    // just like the individual noc_mesh routers do.
+    my_clock_handler = new Clock::Handler<noc_mesh_tile>(this,&noc_mesh_tile::clock_handler);
+    clock_tc = registerClock( clock_freq, my_clock_handler);
+    clock_period = clock_tc->getFactor();
+    clock_is_off = false;
+
+    edge_status.resize(num_routers,0);
+    endpoint_locations.resize(num_routers,0);
+    router_on.resize(num_routers,1);
+    last_time.resize(num_routers,0);
+    active.reserve(num_routers);
+    for ( int rtr = 0; rtr < num_routers; ++rtr ) {
+        active.push_back(rtr);
+    }
+
+    ports.resize(num_routers * num_ports,NULL);
+    port_kind.resize(num_routers * num_ports,UNUSED);
+    port_queues.resize(num_routers * num_ports);
+    port_busy.resize(num_routers * num_ports,0);
+    port_credits.resize(num_routers * num_ports,0);
+    send_bit_count.resize(num_routers * num_ports,NULL);
+    output_port_stalls.resize(num_routers * num_ports,NULL);
+    xbar_stalls.resize(num_routers * num_ports,NULL);
+
+    // Configure the ports.  Directional ports between two routers of
+    // the tile are internal, the ones on the edge of the tile are
+    // links to the next tile or, on the edge of the mesh, to the
+    // endpoints in the halo.
+    for ( int rtr = 0; rtr < num_routers; ++rtr ) {
+        int lx = rtr % tile_width;
+        int ly = rtr / tile_width;
+        std::stringstream rtr_name;
+        rtr_name << (router_x(rtr) - 1) << "_" << (router_y(rtr) - 1) << "_";
+
+        for ( int dir = 0; dir < local_port_start; ++dir ) {
+            std::string stat_name = rtr_name.str() + dir_names[dir];
+            std::string port_name;
+            bool mesh_edge = false;
+            switch ( dir ) {
+            case north_port:
+                if ( ly < tile_height - 1 ) break;
+                port_name = "north" + std::to_string(lx);
+                mesh_edge = router_y(rtr) == y_size - 2;
+                break;
+            case south_port:
+                if ( ly > 0 ) break;
+                port_name = "south" + std::to_string(lx);
+                mesh_edge = router_y(rtr) == 1;
+                break;
+            case east_port:
+                if ( lx < tile_width - 1 ) break;
+                port_name = "east" + std::to_string(ly);
+                mesh_edge = router_x(rtr) == x_size - 2;
+                break;
+            case west_port:
+                if ( lx > 0 ) break;
+                port_name = "west" + std::to_string(ly);
+                mesh_edge = router_x(rtr) == 1;
+                break;
+            }
+
+            int port = rtr * num_ports + dir;
+            if ( port_name.empty() ) {
+                port_kind[port] = INTERNAL;
+            }
+            else {
+                configure_port(rtr, dir, port_name, stat_name);
+                if ( ports[port] == NULL && !mesh_edge ) {
+                    output.fatal(CALL_INFO, -1, "noc_mesh_tile: port %s must be connected to the neighboring tile\n",
+                                 port_name.c_str());
+                }
+                continue;
+            }
+            send_bit_count[port] = registerStatistic<uint64_t>("send_bit_count",stat_name);
+            output_port_stalls[port] = registerStatistic<uint64_t>("output_port_stalls",stat_name);
+            xbar_stalls[port] = registerStatistic<uint64_t>("xbar_stalls",stat_name);
+        }
+
+        for ( int i = 0; i < local_ports; ++i ) {
+            configure_port(rtr, local_port_start + i,
+                           "local" + std::to_string(rtr * local_ports + i),
+                           rtr_name.str() + "local" + std::to_string(i));
+        }
+    }
+}
+
+void
+noc_mesh_tile::configure_port(int rtr, int dir, const std::string& name, const std::string& stat_name)
+{
+    int port = rtr * num_ports + dir;
+    ports[port] = configureLink(name, new Event::Handler<noc_mesh_tile,int>(this,&noc_mesh_tile::handle_input,port));
+    // Whether this is an endpoint is found out during init
+    port_kind[port] = ports[port] == NULL ? UNUSED : REMOTE;
+
+    send_bit_count[port] = registerStatistic<uint64_t>("send_bit_count",stat_name);
+    output_port_stalls[port] = registerStatistic<uint64_t>("output_port_stalls",stat_name);
+    xbar_stalls[port] = registerStatistic<uint64_t>("xbar_stalls",stat_name);
+}
+
+int
+noc_mesh_tile::neighbor(int rtr, int dir) const
+{
+    switch ( dir ) {
+    case north_port:
+        return rtr + tile_width;
+    case south_port:
+        return rtr - tile_width;
+    case east_port:
+        return rtr + 1;
+    case west_port:
+        return rtr - 1;
+    }
+    return -1;
+}
+
+void
+noc_mesh_tile::route(int rtr, noc_mesh_event* event)
+{
+    int my_x = router_x(rtr);
+    int my_y = router_y(rtr);
+
+    if ( route_y_first ) {
+        // Compute next port
+        if ( event->dest_mesh_loc.second > my_y ) {
+            event->next_port = north_port;
+        }
+        else if ( event->dest_mesh_loc.second < my_y ) {
+            event->next_port = south_port;
+        }
+        else {
+            if ( event->dest_mesh_loc.first > my_x ) {
+                event->next_port = east_port;
+            }
+            else if ( event->dest_mesh_loc.first < my_x) {
+                event->next_port = west_port;
+            }
+            else {
+                event->next_port = event->egress_port;
+            }
+        }
+    }
+
+    else {
+        // Compute next port
+        if ( event->dest_mesh_loc.first > my_x ) {
+            event->next_port = east_port;
+        }
+        else if ( event->dest_mesh_loc.first < my_x) {
+            event->next_port = west_port;
+        }
+        else {
+            if ( event->dest_mesh_loc.second > my_y ) {
+                event->next_port = north_port;
+            }
+            else if ( event->dest_mesh_loc.second < my_y) {
+                event->next_port = south_port;
+            }
+            else {
+                event->next_port = event->egress_port;
+            }
+        }
+    }
+}
+
+noc_mesh_event*
+noc_mesh_tile::wrap_incoming_packet(NocPacket* packet) {
+    // Wrap the incoming NocPacket in a noc_mesh_event
+    noc_mesh_event* event = new noc_mesh_event(packet);
+
+    // Compute the destination router
+    int dest = packet->request->dest;
+
+    if ( dest == SimpleNetwork::INIT_BROADCAST_ADDR ) {
+        event->dest_mesh_loc.first = -1;
+        event->dest_mesh_loc.second = -1;
+        event->egress_port = -1;
+        return event;
+    }
+
+    // Check to see if we have dense addressing
+    if ( use_dense_map ) {
+        dest = dense_map[dest];
+    }
+
+    int dest_rtr_id = dest / local_ports;
+    int x = dest_rtr_id % x_size;
+    int y = dest_rtr_id / x_size;
+
+    // Compute the egress port.  If this is in the halo, then it will
+    // be either north, south, east or west.  If it is not in the halo,
+    // it will be one of the local_ports.
+    if ( x == 0 ) {
+        x = 1;
+        event->egress_port = west_port;
+    }
+    else if ( x == x_size - 1) {
+        x = x_size - 2;
+        event->egress_port = east_port;
+    }
+    else if ( y == 0 ) {
+        y = 1;
+        event->egress_port = south_port;
+    }
+    else if ( y == y_size - 1 ) {
+        y = y_size - 2;
+        event->egress_port = north_port;
+    }
+    else {
+        event->egress_port = local_port_start + (dest - (((y * x_size) + x ) * local_ports) );
+    }
+
+    event->dest_mesh_loc.first = x;
+    event->dest_mesh_loc.second = y;
+
+    return event;
+}
+
+void
+noc_mesh_tile::wakeup(int rtr, SimTime_t time)
+{
+    if ( router_on[rtr] ) return;
+
+    // Same as noc_mesh::clock_wakeup(), the router's clock would next
+    // fire on the first edge after the event arrived.
+    Cycle_t next = time / clock_period + 1;
+    Cycle_t cyclesOff = next - last_time[rtr] - 1;
+    int* busy = &port_busy[rtr * num_ports];
+    for ( int i = 0; i < num_ports; ++i ) {
+        busy[i] = (busy[i] < cyclesOff) ? 0 : busy[i] - cyclesOff;
+    }
+    router_on[rtr] = 1;
+    active.push_back(rtr);
+
+    if ( clock_is_off ) {
+        reregisterClock(clock_tc, my_clock_handler);
+        clock_is_off = false;
+    }
+}
+
+void
+noc_mesh_tile::deliver(int port, noc_mesh_event* event, SimTime_t time)
+{
+    int rtr = port / num_ports;
+    route(rtr, event);
+
+    // Put the event into the proper queue
+    port_queues[port].push(event);
+    wakeup(rtr, time);
+}
+
+void
+noc_mesh_tile::handle_input(Event* ev, int port)
+{
+    // Check type of event
+    BaseNocEvent* base_ev = static_cast<BaseNocEvent*>(ev);
+    switch ( base_ev->getType() ) {
+    case BaseNocEvent::CREDIT:
+    {
+        credit_event* credit_ret = static_cast<credit_event*>(ev);
+        if ( credit_ret->vn == latency_probe_vn ) {
+            // Sent at time 0 from setup(), so it arrives after exactly the link latency
+            if ( getCurrentSimCycle() != mesh_link_latency ) {
+                output.fatal(CALL_INFO, -1, "noc_mesh_tile %s: the link on port %d to the neighboring tile has a latency of %" PRIu64
+                             " but mesh_link_latency is %" PRIu64 " (both in units of core timebase), they must match\n",
+                             getName().c_str(), port, getCurrentSimCycle(), mesh_link_latency);
+            }
+            delete ev;
+            break;
+        }
+        port_credits[port] += credit_ret->credits;
+        delete ev;
+        break;
+    }
+    case BaseNocEvent::PACKET:
+        // From an endpoint
+        deliver(port, wrap_incoming_packet(static_cast<NocPacket*>(ev)), getCurrentSimCycle());
+        break;
+    case BaseNocEvent::INTERNAL:
+        // From the neighboring tile
+        deliver(port, static_cast<noc_mesh_event*>(ev), getCurrentSimCycle());
+        break;
+    default:
+        break;
+    }
+}
+
+bool
+noc_mesh_tile::clock_handler(Cycle_t cycle)
+{
+    SimTime_t now = getCurrentSimCycle();
+
+    // Anything that arrived since the last edge.  Something arriving
+    // exactly on this edge is seen after the clock, like an event on a
+    // link would be.
+    while ( !in_transit.empty() && in_transit.front().time < now ) {
+        transit_t& t = in_transit.front();
+        if ( t.event != NULL ) {
+            deliver(t.port, t.event, t.time);
+        }
+        else {
+            port_credits[t.port] += t.credits;
+        }
+        in_transit.pop_front();
+    }
+
+    // The routers only talk to each other through in_transit, so the
+    // order they are clocked in does not matter.
+    size_t count = 0;
+    for ( size_t i = 0; i < active.size(); ++i ) {
+        int rtr = active[i];
+        if ( router_clock(rtr, cycle) ) {
+            active[count++] = rtr;
+        }
+        else {
+            router_on[rtr] = 0;
+        }
+    }
+    active.resize(count);
+
+    clock_is_off = active.empty() && in_transit.empty();
+    return clock_is_off;
+}
+
+// Body of noc_mesh::clock_handler() for one router of the tile
+bool
+noc_mesh_tile::router_clock(int rtr, Cycle_t cycle)
+{
+    int base = rtr * num_ports;
+    int* busy = &port_busy[base];
+    int* credits = &port_credits[base];
+    port_queue_t* queues = &port_queues[base];
+
+    last_time[rtr] = cycle;
+    // Decrement all the busy values
+    for ( int i = 0; i < num_ports; ++i ) {
+        busy[i]--;
+        if (busy[i] < 0) busy[i] = 0;
+    }
+
+    bool keepClockOn = false;
+
+    // Prioirty goes in order of the lru_units list.  First entry has
+    // highest priority, second has second highest, etc
+    for ( int u = 0; u < lru_per_router; ++u ) {
+        lru_unit<int>& lru = lru_units[rtr * lru_per_router + u];
+        for ( unsigned int i = 0; i < lru.size(); i++ ) {
+            int lru_port = lru.top();
+            if ( !queues[lru_port].empty() ) {
+                noc_mesh_event* event = queues[lru_port].front();
+
+                // Get the next port
+                int port = event->next_port;
+
+                // Check to see if the port is busy
+                if ( busy[port] > 0 ) {
+                    xbar_stalls[base + port]->addData(1);
+                    lru.satisfied(false);
+                    keepClockOn = true;
+                    continue;
+                }
+
+                // Check to see if there are enough credits to send on
+                // that port
+                if ( credits[port] >= event->encap_ev->getSizeInFlits() ) {
+                    int trace_id = event->encap_ev->request->getTraceID();
+                    int vn = event->encap_ev->vn;
+                    SST::Interfaces::SimpleNetwork::nid_t src = event->encap_ev->request->src;
+                    SST::Interfaces::SimpleNetwork::nid_t dest = event->encap_ev->request->dest;
+                    SST::Interfaces::SimpleNetwork::Request::TraceType ttype = event->encap_ev->request->getTraceType();
+                    int flits = event->encap_ev->getSizeInFlits();
+
+                    queues[lru_port].pop();
+                    credits[port] -= flits;
+                    busy[port] = flits;
+                    send_bit_count[base + port]->addData(event->encap_ev->request->size_in_bits);
+                    if ( edge_status[rtr] & ( 1 << port) ) {
+                        ports[base + port]->send(event->encap_ev);
+                        event->encap_ev = NULL;
+                        delete event;
+                    }
+                    else if ( port_kind[base + port] == INTERNAL ) {
+                        transit_t t = { getCurrentSimCycle() + mesh_link_latency,
+                                        neighbor(rtr, port) * num_ports + (port ^ 1), event, 0 };
+                        in_transit.push_back(t);
+                    }
+                    else {
+                        ports[base + port]->send(event);
+                    }
+                    if ( ttype == SimpleNetwork::Request::FULL ) {
+                        output.output("TRACE(%d): %" PRIu64 " ns: Sent an event to router from router: (%d,%d)"
+                                      " (%s) on VC %d from src %" PRIu64 " to dest %" PRIu64 ".\n",
+                                      trace_id,
+                                      getCurrentSimTimeNano(),
+                                      router_x(rtr), router_y(rtr),
+                                      getName().c_str(),
+                                      vn,
+                                      src,
+                                      dest);
+                    }
+                    // Need to send credit event back to last router
+                    if ( port_kind[base + lru_port] == INTERNAL ) {
+                        transit_t t = { getCurrentSimCycle() + mesh_link_latency,
+                                        neighbor(rtr, lru_port) * num_ports + (lru_port ^ 1), NULL, flits };
+                        in_transit.push_back(t);
+                    }
+                    else {
+                        ports[base + lru_port]->send(new credit_event(0, flits));
+                    }
+                    lru.satisfied(true);
+                }
+                else {
+                    output_port_stalls[base + port]->addData(1);
+                    lru.satisfied(false);
+                }
+                if (!queues[lru_port].empty())
+                    keepClockOn = true;
+            }
+            else {
+                lru.satisfied(false);
+            }
+        }
+    }
+
+    return keepClockOn;
+}
+
+void noc_mesh_tile::setup()
+{
+    // Set up the lru units, endpoints first unless all ports have
+    // equal priority
+    lru_per_router = port_priority_equal ? 1 : 2;
+    lru_units.resize(num_routers * lru_per_router);
+
+    for ( int rtr = 0; rtr < num_routers; ++rtr ) {
+        lru_unit<int>* units = &lru_units[rtr * lru_per_router];
+        for ( int i = local_port_start; i < num_ports; ++i ) {
+            if ( port_kind[rtr * num_ports + i] != UNUSED ) {
+                units[0].insert(i);
+            }
+        }
+
+        if ( !port_priority_equal ) {
+            units[0].finalize();
+        }
+
+        // Now the mesh ports
+        for ( int i = 0; i < local_port_start; ++i ) {
+            if ( port_kind[rtr * num_ports + i] != UNUSED ) {
+                units[lru_per_router - 1].insert(i);
+            }
+        }
+        units[lru_per_router - 1].finalize();
+    }
+
+    // Flits between routers of the tile take mesh_link_latency, so the
+    // links to the neighboring tiles must have the same latency or the
+    // timing would depend on where the mesh is split
+    for ( size_t port = 0; port < ports.size(); ++port ) {
+        if ( port_kind[port] == REMOTE ) {
+            ports[port]->send(new credit_event(latency_probe_vn, 0));
+        }
+    }
+}
+
+void noc_mesh_tile::finish()
+{
+}
+
+void
+noc_mesh_tile::assign_endpoint_ids()
+{
+    // Endpoints are numbered router by router in row major order, so
+    // each router needs the number of endpoints on all the routers
+    // before it in the mesh, including the ones in other tiles.
+    std::vector<int> endpoint_start;
+    if ( use_dense_map ) {
+        int mesh_routers = (x_size - 2) * (y_size - 2);
+        endpoint_start.resize(mesh_routers);
+        for ( int i = 0; i < mesh_routers; ++i ) {
+            endpoint_start[i] = total_endpoints;
+            total_endpoints += endpoint_counts[i];
+        }
+        dense_map.initialize("noc_mesh_tile_dense_map", 16 * total_endpoints);
+    }
+
+    for ( int rtr = 0; rtr < num_routers; ++rtr ) {
+        int my_x = router_x(rtr);
+        int my_y = router_y(rtr);
+        unsigned int locations = endpoint_locations[rtr];
+
+        std::vector<std::pair<int,int>> ep_ids;
+        for ( int dir = 0; dir < local_port_start; ++dir ) {
+            if ( !(locations & (1 << dir)) ) continue;
+            int x = my_x;
+            int y = my_y;
+            switch ( dir ) {
+            case north_port: y++; break;
+            case south_port: y--; break;
+            case east_port:  x++; break;
+            case west_port:  x--; break;
+            }
+            ep_ids.push_back(std::make_pair(((y * x_size) + x) * local_ports, dir));
+        }
+
+        // Now for local ports
+        for ( int i = 0; i < local_ports; ++i ) {
+            if ( locations & ( 1 << (i + local_port_start) ) ) {
+                int endpoint_id = (((my_y * x_size) + my_x) * local_ports) + i;
+                ep_ids.push_back(std::make_pair(endpoint_id,local_port_start + i));
+            }
+        }
+
+        if ( use_dense_map ) {
+            std::sort(ep_ids.begin(), ep_ids.end());
+
+            int start = endpoint_start[mesh_index(rtr)];
+            for ( size_t i = 0; i < ep_ids.size(); ++i ) {
+                dense_map.write(start + i, ep_ids[i].first);
+                ep_ids[i].first = start + i;
+            }
+        }
+
+        // Send all the endpoint notifications
+        for ( auto i : ep_ids ) {
+            NocInitEvent* nie = new NocInitEvent();
+            nie->command = NocInitEvent::REPORT_ENDPOINT_ID;
+            nie->int_value = i.first;
+            ports[rtr * num_ports + i.second]->sendUntimedData(nie);
+        }
+    }
+
+    if ( use_dense_map ) {
+        dense_map.publish();
+    }
+}
+
+void
+noc_mesh_tile::init(unsigned int phase)
+{
+    // Init states:
+    // 0 - wait for endpoint messages
+    //
+    // 1 - recv messages from endpoints, pass flit_size to them and
+    // publish the endpoint count of each router
+    //
+    // 2 - Send ids to the endpoints
+    //
+    // 3 - Send all credit events
+    //
+    // 4 - Receive credits, then route untimed messages from here on
+
+    switch ( init_state ) {
+    case 0:
+        // Phase 0 is only for endpoints to send a message
+        init_state = 1;
+        break;
+    case 1:
+    {
+        for ( int port = 0; port < num_routers * num_ports; ++port ) {
+            if ( ports[port] == NULL ) continue;
+            Event* ev = ports[port]->recvUntimedData();
+            if ( ev == NULL ) continue;
+            NocInitEvent* nie = static_cast<NocInitEvent*>(ev);
+            if ( nie->command == NocInitEvent::REPORT_ENDPOINT ) {
+                port_kind[port] = ENDPOINT;
+                endpoint_locations[port / num_ports] |= 1 << (port % num_ports);
+            }
+            delete nie;
+        }
+
+        for ( int port = 0; port < num_routers * num_ports; ++port ) {
+            if ( port_kind[port] == UNUSED || port_kind[port] == ENDPOINT ) {
+                edge_status[port / num_ports] |= 1 << (port % num_ports);
+            }
+            if ( port_kind[port] == ENDPOINT ) {
+                NocInitEvent* nie = new NocInitEvent();
+                nie->command = NocInitEvent::REPORT_FLIT_SIZE;
+                nie->ua_value = UnitAlgebra("1b") * flit_size;
+                ports[port]->sendUntimedData(nie);
+            }
+        }
+
+        if ( use_dense_map ) {
+            endpoint_counts.initialize("noc_mesh_tile_endpoint_counts", (x_size - 2) * (y_size - 2));
+            for ( int rtr = 0; rtr < num_routers; ++rtr ) {
+                endpoint_counts.write(mesh_index(rtr), __builtin_popcount(endpoint_locations[rtr]));
+            }
+            endpoint_counts.publish();
+        }
+        init_state = 2;
+        break;
+    }
+    case 2:
+        assign_endpoint_ids();
+        init_state = 3;
+        break;
+    case 3:
+        for ( int port = 0; port < num_routers * num_ports; ++port ) {
+            if ( port_kind[port] == INTERNAL ) {
+                // Would have come from the neighbor inside the tile
+                port_credits[port] += input_buf_size/flit_size;
+            }
+            else if ( ports[port] != NULL ) {
+                ports[port]->sendUntimedData(new credit_event(0,input_buf_size/flit_size));
+            }
+        }
+        init_state = 4;
+        break;
+    default:
+        // Receive credits and route messages that are sent by the
+        // endpoints
+        for ( int port = 0; port < num_routers * num_ports; ++port ) {
+            if ( ports[port] == NULL ) continue;
+            while ( Event* ev = ports[port]->recvUntimedData() ) {
+                if ( static_cast<BaseNocEvent*>(ev)->getType() == BaseNocEvent::CREDIT ) {
+                    port_credits[port] += static_cast<credit_event*>(ev)->credits;
+                    delete ev;
+                }
+                else {
+                    route_untimed(port, ev);
+                }
+            }
+        }
+        break;
+    }
+}
+
+void
+noc_mesh_tile::complete(unsigned int phase)
+{
+    // Simply route messages that are sent by the endpoints
+    for ( int port = 0; port < num_routers * num_ports; ++port ) {
+        if ( ports[port] == NULL ) continue;
+        while ( Event* ev = ports[port]->recvUntimedData() ) {
+            route_untimed(port, ev);
+        }
+    }
+}
+
+// Same routing as noc_mesh::init() and noc_mesh::complete(), except
+// that hops inside the tile are taken right away instead of in the
+// next phase.
+void
+noc_mesh_tile::route_untimed(int in_port, Event* in_ev)
+{
+    std::queue<std::pair<int,Event*>> work;
+    work.push(std::make_pair(in_port, in_ev));
+
+    while ( !work.empty() ) {
+        int rtr = work.front().first / num_ports;
+        int i = work.front().first % num_ports;
+        Event* ev = work.front().second;
+        work.pop();
+
+        int base = rtr * num_ports;
+        unsigned int edges = edge_status[rtr];
+        bool endpoint = port_kind[base + i] == ENDPOINT;
+
+        auto forward = [&](int dir, noc_mesh_event* nme) {
+            if ( port_kind[base + dir] == INTERNAL ) {
+                work.push(std::make_pair(neighbor(rtr, dir) * num_ports + (dir ^ 1), static_cast<Event*>(nme)));
+            }
+            else {
+                ports[base + dir]->sendUntimedData(nme);
+            }
+        };
+
+        noc_mesh_event* nme;
+        if ( endpoint ) {
+            nme = wrap_incoming_packet(static_cast<NocPacket*>(ev));
+        }
+        else {
+            nme = static_cast<noc_mesh_event*>(ev);
+        }
+
+        if ( nme->egress_port != -1 ) {
+            route(rtr, nme);
+            if ( (1 << nme->next_port) & endpoint_locations[rtr] ) {
+                ports[base + nme->next_port]->sendUntimedData(nme->encap_ev);
+                nme->encap_ev = NULL;
+                delete nme;
+            }
+            else {
+                forward(nme->next_port, nme);
+            }
+            continue;
+        }
+
+        // Broadcast.  From an endpoint it goes in all four directions,
+        // from the east or west it keeps going that way and also
+        // turns north and south, and from the north or south it only
+        // keeps going.
+        if ( endpoint || ( (1 << i ) & west_mask ) ) {
+            if ( !(edges & east_mask) ) forward(east_port, nme->clone());
+        }
+        if ( endpoint || ( (1 << i ) & east_mask ) ) {
+            if ( !(edges & west_mask) ) forward(west_port, nme->clone());
+        }
+        if ( endpoint || ( (1 << i ) & west_mask ) ||
+             ( (1 << i ) & east_mask ) || ( (1 << i ) & south_mask )) {
+            if ( !(edges & north_mask) ) forward(north_port, nme->clone());
+        }
+        if ( endpoint || ( (1 << i ) & west_mask ) ||
+             ( (1 << i ) & east_mask ) || ( (1 << i ) & north_mask )) {
+            if ( !(edges & south_mask) ) forward(south_port, nme->clone());
+        }
+
+        // Now send to all the endpoints
+        bool sent = false;
+        NocPacket* packet = nme->encap_ev;
+        nme->encap_ev = NULL;
+        delete nme;
+        for ( int j = 0; j < num_ports; ++j ) {
+            if ( endpoint && ( i == j ) ) continue;  // No need to send back to src
+            if ( (1 << j) & endpoint_locations[rtr] ) {
+                if (!sent) {
+                    ports[base + j]->sendUntimedData(packet);
+                    sent = true;
+                }
+                else {
+                    ports[base + j]->sendUntimedData(packet->clone());
+                }
+            }
+        }
+        if ( !sent ) delete packet;
+    }
+}
+
+void
+noc_mesh_tile::printStatus(Output& out)
+{
+    out.output("Start Tile %s:  %d x %d routers at (%d, %d)\n", getName().c_str(),
+               tile_width, tile_height, tile_x, tile_y);
+
+    for ( int rtr = 0; rtr < num_routers; ++rtr ) {
+        out.output("  Router (%d, %d)%s:\n", router_x(rtr), router_y(rtr), router_on[rtr] ? "" : " (clock off)");
+        for ( int p = 0; p < num_ports; ++p ) {
+            int port = rtr * num_ports + p;
+            if ( port_kind[port] == UNUSED ) continue;
+            if ( p < local_port_start ) out.output("    %s port:\n", dir_names[p]);
+            else                        out.output("    local_port%d port:\n", p - local_port_start);
+            out.output("      Port busy = %d\n",port_busy[port]);
+            out.output("      Port credits = %d\n",port_credits[port]);
+            out.output("      Input queue total packets = %lu, head packet info:\n",port_queues[port].size());
+            if ( port_queues[port].empty() ) {
+                out.output("        <empty>\n");
+            }
+            else {
+                noc_mesh_event* event = port_queues[port].front();
+                out.output("        src = %" PRI_NID ", dest = %" PRI_NID ", next_port = %d, flits = %d\n",
+                           event->encap_ev->request->src, event->encap_ev->request->dest,
+                           event->next_port, event->encap_ev->getSizeInFlits());
+            }
+        }
+    }
+
+    out.output("End Tile %s\n\n", getName().c_str());
+}
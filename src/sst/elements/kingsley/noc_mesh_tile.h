@@ -0,0 +1,198 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_KINGSLEY_NOC_MESH_TILE_H
+#define COMPONENTS_KINGSLEY_NOC_MESH_TILE_H
+
+#include <sst/core/clock.h>
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+#include <sst/core/shared/sharedArray.h>
+
+#include <sst/core/statapi/stataccumulator.h>
+
+#include <deque>
+#include <queue>
+#include <vector>
+
+#include "sst/elements/kingsley/nocEvents.h"
+#include "sst/elements/kingsley/lru_unit.h"
+#include "sst/elements/kingsley/noc_mesh.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Kingsley {
+
+// Simulates a rectangular tile of a 2-D mesh (or the whole mesh) in a
+// single component.  Every router in the tile behaves exactly like a
+// noc_mesh router, including its clock gating and arbitration state,
+// but flits and credits between routers in the same tile are passed
+// through an internal queue instead of SST links.  Only endpoints and
+// neighboring tiles are attached with real links, so tiles can be
+// placed on different ranks.
+//
+// Unlike noc_mesh, the geometry is given as parameters rather than
+// discovered during init, so tiles can only be connected to other
+// tiles and to endpoints.
+class noc_mesh_tile : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        noc_mesh_tile,
+        "kingsley",
+        "noc_mesh_tile",
+        SST_ELI_ELEMENT_VERSION(0,1,0),
+        "Rectangular tile of 2-D mesh NOC routers simulated in one component",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"local_ports",        "Number of ports on each router that are dedicated to endpoints.","1"},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix)."},
+        {"input_buf_size",     "Size of input buffers in either b or B (can use SI prefix).  Default is 2*flit_size."},
+        {"port_priority_equal","Set to true to have all port have equal priority (usually endpoint ports have higher priority).","false"},
+        {"route_y_first",      "Set to true to rout Y-dimension first.","false"},
+        {"use_dense_map",      "Set to true to have a dense network id map instead of the sparse map normally used.","false"},
+        {"mesh_x",             "Number of routers in the X dimension of the whole mesh."},
+        {"mesh_y",             "Number of routers in the Y dimension of the whole mesh."},
+        {"tile_x",             "X coordinate of the south west router of this tile.","0"},
+        {"tile_y",             "Y coordinate of the south west router of this tile.","0"},
+        {"tile_width",         "Number of routers in the X dimension of this tile.  Default is the rest of the mesh.",""},
+        {"tile_height",        "Number of routers in the Y dimension of this tile.  Default is the rest of the mesh.",""},
+        {"mesh_link_latency",  "Latency of the links between routers inside the tile.  Should match the latency of the links between tiles.","800ps"},
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        { "north%(tile_width)d", "North edge of the tile, one port per column.", {} },
+        { "south%(tile_width)d", "South edge of the tile, one port per column.", {} },
+        { "east%(tile_height)d", "East edge of the tile, one port per row.",     {} },
+        { "west%(tile_height)d", "West edge of the tile, one port per row.",     {} },
+        { "local%d",             "Ports which connect to endpoints.  Router (x,y) of the tile uses ports (y*tile_width+x)*local_ports and up.", {} }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+        { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
+        { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
+    )
+
+private:
+
+    enum port_kind_t { UNUSED, INTERNAL, REMOTE, ENDPOINT };
+
+    // A flit or credit on its way between two routers of the tile
+    struct transit_t {
+        SimTime_t time;         // core time it arrives
+        int port;               // flat index of the receiving port
+        noc_mesh_event* event;  // NULL for a credit
+        int credits;
+    };
+
+    typedef std::queue<noc_mesh_event*> port_queue_t;
+
+    int init_state;
+
+    int flit_size;
+    int input_buf_size;
+    int local_ports;
+    int num_ports;      // per router
+    bool route_y_first;
+    bool use_dense_map;
+    bool port_priority_equal;
+
+    // Mesh coordinates include the virtual halo of edge endpoints,
+    // so the router at (0,0) in the parameters is (1,1) here.
+    int x_size;
+    int y_size;
+    int tile_x;
+    int tile_y;
+    int tile_width;
+    int tile_height;
+    int num_routers;
+    int total_endpoints;
+
+    Clock::Handler<noc_mesh_tile>* my_clock_handler;
+    TimeConverter* clock_tc;
+    SimTime_t clock_period;
+    SimTime_t mesh_link_latency;
+    bool clock_is_off;
+
+    // Per router state
+    std::vector<unsigned int> edge_status;
+    std::vector<unsigned int> endpoint_locations;
+    std::vector<char> router_on;
+    std::vector<Cycle_t> last_time;
+    std::vector< lru_unit<int> > lru_units;  // lru_per_router per router, highest priority first
+    int lru_per_router;
+    std::vector<int> active;
+
+    // Per port state, indexed by router * num_ports + port
+    std::vector<Link*> ports;
+    std::vector<port_kind_t> port_kind;
+    std::vector<port_queue_t> port_queues;
+    std::vector<int> port_busy;
+    std::vector<int> port_credits;
+    std::vector<Statistic<uint64_t>*> send_bit_count;
+    std::vector<Statistic<uint64_t>*> output_port_stalls;
+    std::vector<Statistic<uint64_t>*> xbar_stalls;
+
+    std::deque<transit_t> in_transit;
+
+    Shared::SharedArray<int> endpoint_counts;
+    Shared::SharedArray<int> dense_map;
+
+    Output& output;
+
+    inline int router_x(int rtr) const { return tile_x + (rtr % tile_width) + 1; }
+    inline int router_y(int rtr) const { return tile_y + (rtr / tile_width) + 1; }
+    inline int mesh_index(int rtr) const { return (router_y(rtr) - 1) * (x_size - 2) + router_x(rtr) - 1; }
+    int neighbor(int rtr, int dir) const;
+
+    void configure_port(int rtr, int port, const std::string& name, const std::string& stat_name);
+
+    bool clock_handler(Cycle_t cycle);
+    bool router_clock(int rtr, Cycle_t cycle);
+    void wakeup(int rtr, SimTime_t time);
+    void handle_input(Event* ev, int port);
+
+    noc_mesh_event* wrap_incoming_packet(NocPacket* packet);
+    void route(int rtr, noc_mesh_event* event);
+    void deliver(int port, noc_mesh_event* event, SimTime_t time);
+
+    void assign_endpoint_ids();
+    void route_untimed(int port, Event* ev);
+
+public:
+    noc_mesh_tile(ComponentId_t cid, Params& params);
+    ~noc_mesh_tile();
+
+    void init(unsigned int phase);
+    void complete(unsigned int phase);
+    void setup();
+    void finish();
+
+    void printStatus(Output& out);
+};
+
+}
+}
+
+#endif // COMPONENTS_KINGSLEY_NOC_MESH_TILE_H
@@ -0,0 +1,134 @@
+# The network of noc_mesh_32_test.py built from noc_mesh_tile components
+# instead of one noc_mesh component per router.  The mesh is split into
+# tiles_x by tiles_y tiles, given as model options, e.g.
+#   sst noc_mesh_tile_32_test.py --model-options="2 1"
+# Every split must produce the same output as noc_mesh_32_test.py.
+import sys
+import sst
+
+sst.setProgramOption("timebase", "1ps")
+
+x_size = 4
+y_size = 4
+
+tiles_x = 1
+tiles_y = 1
+if len(sys.argv) > 2:
+    tiles_x = int(sys.argv[1])
+    tiles_y = int(sys.argv[2])
+
+if x_size % tiles_x != 0 or y_size % tiles_y != 0:
+    print("The %dx%d mesh can not be split into %dx%d tiles"%(x_size, y_size, tiles_x, tiles_y))
+    sys.exit(1)
+
+tile_width = x_size // tiles_x
+tile_height = y_size // tiles_y
+
+links = dict()
+def getLink(name1, name2):
+    name = "link.%s_%s"%(name1, name2)
+    if name not in links:
+        links[name] = sst.Link(name)
+    return links[name]
+
+num_endpoints = 1
+
+num_peers = (num_endpoints * (x_size * y_size)) + (2*x_size) + (2*y_size)
+num_messages = 10
+msg_size = "64B"
+link_bw = "32GB/s"
+flit_size = "32B"
+input_buf_size = "64B"
+link_latency = "800ps"
+
+def addEndpoint(name, link):
+    ep = sst.Component(name, "merlin.test_nic")
+    ep.addParams({
+        "num_peers" : "%d"%(num_peers),
+        "link_bw" : "1GB/s",
+        "linkcontrol_type" : "kingsley.linkcontrol",
+        "message_size" : msg_size,
+        "num_messages" : "%d"%(num_messages)
+    })
+    sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
+    sub.addParam("link_bw","1GB/s")
+    sub.addLink(link, "rtr_port", link_latency)
+
+# The links between routers carry the same names as in noc_mesh_32_test.py,
+# whether they end up between two tiles or inside one
+tiles = dict()
+for ty in range(tiles_y):
+    for tx in range(tiles_x):
+        tile = sst.Component("tile_%d_%d"%(tx,ty), "kingsley.noc_mesh_tile")
+        tile.addParams({
+            "local_ports" : "%d"%(num_endpoints),
+            "link_bw" : link_bw,
+            "input_buf_size" : input_buf_size,
+            "flit_size" : flit_size,
+            "use_dense_map" : "true",
+            "mesh_x" : x_size,
+            "mesh_y" : y_size,
+            "tile_x" : tx * tile_width,
+            "tile_y" : ty * tile_height,
+            "tile_width" : tile_width,
+            "tile_height" : tile_height,
+            "mesh_link_latency" : link_latency
+        })
+        tiles[(tx,ty)] = tile
+
+for y in range(y_size):
+    for x in range(x_size):
+        tile = tiles[(x // tile_width, y // tile_height)]
+        lx = x % tile_width
+        ly = y % tile_height
+
+        # Ports on the edge of a tile are links, either to the next tile
+        # or to the endpoints around the mesh
+        if ly == tile_height - 1:
+            if y != y_size - 1:
+                tile.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x,y+1)), "north%d"%(lx), link_latency)
+            else:
+                link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x,y+1))
+                tile.addLink(link, "north%d"%(lx), link_latency)
+                addEndpoint("ep0_%d_%d"%(x,y+1), link)
+
+        if ly == 0:
+            if y != 0:
+                tile.addLink(getLink("rtr_%d_%d"%(x,y-1), "rtr_%d_%d"%(x,y)), "south%d"%(lx), link_latency)
+            else:
+                link = getLink("rtr_%d_X"%(x), "ep0_%d_%d"%(x,y))
+                tile.addLink(link, "south%d"%(lx), link_latency)
+                addEndpoint("ep0_%d_X"%(x), link)
+
+        if lx == tile_width - 1:
+            if x != x_size - 1:
+                tile.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x+1,y)), "east%d"%(ly), link_latency)
+            else:
+                link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x+1,y))
+                tile.addLink(link, "east%d"%(ly), link_latency)
+                addEndpoint("ep0_%d_%d"%(x+1,y), link)
+
+        if lx == 0:
+            if x != 0:
+                tile.addLink(getLink("rtr_%d_%d"%(x-1,y), "rtr_%d_%d"%(x,y)), "west%d"%(ly), link_latency)
+            else:
+                link = getLink("rtr_X_%d"%(y), "ep0_%d_%d"%(x,y))
+                tile.addLink(link, "west%d"%(ly), link_latency)
+                addEndpoint("ep0_X_%d"%(y), link)
+
+        # Add endpoints
+        for z in range(num_endpoints):
+            link = getLink("rtr_%d_%d"%(x,y), "ep%d_%d_%d"%(z,x,y))
+            tile.addLink(link, "local%d"%((ly * tile_width + lx) * num_endpoints + z), link_latency)
+            addEndpoint("ep%d_%d_%d"%(z,x,y), link)
+
+
+sst.setStatisticLoadLevel(9)
+
+sst.setStatisticOutput("sst.statOutputCSV");
+sst.setStatisticOutputOptions({
+    "filepath" : "stats.csv",
+    "separator" : ", "
+})
+
+sst.enableAllStatisticsForComponentType("kingsley.noc_mesh_tile", {"type":"sst.AccumulatorStatistic","rate":"0ns"})
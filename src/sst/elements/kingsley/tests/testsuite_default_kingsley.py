@@ -19,9 +19,20 @@ class testcase_kingsley_Component(SSTTestCase):
     def test_kingsly_noc_mesh_32(self):
         self.kingsley_test_template("noc_mesh_32_test")
 
+    # The same mesh simulated by noc_mesh_tile components must match the
+    # noc_mesh reference output however it is split into tiles
+    def test_kingsly_noc_mesh_tile_32_1x1(self):
+        self.kingsley_test_template("noc_mesh_tile_32_test", "1x1", "noc_mesh_32_test")
+
+    def test_kingsly_noc_mesh_tile_32_2x1(self):
+        self.kingsley_test_template("noc_mesh_tile_32_test", "2x1", "noc_mesh_32_test")
+
+    def test_kingsly_noc_mesh_tile_32_2x2(self):
+        self.kingsley_test_template("noc_mesh_tile_32_test", "2x2", "noc_mesh_32_test")
+
 #####
 
-    def kingsley_test_template(self, testcase):
+    def kingsley_test_template(self, testcase, tiles="", reftestcase=""):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -29,14 +40,22 @@ class testcase_kingsley_Component(SSTTestCase):
 
         # Set the various file paths
         testDataFileName="test_kingsley_{0}".format(testcase)
+        if len(tiles):
+            testDataFileName="{0}_{1}".format(testDataFileName, tiles)
+        if not len(reftestcase):
+            reftestcase = testcase
 
         sdlfile = "{0}/{1}.py".format(test_path, testcase)
-        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        reffile = "{0}/refFiles/test_kingsley_{1}.out".format(test_path, reftestcase)
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+        otherargs = ""
+        if len(tiles):
+            otherargs = '--model-options="{0}"'.format(tiles.replace("x", " "))
+
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
 
         # NOTE: THE PASS / FAIL EVALUATIONS ARE PORTED FROM THE SQE BAMBOO
         #       BASED testSuite_XXX.sh THESE SHOULD BE RE-EVALUATED BY THE
@@ -37,6 +37,9 @@ LlyrComponent::LlyrComponent(ComponentId_t id, Params& params) :
     //initial params
     clock_enabled_ = 1;
     compute_complete = 0;
+    last_active_cycle_ = 0;
+    tick_position_ = -1;
+    in_tick_ = 0;
     const uint32_t verbosity = params.find< uint32_t >("verbose", 0);
 
     //setup up i/o for messages
@@ -207,6 +210,93 @@ void LlyrComponent::init( uint32_t phase )
 
 void LlyrComponent::setup()
 {
+    freezeGraph();
+}
+
+void LlyrComponent::freezeGraph()
+{
+    std::map< uint32_t, Vertex< ProcessingElement* > >* vertex_map_ = mappedGraph_.getVertexMap();
+
+    // compressed adjacency of the mapped graph, vertex ids become dense indices
+    std::map< uint32_t, uint32_t > index;
+    std::vector< uint32_t > ids;
+    for( auto it = vertex_map_->begin(); it != vertex_map_->end(); ++it ) {
+        index.emplace( it->first, ids.size() );
+        ids.push_back( it->first );
+    }
+
+    std::vector< uint32_t > rowStart( 1, 0 );
+    std::vector< uint32_t > columns;
+    for( auto it = vertex_map_->begin(); it != vertex_map_->end(); ++it ) {
+        std::vector< Edge* >* adjacencyList = it->second.getAdjacencyList();
+        for( auto edge = adjacencyList->begin(); edge != adjacencyList->end(); ++edge ) {
+            columns.push_back( index.at( (*edge)->getDestination() ) );
+        }
+        rowStart.push_back( columns.size() );
+    }
+
+    //Node 0 is a dummy node and is always the entry point
+    std::vector< bool > visited( ids.size(), 0 );
+    std::queue< uint32_t > nodeQueue;
+    nodeQueue.push( index.at(0) );
+    visited[index.at(0)] = 1;
+
+    while( nodeQueue.empty() == 0 ) {
+        uint32_t current = nodeQueue.front();
+        nodeQueue.pop();
+
+        uint32_t position = pe_order_.size();
+        ProcessingElement* pe = vertex_map_->at(ids[current]).getValue();
+
+        pe_order_.push_back( pe );
+        pe_vertex_.push_back( ids[current] );
+        vertex_position_[ids[current]] = position;
+        pe->setWakeup( [this, position]() { wakePE( position ); } );
+
+        if( pe->hasQueuedData() ) {
+            ready_next_.insert( position );
+        }
+
+        for( uint32_t i = rowStart[current]; i < rowStart[current + 1]; ++i ) {
+            if( visited[columns[i]] == 0 ) {
+                visited[columns[i]] = 1;
+                nodeQueue.push( columns[i] );
+            }
+        }
+    }
+
+    output_->verbose(CALL_INFO, 1, 0, "Scheduling %zu of %zu PEs\n", pe_order_.size(), ids.size());
+}
+
+// Data pushed into a PE later in the walk is consumed this cycle, data
+// pushed into one already passed waits for the next cycle.
+void LlyrComponent::wakePE( uint32_t position )
+{
+    if( in_tick_ && int64_t(position) > tick_position_ ) {
+        ready_now_.insert( position );
+    } else {
+        ready_next_.insert( position );
+    }
+}
+
+void LlyrComponent::turnClockOn()
+{
+    if( clock_enabled_ ) {
+        return;
+    }
+
+    // the cycles spent waiting on memory would have found nothing to do,
+    // a device waiting to be started by MMIO has no requests outstanding
+    Cycle_t cycle = reregisterClock( time_converter_, clock_tick_handler_ );
+    if( ls_queue_->getNumEntries() > 0 ) {
+        zeroEventCycles_->addDataNTimes( cycle - 1 - last_active_cycle_, 1 );
+    }
+    clock_enabled_ = 1;
+}
+
+bool LlyrComponent::lsHeadReady() const
+{
+    return ls_queue_->getNumEntries() > 0 && ls_queue_->getEntryReady( ls_queue_->getNextEntry() ) != 0;
 }
 
 void LlyrComponent::finish()
@@ -216,59 +306,60 @@ void LlyrComponent::finish()
 bool LlyrComponent::tick(SST::Cycle_t currentCycle)
 {
     // TraceFunction trace(CALL_INFO_LONG);
+    //a device waiting for MMIO stops its clock until it is started
     if( clock_enabled_ == 0 ) {
-        return false;
+        return true;
     }
 
     compute_complete = 0;
-    //On each tick perform BFS on graph and compute based on operand availability
-    //NOTE node0 is a dummy node to simplify the algorithm
-    std::queue< uint32_t > nodeQueue;
-
     output_->verbose(CALL_INFO, 1, 0, "Device clock tick\n");
 
-    //Mark all nodes in the PE graph un-visited
-    std::map< uint32_t, Vertex< ProcessingElement* > >* vertex_map_ = mappedGraph_.getVertexMap();
-    typename std::map< uint32_t, Vertex< ProcessingElement* > >::iterator vertexIterator;
-    for(vertexIterator = vertex_map_->begin(); vertexIterator != vertex_map_->end(); ++vertexIterator) {
-        vertexIterator->second.setVisited(0);
-    }
-
-    //Node 0 is a dummy node and is always the entry point
-    nodeQueue.push(0);
-
-    //BFS and do operations if values available in input queues
-    while( nodeQueue.empty() == 0 ) {
-        uint32_t currentNode = nodeQueue.front();
-        nodeQueue.pop();
-
-        std::vector< Edge* >* adjacencyList = vertex_map_->at(currentNode).getAdjacencyList();
-
-        //set visited for bfs
-        vertex_map_->at(currentNode).setVisited(1);
+    //Walk the PEs in BFS order and do operations if values available in input queues
+    ready_now_.swap( ready_next_ );
+    ready_next_.clear();
+    in_tick_ = 1;
+    tick_position_ = -1;
+
+    //the L/S unit is drained a little before each PE, once the oldest
+    //request is not back yet it cannot make progress until a later cycle
+    bool lsReady = lsHeadReady();
+    uint32_t position = 0;
+    while( position < pe_order_.size() ) {
+        if( lsReady == 0 ) {
+            auto next = ready_now_.lower_bound( position );
+            if( next == ready_now_.end() ) {
+                break;
+            }
+            position = *next;
+        }
 
         //send n responses from L/S unit to destination
-        doLoadStoreOps(ls_entries_);
+        if( lsReady == 1 ) {
+            lsReady = doLoadStoreOps(ls_entries_);
+        }
 
-        //Let the PE decide whether or not it can do the compute
-        vertex_map_->at(currentNode).getValue()->doCompute();
+        tick_position_ = position;
+        if( ready_now_.erase( position ) == 1 ) {
+            ProcessingElement* pe = pe_order_[position];
 
-        //send one item from each output queue to destination
-        vertex_map_->at(currentNode).getValue()->doSend();
+            //Let the PE decide whether or not it can do the compute
+            pe->doCompute();
 
-        compute_complete = compute_complete | vertex_map_->at(currentNode).getValue()->getPendingOp();
-        output_->verbose(CALL_INFO, 1, 0, "PE(%" PRIu32 ") pending: %" PRIu32 " status: %" PRIu32 "\n\n",
-                        currentNode, vertex_map_->at(currentNode).getValue()->getPendingOp(), compute_complete );
+            //send one item from each output queue to destination
+            pe->doSend();
 
-        //add the destination vertices from this node to the node queue
-        for( auto it = adjacencyList->begin(); it != adjacencyList->end(); it++ ) {
-            uint32_t destinationVertx = (*it)->getDestination();
-            if( vertex_map_->at(destinationVertx).getVisited() == 0 ) {
-                vertex_map_->at(destinationVertx).setVisited(1);
-                nodeQueue.push(destinationVertx);
+            compute_complete = compute_complete | pe->getPendingOp();
+            output_->verbose(CALL_INFO, 1, 0, "PE(%" PRIu32 ") pending: %" PRIu32 " status: %" PRIu32 "\n\n",
+                            pe_vertex_[position], pe->getPendingOp(), compute_complete );
+
+            if( pe->hasQueuedData() ) {
+                ready_next_.insert( position );
             }
         }
+
+        ++position;
     }
+    in_tick_ = 0;
 
     // return false so we keep going
     if( compute_complete == 1 ){
@@ -278,6 +369,13 @@ bool LlyrComponent::tick(SST::Cycle_t currentCycle)
     } else if( ls_queue_->getNumEntries() > 0 ) {
         zeroEventCycles_->addData(1);
         output_->verbose(CALL_INFO, 40, 0, "Continuing simulation due to live memory...\n");
+
+        //nothing can happen until memory responds, so stop the clock
+        if( ready_next_.empty() && lsHeadReady() == 0 ) {
+            clock_enabled_ = 0;
+            last_active_cycle_ = currentCycle;
+            return true;
+        }
         return false;
     } else {
         output_->verbose(CALL_INFO, 40, 0, "Ending simulation due to flying cows...\n");
@@ -303,7 +401,7 @@ void LlyrComponent::LlyrMemHandlers::handle(StandardMem::Read* read) {
 void LlyrComponent::LlyrMemHandlers::handle(StandardMem::Write* write) {
     out->verbose(CALL_INFO, 8, 0, "Handle Write for Address p-0x%" PRIx64 " -- v-0x%" PRIx64 ".\n", write->pAddr, write->vAddr);
 
-    llyr_->clock_enabled_ = 1;
+    llyr_->turnClockOn();
 
     /* Send response (ack) if needed */
     if (!(write->posted)) {
@@ -346,6 +444,7 @@ void LlyrComponent::LlyrMemHandlers::handle(StandardMem::ReadResp* resp) {
 
     ls_queue_->setEntryData( resp->getID(), testArg );
     ls_queue_->setEntryReady( resp->getID(), 1 );
+    llyr_->turnClockOn();
 
     // Need to clean up the events coming back from the cache
     delete resp;
@@ -359,13 +458,14 @@ void LlyrComponent::LlyrMemHandlers::handle(StandardMem::WriteResp* resp) {
     out->verbose(CALL_INFO, 8, 0, "Response to a write for addr: %" PRIu64 " to PE %" PRIu32 "\n",
                  resp->pAddr, ls_queue_->lookupEntry( resp->getID() ).second );
     ls_queue_->setEntryReady( resp->getID(), 2 );
+    llyr_->turnClockOn();
 
     // Need to clean up the events coming back from the cache
     delete resp;
     out->verbose(CALL_INFO, 4, 0, "Complete cache response handling.\n");
 }
 
-void LlyrComponent::doLoadStoreOps( uint32_t numOps )
+bool LlyrComponent::doLoadStoreOps( uint32_t numOps )
 {
     // TraceFunction trace(CALL_INFO_LONG);
     output_->verbose(CALL_INFO, 10, 0, "Doing L/S ops\n");
@@ -381,6 +481,11 @@ void LlyrComponent::doLoadStoreOps( uint32_t numOps )
 
                 mappedGraph_.getVertex(srcPe)->getValue()->doReceive(data);
 
+                auto position = vertex_position_.find( srcPe );
+                if( position != vertex_position_.end() ) {
+                    wakePE( position->second );
+                }
+
                 ls_queue_->removeEntry( next );
             } else if( ls_queue_->getEntryReady(next) == 2 ){
                 output_->verbose(CALL_INFO, 10, 0, "--(2)Mem Req ID %" PRIu32 "\n", uint32_t(next));
@@ -388,6 +493,8 @@ void LlyrComponent::doLoadStoreOps( uint32_t numOps )
             }
         }
     }
+
+    return lsHeadReady();
 }
 
 void LlyrComponent::constructHardwareGraph(std::string fileName)
@@ -21,6 +21,7 @@
 #include <sst/core/component.h>
 #include <sst/core/interfaces/stdMem.h>
 
+#include <set>
 #include <string>
 #include <fstream>
 #include <cinttypes>
@@ -133,10 +134,30 @@ private:
     SST::TimeConverter*     time_converter_;
     Clock::HandlerBase*     clock_tick_handler_;
     bool                    handler_registered_;
+    // Clear while the clock is unregistered, either waiting to be started
+    // by MMIO or waiting on memory with nothing ready
     bool                    clock_enabled_;
 
     bool compute_complete;
 
+    // The mapped graph is walked in the same BFS order from the dummy node
+    // every cycle, so the order is computed once in setup(). Only PEs that
+    // have data queued are ticked; a PE with empty queues does nothing.
+    std::vector< ProcessingElement* > pe_order_;
+    std::vector< uint32_t > pe_vertex_;
+    std::map< uint32_t, uint32_t > vertex_position_;
+    std::set< uint32_t > ready_now_;
+    std::set< uint32_t > ready_next_;
+    int64_t tick_position_;
+    bool in_tick_;
+
+    Cycle_t last_active_cycle_;
+
+    void freezeGraph();
+    void wakePE( uint32_t position );
+    void turnClockOn();
+    bool lsHeadReady() const;
+
     SST::Link**  links_;
     SST::Link*   clockLink_;
     SST::Output* output_;
@@ -160,7 +181,7 @@ private:
 
     uint32_t ls_entries_;
     LSQueue* ls_queue_;
-    void doLoadStoreOps( uint32_t numOps );
+    bool doLoadStoreOps( uint32_t numOps );
 
 };
 
@@ -27,6 +27,7 @@
 #include <bitset>
 #include <string>
 #include <cstdint>
+#include <functional>
 #include <sstream>
 #include <algorithm>
 
@@ -217,11 +218,36 @@ public:
     {
         LlyrData newValue = LlyrData(inVal);
         input_queues_->at(id)->data_queue_->push(newValue);
+        if( wakeup_ ) {
+            wakeup_();
+        }
     }
 
     void pushInputQueue(uint32_t id, LlyrData &inVal )
     {
         input_queues_->at(id)->data_queue_->push(inVal);
+        if( wakeup_ ) {
+            wakeup_();
+        }
+    }
+
+    // called whenever another PE pushes data into one of our input queues
+    void setWakeup(std::function< void() > wakeup) { wakeup_ = wakeup; }
+
+    // a PE with nothing queued has no work to do when it is ticked
+    bool hasQueuedData() const
+    {
+        for( auto it = input_queues_->begin(); it != input_queues_->end(); ++it ) {
+            if( (*it)->data_queue_->size() > 0 ) {
+                return true;
+            }
+        }
+        for( auto it = output_queues_->begin(); it != output_queues_->end(); ++it ) {
+            if( (*it)->data_queue_->size() > 0 ) {
+                return true;
+            }
+        }
+        return false;
     }
 
     int32_t getInputQueueId(uint32_t id) const
@@ -429,6 +455,8 @@ protected:
     // bundle of configuration parameters
     LlyrConfig* llyr_config_;
 
+    std::function< void() > wakeup_;
+
     // Make sure that anything that needs to be routed gets routed
     virtual bool doRouting( uint32_t total_num_inputs )
     {
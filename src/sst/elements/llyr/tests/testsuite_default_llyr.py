@@ -3,6 +3,7 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import re
 
 class testcase_llyr_Component(SSTTestCase):
 
@@ -21,6 +22,33 @@ class testcase_llyr_Component(SSTTestCase):
     def test_llyr_singlestream(self):
         self.llyr_test_template("llyr_test")
 
+        # The gemm loads wait 100ns on memory with nothing else ready, so the
+        # device clock gates off and is reregistered by the responses. The
+        # reference output predates clock gating and carries the end time and
+        # memory statistics but no device statistics, so check those against
+        # the per cycle accounting the ungated clock kept: every 1GHz tick
+        # before the last counted one cycle with or without events.
+        outfile = "{0}/test_llyr_llyr_test.out".format(self.get_test_output_run_dir())
+        stats = {}
+        endtime = None
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = re.search(r"df_0\.(cycles_\w+) : Accumulator : Sum\.u64 = (\d+);", line)
+                if m:
+                    stats[m.group(1)] = int(m.group(2))
+                m = re.search(r"Simulation is complete, simulated time: (\d+) ns", line)
+                if m:
+                    endtime = int(m.group(1))
+
+        self.assertTrue(endtime is not None, "Did not find the simulated time in {0}".format(outfile))
+        self.assertTrue("cycles_events" in stats and "cycles_zero_events" in stats,
+                "Did not find the df_0 cycle statistics in {0}".format(outfile))
+        self.assertTrue(stats["cycles_zero_events"] > 0,
+                "Device never waited on memory, clock gating was not exercised")
+        self.assertEqual(stats["cycles_events"] + stats["cycles_zero_events"], endtime - 1,
+                "Gated cycles were not accounted: {0} cycles with events, {1} without, simulation ended at cycle {2}".format(
+                    stats["cycles_events"], stats["cycles_zero_events"], endtime))
+
 #####
 
     def llyr_test_template(self, testcase, testtimeout=240):
@@ -196,6 +196,10 @@ MpiApi::~MpiApi()
   //   delete req;
   // }
 
+  for (auto* req : req_pool_){
+    delete req;
+  }
+
   if (qos_analysis_) delete qos_analysis_;
 }
 
@@ -561,10 +565,36 @@ MpiApi::eraseRequestPtr(MPI_Request req)
         "could not find mpi request %d for rank %d",
         req, int(rank_));
   }
-  delete it->second;
+  freeRequest(it->second);
   req_map_.erase(it);
 }
 
+MpiRequest*
+MpiApi::newRequest(MpiRequest::op_type_t ty)
+{
+  if (req_pool_.empty()){
+    return MpiRequest::construct(ty);
+  }
+  MpiRequest* req = req_pool_.back();
+  req_pool_.pop_back();
+  req->reset(ty);
+  return req;
+}
+
+void
+MpiApi::freeRequest(MpiRequest* req)
+{
+  if (req->isCancelled()){
+    //a cancelled receive can still be sitting in the posted queue,
+    //which only drops it lazily - take it out before the request goes
+    queue_->dropRecv(req);
+    delete req;
+    return;
+  }
+  req->release();
+  req_pool_.push_back(req);
+}
+
 void
 MpiApi::checkKey(int key)
 {
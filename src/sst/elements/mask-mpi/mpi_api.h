@@ -627,6 +627,21 @@ class MpiApi : public SST::Iris::sumi::SimTransport
 
   void eraseRequestPtr(MPI_Request req);
 
+  /**
+   * @brief newRequest Get a request for a new operation, reusing
+   *        a previously freed one if possible
+   * @param ty
+   * @return
+   */
+  MpiRequest* newRequest(MpiRequest::op_type_t ty);
+
+  /**
+   * @brief freeRequest Return a finished request to the pool.
+   *        Cancelled requests are deleted instead.
+   * @param req
+   */
+  void freeRequest(MpiRequest* req);
+
   void checkKey(int key);
 
   void addKeyval(int key, keyval* keyval);
@@ -852,6 +867,7 @@ class MpiApi : public SST::Iris::sumi::SimTransport
   typedef std::unordered_map<MPI_Request, MpiRequest*> req_ptr_map;
   req_ptr_map req_map_;
   MPI_Request req_counter_;
+  std::vector<MpiRequest*> req_pool_;
 
   SST::Statistics::MultiStatistic<int, //sender
                                   int, //recver
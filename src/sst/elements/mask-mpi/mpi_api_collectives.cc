@@ -76,7 +76,7 @@ namespace SST::MASKMPI {
 MpiRequest*
 MpiApi::addImmediateCollective(CollectiveOpBase::ptr&& op)
 {
-  MpiRequest* reqPtr = MpiRequest::construct(MpiRequest::Collective);
+  MpiRequest* reqPtr = newRequest(MpiRequest::Collective);
   op->comm->addRequest(op->tag, reqPtr);
   if (op->complete){
     finishCollective(op.get());
@@ -233,7 +233,7 @@ MpiApi::waitCollectives(std::vector<CollectiveOpBase::ptr>&& ops)
     if (!req->isComplete()){
       queue_->progressLoop(req);
     }
-    delete req;
+    freeRequest(req);
   }
 }
 
@@ -248,7 +248,7 @@ MpiApi::waitCollective(CollectiveOpBase::ptr&& op)
   if (is_comm_world) {
     crossed_comm_world_barrier_ = true;
   }
-  delete req;
+  freeRequest(req);
 }
 
 Iris::sumi::CollectiveDoneMessage*
@@ -64,7 +64,7 @@ MpiApi::probe(int source, int tag, MPI_Comm comm, MPI_Status *status)
 
   MpiComm* commPtr = getComm(comm);
 
-  MpiRequest* req = MpiRequest::construct(MpiRequest::Probe);
+  MpiRequest* req = newRequest(MpiRequest::Probe);
   queue_->probe(req, commPtr, source, tag);
   queue_->progressLoop(req);
 
@@ -73,7 +73,7 @@ MpiApi::probe(int source, int tag, MPI_Comm comm, MPI_Status *status)
   }
 
 
-  delete req;
+  freeRequest(req);
 
   return MPI_SUCCESS;
 }
@@ -80,10 +80,10 @@ MpiApi::send(const void *buf, int count, MPI_Datatype datatype, int dest, int ta
   MpiComm* commPtr = getComm(comm);
 
   if (dest != MPI_PROC_NULL){
-    MpiRequest* req = MpiRequest::construct(MpiRequest::Send);
+    MpiRequest* req = newRequest(MpiRequest::Send);
     queue_->send(req, count, datatype, dest, tag, commPtr, const_cast<void*>(buf));
     queue_->progressLoop(req);
-    delete req;
+    freeRequest(req);
   }
 
   FinishMPICall(MPI_Send);
@@ -125,7 +125,7 @@ MpiApi::sendrecv(const void *sendbuf, int sendcount,
     MpiRequest* req = doIsend(sendbuf, sendcount, sendtype, dest, sendtag, comm);
     rc = doRecv(recvbuf, recvcount, recvtype, source, recvtag, comm, status);
     queue_->progressLoop(req);
-    delete req;
+    freeRequest(req);
   }
 
   FinishMPICall(MPI_Sendrecv);
@@ -239,7 +239,7 @@ MpiApi::sendInit(const void *buf, int count,
 {
   //_StartMPICall_(MPI_Send_init);
 
-  MpiRequest* req = MpiRequest::construct(MpiRequest::Send);
+  MpiRequest* req = newRequest(MpiRequest::Send);
   addRequestPtr(req, request);
 
 //  mpi_api_debug(sprockit::dbg::mpi | sprockit::dbg::mpi_request | sprockit::dbg::mpi_pt2pt,
@@ -274,7 +274,7 @@ MpiApi::doIsend(const void *buf, int count, MPI_Datatype datatype, int dest,
                int tag, MPI_Comm comm)
 {
   MpiComm* commPtr = getComm(comm);
-  MpiRequest* req = MpiRequest::construct(MpiRequest::Send);
+  MpiRequest* req = newRequest(MpiRequest::Send);
   if (dest == MPI_PROC_NULL){
     req->setComplete(true); //just mark complete
   } else {
@@ -342,14 +342,14 @@ int
 MpiApi::doRecv(void *buf, int count, MPI_Datatype datatype, int source,
               int tag, MPI_Comm comm, MPI_Status *status)
 {
-  MpiRequest* req = MpiRequest::construct(MpiRequest::Recv);
+  MpiRequest* req = newRequest(MpiRequest::Recv);
   MpiComm* commPtr = getComm(comm);
   queue_->recv(req, count, datatype, source, tag, commPtr, buf);
   queue_->progressLoop(req);
   if (status != MPI_STATUS_IGNORE){
     *status = req->status();
   }
-  delete req;
+  freeRequest(req);
   return MPI_SUCCESS;
 }
 
@@ -359,7 +359,7 @@ MpiApi::recvInit(void *buf, int count, MPI_Datatype datatype, int source,
 {
   //_StartMPICall_(MPI_Recv_init);
 
-  MpiRequest* req = MpiRequest::construct(MpiRequest::Recv);
+  MpiRequest* req = newRequest(MpiRequest::Recv);
   addRequestPtr(req, request);
 
 //  mpi_api_debug(sprockit::dbg::mpi | sprockit::dbg::mpi_pt2pt,
@@ -400,7 +400,7 @@ MpiApi::irecv(void *buf, int count, MPI_Datatype datatype, int source,
   using namespace SST::Hg;
   MpiComm* commPtr = getComm(comm);
 
-  MpiRequest* req = MpiRequest::construct(MpiRequest::Recv);
+  MpiRequest* req = newRequest(MpiRequest::Recv);
   addRequestPtr(req, request);
 
 //  mpi_api_debug(dbg::mpi | dbg::mpi_request | dbg::mpi_pt2pt,
@@ -120,20 +120,33 @@ MpiApi::testall(int count, MPI_Request array_of_requests[], int *flag, MPI_Statu
 #endif
 
   //_StartMPICall_(MPI_Testall);
+  //no request is touched unless all of them are done
   *flag = 1;
   bool ignore_status = array_of_statuses == MPI_STATUSES_IGNORE;
+  std::vector<MpiRequest*> reqPtrs(count);
   for (int i=0; i < count; ++i){
-    MPI_Status* stat = ignore_status ? MPI_STATUS_IGNORE : &array_of_statuses[i];
-    int tag, source;
-    if (!test(&array_of_requests[i], stat, tag, source)){
+    reqPtrs[i] = getRequest(array_of_requests[i]);
+    if (reqPtrs[i] && !reqPtrs[i]->isComplete()){
       *flag = 0;
       break;
     }
+  }
+
+  if (*flag){
+    for (int i=0; i < count; ++i){
+      MpiRequest* reqPtr = reqPtrs[i];
+      if (!reqPtr) continue;
 #ifdef SST_HG_OTF2_ENABLED
-    statuses[i].tag = tag;
-    statuses[i].source = source;
+      statuses[i].tag = reqPtr->status().MPI_TAG;
+      statuses[i].source = reqPtr->status().MPI_SOURCE;
 #endif
+      finalizeWaitRequest(reqPtr, &array_of_requests[i],
+         ignore_status ? MPI_STATUS_IGNORE : &array_of_statuses[i]);
+    }
+  } else if (test_delay_us_){
+    queue_->forwardProgress(test_delay_us_*1e-6);
   }
+
   if (*flag){
     //mpi_api_debug(sprockit::dbg::mpi | sprockit::dbg::mpi_request,
     //  "MPI_Testall(%d,...)", count);
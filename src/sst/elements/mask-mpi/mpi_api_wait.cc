@@ -116,7 +116,7 @@ MpiApi::finalizeWaitRequest(MpiRequest* reqPtr, MPI_Request* req, MPI_Status* st
   if (!reqPtr->isPersistent()){
     req_map_.erase(*req);
     *req = MPI_REQUEST_NULL;
-    delete reqPtr;
+    freeRequest(reqPtr);
   }
 }
 
@@ -134,17 +134,25 @@ MpiApi::waitall(int count, MPI_Request array_of_requests[],
 //  mpi_api_debug(sprockit::dbg::mpi | sprockit::dbg::mpi_request,
 //    "MPI_Waitall(%d,...)", count);
   bool ignore_status = array_of_statuses == MPI_STATUSES_IGNORE;
-  std::vector<MPI_Request> req_vec;
+  //look up every request once and progress until all are done
+  //rather than entering the progress loop once per request
+  std::vector<MpiRequest*> reqPtrs(count);
+  for (int i=0; i < count; ++i){
+    reqPtrs[i] = getRequest(array_of_requests[i]);
+  }
+  queue_->progressLoop(reqPtrs);
+
   for (int i=0; i < count; ++i){
-    MPI_Status* status = ignore_status ? MPI_STATUS_IGNORE : &array_of_statuses[i];
-    int tag, source;
-    doWait(&array_of_requests[i], status, tag, source);
+    MpiRequest* reqPtr = reqPtrs[i];
+    if (!reqPtr) continue;
 #ifdef SST_HG_OTF2_ENABLED
     if (OTF2Writer_) {
-      statuses[i].tag = tag;
-      statuses[i].source = source;
+      statuses[i].tag = reqPtr->status().MPI_TAG;
+      statuses[i].source = reqPtr->status().MPI_SOURCE;
     }
 #endif
+    finalizeWaitRequest(reqPtr, &array_of_requests[i],
+       ignore_status ? MPI_STATUS_IGNORE : &array_of_statuses[i]);
   }
   FinishMPICall(MPI_Waitall);
 
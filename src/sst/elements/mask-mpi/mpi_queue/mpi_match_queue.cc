@@ -0,0 +1,247 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <mpi_queue/mpi_match_queue.h>
+#include <mpi_queue/mpi_queue_recv_request.h>
+
+namespace SST::MASKMPI {
+
+static inline uint64_t
+matchKey(int src, int tag)
+{
+  return (uint64_t(uint32_t(src)) << 32) | uint32_t(tag);
+}
+
+void
+MpiPostedRecvQueue::push(MpiQueueRecvRequest* req)
+{
+  comm_bins& bins = comms_[req->comm_];
+  entry e{next_seq_++, req};
+  bool any_src = req->source_ == MPI_ANY_SOURCE;
+  bool any_tag = req->tag_ == MPI_ANY_TAG;
+  if (any_src && any_tag){
+    bins.any.push_back(e);
+  } else if (any_src){
+    bins.any_src[req->tag_].push_back(e);
+  } else if (any_tag){
+    bins.any_tag[req->source_].push_back(e);
+  } else {
+    bins.exact[matchKey(req->source_, req->tag_)].push_back(e);
+  }
+  ++size_;
+}
+
+MpiPostedRecvQueue::bin_t*
+MpiPostedRecvQueue::liveBin(bin_t* bin)
+{
+  while (!bin->empty() && bin->front().req->isCancelled()){
+    pool_.push_back(bin->front().req);
+    bin->pop_front();
+    --size_;
+  }
+  return bin->empty() ? nullptr : bin;
+}
+
+MpiQueueRecvRequest*
+MpiPostedRecvQueue::pop(MpiMessage* msg)
+{
+  auto comm_it = comms_.find(msg->comm());
+  if (comm_it == comms_.end()){
+    return nullptr;
+  }
+  comm_bins& bins = comm_it->second;
+
+  auto exact_it = bins.exact.find(matchKey(msg->srcRank(), msg->tag()));
+  auto any_tag_it = bins.any_tag.find(msg->srcRank());
+  auto any_src_it = bins.any_src.find(msg->tag());
+
+  bin_t* candidates[] = {
+    exact_it == bins.exact.end() ? nullptr : liveBin(&exact_it->second),
+    any_tag_it == bins.any_tag.end() ? nullptr : liveBin(&any_tag_it->second),
+    any_src_it == bins.any_src.end() ? nullptr : liveBin(&any_src_it->second),
+    liveBin(&bins.any)
+  };
+
+  bin_t* oldest = nullptr;
+  for (bin_t* bin : candidates){
+    if (bin && (!oldest || bin->front().seq < oldest->front().seq)){
+      oldest = bin;
+    }
+  }
+
+  MpiQueueRecvRequest* req = nullptr;
+  if (oldest){
+    req = oldest->front().req;
+    oldest->pop_front();
+    --size_;
+  }
+
+  //do not let bins for signatures that are no longer in use pile up
+  if (exact_it != bins.exact.end() && exact_it->second.empty()){
+    bins.exact.erase(exact_it);
+  }
+  if (any_tag_it != bins.any_tag.end() && any_tag_it->second.empty()){
+    bins.any_tag.erase(any_tag_it);
+  }
+  if (any_src_it != bins.any_src.end() && any_src_it->second.empty()){
+    bins.any_src.erase(any_src_it);
+  }
+  return req;
+}
+
+MpiQueueRecvRequest*
+MpiPostedRecvQueue::remove(MpiRequest* key)
+{
+  auto take = [&](bin_t& bin) -> MpiQueueRecvRequest* {
+    for (auto it = bin.begin(); it != bin.end(); ++it){
+      if (it->req->key_ == key){
+        MpiQueueRecvRequest* req = it->req;
+        bin.erase(it);
+        --size_;
+        return req;
+      }
+    }
+    return nullptr;
+  };
+
+  for (auto& pair : comms_){
+    comm_bins& bins = pair.second;
+    MpiQueueRecvRequest* req = take(bins.any);
+    for (auto it = bins.exact.begin(); !req && it != bins.exact.end(); ++it){
+      req = take(it->second);
+    }
+    for (auto it = bins.any_tag.begin(); !req && it != bins.any_tag.end(); ++it){
+      req = take(it->second);
+    }
+    for (auto it = bins.any_src.begin(); !req && it != bins.any_src.end(); ++it){
+      req = take(it->second);
+    }
+    if (req){
+      return req;
+    }
+  }
+  return nullptr;
+}
+
+void
+MpiUnexpectedQueue::push(MpiMessage* msg)
+{
+  comms_[msg->comm()][msg->srcRank()][msg->tag()].push_back(entry{next_seq_++, msg});
+  ++size_;
+}
+
+MpiUnexpectedQueue::match
+MpiUnexpectedQueue::locate(src_bins& sources, int src, int tag)
+{
+  //bins are erased as soon as they empty, so every bin has a front
+  match oldest{nullptr, 0, 0};
+  auto consider = [&](bin_t& bin, int s, int t){
+    if (!oldest.bin || bin.front().seq < oldest.bin->front().seq){
+      oldest = match{&bin, s, t};
+    }
+  };
+  auto search_tags = [&](tag_bins& tags, int s){
+    if (tag == MPI_ANY_TAG){
+      for (auto& pair : tags){
+        consider(pair.second, s, pair.first);
+      }
+    } else {
+      auto it = tags.find(tag);
+      if (it != tags.end()){
+        consider(it->second, s, tag);
+      }
+    }
+  };
+
+  if (src == MPI_ANY_SOURCE){
+    for (auto& pair : sources){
+      search_tags(pair.second, pair.first);
+    }
+  } else {
+    auto it = sources.find(src);
+    if (it != sources.end()){
+      search_tags(it->second, src);
+    }
+  }
+  return oldest;
+}
+
+MpiMessage*
+MpiUnexpectedQueue::find(MPI_Comm comm, int src, int tag)
+{
+  auto comm_it = comms_.find(comm);
+  if (comm_it == comms_.end()){
+    return nullptr;
+  }
+  match m = locate(comm_it->second, src, tag);
+  return m.bin ? m.bin->front().msg : nullptr;
+}
+
+MpiMessage*
+MpiUnexpectedQueue::pop(MPI_Comm comm, int src, int tag)
+{
+  auto comm_it = comms_.find(comm);
+  if (comm_it == comms_.end()){
+    return nullptr;
+  }
+  src_bins& sources = comm_it->second;
+  match m = locate(sources, src, tag);
+  if (!m.bin){
+    return nullptr;
+  }
+
+  MpiMessage* msg = m.bin->front().msg;
+  m.bin->pop_front();
+  --size_;
+  if (m.bin->empty()){
+    auto src_it = sources.find(m.src);
+    src_it->second.erase(m.tag);
+    if (src_it->second.empty()){
+      sources.erase(src_it);
+    }
+  }
+  return msg;
+}
+
+}
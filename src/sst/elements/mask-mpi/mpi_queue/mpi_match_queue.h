@@ -0,0 +1,183 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <mpi_message.h>
+#include <mpi_queue/mpi_queue_recv_request_fwd.h>
+#include <mpi_request_fwd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#pragma once
+
+namespace SST::MASKMPI {
+
+/**
+ * Receives that have been posted but not yet matched to a message.
+ * Receives are binned by communicator and by which of source and tag
+ * are wildcards, so an incoming message only has to look at the head of
+ * four bins. Every receive is stamped with the order it was posted in
+ * and the oldest matching receive wins, which preserves the MPI
+ * non-overtaking rule across bins.
+ */
+class MpiPostedRecvQueue
+{
+ public:
+  /**
+   * @param pool Where cancelled receives dropped by pop() are returned
+   */
+  explicit MpiPostedRecvQueue(std::vector<MpiQueueRecvRequest*>& pool) :
+    next_seq_(0), size_(0), pool_(pool) {}
+
+  void push(MpiQueueRecvRequest* req);
+
+  /**
+   * @brief pop Remove the oldest posted receive that matches a message.
+   *        Cancelled receives found along the way are dropped.
+   * @param msg
+   * @return The matching receive or null
+   */
+  MpiQueueRecvRequest* pop(MpiMessage* msg);
+
+  /**
+   * @brief remove Remove the posted receive for a request, e.g. a
+   *        cancelled one that is about to be freed. Visits every bin.
+   * @param key
+   * @return The receive or null if the request has none posted
+   */
+  MpiQueueRecvRequest* remove(MpiRequest* key);
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+ private:
+  struct entry {
+    uint64_t seq;
+    MpiQueueRecvRequest* req;
+  };
+
+  typedef std::deque<entry> bin_t;
+
+  struct comm_bins {
+    std::unordered_map<uint64_t, bin_t> exact;
+    std::unordered_map<int, bin_t> any_tag; //indexed by source
+    std::unordered_map<int, bin_t> any_src; //indexed by tag
+    bin_t any;
+  };
+
+  bin_t* liveBin(bin_t* bin);
+
+  std::unordered_map<MPI_Comm, comm_bins> comms_;
+  uint64_t next_seq_;
+  size_t size_;
+  std::vector<MpiQueueRecvRequest*>& pool_;
+};
+
+/**
+ * Messages that arrived before a matching receive was posted.
+ * Messages are binned by communicator, source and tag so a receive
+ * or probe without wildcards is a single lookup. A wildcard only has
+ * to visit the distinct sources and tags that currently have messages
+ * waiting, not every message.
+ */
+class MpiUnexpectedQueue
+{
+ public:
+  MpiUnexpectedQueue() : next_seq_(0), size_(0) {}
+
+  void push(MpiMessage* msg);
+
+  /**
+   * @brief find Look up the oldest message matching a receive signature
+   *        without removing it, e.g. for a probe
+   * @return The matching message or null
+   */
+  MpiMessage* find(MPI_Comm comm, int src, int tag);
+
+  /**
+   * @brief pop Remove the oldest message matching a receive signature
+   * @return The matching message or null
+   */
+  MpiMessage* pop(MPI_Comm comm, int src, int tag);
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+ private:
+  struct entry {
+    uint64_t seq;
+    MpiMessage* msg;
+  };
+
+  typedef std::deque<entry> bin_t;
+  typedef std::unordered_map<int, bin_t> tag_bins;
+  typedef std::unordered_map<int, tag_bins> src_bins;
+
+  struct match {
+    bin_t* bin;
+    int src;
+    int tag;
+  };
+
+  match locate(src_bins& sources, int src, int tag);
+
+  std::unordered_map<MPI_Comm, src_bins> comms_;
+  uint64_t next_seq_;
+  size_t size_;
+};
+
+}
@@ -86,6 +86,7 @@ MpiQueue::sortbyseqnum::operator()(MpiMessage* a, MpiMessage*b) const
 }
 
 MpiQueue::MpiQueue(SST::Params& params, int task_id, MpiApi* api, Iris::sumi::CollectiveEngine* engine) :
+  need_send_match_(recv_req_pool_),
   queue_(api->parent()->os()),
   taskid_(task_id),
   api_(api)
@@ -162,6 +163,9 @@ MpiQueue::~MpiQueue() throw ()
   for (auto* prot : protocols_){
     if (prot) delete prot;
   }
+  for (auto* req : recv_req_pool_){
+    delete req;
+  }
 }
 
 void
@@ -201,18 +205,17 @@ MpiQueue::send(MpiRequest *key, int count, MPI_Datatype type,
 MpiMessage*
 MpiQueue::findMatchingRecv(MpiQueueRecvRequest* req)
 {
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req->matches(mess)) {
-//      mpi_queue_debug("matched recv tag=%s,src=%s on comm=%s to send %s",
-//        api_->tagStr(req->tag_).c_str(),
-//        api_->srcStr(req->source_).c_str(),
-//        api_->commStr(req->comm_).c_str(),
-//        mess->toString().c_str());
-
-      need_recv_match_.erase(it);
-      return mess;
-    }
+  MpiMessage* mess = need_recv_match_.pop(req->comm_, req->source_, req->tag_);
+  if (mess) {
+//    mpi_queue_debug("matched recv tag=%s,src=%s on comm=%s to send %s",
+//      api_->tagStr(req->tag_).c_str(),
+//      api_->srcStr(req->source_).c_str(),
+//      api_->commStr(req->comm_).c_str(),
+//      mess->toString().c_str());
+
+    //the signature already matches, but this checks the buffer size
+    req->matches(mess);
+    return mess;
   }
 //  mpi_queue_debug("could not match recv tag=%s, src=%s to any of %d sends on comm=%s",
 //    api_->tagStr(req->tag_).c_str(),
@@ -220,7 +223,7 @@ MpiQueue::findMatchingRecv(MpiQueueRecvRequest* req)
 //    need_recv_match_.size(),
 //    api_->commStr(req->comm_).c_str());
 
-  need_send_match_.push_back(req);
+  need_send_match_.push(req);
   return nullptr;
 }
 
@@ -238,8 +241,15 @@ MpiQueue::recv(MpiRequest* key, int count,
 //        count, api_->typeStr(type).c_str(), api_->srcStr(source).c_str(),
 //        api_->tagStr(tag).c_str(), api_->commStr(comm).c_str(), buffer);
 
-  MpiQueueRecvRequest* req = new MpiQueueRecvRequest(api_->now(), key, this,
-                            count, type, source, tag, comm->id(), buffer);
+  MpiQueueRecvRequest* req;
+  if (recv_req_pool_.empty()){
+    req = new MpiQueueRecvRequest(api_->now(), key, this,
+                                  count, type, source, tag, comm->id(), buffer);
+  } else {
+    req = recv_req_pool_.back();
+    recv_req_pool_.pop_back();
+    req->reset(api_->now(), key, this, count, type, source, tag, comm->id(), buffer);
+  }
   MpiMessage* mess = findMatchingRecv(req);
   if (mess) {
     auto* protocol = protocols_[mess->protocol()];
@@ -255,7 +265,7 @@ MpiQueue::finalizeRecv(MpiMessage* msg, MpiQueueRecvRequest* req)
     req->type_->unpack_recv(req->recv_buffer_, req->final_buffer_, msg->count());
     delete[] req->recv_buffer_;
   }
-  delete req;
+  recv_req_pool_.push_back(req);
 }
 
 //
@@ -269,18 +279,15 @@ MpiQueue::probe(MpiRequest* key, MpiComm* comm,
 //    api_->srcStr(source).c_str(), api_->tagStr(tag).c_str(),
 //    api_->commStr(comm).c_str());
 
-  mpi_queue_probe_request* req = new mpi_queue_probe_request(key, comm->id(), source, tag);
   // Figure out whether we already have a matching message.
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req->matches(mess)){
-      // We're good to go.
-      req->complete(mess);
-      return;
-    }
+  MpiMessage* mess = need_recv_match_.find(comm->id(), source, tag);
+  if (mess){
+    // We're good to go.
+    key->complete(mess);
+    return;
   }
   // If we get here, we still need to wait for the message.
-  probelist_.push_back(req);
+  probelist_.push_back(new mpi_queue_probe_request(key, comm->id(), source, tag));
 }
 
 //
@@ -296,33 +303,34 @@ MpiQueue::iprobe(MpiComm* comm,
 //    api_->srcStr(source).c_str(), api_->tagStr(tag).c_str(),
 //    api_->commStr(comm).c_str());
 
-  mpi_queue_probe_request req(NULL, comm->id(), source, tag);
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req.matches(mess)) {
-      // This is it
-      if (stat != MPI_STATUS_IGNORE) mess->buildStatus(stat);
-      return true;
-    }
+  MpiMessage* mess = need_recv_match_.find(comm->id(), source, tag);
+  if (mess) {
+    // This is it
+    if (stat != MPI_STATUS_IGNORE) mess->buildStatus(stat);
+    return true;
   }
   return false;
 }
 
+void
+MpiQueue::dropRecv(MpiRequest* key)
+{
+  MpiQueueRecvRequest* req = need_send_match_.remove(key);
+  if (req){
+    recv_req_pool_.push_back(req);
+  }
+}
+
 MpiQueueRecvRequest*
 MpiQueue::findMatchingRecv(MpiMessage* message)
 {
-  auto end = need_send_match_.end();
-  for (auto it = need_send_match_.begin(); it != end;) {
-    auto* req = *it;
-    auto tmp = it++;
-    if (req->isCancelled()) {
-      need_send_match_.erase(tmp);
-    } else if (req->matches(message)) {
-      need_send_match_.erase(tmp);
-      return req;
-    }
+  MpiQueueRecvRequest* req = need_send_match_.pop(message);
+  if (req) {
+    //the signature already matches, but this checks the buffer size
+    req->matches(message);
+    return req;
   }
-  need_recv_match_.push_back(message);
+  need_recv_match_.push(message);
   return nullptr;
 }
 
@@ -369,13 +377,15 @@ MpiQueue::incomingPt2ptMessage(Iris::sumi::Message* m)
     ++next_inbound;
 
     // Handle any messages that have been freed by the arrival of this one
-    if (!held_[tid].empty()) {
-      hold_list_t::iterator it = held_[tid].begin(), end = held_[tid].end();
+    auto held_it = held_.find(tid);
+    if (held_it != held_.end()) {
+      hold_list_t& held = held_it->second;
+      hold_list_t::iterator it = held.begin(), end = held.end();
       while (it != end) {
         MpiMessage* mess = *it;
 //        mpi_queue_debug("handling out-of-order message for task %d, seqnum %d",
 //            int(tid), mess->seqnum());
-        if (mess->seqnum() <= next_inbound_[tid]) {
+        if (mess->seqnum() <= next_inbound) {
           //it = held_[tid].erase(it);
           it++;
           handlePt2ptMessage(mess);
@@ -385,7 +395,10 @@ MpiQueue::incomingPt2ptMessage(Iris::sumi::Message* m)
         }
       }
       // Now erase all the completed messages from the held queue.
-      held_[tid].erase(held_[tid].begin(), it);
+      held.erase(held.begin(), it);
+      if (held.empty()) {
+        held_.erase(tid);
+      }
     }
   } else if (message->seqnum() < next_inbound){
     sst_hg_abort_printf("message sequence went backwards on %s from %d",
@@ -467,6 +480,35 @@ MpiQueue::progressLoop(MpiRequest* req)
   return api_->now();
 }
 
+SST::Hg::Timestamp
+MpiQueue::progressLoop(const std::vector<MpiRequest*>& reqs)
+{
+  SST::Hg::Timestamp wait_start = api_->now();
+  for (auto* req : reqs) {
+    if (req && !req->isComplete()) {
+      req->setWaitStart(wait_start);
+    }
+  }
+
+  //requests before next are all done, so no request is checked more
+  //than once after it completes
+  size_t next = 0;
+  while (true) {
+    while (next < reqs.size() && (!reqs[next] || reqs[next]->isComplete())) {
+      ++next;
+    }
+    if (next == reqs.size()) {
+      break;
+    }
+    Iris::sumi::Message* msg = queue_.find_any();
+    if (!msg){
+      sst_hg_abort_printf("polling returned null message");
+    }
+    incomingMessage(msg);
+  }
+  return api_->now();
+}
+
 bool
 MpiQueue::atLeastOneComplete(const std::vector<MpiRequest*>& req)
 {
@@ -60,6 +60,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <mpi_queue/mpi_queue_recv_request_fwd.h>
 #include <mpi_queue/mpi_queue_probe_request.h>
+#include <mpi_queue/mpi_match_queue.h>
 
 #include <sst/core/params.h>
 
@@ -106,6 +107,13 @@ class MpiQueue
 
   bool iprobe(MpiComm* comm, int source, int tag, MPI_Status* stat);
 
+  /**
+   * @brief dropRecv Take the receive for a cancelled request out of the
+   *        posted queue so the request can be deleted
+   * @param key
+   */
+  void dropRecv(MpiRequest* key);
+
   MpiApi* api() const {
     return api_;
   }
@@ -119,6 +127,15 @@ class MpiQueue
 
   SST::Hg::Timestamp progressLoop(MpiRequest* req);
 
+  /**
+   * @brief progressLoop Progress until every non-null request is complete.
+   *        Unlike calling progressLoop on each request in turn, all
+   *        requests are in an active wait for the whole loop.
+   * @param reqs
+   * @return The time the last request completed
+   */
+  SST::Hg::Timestamp progressLoop(const std::vector<MpiRequest*>& reqs);
+
   void nonblockingProgress();
 
   void startProgressLoop(const std::vector<MpiRequest*>& req);
@@ -190,8 +207,12 @@ class MpiQueue
   std::unordered_map<TaskId, hold_list_t> held_;
 
   /// Inbound messages waiting for a matching receive request.
-  std::list<MpiMessage*> need_recv_match_;
-  std::list<MpiQueueRecvRequest*> need_send_match_;
+  MpiUnexpectedQueue need_recv_match_;
+  /// Posted receive requests waiting for a matching message.
+  MpiPostedRecvQueue need_send_match_;
+
+  /// Finished receive requests kept around for reuse
+  std::vector<MpiQueueRecvRequest*> recv_req_pool_;
 
   std::vector<MpiProtocol*> protocols_;
 
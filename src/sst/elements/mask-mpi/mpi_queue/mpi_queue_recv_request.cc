@@ -60,19 +60,30 @@ MpiQueueRecvRequest::MpiQueueRecvRequest(
   MpiQueue* queue,
   int count,
   MPI_Datatype type,
-  int source, int tag, MPI_Comm comm, void* buffer) :
-  queue_(queue), 
-  source_(source), 
-  tag_(tag), 
-  comm_(comm),
-  seqnum_(0), 
-  final_buffer_(buffer), 
-  recv_buffer_(nullptr),
-  count_(count), 
-  type_(queue->api()->typeFromId(type)),
-  key_(key), 
-  start_(start) 
+  int source, int tag, MPI_Comm comm, void* buffer)
 {
+  reset(start, key, queue, count, type, source, tag, comm, buffer);
+}
+
+void
+MpiQueueRecvRequest::reset(
+  SST::Hg::Timestamp start,
+  MpiRequest* key,
+  MpiQueue* queue,
+  int count,
+  MPI_Datatype type,
+  int source, int tag, MPI_Comm comm, void* buffer)
+{
+  queue_ = queue;
+  source_ = source;
+  tag_ = tag;
+  comm_ = comm;
+  seqnum_ = 0;
+  final_buffer_ = buffer;
+  count_ = count;
+  type_ = queue->api()->typeFromId(type);
+  key_ = key;
+  start_ = start;
   if (isNonNullBuffer(buffer) && !type_->contiguous()){
     recv_buffer_ = new char[count*type_->packed_size()];
   } else {
@@ -59,6 +59,7 @@ class MpiQueueRecvRequest  {
   friend class RendezvousGet;
   friend class Eager1;
   friend class Eager0;
+  friend class MpiPostedRecvQueue;
 
  public:
   MpiQueueRecvRequest(SST::Hg::Timestamp start, MpiRequest* key, MpiQueue* queue,
@@ -67,6 +68,14 @@ class MpiQueueRecvRequest  {
 
   ~MpiQueueRecvRequest();
 
+  /**
+   * @brief reset Reinitialize a finished request so the queue
+   *        can reuse it for a new receive
+   */
+  void reset(SST::Hg::Timestamp start, MpiRequest* key, MpiQueue* queue,
+             int count, MPI_Datatype type, int source, int tag,
+             MPI_Comm comm, void* buffer);
+
   bool matches(MpiMessage* msg);
 
   void setSeqnum(int seqnum) {
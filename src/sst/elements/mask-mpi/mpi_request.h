@@ -172,6 +172,28 @@ class MpiRequest :
     return new MpiRequest(ty);
   }
 
+  /**
+   * @brief reset Reinitialize a released request for a new operation
+   * @param ty
+   */
+  void reset(op_type_t ty){
+    release();
+    complete_ = false;
+    cancelled_ = false;
+    optype_ = ty;
+    wait_start_ = SST::Hg::Timestamp();
+  }
+
+  /**
+   * @brief release Free the persistent and collective data so a
+   *        finished request can sit in a pool without holding on to them
+   */
+  void release(){
+    if (persistent_op_) delete persistent_op_;
+    persistent_op_ = nullptr;
+    collective_op_.reset();
+  }
+
   ~MpiRequest();
 
   void complete(MpiMessage* msg);
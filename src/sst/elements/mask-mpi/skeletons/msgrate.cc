@@ -0,0 +1,176 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+/*
+ * Message rate microbenchmark for the MPI progress engine.
+ *
+ * Even ranks send windows of small messages to the next odd rank.
+ * The host (wall clock) time spent per message is what is being
+ * measured, so the network should be made as cheap as possible.
+ *
+ *   -n <msgs>         messages per window (default 64)
+ *   -iterations <n>   windows to send (default 100)
+ *   -count <n>        doubles per message (default 1)
+ *   -match <mode>     exact, any_source or any_tag receives (default exact)
+ *   -reverse          post receives in the reverse order of the sends
+ *   -unexpected       send before the receives are posted
+ */
+
+#define ssthg_app_name msgrate
+
+#include <mask_mpi.h>
+#include <mercury/common/skeleton.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+  MPI_Init(&argc, &argv);
+
+  int me, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &me);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  int nmsgs = 64;
+  int iterations = 100;
+  int count = 1;
+  bool any_source = false;
+  bool any_tag = false;
+  bool reverse = false;
+  bool unexpected = false;
+
+  for (int i=1; i < argc; ++i){
+    bool has_value = i + 1 < argc;
+    if (strcmp(argv[i], "-n") == 0 && has_value){
+      nmsgs = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-iterations") == 0 && has_value){
+      iterations = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-count") == 0 && has_value){
+      count = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "-match") == 0 && has_value && strcmp(argv[i+1], "exact") == 0){
+      ++i;
+    } else if (strcmp(argv[i], "-match") == 0 && has_value && strcmp(argv[i+1], "any_source") == 0){
+      any_source = true;
+      ++i;
+    } else if (strcmp(argv[i], "-match") == 0 && has_value && strcmp(argv[i+1], "any_tag") == 0){
+      any_tag = true;
+      ++i;
+    } else if (strcmp(argv[i], "-reverse") == 0){
+      reverse = true;
+    } else if (strcmp(argv[i], "-unexpected") == 0){
+      unexpected = true;
+    } else {
+      if (me == 0){
+        fprintf(stderr, "Unknown or incomplete option: %s\n", argv[i]);
+      }
+      exit(-1);
+    }
+  }
+
+  //an odd rank out just takes part in the barriers
+  bool sender = me % 2 == 0 && me + 1 < size;
+  bool receiver = me % 2 == 1;
+  int partner = sender ? me + 1 : me - 1;
+  int src = any_source ? MPI_ANY_SOURCE : partner;
+
+  std::vector<double> buffer(nmsgs * count);
+  std::vector<MPI_Request> reqs(nmsgs);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  double sim_start = MPI_Wtime();
+  auto host_start = std::chrono::steady_clock::now();
+
+  auto post = [&](){
+    if (sender){
+      for (int m=0; m < nmsgs; ++m){
+        MPI_Isend(&buffer[m*count], count, MPI_DOUBLE, partner, m,
+                  MPI_COMM_WORLD, &reqs[m]);
+      }
+    } else if (receiver){
+      for (int i=0; i < nmsgs; ++i){
+        int m = reverse ? nmsgs - 1 - i : i;
+        int tag = any_tag ? MPI_ANY_TAG : m;
+        MPI_Irecv(&buffer[m*count], count, MPI_DOUBLE, src, tag,
+                  MPI_COMM_WORLD, &reqs[m]);
+      }
+    }
+  };
+
+  //the barrier decides whether the receives are posted before or after the sends
+  bool goes_first = unexpected ? sender : receiver;
+  for (int iter=0; iter < iterations; ++iter){
+    if (goes_first) post();
+    MPI_Barrier(MPI_COMM_WORLD);
+    if (!goes_first) post();
+
+    if (sender || receiver){
+      MPI_Waitall(nmsgs, reqs.data(), MPI_STATUSES_IGNORE);
+    }
+  }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  double sim_time = MPI_Wtime() - sim_start;
+  std::chrono::duration<double> host_time = std::chrono::steady_clock::now() - host_start;
+
+  if (me == 0){
+    //every rank runs in the same simulator process, so the host time
+    //covers the messages of all pairs
+    double total_msgs = double(iterations) * nmsgs * (size / 2);
+    printf("msgrate: %d pairs, %d msgs x %d iterations, match=%s%s%s\n",
+           size / 2, nmsgs, iterations,
+           any_source ? "any_source" : (any_tag ? "any_tag" : "exact"),
+           reverse ? " reverse" : "", unexpected ? " unexpected" : "");
+    printf("msgrate: simulated time %12.8fs, host time %12.8fs\n",
+           sim_time, host_time.count());
+    printf("msgrate: host time per message %10.2fns\n",
+           host_time.count() * 1e9 / total_msgs);
+  }
+
+  MPI_Finalize();
+  return 0;
+}
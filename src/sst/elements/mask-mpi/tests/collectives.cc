@@ -0,0 +1,140 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#define ssthg_app_name collectives
+
+#include <stdio.h>
+
+#include <mask_mpi.h>
+#include <mercury/common/skeleton.h>
+
+// Checks the results of allreduce, bcast and allgather for a small and a
+// large message. The output only depends on whether the results are right,
+// so it is the same whichever algorithm the collective engine picks.
+
+static void report(const char* what, int count, int errors)
+{
+    int rank, total = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Reduce(&errors, &total, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+    if (rank == 0) {
+        printf("collectives: %s %d elements: %s\n", what, count, total ? "FAILED" : "ok");
+    }
+}
+
+static void check_allreduce(int count, int rank, int size)
+{
+    int* values = new int[count];
+    int* result = new int[count];
+    for (int i = 0; i < count; ++i) {
+        values[i] = rank * count + i;
+    }
+    MPI_Allreduce(values, result, count, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+
+    int errors = 0;
+    for (int i = 0; i < count; ++i) {
+        int expected = count * (size * (size - 1) / 2) + size * i;
+        if (result[i] != expected) ++errors;
+    }
+    report("allreduce", count, errors);
+    delete[] values;
+    delete[] result;
+}
+
+static void check_bcast(int count, int root, int rank)
+{
+    int* buf = new int[count];
+    for (int i = 0; i < count; ++i) {
+        buf[i] = rank == root ? 3 * i + root : -1;
+    }
+    MPI_Bcast(buf, count, MPI_INT, root, MPI_COMM_WORLD);
+
+    int errors = 0;
+    for (int i = 0; i < count; ++i) {
+        if (buf[i] != 3 * i + root) ++errors;
+    }
+    char what[32];
+    snprintf(what, sizeof(what), "bcast root %d", root);
+    report(what, count, errors);
+    delete[] buf;
+}
+
+static void check_allgather(int count, int rank, int size)
+{
+    int* values = new int[count];
+    int* result = new int[count * size];
+    for (int i = 0; i < count; ++i) {
+        values[i] = rank * count + i;
+    }
+    MPI_Allgather(values, count, MPI_INT, result, count, MPI_INT, MPI_COMM_WORLD);
+
+    int errors = 0;
+    for (int i = 0; i < count * size; ++i) {
+        if (result[i] != i) ++errors;
+    }
+    report("allgather", count, errors);
+    delete[] values;
+    delete[] result;
+}
+
+int main(int argc, char* argv[])
+{
+    MPI_Init(&argc, &argv);
+    int size, rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // 16 bytes stays below every cutoff, 64KiB is above the test configs'
+    const int counts[] = { 4, 16384 };
+    for (int count : counts) {
+        check_allreduce(count, rank, size);
+        check_bcast(count, 0, rank);
+        check_bcast(count, size - 1, rank);
+        check_allgather(count, rank, size);
+    }
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#define ssthg_app_name matching
+
+#include <stdio.h>
+
+#include <vector>
+
+#include <mask_mpi.h>
+#include <mercury/common/skeleton.h>
+
+// Checks which posted receive a message matches, with and without
+// wildcards, and that messages between one pair of ranks are received in
+// the order they were sent (MPI non-overtaking). Rank 0 receives, the
+// other ranks send. Every message carries its sender and sequence number.
+
+static const int tag = 5;
+static const int nmsgs = 16;
+
+// Over the eager limit, so these go rendezvous
+static const int large = 4096;
+
+static void report(const char* what, int errors)
+{
+    int rank, total = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Reduce(&errors, &total, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+    if (rank == 0) {
+        printf("matching: %s: %s\n", what, total ? "FAILED" : "ok");
+    }
+
+    // Messages of the next check must not meet receives of this one
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+// Message m from rank src, the first two ints identify it
+static int check_msg(const std::vector<int>& buf, const MPI_Status& stat,
+                     int src, int m, int tag_sent)
+{
+    int errors = 0;
+    if (buf[0] != src || buf[1] != m) ++errors;
+    if (stat.MPI_SOURCE != src || stat.MPI_TAG != tag_sent) ++errors;
+    return errors;
+}
+
+static void send_msg(int src, int m, int count, int tag_sent)
+{
+    std::vector<int> buf(count, 0);
+    buf[0] = src;
+    buf[1] = m;
+    MPI_Send(buf.data(), count, MPI_INT, 0, tag_sent, MPI_COMM_WORLD);
+}
+
+// Rank 1 sends nmsgs messages with one signature, mixing small and large
+// ones. Posted or unexpected, rank 0 must receive them in send order.
+static void check_order(int rank, bool unexpected, int recv_tag)
+{
+    int errors = 0;
+    if (rank == 0) {
+        std::vector<std::vector<int>> bufs(nmsgs, std::vector<int>(large, -1));
+        std::vector<MPI_Request> reqs(nmsgs);
+        std::vector<MPI_Status> stats(nmsgs);
+        if (unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        for (int m = 0; m < nmsgs; ++m) {
+            MPI_Irecv(bufs[m].data(), large, MPI_INT, 1, recv_tag, MPI_COMM_WORLD, &reqs[m]);
+        }
+        if (!unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Waitall(nmsgs, reqs.data(), stats.data());
+        for (int m = 0; m < nmsgs; ++m) {
+            errors += check_msg(bufs[m], stats[m], 1, m, tag);
+        }
+    } else {
+        std::vector<MPI_Request> reqs;
+        std::vector<std::vector<int>> bufs;
+        if (!unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        if (rank == 1) {
+            reqs.resize(nmsgs);
+            bufs.resize(nmsgs);
+            for (int m = 0; m < nmsgs; ++m) {
+                bufs[m].assign(m % 3 == 2 ? large : 2, 0);
+                bufs[m][0] = rank;
+                bufs[m][1] = m;
+                MPI_Isend(bufs[m].data(), bufs[m].size(), MPI_INT, 0, tag, MPI_COMM_WORLD, &reqs[m]);
+            }
+        }
+        if (unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE);
+    }
+
+    char what[64];
+    snprintf(what, sizeof(what), "order %s %s", recv_tag == MPI_ANY_TAG ? "any_tag" : "exact",
+             unexpected ? "unexpected" : "posted");
+    report(what, errors);
+}
+
+// Every other rank sends nmsgs messages. Rank 0 receives them all with
+// MPI_ANY_SOURCE and each sender's messages must arrive in order.
+static void check_any_source(int rank, int size, bool unexpected)
+{
+    int errors = 0;
+    if (rank == 0) {
+        int total = nmsgs * (size - 1);
+        std::vector<std::vector<int>> bufs(total, std::vector<int>(2, -1));
+        std::vector<MPI_Request> reqs(total);
+        std::vector<MPI_Status> stats(total);
+        if (unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        for (int i = 0; i < total; ++i) {
+            MPI_Irecv(bufs[i].data(), 2, MPI_INT, MPI_ANY_SOURCE, tag, MPI_COMM_WORLD, &reqs[i]);
+        }
+        if (!unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Waitall(total, reqs.data(), stats.data());
+
+        // Receives match in the order they were posted
+        std::vector<int> next(size, 0);
+        for (int i = 0; i < total; ++i) {
+            int src = stats[i].MPI_SOURCE;
+            if (src <= 0 || src >= size) {
+                ++errors;
+            } else {
+                errors += check_msg(bufs[i], stats[i], src, next[src]++, tag);
+            }
+        }
+        for (int src = 1; src < size; ++src) {
+            if (next[src] != nmsgs) ++errors;
+        }
+    } else {
+        std::vector<std::vector<int>> bufs(nmsgs, std::vector<int>(2));
+        std::vector<MPI_Request> reqs(nmsgs);
+        if (!unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        for (int m = 0; m < nmsgs; ++m) {
+            bufs[m][0] = rank;
+            bufs[m][1] = m;
+            MPI_Isend(bufs[m].data(), 2, MPI_INT, 0, tag, MPI_COMM_WORLD, &reqs[m]);
+        }
+        if (unexpected) MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Waitall(nmsgs, reqs.data(), MPI_STATUSES_IGNORE);
+    }
+    report(unexpected ? "any_source unexpected" : "any_source posted", errors);
+}
+
+// Receives that could all take the same message are posted exact,
+// any source, any tag and full wildcard, then in the opposite order.
+// Whatever bin a receive sits in, the oldest posted one must win.
+static void check_posted_order(int rank, bool wildcards_first)
+{
+    const int srcs[] = { 1, MPI_ANY_SOURCE, 1, MPI_ANY_SOURCE };
+    const int tags[] = { tag, tag, MPI_ANY_TAG, MPI_ANY_TAG };
+    const int nrecvs = 4;
+
+    int errors = 0;
+    if (rank == 0) {
+        std::vector<std::vector<int>> bufs(nrecvs, std::vector<int>(2, -1));
+        std::vector<MPI_Request> reqs(nrecvs);
+        std::vector<MPI_Status> stats(nrecvs);
+        for (int i = 0; i < nrecvs; ++i) {
+            int r = wildcards_first ? nrecvs - 1 - i : i;
+            MPI_Irecv(bufs[i].data(), 2, MPI_INT, srcs[r], tags[r], MPI_COMM_WORLD, &reqs[i]);
+        }
+        MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Waitall(nrecvs, reqs.data(), stats.data());
+        for (int i = 0; i < nrecvs; ++i) {
+            errors += check_msg(bufs[i], stats[i], 1, i, tag);
+        }
+    } else {
+        MPI_Barrier(MPI_COMM_WORLD);
+        if (rank == 1) {
+            for (int m = 0; m < nrecvs; ++m) {
+                send_msg(rank, m, 2, tag);
+            }
+        }
+    }
+    report(wildcards_first ? "posted order wildcards first" : "posted order exact first", errors);
+}
+
+// A receive for one tag must skip older unexpected messages with other
+// tags, and a later MPI_ANY_TAG receive must then find the oldest of them.
+static void check_unexpected_tags(int rank)
+{
+    int errors = 0;
+    if (rank == 0) {
+        std::vector<int> buf(2);
+        MPI_Status stat;
+        MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Recv(buf.data(), 2, MPI_INT, 1, tag + 2, MPI_COMM_WORLD, &stat);
+        errors += check_msg(buf, stat, 1, 2, tag + 2);
+        const int rest[] = { 0, 1, 3 };
+        for (int m : rest) {
+            MPI_Recv(buf.data(), 2, MPI_INT, 1, MPI_ANY_TAG, MPI_COMM_WORLD, &stat);
+            errors += check_msg(buf, stat, 1, m, tag + m);
+        }
+    } else {
+        std::vector<std::vector<int>> bufs(4, std::vector<int>(2));
+        std::vector<MPI_Request> reqs;
+        if (rank == 1) {
+            reqs.resize(4);
+            for (int m = 0; m < 4; ++m) {
+                bufs[m][0] = rank;
+                bufs[m][1] = m;
+                MPI_Isend(bufs[m].data(), 2, MPI_INT, 0, tag + m, MPI_COMM_WORLD, &reqs[m]);
+            }
+        }
+        MPI_Barrier(MPI_COMM_WORLD);
+        MPI_Waitall(reqs.size(), reqs.data(), MPI_STATUSES_IGNORE);
+    }
+    report("unexpected tags", errors);
+}
+
+int main(int argc, char* argv[])
+{
+    MPI_Init(&argc, &argv);
+    int size, rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    check_order(rank, false, tag);
+    check_order(rank, true, tag);
+    check_order(rank, false, MPI_ANY_TAG);
+    check_order(rank, true, MPI_ANY_TAG);
+    check_any_source(rank, size, false);
+    check_any_source(rank, size, true);
+    check_posted_order(rank, false);
+    check_posted_order(rank, true);
+    check_unexpected_tags(rank);
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#define ssthg_app_name stackbuf
+
+#include <stdio.h>
+
+#include <mask_mpi.h>
+#include <mercury/common/skeleton.h>
+
+// Every buffer, request and status lives on the stack of the rank, as in
+// many skeletons. Ranks block one after the other in a chain, so with
+// copy_stacks the stacks of blocked ranks are copied out while messages
+// are still delivered into them, and while rendezvous sends still read
+// from them. Every received value and status must be the one that was
+// sent.
+
+static const int tag = 9;
+static const int nrounds = 4;
+static const int maxranks = 8;
+static const int small = 64;
+
+// Over the eager limit, so these go rendezvous
+static const int large = 9000;
+
+static int value(int src, int round, int i)
+{
+    return src * 1000000 + round * 10000 + i;
+}
+
+static int exchange(int rank, int size, int round)
+{
+    int small_in[maxranks][small];
+    int small_out[small];
+    int large_in[large];
+    int large_out[large];
+    MPI_Request reqs[2 * maxranks + 2];
+    MPI_Status stats[2 * maxranks + 2];
+    int nreqs = 0;
+
+    for (int src = 0; src < size; ++src) {
+        for (int i = 0; i < small; ++i) small_in[src][i] = -1;
+    }
+    for (int i = 0; i < large; ++i) large_in[i] = -1;
+
+    // Post every receive first, the messages arrive while this rank blocks
+    for (int src = 0; src < size; ++src) {
+        if (src == rank) continue;
+        MPI_Irecv(small_in[src], small, MPI_INT, src, tag, MPI_COMM_WORLD, &reqs[nreqs++]);
+    }
+    int left = (rank + size - 1) % size;
+    int right = (rank + 1) % size;
+    int nsmall = nreqs;
+    MPI_Irecv(large_in, large, MPI_INT, left, tag + 1, MPI_COMM_WORLD, &reqs[nreqs++]);
+
+    // Block one after the other
+    int token = round;
+    if (rank > 0) {
+        MPI_Recv(&token, 1, MPI_INT, rank - 1, tag + 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+    if (rank < size - 1) {
+        MPI_Send(&token, 1, MPI_INT, rank + 1, tag + 2, MPI_COMM_WORLD);
+    }
+
+    for (int i = 0; i < small; ++i) small_out[i] = value(rank, round, i);
+    for (int i = 0; i < large; ++i) large_out[i] = value(rank, round, i);
+    for (int dst = 0; dst < size; ++dst) {
+        if (dst == rank) continue;
+        MPI_Isend(small_out, small, MPI_INT, dst, tag, MPI_COMM_WORLD, &reqs[nreqs++]);
+    }
+    MPI_Isend(large_out, large, MPI_INT, right, tag + 1, MPI_COMM_WORLD, &reqs[nreqs++]);
+
+    MPI_Waitall(nreqs, reqs, stats);
+
+    int errors = token != round;
+    for (int r = 0; r < nsmall; ++r) {
+        int src = r < rank ? r : r + 1;
+        if (stats[r].MPI_SOURCE != src || stats[r].MPI_TAG != tag) ++errors;
+        for (int i = 0; i < small; ++i) {
+            if (small_in[src][i] != value(src, round, i)) ++errors;
+        }
+    }
+    if (stats[nsmall].MPI_SOURCE != left || stats[nsmall].MPI_TAG != tag + 1) ++errors;
+    for (int i = 0; i < large; ++i) {
+        if (large_in[i] != value(left, round, i)) ++errors;
+    }
+    return errors;
+}
+
+int main(int argc, char** argv)
+{
+    MPI_Init(&argc, &argv);
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    if (size > maxranks) {
+        if (rank == 0) printf("stackbuf: at most %d ranks: FAILED\n", maxranks);
+        MPI_Finalize();
+        return 0;
+    }
+
+    for (int round = 0; round < nrounds; ++round) {
+        int errors = exchange(rank, size, round);
+        int total = 0;
+        MPI_Reduce(&errors, &total, 1, MPI_INT, MPI_SUM, 0, MPI_COMM_WORLD);
+        if (rank == 0) {
+            printf("stackbuf: round %d: %s\n", round, total ? "FAILED" : "ok");
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}
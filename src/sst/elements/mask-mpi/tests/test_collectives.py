@@ -0,0 +1,59 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sys
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+from sst.hg import *
+
+# Collective engine settings come in as name=value model options, e.g.
+#   --model-options="allreduce=ring bcast=pipeline segment_size=4KiB"
+engine_params = ["allreduce", "bcast", "allgather", "ring_cutoff", "ring_max_nproc",
+                 "pipeline_cutoff", "segment_size", "bcast_fanout", "smp_optimize"]
+
+if __name__ == "__main__":
+
+    PlatformDefinition.loadPlatformFile("platform_file_mask_mpi_test")
+    PlatformDefinition.setCurrentPlatform("platform_mask_mpi_test")
+    platform = PlatformDefinition.getCurrentPlatform()
+
+    os_params = {
+        "verbose" : "0",
+        "app1.name" : "collectives",
+        "app1.exe"  : "collectives.so",
+        "app1.libraries" : ["SystemLibrary:libsystemlibrary.so",
+                            "ComputeLibrary:libcomputelibrary.so",
+                            "SimTransport:libsumi.so",
+                            "MpiApi:libmask_mpi.so"],
+    }
+    for arg in sys.argv[1:]:
+        key, value = arg.split("=", 1)
+        if key not in engine_params:
+            sys.exit("test_collectives: unknown option %s" % key)
+        os_params["app1." + key] = value
+    platform.addParamSet("operating_system", os_params)
+
+    topo = topoSingle()
+    topo.link_latency = "20ns"
+    topo.num_ports = 32
+
+    ep = HgJob(0,8)
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
@@ -0,0 +1,60 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sys
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+from sst.hg import *
+
+# Thread stack settings come in as name=value model options, e.g.
+#   --model-options="copy_stacks=1 resident_blocked_stacks=1"
+stack_params = ["release_stacks", "copy_stacks", "resident_blocked_stacks", "protect_stacks"]
+
+if __name__ == "__main__":
+
+    PlatformDefinition.loadPlatformFile("platform_file_mask_mpi_test")
+    PlatformDefinition.setCurrentPlatform("platform_mask_mpi_test")
+    platform = PlatformDefinition.getCurrentPlatform()
+
+    os_params = {
+        "verbose" : "0",
+        "stack_size" : "256KiB",
+        "print_stack_stats" : "1",
+        "app1.name" : "stackbuf",
+        "app1.exe"  : "stackbuf.so",
+        "app1.libraries" : ["SystemLibrary:libsystemlibrary.so",
+                            "ComputeLibrary:libcomputelibrary.so",
+                            "SimTransport:libsumi.so",
+                            "MpiApi:libmask_mpi.so"],
+    }
+    for arg in sys.argv[1:]:
+        key, value = arg.split("=", 1)
+        if key not in stack_params:
+            sys.exit("test_stackbuf: unknown option %s" % key)
+        os_params[key] = value
+    platform.addParamSet("operating_system", os_params)
+
+    topo = topoSingle()
+    topo.link_latency = "20ns"
+    topo.num_ports = 32
+
+    ep = HgJob(0,8)
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
@@ -1,9 +1,50 @@
 # -*- coding: utf-8 -*-
 import os
+import re
 import subprocess
 
 from sst_unittest import *
 from sst_unittest_support import *
+from sst_unittest_parameterized import parameterized
+
+################################################################################
+# Collective engine settings for test_collectives. Every configuration has to
+# produce the same results, the auto rows pick ring/pipeline only for the large
+# message. Mercury runs one rank per node, so with smp_optimize the collectives
+# stay flat.
+collectives_test_matrix = [
+    ["default",  ""],
+    ["ring",     "allreduce=ring segment_size=4KiB"],
+    ["pipeline", "bcast=pipeline bcast_fanout=2 segment_size=4KiB"],
+    ["chain",    "bcast=pipeline bcast_fanout=1 segment_size=4KiB"],
+    ["auto",     "allreduce=auto bcast=auto allgather=auto ring_cutoff=16KiB pipeline_cutoff=16KiB segment_size=4KiB"],
+    ["smp",      "smp_optimize=1 allreduce=auto bcast=auto ring_cutoff=16KiB pipeline_cutoff=16KiB"],
+]
+
+# msgrate skeleton options and the match mode its header reports. The
+# wildcard and out of order variants go through every posted and
+# unexpected queue bin. Timing is host dependent, so only the header and
+# completion are checked.
+msgrate_test_matrix = [
+    ["exact",                 "",                               "exact"],
+    ["exact_unexpected",      "-unexpected",                    "exact unexpected"],
+    ["any_source_reverse",    "-match any_source -reverse",     "any_source reverse"],
+    ["any_source_unexpected", "-match any_source -unexpected",  "any_source unexpected"],
+    ["any_tag_reverse",       "-match any_tag -reverse",        "any_tag reverse"],
+]
+
+# Thread stack settings for test_stackbuf and whether stacks must be copied
+# out. Message buffers, requests and statuses of the skeleton live on its
+# stack, so received data is only right if copied out stacks stay
+# accessible to the simulator.
+stackbuf_test_matrix = [
+    ["default", "",                                         False],
+    ["copy",    "copy_stacks=1 resident_blocked_stacks=1",  True],
+    ["copy_no_release", "copy_stacks=1 resident_blocked_stacks=1 release_stacks=0", True],
+]
+
+def gen_custom_name(testcase_func, param_num, param):
+    return "{0}_{1}".format(testcase_func.__name__, parameterized.to_safe_name(param.args[0]))
 
 ################################################################################
 
@@ -70,9 +111,113 @@ class testcase_mask_mpi(SSTTestCase):
             os.environ["SST_LIB_PATH"] = path + ":" + libdir
         self.mask_mpi_template("test_halo3d26")
 
+    def test_matching(self):
+        testdir = self.get_testsuite_dir()
+        libdir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR",str)
+        path = os.environ.get("SST_LIB_PATH")
+        if path is None or path == "":
+            os.environ["SST_LIB_PATH"] = libdir
+        else:
+            os.environ["SST_LIB_PATH"] = path + ":" + libdir
+        self.mask_mpi_template("test_matching", grepfor="matching:")
+
+    @parameterized.expand(stackbuf_test_matrix, name_func=gen_custom_name)
+    def test_stackbuf(self, variant, modeloptions, copies):
+        testdir = self.get_testsuite_dir()
+        libdir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR",str)
+        path = os.environ.get("SST_LIB_PATH")
+        if path is None or path == "":
+            os.environ["SST_LIB_PATH"] = libdir
+        else:
+            os.environ["SST_LIB_PATH"] = path + ":" + libdir
+        outfile = self.mask_mpi_template("test_stackbuf", variant=variant, modeloptions=modeloptions,
+                                         grepfor="stackbuf:")
+
+        stats = None
+        with open(outfile, 'r') as f:
+            for line in f:
+                stats = stats or re.search(r"stacks: (\d+) in use, (\d+) max in use, (\d+) bytes max committed per stack, "
+                                           r"(\d+) bytes max held in copies", line)
+        self.assertIsNotNone(stats, "No stack statistics in {0}".format(outfile))
+        self.assertTrue(int(stats.group(2)) >= 8, "Expected a stack per rank, see {0}".format(outfile))
+        if copies:
+            self.assertTrue(int(stats.group(4)) > 0, "No stack was copied out, see {0}".format(outfile))
+        else:
+            self.assertEqual(int(stats.group(4)), 0, "Stacks were copied out by default, see {0}".format(outfile))
+
+    @parameterized.expand(msgrate_test_matrix, name_func=gen_custom_name)
+    def test_msgrate(self, variant, options, match):
+        testdir = self.get_testsuite_dir()
+        libdir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR",str)
+        path = os.environ.get("SST_LIB_PATH")
+        if path is None or path == "":
+            os.environ["SST_LIB_PATH"] = libdir
+        else:
+            os.environ["SST_LIB_PATH"] = path + ":" + libdir
+
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        testDataFileName = "test_msgrate_{0}".format(variant)
+        sdlfile = "{0}/test_msgrate.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        otherargs = '--model-options="-n 16 -iterations 10 {0}"'.format(options)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, set_cwd=test_path)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("hg test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile, 'r') as f:
+            lines = [line.strip() for line in f if line.startswith("msgrate:")]
+        header = "msgrate: 4 pairs, 16 msgs x 10 iterations, match={0}".format(match)
+        self.assertIn(header, lines, "msgrate output {0} does not start with '{1}'".format(outfile, header))
+        self.assertTrue(any(line.startswith("msgrate: host time per message") for line in lines),
+                        "msgrate output {0} has no message rate".format(outfile))
+        self.assertIsNotNone(self.simulated_time(outfile), "No simulated time in {0}".format(outfile))
+
+    @parameterized.expand(collectives_test_matrix, name_func=gen_custom_name)
+    def test_collectives(self, variant, modeloptions):
+        testdir = self.get_testsuite_dir()
+        libdir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR",str)
+        path = os.environ.get("SST_LIB_PATH")
+        if path is None or path == "":
+            os.environ["SST_LIB_PATH"] = libdir
+        else:
+            os.environ["SST_LIB_PATH"] = path + ":" + libdir
+        self.mask_mpi_template("test_collectives", variant=variant, modeloptions=modeloptions,
+                               grepfor="collectives:")
+
+    def test_collectives_selection(self):
+        testdir = self.get_testsuite_dir()
+        libdir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR",str)
+        path = os.environ.get("SST_LIB_PATH")
+        if path is None or path == "":
+            os.environ["SST_LIB_PATH"] = libdir
+        else:
+            os.environ["SST_LIB_PATH"] = path + ":" + libdir
+        # With cutoffs above every message the auto rules must pick the default
+        # algorithms, and so the same timing. Below them they must not.
+        auto = "allreduce=auto bcast=auto allgather=auto segment_size=4KiB"
+        flat = self.mask_mpi_template("test_collectives", variant="select_default",
+                                      grepfor="collectives:")
+        high = self.mask_mpi_template("test_collectives", variant="select_high",
+                                      modeloptions=auto + " ring_cutoff=1GiB pipeline_cutoff=1GiB",
+                                      grepfor="collectives:")
+        low = self.mask_mpi_template("test_collectives", variant="select_low",
+                                     modeloptions=auto + " ring_cutoff=16KiB pipeline_cutoff=16KiB",
+                                     grepfor="collectives:")
+
+        self.assertIsNotNone(self.simulated_time(flat), "No simulated time in {0}".format(flat))
+        self.assertEqual(self.simulated_time(high), self.simulated_time(flat),
+                         "auto selection above the cutoffs {0} does not time like the defaults {1}".format(high, flat))
+        self.assertNotEqual(self.simulated_time(low), self.simulated_time(flat),
+                            "auto selection below the cutoffs {0} times like the defaults {1}".format(low, flat))
+
 #####
 
-    def mask_mpi_template(self, testcase, striptotail=0):
+    def mask_mpi_template(self, testcase, striptotail=0, variant="", modeloptions="", grepfor=""):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -83,13 +228,18 @@ class testcase_mask_mpi(SSTTestCase):
 
         sdlfile = "{0}/{1}.py".format(test_path, testDataFileName)
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        if variant != "":
+            testDataFileName = "{0}_{1}".format(testcase, variant)
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         tmpfile = "{0}/{1}.tmp".format(tmpdir, testDataFileName)
         cmpfile = "{0}/{1}.cmp".format(tmpdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path)
+        otherargs = ""
+        if modeloptions != "":
+            otherargs = '--model-options="{0}"'.format(modeloptions)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, set_cwd=test_path)
 
         testing_remove_component_warning_from_file(outfile)
 
@@ -101,6 +251,10 @@ class testcase_mask_mpi(SSTTestCase):
             os.system("grep Random {0} > {1}".format(outfile, tmpfile))
             os.system("tail -5 {0} > {1}".format(tmpfile, cmpfile))
 
+        if grepfor != "":
+            # Only keep the lines the test prints, the simulated time depends on the algorithm
+            os.system("grep '{0}' {1} > {2}".format(grepfor, outfile, cmpfile))
+
         # NOTE: THE PASS / FAIL EVALUATIONS ARE PORTED FROM THE SQE BAMBOO
         #       BASED testSuite_XXX.sh THESE SHOULD BE RE-EVALUATED BY THE
         #       DEVELOPER AGAINST THE LATEST VERSION OF SST TO SEE IF THE
@@ -115,3 +269,12 @@ class testcase_mask_mpi(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(cmpfile, reffile))
+
+        return outfile
+
+    def simulated_time(self, outfile):
+        with open(outfile, 'r') as f:
+            for line in f:
+                if line.startswith("Simulation is complete"):
+                    return line.strip()
+        return None
@@ -25,6 +25,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/lineTypes.h"
+#include "sst/elements/memHierarchy/lineCompressor.h"
 
 using namespace std;
 
@@ -77,13 +78,18 @@ class CacheArray {
         T * lookup(Addr addr, bool updateReplacement);
 
         /** Identify a replacement candidate using the replacement manager */
-        T * findReplacementCandidate(Addr addr);
+        virtual T * findReplacementCandidate(Addr addr);
 
         /** Replace a line with address 'addr' and update its replacement info */
-        void replace(Addr addr, T* candidate);
+        virtual void replace(Addr addr, T* candidate);
 
         /** Deallocate a line and notify replacement manager that it's been deallocated */
-        void deallocate(T* candidate);
+        virtual void deallocate(T* candidate);
+
+        /** Whether the set holding 'addr' needs another eviction before a line can be allocated,
+         *  even if the current replacement candidate is invalid. Only arrays whose sets can hold
+         *  a varying number of lines (e.g., compressed arrays) return true. */
+        virtual bool isSetFull(Addr addr) { return false; }
 
     /**** Configuration and output */
         void setSliceAware(Addr size, Addr step);
@@ -236,5 +242,129 @@ void CacheArray<T>::printCacheArray(Output &out) {
     }
 }
 
+/*
+ * A compressed cache array
+ *
+ * Each set has 'associativity' physical ways of data but 'tagsPerWay' times
+ * as many tags, so a set can hold more lines when their data compresses.
+ * A set holds any number of lines up to the tag count, as long as their
+ * compressed sizes fit in associativity * lineSize bytes. Compressed sizes
+ * are rounded up to 'segmentSize' bytes.
+ *
+ * Lines are allocated on a miss, before their data is known. A set admits a
+ * new line if it has room for at least one segment. The new line counts as
+ * uncompressed until the coherence manager reports its data with
+ * updateData(). A fill or write that does not fit leaves the set
+ * oversubscribed until its next allocation, which evicts until there is
+ * room again. This approximates compressing on fill without stalling the
+ * fill for evictions. Lines whose data is never reported, e.g., because no
+ * level below carries data, count as uncompressed.
+ *
+ * The replacement policy manages all tags, so it must be created with
+ * lines * tagsPerWay lines and associativity * tagsPerWay ways.
+ */
+template <class T>
+class CompressedCacheArray : public CacheArray<T> {
+    public:
+        CompressedCacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, unsigned int tagsPerWay,
+                uint32_t segmentSize, LineCompressor* compressor, ReplacementPolicy* replacementMgr, HashFunction* hash) :
+            CacheArray<T>(dbg, numLines * tagsPerWay, associativity * tagsPerWay, lineSize, replacementMgr, hash),
+            setBytes_(associativity * lineSize), segmentSize_(segmentSize), compressor_(compressor) {
+
+            if (segmentSize_ == 0 || segmentSize_ > lineSize)
+                dbg->fatal(CALL_INFO, -1, "CompressedCacheArray, Error: segment size must be between 1 and the line size (%u). Segment size = %u.\n",
+                        lineSize, segmentSize_);
+
+            size_.resize(this->numLines_, lineSize);
+            encoding_.resize(this->numLines_, LineCompressor::Encoding::Uncompressed);
+            latency_[(int)LineCompressor::Encoding::Uncompressed] = 0;
+            latency_[(int)LineCompressor::Encoding::BDI] = 0;
+            latency_[(int)LineCompressor::Encoding::FPC] = 0;
+        }
+
+        ~CompressedCacheArray() {
+            delete compressor_;
+        }
+
+        /** Set latency to decompress a line of a given encoding */
+        void setDecompressionLatency(LineCompressor::Encoding enc, uint64_t latency) { latency_[(int)enc] = latency; }
+
+        /** While the set is full, only allocated lines are candidates so that eviction frees data space */
+        T * findReplacementCandidate(Addr addr) override {
+            if (!isSetFull(addr))
+                return CacheArray<T>::findReplacementCandidate(addr);
+
+            unsigned int set = getSet(addr);
+            std::vector<ReplacementInfo*> &setInfo = this->rInfo[set];
+            candidates_.clear();
+            for (unsigned int i = 0; i < this->associativity_; i++) {
+                if (this->lines_[set * this->associativity_ + i]->allocated())
+                    candidates_.push_back(setInfo[i]);
+            }
+            if (candidates_.empty())
+                return CacheArray<T>::findReplacementCandidate(addr);
+            unsigned int id = this->replacementMgr_->findBestCandidate(candidates_);
+            return this->lines_[id];
+        }
+
+        void replace(Addr addr, T* candidate) override {
+            CacheArray<T>::replace(addr, candidate);
+            size_[candidate->getIndex()] = this->lineSize_;
+            encoding_[candidate->getIndex()] = LineCompressor::Encoding::Uncompressed;
+        }
+
+        bool isSetFull(Addr addr) override {
+            return getSetBytes(getSet(addr)) + segmentSize_ > setBytes_;
+        }
+
+        /** Recompute the compressed size of a line after its data changes. Returns the stored size in bytes. */
+        uint32_t updateData(T* line) {
+            LineCompressor::Result res = compressor_->compress(*line->getData());
+            uint32_t size = ((res.size + segmentSize_ - 1) / segmentSize_) * segmentSize_;
+            if (size >= this->lineSize_) {
+                size = this->lineSize_;
+                res.encoding = LineCompressor::Encoding::Uncompressed;
+            }
+            size_[line->getIndex()] = size;
+            encoding_[line->getIndex()] = res.encoding;
+            return size;
+        }
+
+        /** Additional latency to read the data of 'line' */
+        uint64_t getDecompressionLatency(T* line) { return latency_[(int)encoding_[line->getIndex()]]; }
+
+        /** Number of lines currently allocated in the set holding 'addr' */
+        unsigned int getSetLines(Addr addr) {
+            unsigned int set = getSet(addr);
+            unsigned int count = 0;
+            for (unsigned int i = set * this->associativity_; i < (set + 1) * this->associativity_; i++) {
+                if (this->lines_[i]->allocated())
+                    count++;
+            }
+            return count;
+        }
+
+    private:
+        uint32_t setBytes_;             // Data capacity of a set
+        uint32_t segmentSize_;          // Compressed sizes are rounded up to this
+        LineCompressor* compressor_;
+        vector<uint32_t> size_;         // Stored size of each line, by index
+        vector<LineCompressor::Encoding> encoding_;
+        uint64_t latency_[3];           // Decompression latency by encoding
+        std::vector<ReplacementInfo*> candidates_;
+
+        unsigned int getSet(Addr addr) { return this->hash_->hash(0, this->toLineAddr(addr)) % this->numSets_; }
+
+        /* Bytes held by the allocated lines in a set */
+        uint32_t getSetBytes(unsigned int set) {
+            uint32_t bytes = 0;
+            for (unsigned int i = set * this->associativity_; i < (set + 1) * this->associativity_; i++) {
+                if (this->lines_[i]->allocated())
+                    bytes += size_[i];
+            }
+            return bytes;
+        }
+};
+
 }}
 #endif	/* CACHEARRAY_H */
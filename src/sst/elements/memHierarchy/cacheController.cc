@@ -99,15 +99,22 @@ void Cache::processPrefetchEvent(SST::Event * ev) {
 bool Cache::clockTick(Cycle_t time) {
     timestamp_++;
 
+    // Statistical sampling - switch between detailed simulation and functional warming
+    if (sampling_->update(getCurrentSimTimeNano()))
+        coherenceMgr_->setWarming(sampling_->isWarming());
+    int maxRequests = sampling_->isWarming() ? -1 : maxRequestsPerCycle_;
+
     // Drain any outgoing messages
     bool idle = coherenceMgr_->sendOutgoingEvents();
 
+    bool linksIdle = true;
     if (clockUpLink_) {
-        idle &= linkUp_->clock();
+        linksIdle &= linkUp_->clock();
     }
     if (clockDownLink_) {
-        idle &= linkDown_->clock();
+        linksIdle &= linkDown_->clock();
     }
+    idle &= linksIdle;
 
     // MSHR occupancy
     statMSHROccupancy->addData(mshr_->getSize());
@@ -128,7 +135,7 @@ bool Cache::clockTick(Cycle_t time) {
 
     std::list<MemEventBase*>::iterator it = retryBuffer_.begin();
     while (it != retryBuffer_.end()) {
-        if (accepted == maxRequestsPerCycle_)
+        if (accepted == maxRequests)
             break;
         if (is_debug_event((*it))) {
             dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Retry   (%s)\n",
@@ -150,7 +157,7 @@ bool Cache::clockTick(Cycle_t time) {
     // 2. An event can be rejected, in which case we check the next one with no penalty (doesn't block a later response)
     it = eventBuffer_.begin();
     while (it != eventBuffer_.end()) {
-        if (accepted == maxRequestsPerCycle_)
+        if (accepted == maxRequests)
             break;
         Event::id_type id = (*it)->getID();
         Command cmd = (*it)->getCmd();
@@ -175,7 +182,7 @@ bool Cache::clockTick(Cycle_t time) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(), prefetchBuffer_.front()->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (accepted != maxRequestsPerCycle_ && processEvent(prefetchBuffer_.front(), false)) {
+        if (accepted != maxRequests && processEvent(prefetchBuffer_.front(), false)) {
             accepted++;
             // Accepted prefetches are profiled in the coherence manager
 	    prefetchBuffer_.pop();
@@ -201,6 +208,16 @@ bool Cache::clockTick(Cycle_t time) {
         return true;
     }
 
+    // If only waiting to send queued events, sleep until the first one is due
+    if (eventBuffer_.empty() && retryBuffer_.empty() && linksIdle) {
+        uint64_t nextDelivery = coherenceMgr_->getNextDeliveryTime();
+        if (nextDelivery > timestamp_ + 1) {
+            turnClockOff();
+            clockWakeSelfLink_->send(nextDelivery - timestamp_ - 1, nullptr);
+            return true;
+        }
+    }
+
     // Keep the clock on
     return false;
 }
@@ -216,6 +233,12 @@ void Cache::turnClockOn() {
     clockIsOn_ = true;
 }
 
+/* Handler for clockWakeSelfLink_ - an outgoing event is due */
+void Cache::clockWakeup(SST::Event * ev) {
+    if (!clockIsOn_)
+        turnClockOn();
+}
+
 void Cache::turnClockOff() {
     //dbg_->debug(_L3_, "%s turning clock OFF at cycle %" PRIu64 ", timestamp %" PRIu64 ", ns %" PRIu64 "\n", this->getName().c_str(), getCurrentSimCycle(), timestamp_, getCurrentSimTimeNano());
     clockIsOn_ = false;
@@ -373,7 +396,7 @@ bool Cache::processEvent(MemEventBase* ev, bool retry) {
 
 /* Arbitrate for access. Return whether successful */
 bool Cache::arbitrateAccess(Addr addr) {
-    if (!banked_) {
+    if (!banked_ || sampling_->isWarming()) {
         if (addrsThisCycle_.find(addr) == addrsThisCycle_.end()) {
             return true;
         }
@@ -591,6 +614,7 @@ void Cache::finish() {
     }
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->printStats(*out_);
+    sampling_->finish(getCurrentSimTimeNano());
     linkDown_->finish();
     if (linkUp_ != linkDown_) linkUp_->finish();
 }
@@ -35,6 +35,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/sampling.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -78,7 +79,7 @@ public:
             {"drop_prefetch_mshr_level","(uint) Drop/NACK prefetches if the number of in-use mshrs is greater than or equal to this number. Default is mshr_num_entries - 2.", "mshr_num_entries-2"},
             {"num_cache_slices",        "(uint) For a distributed, shared cache, total number of cache slices", "1"},
             {"slice_id",                "(uint) For distributed, shared caches, unique ID for this cache slice", "0"},
-            {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin]", "rr"},
+            {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin], xor[XOR hash of line addresses, num_cache_slices must be a power of two]", "rr"},
             {"maxRequestDelay",         "(uint) Set an error timeout if memory requests take longer than this in ns (0: disable)", "0"},
             {"snoop_l1_invalidations",  "(bool) Forward invalidations from L1s to processors. Options: 0[off], 1[on]", "false"},
             {"llsc_block_cycles",       "(uint64_t) Number of cycles to prevent competing access to an LL/LR line. Encourages forward progress", "0"},
@@ -89,7 +90,13 @@ public:
             {"cache_line_size",         "(uint) Size of a cache line [aka cache block] in bytes.", "64"},
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
-            {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"})
+            {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"compression",             "(string) Model a compressed data array in which a set holds more lines when their data compresses. Requires a coherent, inclusive, non-L1 cache and real data (e.g., a memory backing store). Options: none, bdi[Base-Delta-Immediate], fpc[Frequent Pattern Compression], best[smaller of bdi and fpc]", "none"},
+            {"compression_tags_per_way","(uint) Compressed cache: tags per physical way, which bounds lines per set at associativity * compression_tags_per_way", "2"},
+            {"compression_segment_size","(uint) Compressed cache: compressed line sizes are rounded up to a multiple of this many bytes", "8"},
+            {"compression_bdi_latency_cycles", "(uint) Compressed cache: cycles added to hits on lines compressed with BDI", "1"},
+            {"compression_fpc_latency_cycles", "(uint) Compressed cache: cycles added to hits on lines compressed with FPC", "5"},
+            MEMHIERARCHY_SAMPLING_ELI_PARAMS)
 
     SST_ELI_DOCUMENT_PORTS(
             {"highlink",        "Non-network upper/processor-side link (i.e., link towards the core/accelerator/etc.). This port loads the 'memHierarchy.MemLink' manager. "
@@ -167,6 +174,7 @@ public:
             {"GetSX_uncache_recv",      "Noncacheable Event: GetSX received", "count", 4},
             {"GetSResp_uncache_recv",   "Noncacheable Event: GetSResp received", "count", 4},
             {"WriteResp_uncache_recv",  "Noncacheable Event: WriteResp received", "count", 4},
+            MEMHIERARCHY_SAMPLING_ELI_STATS,
             {"default_stat",            "Default statistic used for unexpected events/cases/etc. Should be 0, if not, check for missing statistic registrations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -252,6 +260,7 @@ private:
     // Clock helpers - turn clock on & off
     void turnClockOn();
     void turnClockOff();
+    void clockWakeup(SST::Event * ev);
 
     // Trigger timeouts if events sit in MSHR for too long
     void timeoutWakeup(SST::Event * ev);
@@ -271,8 +280,10 @@ private:
     MemLinkBase* linkDown_;                 // link manager down (towards memory)
     Link* prefetchSelfLink_;                // link to delay prefetch request receive
     Link* timeoutSelfLink_;                 // link to check for timeouts (possible deadlock)
+    Link* clockWakeSelfLink_;               // link to re-enable the clock when a queued outgoing event is due
     MSHR* mshr_;                            // MSHR
     CoherenceController* coherenceMgr_;     // Coherence protocol - where most of the event handling happens
+    SamplingController* sampling_;          // Statistical sampling schedule
 
     /** Latencies **************************************************************/
     SimTime_t   prefetchDelay_;
@@ -132,6 +132,13 @@ void Cache::createCoherenceManager(Params &params) {
                 getName().c_str(), itype.c_str(), protStr.c_str());
     }
 
+    std::string compression = params.find<std::string>("compression", "none");
+    to_lower(compression);
+    if (compression != "none" && (L1 || protocol == CoherenceProtocol::NONE || itype != "inclusive")) {
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: compression is only supported by coherent, inclusive, non-L1 caches. You specified: compression = '%s', cache_type = '%s', coherence_protocol = '%s', L1 = '%s'\n",
+                getName().c_str(), compression.c_str(), itype.c_str(), protStr.c_str(), L1 ? "true" : "false");
+    }
+
     /* Create MSHR */
     uint64_t mshrLatency = createMSHR(params, accessLatency, L1);
 
@@ -163,6 +170,11 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceParams.insert("dassoc", params.find<std::string>("noninclusive_directory_associativity", "0"));
     coherenceParams.insert("drpolicy", params.find<std::string>("noninclusive_directory_repl", "lru"));
     coherenceParams.insert("cache_frequency", params.find<std::string>("cache_frequency", "")); // Not used by all managers, already error checked
+    coherenceParams.insert("compression", compression); // Not used by all managers, already error checked
+    coherenceParams.insert("compression_tags_per_way", params.find<std::string>("compression_tags_per_way", "2"));
+    coherenceParams.insert("compression_segment_size", params.find<std::string>("compression_segment_size", "8"));
+    coherenceParams.insert("compression_bdi_latency_cycles", params.find<std::string>("compression_bdi_latency_cycles", "1"));
+    coherenceParams.insert("compression_fpc_latency_cycles", params.find<std::string>("compression_fpc_latency_cycles", "5"));
     bool prefetch = (statPrefetchRequest != nullptr);
 
     if (!L1) {
@@ -212,8 +224,16 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceMgr_->setMSHR(mshr_);
     coherenceMgr_->setCacheListener(listeners_, dropPrefetchLevel, maxOutstandingPrefetch);
     coherenceMgr_->setDebug(DEBUG_ADDR);
-    coherenceMgr_->setSliceAware(region_.interleaveSize, region_.interleaveStep);
+    if (region_.hashSlices != 0)
+        coherenceMgr_->setSliceAware(region_.hashGranularity, region_.hashSlices * region_.hashGranularity);
+    else
+        coherenceMgr_->setSliceAware(region_.interleaveSize, region_.interleaveStep);
     coherenceMgr_->registerClockEnableFunction(std::bind(&Cache::turnClockOn, this));
+
+    sampling_ = new SamplingController(params, out_, getName());
+    coherenceMgr_->setSamplingController(sampling_);
+    if (sampling_->isEnabled())
+        sampling_->setStatistics(registerStatistic<double>("sampled_window_latency"), registerStatistic<double>("sampled_window_throughput"));
 }
 
 
@@ -276,9 +296,12 @@ void Cache::configureLinks(Params &params, TimeConverter* tc) {
             if (sliceID >= sliceCount)
                 out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_id - should be between 0 and num_cache_slices-1. You specified %" PRIu64 ".\n",
                         getName().c_str(), sliceID);
-            if (slicePolicy != "rr")
-                out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_allocation_policy - supported policy is 'rr' (round-robin). You specified '%s'.\n",
+            if (slicePolicy != "rr" && slicePolicy != "xor")
+                out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_allocation_policy - supported policies are 'rr' (round-robin) and 'xor' (XOR hash). You specified '%s'.\n",
                         getName().c_str(), slicePolicy.c_str());
+            if (slicePolicy == "xor" && !isPowerOfTwo(sliceCount))
+                out_->fatal(CALL_INFO,-1, "%s, Invalid param: num_cache_slices - must be a power of two when slice_allocation_policy is 'xor'. You specified %" PRIu64 ".\n",
+                        getName().c_str(), sliceCount);
         } else {
             out_->fatal(CALL_INFO, -1, "%s, Invalid param: num_cache_slices - should be 1 or greater. You specified %" PRIu64 ".\n",
                     getName().c_str(), sliceCount);
@@ -327,6 +350,10 @@ void Cache::configureLinks(Params &params, TimeConverter* tc) {
                 region_.interleaveStep = sliceCount*lineSize_;
             }
         }
+        if (sliceCount > 1 && slicePolicy == "xor") {
+            gotRegion = true;
+            region_.setHash(sliceCount, sliceID, lineSize_);
+        }
 
         // Little bit of error checking
         if (region_.end < region_.start) {
@@ -575,7 +602,8 @@ void Cache::configureLinks(Params &params, TimeConverter* tc) {
         else if (cacheSliceCount > 1) {
             if (sliceID >= cacheSliceCount) out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_id - should be between 0 and num_cache_slices-1. You specified %" PRIu64 ".\n",
                     getName().c_str(), sliceID);
-            if (sliceAllocPolicy != "rr") out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_allocation_policy - supported policy is 'rr' (round-robin). You specified '%s'.\n",
+            if (sliceAllocPolicy != "rr") out_->fatal(CALL_INFO,-1, "%s, Invalid param: slice_allocation_policy - supported policy is 'rr' (round-robin) when using the 'directory' port. "
+                    "Fill the 'lowlink' subcomponent slot instead to use 'xor'. You specified '%s'.\n",
                     getName().c_str(), sliceAllocPolicy.c_str());
         } else {
             out_->fatal(CALL_INFO, -1, "%s, Invalid param: num_cache_slices - should be 1 or greater. You specified %" PRIu64 ".\n",
@@ -680,7 +708,7 @@ void Cache::createListeners(Params &params) {
     /* Configure listener(s) */
     lists = getSubComponentSlotInfo("listener");
     if (lists) {
-        for (int i = 0; i < lists->getMaxPopulatedSlotNumber(); i++) {
+        for (int i = 0; i <= lists->getMaxPopulatedSlotNumber(); i++) {
             if (lists->isPopulated(i))
                 listeners_.push_back(lists->create<CacheListener>(i, ComponentInfo::SHARE_NONE));
         }
@@ -791,6 +819,7 @@ void Cache::createClock(Params &params) {
     clockIsOn_ = true;
     timestamp_ = 0;
     lastActiveClockCycle_ = 0;
+    clockWakeSelfLink_ = configureSelfLink("clockwake", defaultTimeBase_, new Event::Handler<Cache>(this, &Cache::clockWakeup));
 
     // Deadlock timeout
     timeout_ = params.find<SimTime_t>("maxRequestDelay", 0);
@@ -38,6 +38,14 @@ namespace MemHierarchy {
     enum NotifyAccessType{ READ, WRITE, EVICT, PREFETCH };
     enum NotifyResultType{ HIT, MISS, NA };
 
+    /* Outcome of a prefetch, reported to listeners by the cache
+     *  PREFETCH_USEFUL:  a prefetched line was accessed by a demand request
+     *  PREFETCH_LATE:    a demand request arrived while the prefetch was still outstanding.
+     *                    The line is also reported useful when the demand request completes.
+     *  PREFETCH_USELESS: a prefetched line was evicted or invalidated without being accessed
+     */
+    enum NotifyPrefetchResult{ PREFETCH_USEFUL, PREFETCH_LATE, PREFETCH_USELESS };
+
 class CacheListenerNotification {
 public:
     CacheListenerNotification(const Addr tAddr, const Addr pAddr, const Addr vAddr,
@@ -45,7 +53,7 @@ public:
                               NotifyAccessType accessT,
                               NotifyResultType resultT) :
         size(reqSize), targAddr(tAddr), physAddr(pAddr), virtAddr(vAddr), instPtr(iPtr),
-        access(accessT), result(resultT) {}
+        access(accessT), result(resultT), data(nullptr) {}
 
     /** the target address is the underlying address from the
         LOAD/STORE, not the baseAddr (which is usually he cache line
@@ -57,6 +65,9 @@ public:
 	NotifyAccessType getAccessType() const { return access; }
 	NotifyResultType getResultType() const { return result; }
 	uint32_t getSize() const { return size; }
+	/** Data of the accessed line, if the cache provides it (currently L1 read hits). Indexed from the line base. */
+	const std::vector<uint8_t>* getData() const { return data; }
+	void setData(const std::vector<uint8_t>* d) { data = d; }
 private:
 	uint32_t size;
         Addr targAddr;
@@ -65,6 +76,7 @@ private:
 	Addr instPtr;
 	NotifyAccessType access;
 	NotifyResultType result;
+	const std::vector<uint8_t>* data;
 };
 
 class CacheListener : public SubComponent {
@@ -86,6 +98,8 @@ public:
 
     virtual void printStats(Output &UNUSED(out)) {}
     virtual void notifyAccess(const CacheListenerNotification& UNUSED(notify)) {}
+    /** Feedback on prefetches issued by the cache's prefetcher, for throttling */
+    virtual void notifyPrefetchResult(Addr UNUSED(addr), NotifyPrefetchResult UNUSED(result)) {}
     virtual void registerResponseCallback(Event::HandlerBase *handler) { delete handler; }
 };
 
@@ -81,7 +81,7 @@ bool Incoherent::handleGetS(MemEvent * event, bool inMSHR) {
                 recordPrefetchLatency(event->getID(), LatType::HIT);
                 return DONE;
             }
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             recordLatencyType(event->getID(), LatType::HIT);
 
             sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
@@ -154,7 +154,7 @@ bool Incoherent::handleGetX(MemEvent * event, bool inMSHR) {
                     stat_hit[2][(int)inMSHR]->addData(1);
                 stat_hits->addData(1);
             }
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
             line->setTimestamp(sendTime);
             recordLatencyType(event->getID(), LatType::HIT);
@@ -267,7 +267,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool inMSHR) {
         case E:
         case M:
             if (status == MemEventStatus::OK) {
-                recordPrefetchResult(line, statPrefetchEvict);
+                recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
                 forwardFlush(event, true, line->getData(), state == M, line->getTimestamp());
                 line->setState(I_B);
                 mshr_->setInProgress(addr);
@@ -620,7 +620,7 @@ bool Incoherent::handleEviction(Addr addr, PrivateCacheLine* &line, dbgin &diStr
             return false;
     }
 
-    recordPrefetchResult(line, statPrefetchEvict);
+    recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
     return true;
 }
 
@@ -791,9 +791,10 @@ MemEventInitCoherence * Incoherent::getInitCoherenceEvent() {
     return new MemEventInitCoherence(cachename_, Endpoint::Cache, false, false, false, lineSize_, true);
 }
 
-void Incoherent::recordPrefetchResult(PrivateCacheLine * line, Statistic<uint64_t>* stat) {
+void Incoherent::recordPrefetchResult(PrivateCacheLine * line, Statistic<uint64_t>* stat, NotifyPrefetchResult result) {
     if (line->getPrefetch()) {
         stat->addData(1);
+        notifyListenerOfPrefetchResult(line->getAddr(), result);
         line->setPrefetch(false);
     }
 }
@@ -314,7 +314,7 @@ private:
     void forwardByAddress(MemEventBase* ev, Cycle_t timestamp);
     void forwardByDestination(MemEventBase* ev, Cycle_t timestamp);
 
-    void recordPrefetchResult(PrivateCacheLine * line, Statistic<uint64_t> * stat);
+    void recordPrefetchResult(PrivateCacheLine * line, Statistic<uint64_t> * stat, NotifyPrefetchResult result);
 
     void printLine(Addr addr);
 
@@ -80,15 +80,18 @@ bool IncoherentL1::handleGetS(MemEvent* event, bool inMSHR){
                 stat_eventState[(int)Command::GetS][state]->addData(1);
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
-                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
+                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT, line->getData());
             }
             if (localPrefetch) {
-                recordPrefetchResult(line, statPrefetchRedundant);
+                if (line->getPrefetch()) {
+                    statPrefetchRedundant->addData(1);
+                    line->setPrefetch(false);
+                }
                 cleanUpAfterRequest(event, inMSHR);
                 break;
             }
 
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             recordLatencyType(event->getID(), LatType::HIT);
 
             if (event->isLoadLink())
@@ -170,7 +173,7 @@ bool IncoherentL1::handleGetX(MemEvent* event, bool inMSHR) {
             line->setState(M);
         case M:
             // Profile
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
@@ -257,7 +260,7 @@ bool IncoherentL1::handleGetSX(MemEvent* event, bool inMSHR) {
             line->setState(M);
         case M:
             // Profile
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
@@ -386,7 +389,7 @@ bool IncoherentL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     if (!mshr_->getProfiled(addr)) {
         stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
         if (line)
-            recordPrefetchResult(line, statPrefetchEvict);
+            recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
         mshr_->setProfiled(addr);
     }
 
@@ -738,7 +741,7 @@ bool IncoherentL1::handleEviction(Addr addr, L1CacheLine*& line) {
     }
 
     line->atomicEnd();
-    recordPrefetchResult(line, statPrefetchEvict);
+    recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
     return true;
 }
 
@@ -962,9 +965,10 @@ void IncoherentL1::printLine(Addr addr) {
 }
 
 /* Record the result of a prefetch. important: assumes line is not null */
-void IncoherentL1::recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t> * stat) {
+void IncoherentL1::recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t> * stat, NotifyPrefetchResult result) {
     if (line->getPrefetch()) {
         stat->addData(1);
+        notifyListenerOfPrefetchResult(line->getAddr(), result);
         line->setPrefetch(false);
     }
 }
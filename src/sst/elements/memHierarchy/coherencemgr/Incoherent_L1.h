@@ -293,7 +293,7 @@ private:
 /* Miscellaneous */
 
     /* Statistics recording */
-    void recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t> * stat);
+    void recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t> * stat, NotifyPrefetchResult result);
     void recordLatency(Command cmd, int type, uint64_t timestamp);
 
     /* Debug output */
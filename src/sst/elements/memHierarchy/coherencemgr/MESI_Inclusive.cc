@@ -109,10 +109,10 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                 break;
             }
 
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             line->addSharer(event->getSrc());
 
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getData(), inMSHR, getDataReadyTime(line));
             line->setTimestamp(sendTime - 1);
             cleanUpAfterRequest(event, inMSHR);
 
@@ -138,7 +138,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                 break;
             }
 
-            recordPrefetchResult(line, statPrefetchHit); // Accessed a prefetched line
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL); // Accessed a prefetched line
 
             if (line->hasOwner()) {
                 if (!inMSHR)
@@ -179,7 +179,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                 }
             }
 
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp(), respcmd);
+            sendTime = sendResponseUp(event, line->getData(), inMSHR, getDataReadyTime(line), respcmd);
             line->setTimestamp(sendTime);
             cleanUpAfterRequest(event, inMSHR);
 
@@ -253,7 +253,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
                         notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                         mshr_->setProfiled(addr);
                     }
-                    recordPrefetchResult(line, statPrefetchUpgradeMiss);
+                    recordPrefetchResult(line, statPrefetchUpgradeMiss, PREFETCH_USEFUL);
                     recordLatencyType(event->getID(), LatType::UPGRADE);
 
                     sendTime = forwardMessage(event, lineSize_, 0, nullptr);
@@ -281,7 +281,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
                     mshr_->setProfiled(addr);
             }
 
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
 
             if (line->hasOtherSharers(event->getSrc())) {
                 if (!inMSHR)
@@ -323,7 +323,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
             line->setOwner(event->getSrc());
             if (line->isSharer(event->getSrc()))
                 line->removeSharer(event->getSrc());
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getData(), inMSHR, getDataReadyTime(line));
             line->setTimestamp(sendTime);
 
             if (is_debug_event(event))
@@ -441,7 +441,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
         bool downgrade = (state == E || state == M);
         forwardFlush(event, line, downgrade);
         if (line) {
-            recordPrefetchResult(line, statPrefetchEvict);
+            recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
             if (state != I)
                 line->setState(S_B);
         }
@@ -567,7 +567,7 @@ bool MESIInclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
         }
         mshr_->setInProgress(addr);
         if (line)
-            recordPrefetchResult(line, statPrefetchEvict);
+            recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
         forwardFlush(event, line, state != I);
 
         if (state != I)
@@ -1159,7 +1159,7 @@ bool MESIInclusive::handleInv(MemEvent * event, bool inMSHR) {
     if (handle) {
         if (!inMSHR || mshr_->getProfiled(addr)) {
             stat_eventState[(int)Command::Inv][state]->addData(1);
-            recordPrefetchResult(line, statPrefetchInv);
+            recordPrefetchResult(line, statPrefetchInv, PREFETCH_USELESS);
             if (inMSHR) mshr_->setProfiled(addr);
         }
         if (line->hasSharers() && !inMSHR)
@@ -1278,7 +1278,7 @@ bool MESIInclusive::handleForceInv(MemEvent * event, bool inMSHR) {
 
     if ((handle || profile) && (!inMSHR || !mshr_->getProfiled(addr))) {
         stat_eventState[(int)Command::ForceInv][state]->addData(1);
-        recordPrefetchResult(line, statPrefetchInv);
+        recordPrefetchResult(line, statPrefetchInv, PREFETCH_USELESS);
         if (inMSHR || profile) mshr_->setProfiled(addr);
     }
 
@@ -1400,7 +1400,7 @@ bool MESIInclusive::handleFetchInv(MemEvent * event, bool inMSHR) {
 
     if ((handle || profile) && (!inMSHR || !mshr_->getProfiled(addr))) {
         stat_eventState[(int)Command::FetchInv][state]->addData(1);
-        recordPrefetchResult(line, statPrefetchInv);
+        recordPrefetchResult(line, statPrefetchInv, PREFETCH_USELESS);
         if (inMSHR || profile) mshr_->setProfiled(addr);
     }
 
@@ -1535,7 +1535,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     }
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    writeLineData(line, event->getPayload());
     line->setState(S);
 
     if (is_debug_addr(addr))
@@ -1584,7 +1584,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     switch (state) {
         case IS:
         {
-            line->setData(event->getPayload(), 0);
+            writeLineData(line, event->getPayload());
 
             if (event->getDirty())  {
                 line->setState(M); // Sometimes get dirty data from a noninclusive cache
@@ -1614,7 +1614,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
             break;
         }
         case IM:
-            line->setData(event->getPayload(), 0);
+            writeLineData(line, event->getPayload());
             if (is_debug_addr(line->getAddr()))
                 printDataValue(addr, line->getData(), true);
         case SM:
@@ -2028,9 +2028,21 @@ MemEventStatus MESIInclusive::processCacheMiss(MemEvent * event, SharedCacheLine
 
 SharedCacheLine * MESIInclusive::allocateLine(MemEvent * event, SharedCacheLine * line) {
     bool evicted = handleEviction(event->getBaseAddr(), line);
+
+    // A compressed set may need several victims to make room for a new line
+    while (evicted && cacheArray_->isSetFull(event->getBaseAddr())) {
+        notifyListenerOfEvict(line->getAddr(), lineSize_, event->getInstructionPointer());
+        cacheArray_->deallocate(line);
+        stat_compressionEvictions->addData(1);
+        line = nullptr;
+        evicted = handleEviction(event->getBaseAddr(), line);
+    }
+
     if (evicted) {
         notifyListenerOfEvict(line->getAddr(), lineSize_, event->getInstructionPointer());
         cacheArray_->replace(event->getBaseAddr(), line);
+        if (compressedArray_)
+            stat_compressionSetLines->addData(compressedArray_->getSetLines(event->getBaseAddr()));
         if (is_debug_event(event))
             printDebugAlloc(true, event->getBaseAddr(), "");
         return line;
@@ -2130,7 +2142,7 @@ bool MESIInclusive::handleEviction(Addr addr, SharedCacheLine *& line) {
         mshr_->insertWriteback(line->getAddr(), false);
     }
 
-    recordPrefetchResult(line, statPrefetchEvict);
+    recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
     return evict;
 }
 
@@ -2228,12 +2240,32 @@ void MESIInclusive::retry(Addr addr) {
 }
 
 
+void MESIInclusive::writeLineData(SharedCacheLine * line, vector<uint8_t> &data) {
+    line->setData(data, 0);
+    if (compressedArray_ && !data.empty())
+        stat_compressionLineBytes->addData(compressedArray_->updateData(line));
+}
+
+
+uint64_t MESIInclusive::getDataReadyTime(SharedCacheLine * line) {
+    uint64_t time = line->getTimestamp();
+    if (compressedArray_) {
+        uint64_t latency = compressedArray_->getDecompressionLatency(line);
+        if (latency != 0) {
+            stat_compressionDecompress->addData(1);
+            time = std::max(time, timestamp_) + latency;
+        }
+    }
+    return time;
+}
+
+
 State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State state) {
     State nState = state;
-    recordPrefetchResult(line, statPrefetchEvict);
+    recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
 
     if (event->getDirty()) {
-        line->setData(event->getPayload(), 0);
+        writeLineData(line, event->getPayload());
         if (is_debug_addr(event->getBaseAddr())) {
                 printDataValue(event->getBaseAddr(), line->getData(), true);
         }
@@ -2555,9 +2587,10 @@ void MESIInclusive::forwardByDestination(MemEventBase* ev, Cycle_t timestamp) {
  * Statistics and listeners
  ***********************************************************************************************************/
 
-void MESIInclusive::recordPrefetchResult(SharedCacheLine * line, Statistic<uint64_t> * stat) {
+void MESIInclusive::recordPrefetchResult(SharedCacheLine * line, Statistic<uint64_t> * stat, NotifyPrefetchResult result) {
     if (line->getPrefetch()) {
         stat->addData(1);
+        notifyListenerOfPrefetchResult(line->getAddr(), result);
         line->setPrefetch(false);
     }
 }
@@ -2681,7 +2714,7 @@ void MESIInclusive::processCompleteEvent(MemEventInit* event, MemLinkBase* highl
         }
     } else if (event->getCmd() == Command::Write ) {
         SharedCacheLine * line = cacheArray_->lookup(event->getAddr(), false);
-        line->setData(event->getPayload(), 0);
+        writeLineData(line, event->getPayload());
         line->setState(M); // Force a writeback of this data
     }
     delete event; // Nothing for now
@@ -242,6 +242,10 @@ public:
         {"prefetch_inv",            "Prefetched block was invalidated before being accessed", "count", 2},
         {"prefetch_coherence_miss", "Prefetched block incurred a coherence miss (upgrade) on its first access", "count", 2},
         {"prefetch_redundant",      "Prefetch issued for a block that was already in cache", "count", 2},
+        {"compression_line_bytes",  "Compressed cache: stored size of a line each time its data is updated. Line size over the average is the compression ratio", "bytes", 2},
+        {"compression_set_lines",   "Compressed cache: lines resident in the set at each allocation. The average over the associativity is the effective capacity multiplier", "count", 2},
+        {"compression_decompress",  "Compressed cache: hits that paid decompression latency", "count", 2},
+        {"compression_evictions",   "Compressed cache: lines evicted in addition to the first victim to make room in an oversubscribed set", "count", 2},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registerations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -267,9 +271,30 @@ public:
         uint64_t lines = params.find<uint64_t>("lines");
         uint64_t assoc = params.find<uint64_t>("associativity");
 
-        ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, false);
-        HashFunction * ht = createHashFunction(params);
-        cacheArray_ = new CacheArray<SharedCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
+        std::string compression = params.find<std::string>("compression", "none");
+        to_lower(compression);
+        LineCompressor::Algorithm alg;
+        compressedArray_ = nullptr;
+
+        if (compression == "none") {
+            ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, false);
+            HashFunction * ht = createHashFunction(params);
+            cacheArray_ = new CacheArray<SharedCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
+        } else if (LineCompressor::parseAlgorithm(compression, alg)) {
+            uint64_t tags = params.find<uint64_t>("compression_tags_per_way", 2);
+            uint32_t segment = params.find<uint32_t>("compression_segment_size", 8);
+            if (tags == 0)
+                debug->fatal(CALL_INFO, -1, "%s, Invalid param: compression_tags_per_way - must be at least 1.\n", getName().c_str());
+            ReplacementPolicy * rmgr = createReplacementPolicy(lines * tags, assoc * tags, params, false);
+            HashFunction * ht = createHashFunction(params);
+            compressedArray_ = new CompressedCacheArray<SharedCacheLine>(debug, lines, assoc, lineSize_, tags, segment, new LineCompressor(alg), rmgr, ht);
+            compressedArray_->setDecompressionLatency(LineCompressor::Encoding::BDI, params.find<uint64_t>("compression_bdi_latency_cycles", 1));
+            compressedArray_->setDecompressionLatency(LineCompressor::Encoding::FPC, params.find<uint64_t>("compression_fpc_latency_cycles", 5));
+            cacheArray_ = compressedArray_;
+        } else {
+            debug->fatal(CALL_INFO, -1, "%s, Invalid param: compression - valid options are 'none', 'bdi', 'fpc', or 'best'. You specified '%s'.\n",
+                    getName().c_str(), compression.c_str());
+        }
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
 
         /* Statistics */
@@ -446,6 +471,14 @@ public:
             statPrefetchRedundant = registerStatistic<uint64_t>("prefetch_redundant");
         }
 
+        /* Compression statistics */
+        if (compressedArray_) {
+            stat_compressionLineBytes = registerStatistic<uint64_t>("compression_line_bytes");
+            stat_compressionSetLines = registerStatistic<uint64_t>("compression_set_lines");
+            stat_compressionDecompress = registerStatistic<uint64_t>("compression_decompress");
+            stat_compressionEvictions = registerStatistic<uint64_t>("compression_evictions");
+        }
+
         /* Only for caches that expect writeback acks but we don't know yet so always enabled for now (can't register statistics later) */
         stat_eventState[(int)Command::AckPut][I] = registerStatistic<uint64_t>("stateEvent_AckPut_I");
 
@@ -602,13 +635,19 @@ private:
     /** Evict a block */
     State doEviction(MemEvent * event, SharedCacheLine * line, State state);
 
+    /** Write data into a line, updating its compressed size if the cache is compressed */
+    void writeLineData(SharedCacheLine * line, vector<uint8_t> &data);
+
+    /** Time at which a hit can return data from 'line', including decompression */
+    uint64_t getDataReadyTime(SharedCacheLine * line);
+
     /** Call through to coherenceController with statistic recording */
     void forwardByAddress(MemEventBase* ev, Cycle_t timestamp);
     void forwardByDestination(MemEventBase* ev, Cycle_t timestamp);
 
 /* Miscellaneous functions */
     /* Record prefetch statistics. Line cannot be null. */
-    void recordPrefetchResult(SharedCacheLine * line, Statistic<uint64_t> * stat);
+    void recordPrefetchResult(SharedCacheLine * line, Statistic<uint64_t> * stat, NotifyPrefetchResult result);
 
     /* Record latency */
     void recordLatency(Command cmd, int type, uint64_t latency);
@@ -620,6 +659,7 @@ private:
 
 /* Variables */
     CacheArray<SharedCacheLine> * cacheArray_;
+    CompressedCacheArray<SharedCacheLine> * compressedArray_; // Same as cacheArray_ if the cache is compressed, otherwise null
     State protocolState_;       // State to transition to on exclusive response to read/shared request
     bool protocol_;             // True for MESI, false for MSI
 
@@ -640,6 +680,10 @@ private:
     Statistic<uint64_t>* stat_miss[3][2];
     Statistic<uint64_t>* stat_hits;
     Statistic<uint64_t>* stat_misses;
+    Statistic<uint64_t>* stat_compressionLineBytes;
+    Statistic<uint64_t>* stat_compressionSetLines;
+    Statistic<uint64_t>* stat_compressionDecompress;
+    Statistic<uint64_t>* stat_compressionEvictions;
 };
 
 
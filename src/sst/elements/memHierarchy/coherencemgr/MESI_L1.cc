@@ -96,7 +96,7 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
                 stat_eventState[(int)Command::GetS][state]->addData(1);
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
-                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
+                notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT, line->getData());
             }
 
             if (localPrefetch) {
@@ -106,7 +106,7 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
                 break;
             }
 
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
 
             if (event->isLoadLink()) {
                 line->atomicStart(timestamp_ + llscBlockCycles_, event->getThreadID());
@@ -232,7 +232,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
                     stat_misses->addData(1);
                     mshr_->setProfiled(addr);
                 }
-                recordPrefetchResult(line, statPrefetchUpgradeMiss);
+                recordPrefetchResult(line, statPrefetchUpgradeMiss, PREFETCH_USEFUL);
 
                 sendTime = forwardMessage(event, lineSize_, 0, nullptr, Command::GetX);
                 line->setState(SM);
@@ -245,7 +245,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
         case E:
             line->setState(M);
         case M:
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
@@ -362,7 +362,7 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
                     stat_misses->addData(1);
                     mshr_->setProfiled(addr);
                 }
-                recordPrefetchResult(line, statPrefetchUpgradeMiss);
+                recordPrefetchResult(line, statPrefetchUpgradeMiss, PREFETCH_USEFUL);
 
                 sendTime = forwardMessage(event, lineSize_, 0, nullptr);
                 line->setState(SM);
@@ -374,7 +374,7 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
             break;
         case E:
         case M:
-            recordPrefetchResult(line, statPrefetchHit);
+            recordPrefetchResult(line, statPrefetchHit, PREFETCH_USEFUL);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
@@ -528,7 +528,7 @@ bool MESIL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     if (!mshr_->getProfiled(addr)) {
         stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
         if (line)
-            recordPrefetchResult(line, statPrefetchEvict);
+            recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
         mshr_->setProfiled(addr);
     }
 
@@ -778,7 +778,7 @@ bool MESIL1::handleInv(MemEvent* event, bool inMSHR) {
 
     stat_eventState[(int)Command::Inv][state]->addData(1);
     if (line)
-        recordPrefetchResult(line, statPrefetchInv);
+        recordPrefetchResult(line, statPrefetchInv, PREFETCH_USELESS);
 
     switch (state) {
         case S:
@@ -878,7 +878,7 @@ bool MESIL1::handleForceInv(MemEvent* event, bool inMSHR) {
 
     stat_eventState[(int)Command::ForceInv][state]->addData(1);
     if (line) {
-        recordPrefetchResult(line, statPrefetchInv);
+        recordPrefetchResult(line, statPrefetchInv, PREFETCH_USELESS);
 
         if (is_debug_event(event)) {
             eventDI.newst = line->getState();
@@ -958,7 +958,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
     stat_eventState[(int)Command::FetchInv][state]->addData(1);
 
     if (line) {
-        recordPrefetchResult(line, statPrefetchInv);
+        recordPrefetchResult(line, statPrefetchInv, PREFETCH_USELESS);
 
         if (is_debug_event(event)) {
             eventDI.newst = line->getState();
@@ -1497,7 +1497,7 @@ bool MESIL1::handleEviction(Addr addr, L1CacheLine*& line, bool flush) {
     }
 
     line->atomicEnd();
-    recordPrefetchResult(line, statPrefetchEvict);
+    recordPrefetchResult(line, statPrefetchEvict, PREFETCH_USELESS);
     return true;
 }
 
@@ -1789,9 +1789,10 @@ void MESIL1::forwardByDestination(MemEventBase* ev, Cycle_t ts) {
  ***********************************************************************************************************/
 
 /* Record result of a prefetch. Important: assumes line is not null */
-void MESIL1::recordPrefetchResult(L1CacheLine* line, Statistic<uint64_t>* stat) {
+void MESIL1::recordPrefetchResult(L1CacheLine* line, Statistic<uint64_t>* stat, NotifyPrefetchResult result) {
     if (line->getPrefetch()) {
         stat->addData(1);
+        notifyListenerOfPrefetchResult(line->getAddr(), result);
         line->setPrefetch(false);
     }
 }
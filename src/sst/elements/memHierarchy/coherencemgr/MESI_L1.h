@@ -444,7 +444,7 @@ private:
     void forwardByDestination(MemEventBase* ev, Cycle_t timestamp);
 
     /** Statistics/Listeners */
-    inline void recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t>* stat);
+    inline void recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t>* stat, NotifyPrefetchResult result);
     void recordLatency(Command cmd, int type, uint64_t latency);
     void eventProfileAndNotify(MemEvent * event, State state, NotifyAccessType type, NotifyResultType result, bool inMSHR);
 
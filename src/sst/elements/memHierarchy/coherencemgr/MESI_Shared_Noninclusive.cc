@@ -103,7 +103,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 break;
             }
 
-            recordPrefetchResult(tag, statPrefetchHit);
+            recordPrefetchResult(tag, statPrefetchHit, PREFETCH_USEFUL);
 
             if (data || mshr_->hasData(addr)) {
                 tag->addSharer(event->getSrc());
@@ -151,7 +151,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 break;
             }
 
-            recordPrefetchResult(tag, statPrefetchHit);
+            recordPrefetchResult(tag, statPrefetchHit, PREFETCH_USEFUL);
 
             if (tag->hasOwner()) {
                 if (!inMSHR) {
@@ -274,7 +274,7 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                         notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                         mshr_->setProfiled(addr);
                     }
-                    recordPrefetchResult(tag, statPrefetchUpgradeMiss);
+                    recordPrefetchResult(tag, statPrefetchUpgradeMiss, PREFETCH_USEFUL);
                     recordLatencyType(event->getID(), LatType::UPGRADE);
 
                     sendTime = forwardMessage(event, lineSize_, 0, nullptr);
@@ -1456,7 +1456,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    recordPrefetchResult(tag, statPrefetchInv);
+                    recordPrefetchResult(tag, statPrefetchInv, PREFETCH_USELESS);
                     stat_eventState[(int)Command::Inv][state]->addData(1);
                     if (inMSHR) mshr_->setProfiled(addr);
                 }
@@ -1605,7 +1605,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    recordPrefetchResult(tag, statPrefetchInv);
+                    recordPrefetchResult(tag, statPrefetchInv, PREFETCH_USELESS);
                     stat_eventState[(int)Command::ForceInv][state]->addData(1);
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
@@ -1633,7 +1633,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     stat_eventState[(int)Command::ForceInv][state]->addData(1);
-                    recordPrefetchResult(tag, statPrefetchInv);
+                    recordPrefetchResult(tag, statPrefetchInv, PREFETCH_USELESS);
                 }
                 if (tag->hasSharers()) {
                     if (!applyPendingReplacement(addr))
@@ -1792,7 +1792,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    recordPrefetchResult(tag, statPrefetchInv);
+                    recordPrefetchResult(tag, statPrefetchInv, PREFETCH_USELESS);
                     stat_eventState[(int)Command::FetchInv][state]->addData(1);
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
@@ -1824,7 +1824,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     stat_eventState[(int)Command::FetchInv][state]->addData(1);
                     if (tag->hasOwner() || tag->hasSharers()) mshr_->setProfiled(addr);
-                    recordPrefetchResult(tag, statPrefetchInv);
+                    recordPrefetchResult(tag, statPrefetchInv, PREFETCH_USELESS);
                 }
                 if (applyPendingReplacement(addr)) {
                     state == E ? tag->setState(E_Inv) : tag->setState(M_Inv);
@@ -2926,7 +2926,7 @@ bool MESISharNoninclusive::handleDirEviction(Addr addr, DirectoryLine*& tag) {
         mshr_->insertWriteback(tag->getAddr(), false);
     }
 
-    recordPrefetchResult(tag, statPrefetchEvict);
+    recordPrefetchResult(tag, statPrefetchEvict, PREFETCH_USELESS);
     return evict;
 }
 
@@ -2958,7 +2958,7 @@ bool MESISharNoninclusive::handleDataEviction(Addr addr, DataLine *&data) {
                     sendWritebackFromCache(Command::PutS, tag, data, false);
                     if (recvWritebackAck_)
                         mshr_->insertWriteback(tag->getAddr(), false);
-                    recordPrefetchResult(tag, statPrefetchEvict);
+                    recordPrefetchResult(tag, statPrefetchEvict, PREFETCH_USELESS);
                     notifyListenerOfEvict(data->getAddr(), lineSize_, 0);
                     tag->setState(I);
                     dirArray_->deallocate(tag);
@@ -2979,7 +2979,7 @@ bool MESISharNoninclusive::handleDataEviction(Addr addr, DataLine *&data) {
                     sendWritebackFromCache(Command::PutE, tag, data, false);
                     if (recvWritebackAck_)
                         mshr_->insertWriteback(tag->getAddr(), false);
-                    recordPrefetchResult(tag, statPrefetchEvict);
+                    recordPrefetchResult(tag, statPrefetchEvict, PREFETCH_USELESS);
                     notifyListenerOfEvict(data->getAddr(), lineSize_, 0);
                     tag->setState(I);
                     dirArray_->deallocate(tag);
@@ -3001,7 +3001,7 @@ bool MESISharNoninclusive::handleDataEviction(Addr addr, DataLine *&data) {
                     sendWritebackFromCache(Command::PutM, tag, data, true);
                     if (recvWritebackAck_)
                         mshr_->insertWriteback(tag->getAddr(), false);
-                    recordPrefetchResult(tag, statPrefetchEvict);
+                    recordPrefetchResult(tag, statPrefetchEvict, PREFETCH_USELESS);
                     notifyListenerOfEvict(data->getAddr(), lineSize_, 0);
                     tag->setState(I);
                     dirArray_->deallocate(tag);
@@ -3533,9 +3533,10 @@ void MESISharNoninclusive::removeOwnerViaInv(MemEvent * event, DirectoryLine * t
     }
 }
 
-void MESISharNoninclusive::recordPrefetchResult(DirectoryLine * tag, Statistic<uint64_t> * stat) {
+void MESISharNoninclusive::recordPrefetchResult(DirectoryLine * tag, Statistic<uint64_t> * stat, NotifyPrefetchResult result) {
     if (tag->getPrefetch()) {
         stat->addData(1);
+        notifyListenerOfPrefetchResult(tag->getAddr(), result);
         tag->setPrefetch(false);
     }
 }
@@ -654,7 +654,7 @@ private:
 
 /* Statistics */
     void recordLatency(Command cmd, int type, uint64_t latency) override;
-    void recordPrefetchResult(DirectoryLine * line, Statistic<uint64_t> * stat);
+    void recordPrefetchResult(DirectoryLine * line, Statistic<uint64_t> * stat, NotifyPrefetchResult result);
 
 /* Private data members */
     CacheArray<DataLine>* dataArray_;
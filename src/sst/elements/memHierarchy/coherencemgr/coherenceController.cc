@@ -28,6 +28,9 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
     /* Output stream */
     output = new Output("", 1, 0, SST::Output::STDOUT);
 
+    sampling_ = nullptr;
+    warming_ = false;
+
     /* Debug stream */
     debug = new Output("", params.find<int>("debug_level", 1), 0, (Output::output_location_t)params.find<int>("debug", SST::Output::NONE));
 
@@ -384,7 +387,7 @@ bool CoherenceController::sendOutgoingEvents() {
         }
 
         linkDown_->send(outgoingEvent);
-        outgoingEventQueueDown_.pop_front();
+        outgoingEventQueueDown_.pop();
 
     }
 
@@ -410,21 +413,56 @@ bool CoherenceController::sendOutgoingEvents() {
         if (startTimes_.find(outgoingEvent->getResponseToID()) != startTimes_.end()) {
             LatencyStat stat = startTimes_.find(outgoingEvent->getResponseToID())->second;
             recordLatency(stat.cmd, stat.missType, timestamp_ - stat.time);
+            if (sampling_)
+                sampling_->recordLatency(timestamp_ - stat.time);
             startTimes_.erase(outgoingEvent->getResponseToID());
         }
 
         linkUp_->send(outgoingEvent);
-        outgoingEventQueueUp_.pop_front();
+        outgoingEventQueueUp_.pop();
     }
 
     // Return whether it's ok for the cache to turn off the clock - we need it on to be able to send waiting events
     return outgoingEventQueueDown_.empty() && outgoingEventQueueUp_.empty();
 }
 
+void CoherenceController::setWarming(bool warming) {
+    if (warming == warming_) return;
+    warming_ = warming;
+
+    if (warming) {
+        detailedAccessLatency_ = accessLatency_;
+        detailedTagLatency_ = tagLatency_;
+        detailedMshrLatency_ = mshrLatency_;
+        detailedMaxBytesUp_ = maxBytesUp;
+        detailedMaxBytesDown_ = maxBytesDown;
+        accessLatency_ = std::min(accessLatency_, (uint64_t)1);
+        tagLatency_ = std::min(tagLatency_, (uint64_t)1);
+        mshrLatency_ = std::min(mshrLatency_, (uint64_t)1);
+        maxBytesUp = 0;
+        maxBytesDown = 0;
+    } else {
+        accessLatency_ = detailedAccessLatency_;
+        tagLatency_ = detailedTagLatency_;
+        mshrLatency_ = detailedMshrLatency_;
+        maxBytesUp = detailedMaxBytesUp_;
+        maxBytesDown = detailedMaxBytesDown_;
+    }
+}
+
 bool CoherenceController::checkIdle() {
     return outgoingEventQueueDown_.empty() && outgoingEventQueueUp_.empty();
 }
 
+uint64_t CoherenceController::getNextDeliveryTime() {
+    uint64_t next = std::numeric_limits<uint64_t>::max();
+    if (!outgoingEventQueueDown_.empty())
+        next = outgoingEventQueueDown_.front().deliveryTime;
+    if (!outgoingEventQueueUp_.empty())
+        next = std::min(next, outgoingEventQueueUp_.front().deliveryTime);
+    return next;
+}
+
 
 /* Forward an event using memory address to locate a destination. */
 void CoherenceController::forwardByAddress(MemEventBase * event) {
@@ -592,12 +630,13 @@ void CoherenceController::clearRetryBuffer() {
 
 
 /* Listener callbacks */
-void CoherenceController::notifyListenerOfAccess(MemEvent * event, NotifyAccessType accessT, NotifyResultType resultT) {
+void CoherenceController::notifyListenerOfAccess(MemEvent * event, NotifyAccessType accessT, NotifyResultType resultT, vector<uint8_t>* data) {
     if (event->isPrefetch())
         accessT = NotifyAccessType::PREFETCH;
 
     CacheListenerNotification notify(event->getAddr(), event->getBaseAddr(), event->getVirtualAddress(),
             event->getInstructionPointer(), event->getSize(), accessT, resultT);
+    notify.setData(data);
 
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->notifyAccess(notify);
@@ -613,6 +652,12 @@ void CoherenceController::notifyListenerOfEvict(Addr addr, uint32_t size, Addr i
 }
 
 
+void CoherenceController::notifyListenerOfPrefetchResult(Addr addr, NotifyPrefetchResult result) {
+    for (int i = 0; i < listeners_.size(); i++)
+        listeners_[i]->notifyPrefetchResult(addr, result);
+}
+
+
 /* Forward a message to a lower level (towards memory) in the hierarchy */
 uint64_t CoherenceController::forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, vector<uint8_t>* data, Command fwdCmd) {
     /* Create event to be forwarded */
@@ -741,6 +786,13 @@ MemEventStatus CoherenceController::allocateMSHR(MemEvent * event, bool fwdReq,
         }
         if (event->isPrefetch() && event->getRqstr() == cachename_) {
             outstandingPrefetches_++;
+        } else if (!listeners_.empty() && mshr_->getFrontType(event->getBaseAddr()) == MSHREntryType::Event) {
+            // A demand request waiting on our own prefetch means the prefetch was late
+            MemEvent * front = dynamic_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
+            if (front && front->isPrefetch() && front->getRqstr() == cachename_) {
+                for (int i = 0; i < listeners_.size(); i++)
+                    listeners_[i]->notifyPrefetchResult(event->getBaseAddr(), PREFETCH_LATE);
+            }
         }
         return MemEventStatus::Stall;
     }
@@ -832,14 +884,14 @@ void CoherenceController::printStatus(Output& out) {
     out.output("  Begin MemHierarchy::CoherenceController %s\n", getName().c_str());
 
     out.output("    Events waiting in outgoingEventQueueDown: %zu\n", outgoingEventQueueDown_.size());
-    for (list<Response>::iterator it = outgoingEventQueueDown_.begin(); it!= outgoingEventQueueDown_.end(); it++) {
-        out.output("      Time: %" PRIu64 ", Event: %s\n", (*it).deliveryTime, (*it).event->getVerboseString().c_str());
-    }
+    outgoingEventQueueDown_.forEach([&out](Response& resp) {
+        out.output("      Time: %" PRIu64 ", Event: %s\n", resp.deliveryTime, resp.event->getVerboseString().c_str());
+    });
 
     out.output("    Events waiting in outgoingEventQueueUp: %zu\n", outgoingEventQueueUp_.size());
-    for (list<Response>::iterator it = outgoingEventQueueUp_.begin(); it!= outgoingEventQueueUp_.end(); it++) {
-        out.output("      Time: %" PRIu64 ", Event: %s\n", (*it).deliveryTime, (*it).event->getVerboseString().c_str());
-    }
+    outgoingEventQueueUp_.forEach([&out](Response& resp) {
+        out.output("      Time: %" PRIu64 ", Event: %s\n", resp.deliveryTime, resp.event->getVerboseString().c_str());
+    });
 
     out.output("  End MemHierarchy::CoherenceController\n");
 }
@@ -856,26 +908,130 @@ void CoherenceController::printStatus(Output& out) {
  * a block and then re-request it, the requests can get inverted.
  */
 void CoherenceController::addToOutgoingQueue(Response& resp) {
-    list<Response>::reverse_iterator rit;
-    for (rit = outgoingEventQueueDown_.rbegin(); rit!= outgoingEventQueueDown_.rend(); rit++) {
-        if (resp.deliveryTime >= (*rit).deliveryTime) break;
-        if (resp.event->getRoutingAddress() == (*rit).event->getRoutingAddress()) break;
-    }
-    outgoingEventQueueDown_.insert(rit.base(), resp);
+    outgoingEventQueueDown_.insert(resp);
 }
 
 /* Add a new event to the outgoing queue up (towards memory)
  * Again, to do not reorder events to the same address
  */
 void CoherenceController::addToOutgoingQueueUp(Response& resp) {
-    list<Response>::reverse_iterator rit;
-    for (rit = outgoingEventQueueUp_.rbegin(); rit != outgoingEventQueueUp_.rend(); rit++) {
-        if (resp.deliveryTime >= (*rit).deliveryTime) break;
-        if (resp.event->getRoutingAddress() == (*rit).event->getRoutingAddress()) break;
+    outgoingEventQueueUp_.insert(resp);
+}
+
+/* Insert an event where a backwards walk of a delivery-ordered list would:
+ * after the newest event that is due no later than this one or that targets the same address.
+ * Buckets older than the delivery time only hold events that are due by then, so the walk
+ * only visits buckets newer than the delivery time and skips those that cannot hold a stopping point.
+ */
+void CoherenceController::OutgoingQueue::insert(Response& resp) {
+    uint64_t time = resp.deliveryTime;
+    Addr addr = resp.event->getRoutingAddress();
+    std::unordered_map<Addr, std::pair<uint64_t, size_t> >::iterator addrIt = addrs_.find(addr);
+    bool addrQueued = addrIt != addrs_.end();
+
+    const size_t append = std::numeric_limits<size_t>::max();
+    uint64_t cycle = time;          // Bucket to insert into
+    size_t index = append;          // Position in bucket
+
+    if (size_ != 0) {
+        for (uint64_t b = top_; ; b--) {
+            Bucket& bucket = slot(b);
+            if (!bucket.empty()) {
+                if (b <= time) break; // Everything here is due by 'time', append to bucket 'time'
+                if (bucket.minTime <= time || (addrQueued && addrIt->second.first == b)) {
+                    for (size_t i = bucket.events.size(); i > bucket.head; i--) {
+                        Response& queued = bucket.events[i-1];
+                        if (time >= queued.deliveryTime || addr == queued.event->getRoutingAddress()) {
+                            cycle = b;
+                            index = i;
+                            break;
+                        }
+                    }
+                    if (index != append) break;
+                }
+            }
+            if (b == base_) break; // Passed every event, this one goes first
+        }
+    }
+
+    if (size_ == 0) {
+        base_ = top_ = cycle;
+    } else if (cycle < base_ || cycle > top_) {
+        uint64_t low = std::min(base_, cycle);
+        uint64_t high = std::max(top_, cycle);
+        if (high - low >= wheel_.size())
+            resize(low, high);
+        base_ = low;
+        top_ = high;
+    }
+
+    Bucket& bucket = slot(cycle);
+    if (index == append || index == bucket.events.size()) {
+        bucket.events.push_back(resp);
+    } else {
+        bucket.events.insert(bucket.events.begin() + index, resp);
+    }
+    bucket.minTime = std::min(bucket.minTime, time);
+    size_++;
+
+    // Nothing to this address can be queued behind the new event
+    if (addrQueued) {
+        addrIt->second.first = cycle;
+        addrIt->second.second++;
+    } else {
+        addrs_.insert(std::make_pair(addr, std::make_pair(cycle, (size_t)1)));
     }
-    outgoingEventQueueUp_.insert(rit.base(), resp);
 }
 
+CoherenceController::Response& CoherenceController::OutgoingQueue::front() {
+    while (slot(base_).empty())
+        base_++;
+    Bucket& bucket = slot(base_);
+    return bucket.events[bucket.head];
+}
+
+void CoherenceController::OutgoingQueue::pop() {
+    Response& resp = front();
+    std::unordered_map<Addr, std::pair<uint64_t, size_t> >::iterator addrIt = addrs_.find(resp.event->getRoutingAddress());
+    if (--(addrIt->second.second) == 0)
+        addrs_.erase(addrIt);
+
+    Bucket& bucket = slot(base_);
+    bucket.head++;
+    if (bucket.empty()) {
+        if (bucket.events.capacity() > maxBucketCapacity)
+            std::vector<Response>().swap(bucket.events);
+        else
+            bucket.events.clear();
+        bucket.head = 0;
+        bucket.minTime = std::numeric_limits<uint64_t>::max();
+    }
+    size_--;
+
+    /* Shrink after a burst. Waiting until the span is a quarter of the wheel
+     * leaves it half full, so it does not resize back and forth. */
+    if (wheel_.size() > minBuckets) {
+        if (size_ == 0) {
+            std::vector<Bucket>(minBuckets).swap(wheel_);
+        } else if ((top_ - base_ + 1) * 4 <= wheel_.size()) {
+            resize(base_, top_);
+        }
+    }
+}
+
+/* Resize the wheel to the smallest power of two that is at least minBuckets
+ * and twice the span of buckets 'low' through 'high' */
+void CoherenceController::OutgoingQueue::resize(uint64_t low, uint64_t high) {
+    size_t wheelSize = minBuckets;
+    while ((high - low + 1) * 2 > wheelSize)
+        wheelSize *= 2;
+
+    std::vector<Bucket> wheel(wheelSize);
+    for (uint64_t cycle = base_; cycle <= top_; cycle++) {
+        wheel[cycle & (wheelSize - 1)] = std::move(slot(cycle));
+    }
+    wheel_.swap(wheel);
+}
 
 /* Return whether the component is a peer */
 bool CoherenceController::isPeer(std::string name) {
@@ -17,6 +17,8 @@
 #define MEMHIERARCHY_COHERENCECONTROLLER_H
 
 #include <array>
+#include <limits>
+#include <unordered_map>
 
 #include <sst/core/sst_config.h>
 #include <sst/core/subcomponent.h>
@@ -32,6 +34,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
+#include "sst/elements/memHierarchy/sampling.h"
 
 namespace SST { namespace MemHierarchy {
 using namespace std;
@@ -42,6 +45,8 @@ namespace LatType {
 
 class CoherenceController : public SST::SubComponent {
 
+    friend class OutgoingQueueTest; /* Checks OutgoingQueue */
+
 public:
     /* Args: Params& extraParams, bool prefetch */
     SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::CoherenceController, Params&, bool)
@@ -118,6 +123,9 @@ public:
     /* Check whether the event queues are empty/subcomponent is doing anything */
     bool checkIdle();
 
+    /* Earliest time at which a queued outgoing event can be sent, or max uint64_t if none are queued */
+    uint64_t getNextDeliveryTime();
+
     /* Get which bank an address maps to (call through to cache array) */
     virtual Addr getBank(Addr addr) = 0;
 
@@ -178,6 +186,10 @@ public:
     /* Setup debug info (cache-wide) */
     void setDebug(std::set<Addr> debugAddr) { DEBUG_ADDR = debugAddr; }
 
+    /* Statistical sampling - during functional warming, use minimal latencies and unlimited link widths */
+    void setSamplingController(SamplingController* sampling) { sampling_ = sampling; }
+    void setWarming(bool warming);
+
     /* Retry buffer - parent drains this each cycle */
     std::vector<MemEventBase*>* getRetryBuffer();
     void clearRetryBuffer();
@@ -208,9 +220,12 @@ protected:
      *********************************************************************************/
 
     /* Listener callbacks */
-    virtual void notifyListenerOfAccess(MemEvent * event, NotifyAccessType accessT, NotifyResultType resultT);
+    virtual void notifyListenerOfAccess(MemEvent * event, NotifyAccessType accessT, NotifyResultType resultT, vector<uint8_t>* data = nullptr);
     virtual void notifyListenerOfEvict(Addr addr, uint32_t size, uint64_t ip);
 
+    /* Report the outcome of a prefetched line to listeners */
+    void notifyListenerOfPrefetchResult(Addr addr, NotifyPrefetchResult result);
+
     /* Forward a message to a lower memory level (towards memory) */
     uint64_t forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, vector<uint8_t>* data, Command fwdCmd = Command::LAST_CMD);
 
@@ -319,6 +334,56 @@ protected:
         uint64_t size;          // Size of event (for bandwidth accounting)
     };
 
+    /* Outgoing event queue
+     * A timing wheel of buckets, one per cycle. Events are kept in the order a list sorted by
+     * delivery time would hold them, except that an event never passes an earlier event to the
+     * same address. An event behind a later-delivered event to its address goes into that event's bucket.
+     * Inserting into the newest bucket and popping from the oldest are constant time.
+     * The wheel grows to span the queued delivery times and shrinks again as a burst drains.
+     */
+    class OutgoingQueue {
+    public:
+        static const size_t minBuckets = 64;
+        static const size_t maxBucketCapacity = 16;  // Larger buckets free their memory once drained
+
+        OutgoingQueue() : base_(0), top_(0), size_(0) { wheel_.resize(minBuckets); }
+
+        void insert(Response& resp);
+        Response& front();
+        void pop();
+
+        bool empty() const { return size_ == 0; }
+        size_t size() const { return size_; }
+        size_t buckets() const { return wheel_.size(); }
+
+        template<typename F>
+        void forEach(F fcn) {
+            if (size_ == 0) return;
+            for (uint64_t cycle = base_; cycle <= top_; cycle++) {
+                Bucket& bucket = slot(cycle);
+                for (size_t i = bucket.head; i < bucket.events.size(); i++)
+                    fcn(bucket.events[i]);
+            }
+        }
+
+    private:
+        struct Bucket {
+            std::vector<Response> events;   // Events in send order, from 'head'
+            size_t head = 0;
+            uint64_t minTime = std::numeric_limits<uint64_t>::max(); // Lower bound on delivery times in bucket
+            bool empty() const { return head == events.size(); }
+        };
+
+        Bucket& slot(uint64_t cycle) { return wheel_[cycle & (wheel_.size() - 1)]; }
+        void resize(uint64_t low, uint64_t high);
+
+        std::vector<Bucket> wheel_;     // Power-of-two number of buckets
+        uint64_t base_;                 // Oldest bucket that may hold events
+        uint64_t top_;                  // Newest bucket holding events
+        size_t size_;
+        std::unordered_map<Addr, std::pair<uint64_t, size_t> > addrs_; // Address -> bucket of its newest event, number of events
+    };
+
     /* Retry buffer - filled by coherence manangers and drained by parent */
     std::vector<MemEventBase*> retryBuffer_;
 
@@ -358,8 +423,8 @@ protected:
 
 private:
     /* Outgoing event queues - events are stalled here to account for access latencies */
-    list<Response> outgoingEventQueueDown_;
-    list<Response> outgoingEventQueueUp_;
+    OutgoingQueue outgoingEventQueueDown_;
+    OutgoingQueue outgoingEventQueueUp_;
 
     MemLinkBase * linkUp_;
     MemLinkBase * linkDown_;
@@ -375,6 +440,15 @@ protected:
     uint64_t maxBytesDown;
     uint64_t packetHeaderBytes;
 
+    /* Statistical sampling, detailed timing parameters are saved here during functional warming */
+    SamplingController* sampling_;
+    bool warming_;
+    uint64_t detailedAccessLatency_;
+    uint64_t detailedTagLatency_;
+    uint64_t detailedMshrLatency_;
+    uint64_t detailedMaxBytesUp_;
+    uint64_t detailedMaxBytesDown_;
+
     /* Prefetch statistics */
     Statistic<uint64_t>* statPrefetchEvict;
     Statistic<uint64_t>* statPrefetchInv;
@@ -143,6 +143,8 @@ void CoherentMemController::handleEvent(SST::Event* event) {
 
     MemEventBase * ev = static_cast<MemEventBase*>(event);
 
+    sampling_->update(getCurrentSimTimeNano());
+
     if (is_debug_event(ev)) {
         Debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:New     (%s)\n",
                 getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
@@ -194,6 +196,8 @@ void CoherentMemController::handleRequest(MemEvent * ev) {
     }
 
     outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, ev->getBaseAddr())));
+    if (sampling_->isEnabled()) /* Latency includes waiting in the MSHR */
+        sampleStartTimes_.insert(std::make_pair(ev->getID(), getNextClockCycle(clockTimeBase_) - 1));
     notifyListeners(ev);
 
     if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
@@ -201,6 +205,11 @@ void CoherentMemController::handleRequest(MemEvent * ev) {
         if (!ev->queryFlag(MemEventBase::F_NONCACHEABLE)) {
             cacheStatus_.at(ev->getBaseAddr()/lineSize_) = true;
         }
+        if (sampling_->isWarming() && outstandingEventList_.size() == 1) {
+            // Functional warming: update the backing store and respond now
+            handleMemResponse(ev->getID(), 0);
+            return;
+        }
         if (is_debug_event(ev)) {
             Debug(_L4_, "B: %-20" PRIu64 " %-20" PRIu64 " %-20s Bkend:Send    (%s)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
@@ -244,11 +253,17 @@ void CoherentMemController::handleReplacement(MemEvent * ev) {
     ev->setFlag(MemEventBase::F_NORESPONSE);
 
     outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, ev->getBaseAddr())));
+    if (sampling_->isEnabled()) /* Latency includes waiting in the MSHR */
+        sampleStartTimes_.insert(std::make_pair(ev->getID(), getNextClockCycle(clockTimeBase_) - 1));
     notifyListeners(ev);
 
     if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
         mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1, MSHREntry(ev->getID(), ev->getCmd()))));
         cacheStatus_.at(ev->getBaseAddr()/lineSize_) = directory_;
+        if (sampling_->isWarming() && outstandingEventList_.size() == 1) {
+            handleMemResponse(ev->getID(), 0);
+            return;
+        }
         if (is_debug_event(ev)) {
             Debug(_L4_, "B: %-20" PRIu64 " %-20" PRIu64 " %-20s Bkend:Send    (%s)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
@@ -306,7 +321,7 @@ void CoherentMemController::handleFlush(MemEvent * ev) {
                     MemEvent * resp = new MemEvent(ev->getSrc(), ev->getBaseAddr(), ev->getBaseAddr(), Command::AckInv);
                     if (ev->getPayloadSize() != 0) {
                         resp->setDirty(ev->getDirty());
-                        resp->setPayload(ev->getPayload());
+                        resp->setPayload(std::move(ev->getPayload()));
                         ev->setPayload(0, nullptr);
                         ev->setDirty(false);
                         handleFetchResp(resp);
@@ -529,6 +544,15 @@ void CoherentMemController::handleMemResponse(SST::Event::id_type id, uint32_t f
       dbg.fatal(CALL_INFO, -1, "Coherent Memory controller (%s) received unrecgonized response ID: %" PRIu64 ", %" PRIu32 "", getName().c_str(), id.first, id.second);
     }
 
+    if (sampling_->isEnabled()) {
+        sampling_->update(getCurrentSimTimeNano());
+        std::map<SST::Event::id_type, Cycle_t>::iterator st = sampleStartTimes_.find(id);
+        if (st != sampleStartTimes_.end()) {
+            sampling_->recordLatency(getNextClockCycle(clockTimeBase_) - 1 - st->second);
+            sampleStartTimes_.erase(st);
+        }
+    }
+
     if (outstandingEventList_.find(id)->second.request->getCmd() == Command::CustomReq) {
         finishCustomReq(id, flags);
     } else {
@@ -104,6 +104,32 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
                 getName().c_str(), ilStep.c_str());
     }
 
+    /* Slices of a distributed directory. 'rr' fills in the interleaving if no region was given, 'xor' adds a hash to the region */
+    uint32_t numSlices = params.find<uint32_t>("num_slices", 1);
+    uint32_t sliceID = params.find<uint32_t>("slice_id", 0);
+    std::string slicePolicy = params.find<std::string>("slice_allocation_policy", "rr");
+    if (numSlices == 0)
+        dbg.fatal(CALL_INFO, -1, "%s, Invalid param: num_slices - should be 1 or greater.\n", getName().c_str());
+    if (numSlices > 1) {
+        if (sliceID >= numSlices)
+            dbg.fatal(CALL_INFO, -1, "%s, Invalid param: slice_id - should be between 0 and num_slices-1. You specified %" PRIu32 ".\n", getName().c_str(), sliceID);
+        if (slicePolicy == "rr") {
+            if (!gotRegion) {
+                region.start = sliceID * cacheLineSize;
+                region.interleaveSize = cacheLineSize;
+                region.interleaveStep = numSlices * cacheLineSize;
+            }
+        } else if (slicePolicy == "xor") {
+            if (!isPowerOfTwo(numSlices))
+                dbg.fatal(CALL_INFO, -1, "%s, Invalid param: num_slices - must be a power of two when slice_allocation_policy is 'xor'. You specified %" PRIu32 ".\n", getName().c_str(), numSlices);
+            region.setHash(numSlices, sliceID, cacheLineSize);
+        } else {
+            dbg.fatal(CALL_INFO, -1, "%s, Invalid param: slice_allocation_policy - supported policies are 'rr' (round-robin) and 'xor' (XOR hash). You specified '%s'.\n",
+                    getName().c_str(), slicePolicy.c_str());
+        }
+        gotRegion = true;
+    }
+
     clockHandler = new Clock::Handler<DirectoryController>(this, &DirectoryController::clock);
     defaultTimeBase = registerClock(params.find<std::string>("clock", "1GHz"), clockHandler);
     clockOn = true;
@@ -256,6 +282,13 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
             // No linkDown_, traffic to/from memory will use the linkUp_
             linkDown_ = nullptr;
         }
+
+        // The hash cannot be given to the links as parameters
+        if (region.hashSlices != 0) {
+            linkUp_->setRegion(region);
+            if (linkDown_)
+                linkDown_->setRegion(region);
+        }
     }
 
     if (linkDown_)
@@ -367,6 +400,10 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     accessLatency   = params.find<uint64_t>("access_latency_cycles", 0);
     mshrLatency     = params.find<uint64_t>("mshr_latency_cycles", 0);
 
+    sampling = new SamplingController(params, &out, getName());
+    if (sampling->isEnabled())
+        sampling->setStatistics(registerStatistic<double>("sampled_window_latency"), registerStatistic<double>("sampled_window_throughput"));
+
     flush_state_ = FlushState::Ready;
 }
 
@@ -415,6 +452,9 @@ void DirectoryController::handlePacket(SST::Event *event){
  */
 bool DirectoryController::clock(SST::Cycle_t cycle){
     timestamp = cycle;
+
+    if (sampling->update(getCurrentSimTimeNano()))
+        setWarming(sampling->isWarming());
     stat_MSHROccupancy->addData(mshr->getSize());
 
     sendOutgoingEvents();
@@ -794,9 +834,25 @@ void DirectoryController::complete(unsigned int phase) {
 
 
 void DirectoryController::finish(void){
+    sampling->finish(getCurrentSimTimeNano());
     linkUp_->finish();
 }
 
+void DirectoryController::setWarming(bool warming) {
+    if (warming) {
+        detailedAccessLatency = accessLatency;
+        detailedMshrLatency = mshrLatency;
+        detailedMaxRequestsPerCycle = maxRequestsPerCycle;
+        accessLatency = 0;
+        mshrLatency = 0;
+        maxRequestsPerCycle = 0;
+    } else {
+        accessLatency = detailedAccessLatency;
+        mshrLatency = detailedMshrLatency;
+        maxRequestsPerCycle = detailedMaxRequestsPerCycle;
+    }
+}
+
 
 void DirectoryController::setup(void){
     linkUp_->setup();
@@ -2706,9 +2762,10 @@ void DirectoryController::sendOutgoingEvents() {
                     getCurrentSimCycle(), timestamp, getName().c_str(), ev->getBriefString().c_str());
         }
         if (startTimes.find(ev->getResponseToID()) != startTimes.end()) {
-            if (CommandClassArr[(int)ev->getCmd()] == CommandClass::Data)
+            if (CommandClassArr[(int)ev->getCmd()] == CommandClass::Data) {
                 stat_getRequestLatency->addData(timestamp - startTimes.find(ev->getResponseToID())->second); // GetS, GetX, GetSX
-            else
+                sampling->recordLatency(timestamp - startTimes.find(ev->getResponseToID())->second);
+            } else
                 stat_replacementRequestLatency->addData(timestamp - startTimes.find(ev->getResponseToID())->second); // Put*, FlushLine*
             startTimes.erase(ev->getResponseToID());
         }
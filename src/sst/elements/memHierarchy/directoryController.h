@@ -36,6 +36,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/sampling.h"
 
 using namespace std;
 
@@ -65,7 +66,11 @@ public:
             {"addr_range_end",          "Highest address handled by this directory.", "uint64_t-1"},
             {"interleave_size",         "Size of interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"interleave_step",         "Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
+            {"num_slices",              "(uint) For a directory distributed in slices, total number of slices", "1"},
+            {"slice_id",                "(uint) For a directory distributed in slices, unique ID of this slice", "0"},
+            {"slice_allocation_policy", "(string) Policy for distributing addresses among slices. Options: rr[round-robin, used only if no address region is given], xor[XOR hash of line addresses, num_slices must be a power of two]", "rr"},
             {"node",					"Node number in multinode environment"},
+            MEMHIERARCHY_SAMPLING_ELI_PARAMS,
             /* Old parameters - deprecated or moved */
             {"network_bw",                  "MOVED. Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove SST 9.0
             {"network_input_buffer_size",   "MOVED. Now a member of the MemNIC subcomponent.", "1KiB"}, // Remove SST 9.0
@@ -146,6 +151,7 @@ public:
             {"eventSent_FlushAllResp",  "Event sent: FlushAllResp", "count", 2},
             {"eventSent_UnblockFlush",  "Event sent: UnblockFlush", "count", 2},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle",  "events",       1},
+            MEMHIERARCHY_SAMPLING_ELI_STATS,
             {"default_stat",            "Default statistic. If not 0 then a statistic is missing", "", 1})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -244,6 +250,9 @@ public:
     /** Clock handler */
     bool clock(SST::Cycle_t cycle);
 
+    /* Statistical sampling - drop latencies and per-cycle limits during functional warming */
+    void setWarming(bool warming);
+
 /* Coherence portion */
 public:
     bool handleGetS(MemEvent* event, bool inMSHR);
@@ -435,6 +444,12 @@ private:
     uint64_t accessLatency;
     uint64_t mshrLatency;
 
+    /* Statistical sampling */
+    SamplingController* sampling;
+    uint64_t detailedAccessLatency;
+    uint64_t detailedMshrLatency;
+    int detailedMaxRequestsPerCycle;
+
     FlushState flush_state_;
 
     std::map<Addr, std::map<std::string, MemEvent::id_type> > responses;
@@ -0,0 +1,202 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_LINECOMPRESSOR_H
+#define MEMHIERARCHY_LINECOMPRESSOR_H
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Computes the compressed size of a cache line from its data
+ *
+ * Supported algorithms
+ *  bdi: Base-Delta-Immediate (Pekhimenko et al., PACT 2012). The line is
+ *       viewed as 8, 4, or 2 byte values. Each value must be a small delta
+ *       from either zero or a single base value. All-zero and repeated-value
+ *       lines are special cases.
+ *  fpc: Frequent Pattern Compression (Alameldeen & Wood, 2004). Each 32-bit
+ *       word is encoded with a 3-bit prefix and a 0-32 bit pattern.
+ *  best: Both, keeping the smaller result. Ties go to BDI since it is
+ *       cheaper to decompress.
+ *
+ * Only sizes are computed; line data is always stored uncompressed.
+ * The per-value checks are fixed-width loops without early exits or
+ * data-dependent branches, so the compiler can vectorize them. FPC's zero-run
+ * length is the one value carried from word to word.
+ */
+class LineCompressor {
+public:
+    enum class Algorithm { BDI, FPC, Best };
+    enum class Encoding : uint8_t { Uncompressed, BDI, FPC };
+
+    struct Result {
+        uint32_t size;      // Compressed size in bytes
+        Encoding encoding;
+    };
+
+    LineCompressor(Algorithm alg) : alg_(alg) { }
+
+    /* Parse an algorithm name. Returns false if the name is not recognized. */
+    static bool parseAlgorithm(std::string name, Algorithm &alg) {
+        if (name == "bdi") alg = Algorithm::BDI;
+        else if (name == "fpc") alg = Algorithm::FPC;
+        else if (name == "best") alg = Algorithm::Best;
+        else return false;
+        return true;
+    }
+
+    Result compress(const std::vector<uint8_t> &line) const {
+        uint32_t size = line.size();
+        Result res = { size, Encoding::Uncompressed };
+        if (alg_ != Algorithm::FPC) {
+            uint32_t bdi = bdiSize(line.data(), size);
+            if (bdi < res.size) {
+                res.size = bdi;
+                res.encoding = Encoding::BDI;
+            }
+        }
+        if (alg_ != Algorithm::BDI) {
+            uint32_t fpc = fpcSize(line.data(), size);
+            if (fpc < res.size) {
+                res.size = fpc;
+                res.encoding = Encoding::FPC;
+            }
+        }
+        return res;
+    }
+
+    /* BDI size in bytes, 'size' if not compressible */
+    static uint32_t bdiSize(const uint8_t* data, uint32_t size) {
+        uint64_t any = 0;
+        for (uint32_t i = 0; i < size; i++)
+            any |= data[i];
+        if (any == 0)
+            return 1;
+
+        if (size >= 8 && repeated(data, size))
+            return 8;
+
+        /* Encodings in order of increasing size for a 64B line */
+        static const struct { uint8_t base; uint8_t delta; } encodings[] = {
+            {8, 1}, {4, 1}, {8, 2}, {2, 1}, {4, 2}, {8, 4} };
+
+        uint32_t best = size;
+        for (auto &enc : encodings) {
+            if (enc.base > size)
+                continue;
+            uint32_t encSize = enc.base + (size / enc.base) * enc.delta;
+            if (encSize >= best)
+                continue;
+            bool fits;
+            switch (enc.base) {
+                case 8: fits = bdiFits<int64_t>(data, size, enc.delta); break;
+                case 4: fits = bdiFits<int32_t>(data, size, enc.delta); break;
+                default: fits = bdiFits<int16_t>(data, size, enc.delta); break;
+            }
+            if (fits)
+                best = encSize;
+        }
+        return best;
+    }
+
+    /* FPC size in bytes, 'size' if not compressible */
+    static uint32_t fpcSize(const uint8_t* data, uint32_t size) {
+        uint32_t words = size / 4;
+        uint64_t bits = 0;
+        uint32_t zeroRun = 0;
+        for (uint32_t i = 0; i < words; i++) {
+            uint32_t w = load<uint32_t>(data, i);
+            int32_t s = (int32_t)w;
+            uint32_t zero = (w == 0);
+
+            /* Cost of the smallest matching pattern */
+            bool halfword = fitsSigned<int32_t>(s, 16)
+                    | ((w & 0xFFFF) == 0)   // Halfword padded with a zero halfword
+                    | (fitsSigned<int16_t>((int16_t)(w >> 16), 8) & fitsSigned<int16_t>((int16_t)w, 8)); // Two sign-extended bytes
+            bool byte = fitsSigned<int32_t>(s, 8)
+                    | (w == (w & 0xFF) * 0x01010101u);  // Repeated bytes
+            uint32_t cost = 3 + 32;
+            cost = halfword ? 3 + 16 : cost;
+            cost = byte ? 3 + 8 : cost;
+            cost = fitsSigned<int32_t>(s, 4) ? 3 + 4 : cost;
+
+            /* Zero words are coded as runs of up to 8, each run costs a prefix and a 3-bit length */
+            bits += zero ? (zeroRun == 0) * (3 + 3) : cost;
+            zeroRun = zero * ((zeroRun + 1) % 8);
+        }
+        bits += (size % 4) * 8;
+        uint64_t bytes = (bits + 7) / 8;
+        return bytes < size ? bytes : size;
+    }
+
+private:
+    Algorithm alg_;
+
+    template <typename T>
+    static T load(const uint8_t* data, uint32_t i) {
+        T val;
+        memcpy(&val, data + i * sizeof(T), sizeof(T));
+        return val;
+    }
+
+    /* Whether 'val' is representable as a sign-extended 'bits'-bit value */
+    template <typename T>
+    static bool fitsSigned(T val, unsigned bits) {
+        typedef typename std::make_unsigned<T>::type U;
+        U lim = (U)1 << (bits - 1);
+        return (U)((U)val + lim) < (U)(lim << 1);
+    }
+
+    static bool repeated(const uint8_t* data, uint32_t size) {
+        uint64_t first = load<uint64_t>(data, 0);
+        uint64_t diff = 0;
+        for (uint32_t i = 1; i < size / 8; i++)
+            diff |= load<uint64_t>(data, i) ^ first;
+        return diff == 0 && (size % 8) == 0;
+    }
+
+    /* Every value in the line is within a 'delta'-byte signed delta of zero or of a common base */
+    template <typename T>
+    static bool bdiFits(const uint8_t* data, uint32_t size, unsigned delta) {
+        typedef typename std::make_unsigned<T>::type U;
+        const unsigned bits = delta * 8;
+        const uint32_t count = size / sizeof(T);
+
+        /* Base is the first value not reachable from zero */
+        T base = 0;
+        for (uint32_t i = count; i-- > 0; ) {
+            T val = load<T>(data, i);
+            base = fitsSigned<T>(val, bits) ? base : val;
+        }
+
+        unsigned miss = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            T val = load<T>(data, i);
+            T diff = (T)((U)val - (U)base);
+            miss |= !(fitsSigned<T>(val, bits) | fitsSigned<T>(diff, bits));
+        }
+        return miss == 0 && (size % sizeof(T)) == 0;
+    }
+};
+
+}}
+
+#endif // MEMHIERARCHY_LINECOMPRESSOR_H
@@ -23,6 +23,7 @@
 
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
 #include "sst/elements/memHierarchy/memTypes.h"
 
 namespace SST { namespace MemHierarchy {
@@ -68,6 +69,18 @@ public:
         baseAddr_ = 0;
     }
 
+    /* Copy constructor - the payload is copied into a pooled buffer */
+    MemEvent(const MemEvent& ev) : MemEventBase(ev), size_(ev.size_), addr_(ev.addr_), baseAddr_(ev.baseAddr_),
+        addrGlobal_(ev.addrGlobal_), NACKedEvent_(ev.NACKedEvent_), retries_(ev.retries_), prefetch_(ev.prefetch_),
+        dirty_(ev.dirty_), isEvict_(ev.isEvict_), instPtr_(ev.instPtr_), vAddr_(ev.vAddr_) {
+        MemEventPool::reservePayload(payload_, ev.payload_.size());
+        payload_.assign(ev.payload_.begin(), ev.payload_.end());
+    }
+
+    ~MemEvent() {
+        MemEventPool::releasePayload(payload_);
+    }
+
     /** Create a new MemEvent instance, pre-configured to act as a NACK response */
     MemEvent* makeNACKResponse(MemEvent* NACKedEvent) {
         MemEvent *me      = new MemEvent(*this);
@@ -179,7 +192,10 @@ public:
     /** @return  the data payload. */
     dataVec& getPayload(void) {
         /* Lazily allocate space for payload */
-        if ( payload_.size() < size_ )  payload_.resize(size_);
+        if ( payload_.size() < size_ ) {
+            MemEventPool::reservePayload(payload_, size_);
+            payload_.resize(size_);
+        }
         return payload_;
     }
 
@@ -189,15 +205,26 @@ public:
      */
     void setPayload(std::vector<uint8_t>& data) {
         setSize(data.size());
+        MemEventPool::reservePayload(payload_, data.size());
         payload_ = data;
     }
 
+    /** Sets the data payload and payload size.
+     * @param[in] data  Vector to move into the payload. Left empty.
+     */
+    void setPayload(std::vector<uint8_t>&& data) {
+        setSize(data.size());
+        MemEventPool::releasePayload(payload_);
+        payload_.swap(data);
+    }
+
     /** Sets the data payload and payload size.
      * @param[in] size  How many bytes to copy from data
      * @param[in] data  Data array to set as payload
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
+        MemEventPool::reservePayload(payload_, size);
         payload_.resize(size);
         for ( uint32_t i = 0 ; i < size ; i++ ) {
             payload_[i] = data[i];
@@ -207,6 +234,7 @@ public:
     void setZeroPayload(uint32_t size) {
         setSize(size);
         payload_.clear();
+        MemEventPool::reservePayload(payload_, size);
         payload_.resize(size, 0);
     }
 
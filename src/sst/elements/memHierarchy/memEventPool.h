@@ -0,0 +1,99 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTPOOL_H
+#define MEMHIERARCHY_MEMEVENTPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Per-thread recycling of MemEvent data payload buffers.
+ *
+ * Most MemEvents carry a line of data, and every hop of an access copies
+ * it into a new event. Payload buffers come from a free list instead of
+ * the heap once a simulation reaches steady state. The lists are per
+ * thread and need no locking; a buffer freed by a different thread than
+ * allocated it joins the freeing thread's list.
+ *
+ * The events themselves are not pooled here. SST::Event storage already
+ * comes from core's per-thread MemPoolItem allocator, which also tracks
+ * events that were never deleted.
+ *
+ * Payload buffers are recycled up to 'maxPooledPayload' bytes of capacity,
+ * which covers common line sizes. Larger buffers go back to the heap.
+ */
+class MemEventPool {
+public:
+    static const size_t maxPooledPayload = 256;
+    static const size_t maxFreePayloads = 1 << 16;
+
+    struct Counters {
+        uint64_t payloadAllocs;     // payload buffers taken from the heap
+        uint64_t payloadReuses;     // payload buffers taken from the free list
+    };
+
+    /* Give 'payload' capacity for at least 'size' bytes, reusing a freed buffer if possible */
+    static void reservePayload(std::vector<uint8_t>& payload, size_t size) {
+        if (payload.capacity() >= size)
+            return;
+        Local& l = local();
+        if (size <= maxPooledPayload && !l.payloads.empty() && l.payloads.back().capacity() >= size) {
+            l.payloads.back().assign(payload.begin(), payload.end());
+            payload.swap(l.payloads.back());
+            l.payloads.pop_back();
+            l.counters.payloadReuses++;
+            return;
+        }
+        l.counters.payloadAllocs++;
+        payload.reserve(size);
+    }
+
+    /* Return the buffer of 'payload' to the pool, leaving 'payload' empty */
+    static void releasePayload(std::vector<uint8_t>& payload) {
+        if (payload.capacity() == 0)
+            return;
+        Local& l = local();
+        if (payload.capacity() <= maxPooledPayload && l.payloads.size() < maxFreePayloads) {
+            l.payloads.push_back(std::move(payload));
+            l.payloads.back().clear();
+        }
+        std::vector<uint8_t>().swap(payload);
+    }
+
+    /* Counters for the calling thread */
+    static const Counters& getCounters() { return local().counters; }
+
+private:
+    struct Local {
+        Local() : counters() { }
+        std::vector<std::vector<uint8_t> > payloads;
+        Counters counters;
+    };
+
+    /* Never destroyed, so that payloads freed during static destruction are safe */
+    static Local& local() {
+        static thread_local Local* l = new Local();
+        return *l;
+    }
+};
+
+}}
+
+#endif
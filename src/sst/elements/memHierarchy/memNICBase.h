@@ -135,6 +135,9 @@ class MemNICBase : public MemLinkBase {
                     ser & info.region.end;
                     ser & info.region.interleaveSize;
                     ser & info.region.interleaveStep;
+                    ser & info.region.hashSlices;
+                    ser & info.region.hashSlice;
+                    ser & info.region.hashGranularity;
                 }
 
                 ImplementSerializable(SST::MemHierarchy::MemNICBase::InitMemRtrEvent);
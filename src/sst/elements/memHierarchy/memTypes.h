@@ -235,20 +235,32 @@ enum class MemEventStatus { OK, Stall, Reject };
 // Define global cache state used to manage cache flushes
 enum class FlushState { Ready, Drain, Forward, Invalidate };
 
-/* Define an address region by start/end & interleaving */
+/* Define an address region by start/end & interleaving
+ *
+ * A region may also be one slice of an XOR-hashed distribution: with
+ * hashSlices != 0, the region only contains the hashGranularity-sized
+ * chunks whose hash is hashSlice. This is in addition to start/end and
+ * interleaving.
+ */
 class MemRegion : public SST::Core::Serialization::serializable {
 public:
     SST::MemHierarchy::Addr start;             // First address that is part of the region
     SST::MemHierarchy::Addr end;               // Last address that is part of the region
     SST::MemHierarchy::Addr interleaveSize;    // Size of each interleaved chunk
     SST::MemHierarchy::Addr interleaveStep;    // Distance between the start of each interleaved chunk
+    uint32_t hashSlices;                       // Number of hashed slices, 0 if not hashed
+    uint32_t hashSlice;                        // Slice of this region
+    SST::MemHierarchy::Addr hashGranularity;   // Size of each hashed chunk
     static const SST::MemHierarchy::Addr REGION_MAX = std::numeric_limits<SST::MemHierarchy::Addr>::max();
 
+    MemRegion() : start(0), end(0), interleaveSize(0), interleaveStep(0), hashSlices(0), hashSlice(0), hashGranularity(0) { }
+
     void setDefault() {
         start = 0;
         interleaveSize = 0;
         interleaveStep = 0;
         end = REGION_MAX;
+        clearHash();
     }
 
     void setEmpty() {
@@ -256,9 +268,70 @@ public:
         interleaveSize = 0;
         interleaveStep = 0;
         end = 0;
+        clearHash();
+    }
+
+    void setHash(uint32_t slices, uint32_t slice, SST::MemHierarchy::Addr granularity) {
+        hashSlices = slices;
+        hashSlice = slice;
+        hashGranularity = granularity;
+    }
+
+    void clearHash() {
+        setHash(0, 0, 0);
+    }
+
+    /* Slice of 'addr' among 'slices' (a power of two). XOR-folds the chunk
+     * number so that every aligned group of 'slices' consecutive chunks maps
+     * to all slices, and power-of-two strides still spread across slices. */
+    static uint32_t hashToSlice(SST::MemHierarchy::Addr addr, uint32_t slices, SST::MemHierarchy::Addr granularity) {
+        SST::MemHierarchy::Addr chunk = addr / granularity;
+        uint32_t bits = 0;
+        while ((1u << bits) < slices) bits++;
+        if (bits == 0) return 0;
+        SST::MemHierarchy::Addr hash = 0;
+        while (chunk != 0) {
+            hash ^= chunk & (slices - 1);
+            chunk >>= bits;
+        }
+        return hash;
     }
 
     bool contains(uint64_t addr) const {
+        if (hashSlices != 0 && hashToSlice(addr, hashSlices, hashGranularity) != hashSlice)
+            return false;
+        return containsInterleaved(addr);
+    }
+
+    /* The hash is not representable in the interleaved regions, so it is
+     * kept as a filter on each one. Different slices of the same hash do not
+     * intersect. Two different hashes (e.g., 4 cache slices above 2 directory
+     * slices) cannot both be kept, so this region's hash is kept: the result
+     * is then a superset of the intersection but still within this region. */
+    std::set<MemRegion> intersect(const MemRegion &o) const {
+        if (hashSlices == 0 && o.hashSlices == 0)
+            return intersectInterleaved(o);
+
+        std::set<MemRegion> regions;
+        if (hashSlices != 0 && o.hashSlices == hashSlices && o.hashGranularity == hashGranularity && o.hashSlice != hashSlice)
+            return regions;
+
+        const MemRegion& hashed = hashSlices != 0 ? *this : o;
+        std::set<MemRegion> interleaved = intersectInterleaved(o);
+        for (std::set<MemRegion>::iterator it = interleaved.begin(); it != interleaved.end(); it++) {
+            MemRegion reg = *it;
+            reg.setHash(hashed.hashSlices, hashed.hashSlice, hashed.hashGranularity);
+            regions.insert(reg);
+        }
+        return regions;
+    }
+
+private:
+    bool sameHash(const MemRegion &o) const {
+        return hashSlices == o.hashSlices && hashSlice == o.hashSlice && hashGranularity == o.hashGranularity;
+    }
+
+    bool containsInterleaved(uint64_t addr) const {
         if (addr >= start && addr <= end) {
             if (interleaveSize == 0) return true;
             SST::MemHierarchy::Addr offset = (addr - start) % interleaveStep;
@@ -268,17 +341,19 @@ public:
     }
 
     // TODO clean this up to something more succinct
-    // We need to compute the set intersection of this MemRegion with MemRegion 'o'
+    // We need to compute the set intersection of this MemRegion with MemRegion 'o', ignoring hashing
     // The intersection may not be describable as a single MemRegion, so a set is returned
-    std::set<MemRegion> intersect(const MemRegion &o) const {
+    std::set<MemRegion> intersectInterleaved(const MemRegion &o) const {
         std::set<MemRegion> regions;
         // Easy case, regions don't overlap
         if (o.end < start || end < o.start)
             return regions; // Empty
 
         // Easy case, they're equal
-        if (*this == o) {
-            regions.insert(*this);
+        if (sameInterleave(o)) {
+            MemRegion reg = *this;
+            reg.clearHash();
+            regions.insert(reg);
             return regions;
         }
 
@@ -351,7 +426,7 @@ public:
         uint64_t region_size = 0;
         for (uint64_t i = check_start; i < check_end; i++) {
             bool in_region = false;
-            in_region = (*this).contains(i) && o.contains(i);
+            in_region = (*this).containsInterleaved(i) && o.containsInterleaved(i);
             if (in_region) {
                 if (region_size == 0)
                     region_start = i;
@@ -378,13 +453,22 @@ public:
         return regions;
     }
 
+    bool sameInterleave(const MemRegion &o) const {
+        return (start == o.start && end == o.end && interleaveSize == o.interleaveSize && interleaveStep == o.interleaveStep);
+    }
+
+public:
     bool doesIntersect(const MemRegion &o) const {
         // Easy case, regions don't overlap
         if (o.end < start || end < o.start)
             return false;
 
+        // Different slices of the same hash never overlap. Otherwise, assume a hash overlaps with anything.
+        if (hashSlices != 0 && o.hashSlices == hashSlices && o.hashGranularity == hashGranularity)
+            if (o.hashSlice != hashSlice) return false;
+
         // Easy case, they're equal
-        if (*this == o) {
+        if (sameInterleave(o)) {
             return true;
         }
 
@@ -394,12 +478,14 @@ public:
         }
 
         // Check interval from max(start, o.start) to lcm + max(start, o.start)
-        // for overlap
+        // for overlap. If only one is interleaved, one of its steps is enough.
         uint64_t lcm = std::lcm(interleaveStep, o.interleaveStep); 
+        if (interleaveStep == 0 || o.interleaveStep == 0)
+            lcm = std::max(interleaveStep, o.interleaveStep);
         uint64_t check_start = std::max(start, o.start);
         uint64_t check_end = check_start + lcm;
         for (uint64_t i = check_start; i < check_end; i++) {
-            if ( (*this).contains(i) && o.contains(i) )
+            if ( (*this).containsInterleaved(i) && o.containsInterleaved(i) )
                 return true;
         }
         return false;
@@ -411,11 +497,17 @@ public:
             return (start < o.start);
         if (end != o.end)
             return (end < o.end);
-        return (interleaveSize * o.interleaveStep) < (interleaveStep * o.interleaveSize);
+        if ((interleaveSize * o.interleaveStep) != (interleaveStep * o.interleaveSize))
+            return (interleaveSize * o.interleaveStep) < (interleaveStep * o.interleaveSize);
+        if (hashSlices != o.hashSlices)
+            return hashSlices < o.hashSlices;
+        if (hashSlice != o.hashSlice)
+            return hashSlice < o.hashSlice;
+        return hashGranularity < o.hashGranularity;
     }
 
     bool operator==(const MemRegion &o) const {
-        return (start == o.start && end == o.end && interleaveSize == o.interleaveSize && interleaveStep == o.interleaveStep);
+        return sameInterleave(o) && sameHash(o);
     }
 
     bool operator!=(const MemRegion &o) const {
@@ -429,6 +521,8 @@ public:
         str << noshowbase << dec;
         str << " InterleaveSize: " << interleaveSize;
         str << " InterleaveStep: " << interleaveStep;
+        if (hashSlices != 0)
+            str << " HashSlice: " << hashSlice << "/" << hashSlices << " HashGranularity: " << hashGranularity;
         return str.str();
     }
 
@@ -437,6 +531,9 @@ public:
         ser & end;
         ser & interleaveSize;
         ser & interleaveStep;
+        ser & hashSlices;
+        ser & hashSlice;
+        ser & hashGranularity;
     }
 private:
     ImplementSerializable(SST::MemHierarchy::MemRegion)
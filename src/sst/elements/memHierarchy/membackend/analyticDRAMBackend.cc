@@ -0,0 +1,120 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <sst/core/link.h>
+#include "sst/elements/memHierarchy/util.h"
+#include "membackend/analyticDRAMBackend.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- Analytic DRAM ------------------------------- */
+/* AnalyticDRAM computes the latency of each request when it arrives (see
+ * analyticDRAMModel.h) and schedules a single response. It has no clock and
+ * accepts every request, so the cost per request is constant regardless of
+ * load. Request limiting, if any, is left to the convertor.
+ *
+ * Timing parameters can be fitted against TimingDRAM, DRAMSim3 or any other
+ * backend by running that backend with the convertor's 'request_log'
+ * parameter set and passing the log to sst-memh-calibrate.
+ */
+
+AnalyticDRAM::AnalyticDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id, params) {
+    int verbose = params.find<int>("verbose", 0);
+    output = new Output("AnalyticDRAM[@p:@l]: ", verbose, 0, Output::STDOUT);
+
+    AnalyticDRAMTiming timing;
+    timing.tCAS = params.find<uint64_t>("tCAS", 14);
+    timing.tRCD = params.find<uint64_t>("tRCD", 14);
+    timing.tRP = params.find<uint64_t>("tRP", 14);
+    timing.tBurst = params.find<uint64_t>("tBurst", 4);
+    timing.queueScale = params.find<double>("queue_scale", 1.0);
+
+    std::string cycTime = params.find<std::string>("cycle_time", "1ns");
+    uint64_t channels = params.find<uint64_t>("channels", 1);
+    uint64_t banks = params.find<uint64_t>("banks", 16);
+    UnitAlgebra lineSize(params.find<std::string>("bank_interleave_granularity", "64B"));
+    UnitAlgebra rowSize(params.find<std::string>("row_size", "8KiB"));
+    std::string policyStr = params.find<std::string>("row_policy", "open");
+    std::string queueStr = params.find<std::string>("queue_model", "reserve");
+
+    if (policyStr != "closed" && policyStr != "open") {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_policy - must be 'closed' or 'open'. You specified '%s'.\n", getName().c_str(), policyStr.c_str());
+    }
+
+    AnalyticDRAMModel::QueueModel queueModel;
+    if (queueStr == "reserve") queueModel = AnalyticDRAMModel::QueueModel::RESERVE;
+    else if (queueStr == "md1") queueModel = AnalyticDRAMModel::QueueModel::MD1;
+    else output->fatal(CALL_INFO, -1, "Invalid param(%s): queue_model - must be 'reserve' or 'md1'. You specified '%s'.\n", getName().c_str(), queueStr.c_str());
+
+    if (!isPowerOfTwo(channels)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): channels - must be a power of two. You specified %" PRIu64 ".\n", getName().c_str(), channels);
+    }
+    if (!isPowerOfTwo(banks)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): banks - must be a power of two. You specified %" PRIu64 ".\n", getName().c_str(), banks);
+    }
+    if (!(lineSize.hasUnits("B")) || !isPowerOfTwo(lineSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must be a power of two with units of 'B' (bytes). You specified '%s'.\n", getName().c_str(), lineSize.toString().c_str());
+    }
+    if (!(rowSize.hasUnits("B")) || !isPowerOfTwo(rowSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must be a power of two with units of 'B' (bytes). You specified '%s'.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+
+    model = new AnalyticDRAMModel(channels, banks, log2Of(lineSize.getRoundedValue()), log2Of(rowSize.getRoundedValue()),
+            policyStr == "open", queueModel, timing);
+
+    cycleTime = getTimeConverter(cycTime);
+    self_link = configureSelfLink("Self", cycleTime, new Event::Handler<AnalyticDRAM>(this, &AnalyticDRAM::handleSelfEvent));
+
+    statRowHit = registerStatistic<uint64_t>("row_hits");
+    statRowEmpty = registerStatistic<uint64_t>("row_empty");
+    statRowConflict = registerStatistic<uint64_t>("row_conflicts");
+    statQueueDelay = registerStatistic<uint64_t>("queue_delay");
+}
+
+void AnalyticDRAM::handleSelfEvent(SST::Event *event) {
+    MemCtrlEvent *ev = static_cast<MemCtrlEvent*>(event);
+    handleMemResponse(ev->reqId);
+    delete event;
+}
+
+bool AnalyticDRAM::issueRequest( ReqId reqId, Addr addr, bool isWrite, unsigned numBytes ) {
+    AnalyticDRAMModel::RowResult result;
+    uint64_t queueDelay;
+    uint64_t latency = model->access(getCurrentSimTime(cycleTime), addr, result, queueDelay);
+
+    switch (result) {
+        case AnalyticDRAMModel::RowResult::HIT:
+            statRowHit->addData(1);
+            break;
+        case AnalyticDRAMModel::RowResult::EMPTY:
+            statRowEmpty->addData(1);
+            break;
+        case AnalyticDRAMModel::RowResult::CONFLICT:
+            statRowConflict->addData(1);
+            break;
+    }
+    statQueueDelay->addData(queueDelay);
+
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "AnalyticDRAM (%s) request for address %" PRIx64 ", latency %" PRIu64 " cycles (queueing %" PRIu64 ")\n",
+            getName().c_str(), addr, latency, queueDelay);
+#endif
+
+    self_link->send(latency, new MemCtrlEvent(reqId));
+    return true;
+}
@@ -0,0 +1,92 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_ANALYTIC_DRAM_BACKEND
+#define _H_SST_MEMH_ANALYTIC_DRAM_BACKEND
+
+#include "membackend/memBackend.h"
+#include "membackend/analyticDRAMModel.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+class AnalyticDRAM : public SimpleMemBackend {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT(AnalyticDRAM, "memHierarchy", "analyticDRAM", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Analytical DRAM timing model with bank/channel queueing and row-buffer locality, for fast design-space sweeps", SST::MemHierarchy::SimpleMemBackend)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
+            /* Own parameters */
+            {"verbose",     "(uint) Sets the verbosity of the backend output", "0" },
+            {"cycle_time",  "(string) Latency of a cycle or clock frequency (e.g., '4ns' and '250MHz' are both accepted)", "1ns"},
+            {"tCAS",        "(uint) Column access latency in cycles", "14"},
+            {"tRCD",        "(uint) Row activate latency in cycles", "14"},
+            {"tRP",         "(uint) Precharge latency in cycles", "14"},
+            {"tBurst",      "(uint) Cycles a request occupies the channel data bus", "4"},
+            {"channels",    "(uint) Number of channels. Must be a power of two.", "1"},
+            {"banks",       "(uint) Number of banks per channel. Must be a power of two.", "16"},
+            {"bank_interleave_granularity", "(string) Granularity of interleaving across channels and banks in bytes (B), generally a cache line. Must be a power of 2.", "64B"},
+            {"row_size",    "(string) Size of a row in bytes (B). Must be a power of 2.", "8KiB"},
+            {"row_policy",  "(string) Policy for managing the row buffer - open or closed.", "open"},
+            {"queue_model", "(string) Queueing model: 'reserve' (per-bank and per-channel FCFS reservation) or 'md1' (M/D/1 mean waiting time).", "reserve"},
+            {"queue_scale", "(float) For 'md1', scale applied to the M/D/1 waiting time. Fitted by sst-memh-calibrate.", "1.0"} )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"row_hits",        "Number of requests that found their row open", "count", 1},
+            {"row_empty",       "Number of requests that found no row open", "count", 1},
+            {"row_conflicts",   "Number of requests that found another row open", "count", 1},
+            {"queue_delay",     "Cycles each request spent waiting for its bank and channel", "cycles", 1} )
+
+/* Begin class definition */
+    AnalyticDRAM(ComponentId_t id, Params &params);
+    ~AnalyticDRAM() { delete model; }
+    bool issueRequest( ReqId, Addr, bool, unsigned );
+    bool isClocked() { return false; }
+
+    class MemCtrlEvent : public SST::Event {
+    public:
+        MemCtrlEvent(ReqId reqId) : SST::Event(), reqId(reqId) { }
+
+        ReqId reqId;
+    private:
+        MemCtrlEvent() {} // For Serialization only
+
+    public:
+        void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+            Event::serialize_order(ser);
+            ser & reqId;
+        }
+        ImplementSerializable(SST::MemHierarchy::AnalyticDRAM::MemCtrlEvent);
+    };
+
+private:
+    void handleSelfEvent(SST::Event *event);
+
+    Link *self_link;
+    TimeConverter *cycleTime;
+    AnalyticDRAMModel *model;
+
+    Statistic<uint64_t> * statRowHit;
+    Statistic<uint64_t> * statRowEmpty;
+    Statistic<uint64_t> * statRowConflict;
+    Statistic<uint64_t> * statQueueDelay;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,167 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_MEMH_ANALYTIC_DRAM_MODEL
+#define _H_SST_MEMH_ANALYTIC_DRAM_MODEL
+
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+/*
+ * Latency model shared by the analyticDRAM backend and the
+ * sst-memh-calibrate tool. It has no SST dependencies so that the tool can
+ * replay request logs through exactly the model the backend uses.
+ *
+ * Addresses map to channels and banks like SimpleDRAM, with lines
+ * interleaved first across channels, then across banks:
+ *      |...  Row  | Column | Bank | Channel | Line |
+ *
+ * The latency of a request is computed once, when it arrives, from the
+ * open row of its bank and from the queueing delay at the bank and at the
+ * channel's data bus. There are two queueing models:
+ *  RESERVE: each bank and data bus keeps the time it becomes free, and a
+ *           request waits for it (an FCFS queue with deterministic
+ *           service).
+ *  MD1:     waiting time is the M/D/1 mean, rho*S / 2(1-rho), with the
+ *           utilization rho estimated from a moving average of
+ *           inter-arrival times. This is scaled by 'queueScale', which is
+ *           fitted by the calibration tool.
+ * All times are in backend cycles.
+ */
+
+namespace SST {
+namespace MemHierarchy {
+
+struct AnalyticDRAMTiming {
+    uint64_t tCAS;      // column access
+    uint64_t tRCD;      // row activate
+    uint64_t tRP;       // precharge
+    uint64_t tBurst;    // data transfer on the channel bus
+    double queueScale;  // MD1 only
+};
+
+class AnalyticDRAMModel {
+public:
+    enum class QueueModel { RESERVE, MD1 };
+    enum class RowResult { HIT, EMPTY, CONFLICT };
+
+    AnalyticDRAMModel(unsigned channels, unsigned banks, unsigned lineOffset, unsigned rowOffset,
+            bool openPolicy, QueueModel model, const AnalyticDRAMTiming& timing) :
+        channelMask_(channels - 1), bankMask_(banks - 1), lineOffset_(lineOffset), rowOffset_(rowOffset),
+        channelBits_(bitsFor(channels)), openPolicy_(openPolicy), model_(model), timing_(timing),
+        banks_(channels * banks), channels_(channels) { }
+
+    void setTiming(const AnalyticDRAMTiming& timing) { timing_ = timing; }
+    const AnalyticDRAMTiming& getTiming() const { return timing_; }
+
+    /* Forget all bank and channel state */
+    void reset() {
+        std::fill(banks_.begin(), banks_.end(), Resource());
+        std::fill(channels_.begin(), channels_.end(), Resource());
+    }
+
+    /* Latency of a request arriving at 'now'. Updates the bank and channel state. */
+    uint64_t access(uint64_t now, uint64_t addr, RowResult& result, uint64_t& queueDelay) {
+        unsigned channel = (addr >> lineOffset_) & channelMask_;
+        unsigned bank = (addr >> (lineOffset_ + channelBits_)) & bankMask_;
+        int64_t row = addr >> rowOffset_;
+        Resource& b = banks_[channel * (bankMask_ + 1) + bank];
+        Resource& ch = channels_[channel];
+
+        uint64_t rowCycles = 0; // activate and precharge
+        if (b.openRow == row) {
+            result = RowResult::HIT;
+        } else if (b.openRow == -1) {
+            result = RowResult::EMPTY;
+            rowCycles = timing_.tRCD;
+        } else {
+            result = RowResult::CONFLICT;
+            rowCycles = timing_.tRP + timing_.tRCD;
+        }
+        uint64_t access = rowCycles + timing_.tCAS;
+
+        uint64_t latency;
+        if (model_ == QueueModel::RESERVE) {
+            uint64_t bankStart = std::max(now, b.freeAt);
+            uint64_t dataReady = bankStart + access;
+            uint64_t busStart = std::max(dataReady, ch.freeAt);
+            ch.freeAt = busStart + timing_.tBurst;
+            if (openPolicy_)
+                b.freeAt = bankStart + rowCycles + timing_.tBurst;   // column accesses pipeline
+            else
+                b.freeAt = dataReady + timing_.tRP;
+            latency = ch.freeAt - now;
+            queueDelay = (bankStart - now) + (busStart - dataReady);
+        } else {
+            double bankWait = b.wait(now, rowCycles + timing_.tBurst + (openPolicy_ ? 0 : timing_.tRP));
+            double busWait = ch.wait(now, timing_.tBurst);
+            queueDelay = (uint64_t)(timing_.queueScale * (bankWait + busWait) + 0.5);
+            latency = access + timing_.tBurst + queueDelay;
+        }
+
+        b.openRow = openPolicy_ ? row : -1;
+        return latency;
+    }
+
+private:
+    static unsigned bitsFor(unsigned x) {
+        unsigned bits = 0;
+        while ((1u << bits) < x) bits++;
+        return bits;
+    }
+
+    struct Resource {
+        Resource() : openRow(-1), freeAt(0), lastArrival(0), interArrival(0.0), seen(false) { }
+
+        int64_t openRow;
+        uint64_t freeAt;        // RESERVE
+        uint64_t lastArrival;   // MD1
+        double interArrival;
+        bool seen;
+
+        /* M/D/1 mean waiting time for service time 'service' */
+        double wait(uint64_t now, uint64_t service) {
+            if (!seen) {
+                seen = true;
+                lastArrival = now;
+                return 0.0;
+            }
+            double gap = (double)(now - lastArrival);
+            lastArrival = now;
+            interArrival = interArrival == 0.0 ? gap : interArrival + (gap - interArrival) / 16.0;
+            if (interArrival <= 0.0) interArrival = 1.0;
+            double rho = std::min(0.95, service / interArrival);
+            return rho * service / (2.0 * (1.0 - rho));
+        }
+    };
+
+    uint64_t channelMask_;
+    uint64_t bankMask_;
+    unsigned lineOffset_;
+    unsigned rowOffset_;
+    unsigned channelBits_;
+    bool openPolicy_;
+    QueueModel model_;
+    AnalyticDRAMTiming timing_;
+
+    std::vector<Resource> banks_;
+    std::vector<Resource> channels_;
+};
+
+}
+}
+
+#endif
@@ -19,6 +19,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <algorithm>
 #include "sst/elements/memHierarchy/util.h"
 
 namespace SST {
@@ -65,6 +67,25 @@ public:
         Backing(), size_(size), offset_(offset) {
         int flags = MAP_SHARED;
         int fd = -1;
+
+        // With only an input file, map it copy-on-write instead of copying it in. Start up
+        // time no longer depends on the image size, the file is never modified and several
+        // simulations started from the same image share its pages.
+        if ( mmapfile == "" && infile != "" ) {
+            fd = open(infile.c_str(), O_RDONLY);
+            if (fd < 0) { throw 3; }
+
+            struct stat buf;
+            if ( 0 == fstat(fd, &buf) && (size_t) buf.st_size >= size ) {
+                buffer_ = (uint8_t*)mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_PRIVATE | MAP_NORESERVE, fd, 0);
+                close(fd);
+                if ( buffer_ == MAP_FAILED ) { throw 4; }
+                return;
+            }
+            // Image is smaller than memory, fall back to copying it into an anonymous mapping
+            close(fd);
+        }
+
         if ( mmapfile != "" ) {
             int fd_flags = O_RDWR | O_CREAT;
             if (mmapfile != infile) 
@@ -94,13 +115,22 @@ public:
             fd = open(infile.c_str(), O_RDONLY);
             if (fd < 0) { throw 3; } 
 
-            uint8_t* tmp_buffer = (uint8_t*)mmap(NULL, size, PROT_READ, flags, fd, 0);
-            close(fd);
+            // Only copy what the file holds, touching a mapping past the end of the file faults
+            struct stat buf;
+            if ( 0 != fstat(fd, &buf) ) { close(fd); throw 3; }
+            size_t length = std::min( size, (size_t) buf.st_size );
+
+            if ( length ) {
+                uint8_t* tmp_buffer = (uint8_t*)mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                close(fd);
 
-            if ( tmp_buffer == MAP_FAILED ) { throw 4; }
+                if ( tmp_buffer == MAP_FAILED ) { throw 4; }
 
-            memcpy(buffer_, tmp_buffer, size);
-            munmap(tmp_buffer, size);
+                memcpy(buffer_, tmp_buffer, length);
+                munmap(tmp_buffer, length);
+            } else {
+                close(fd);
+            }
         }
     }
 
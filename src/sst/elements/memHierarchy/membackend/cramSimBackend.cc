@@ -51,8 +51,12 @@ bool CramSimMemory::issueRequest(ReqId reqId, Addr addr, bool isWrite, unsigned
     if (memReqs.find(reqId) != memReqs.end())
         output->fatal(CALL_INFO, -1, "Assertion failed");
 
+    // number requestors in the order they are first seen so cramSim's
+    // fairness-aware schedulers can tell them apart
+    auto l_requestor = m_requestorIds.emplace( getRequestor(reqId), m_requestorIds.size() ).first;
+
     memReqs.insert( reqId );
-    cramsim_link->send( new CramSim::MemReqEvent(reqId,addr,isWrite,numBytes,0) );
+    cramsim_link->send( new CramSim::MemReqEvent(reqId,addr,isWrite,numBytes,0,l_requestor->second) );
     return true;
 }
 
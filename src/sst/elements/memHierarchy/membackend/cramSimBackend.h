@@ -47,6 +47,7 @@ private:
     void handleCramsimEvent(SST::Event *event);
 
 	std::set<ReqId> memReqs;
+    std::map<std::string, uint32_t> m_requestorIds;
     SST::Link *cramsim_link;
 
 	int m_maxNumOutstandingReqs;
@@ -15,6 +15,11 @@
 
 
 #include <sst_config.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <algorithm>
+#include <iterator>
+
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memoryController.h"
 #include "membackend/memBackendConvertor.h"
@@ -49,6 +54,35 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
 
     m_clockBackend = m_backend->isClocked();
 
+    m_requestLog = nullptr;
+    std::string requestLog = params.find<std::string>("request_log", "");
+    if (!requestLog.empty()) {
+        m_requestLog = fopen(requestLog.c_str(), "w");
+        if (m_requestLog == nullptr)
+            m_dbg.fatal(CALL_INFO, -1, "%s, Error: could not open request_log file '%s'\n", getName().c_str(), requestLog.c_str());
+    }
+
+    std::string order = params.find<std::string>("request_order", "fifo");
+    if (order == "row_batch") {
+        unsigned batch = params.find<unsigned>("row_batch_size", 4);
+        unsigned banks = params.find<unsigned>("row_batch_banks", 8);
+        UnitAlgebra interleave(params.find<std::string>("row_batch_bank_interleave_granularity", "64B"));
+        UnitAlgebra rowSize(params.find<std::string>("row_batch_row_size", "8KiB"));
+        if (batch == 0)
+            m_dbg.fatal(CALL_INFO, -1, "%s, Error: row_batch_size must be greater than 0\n", getName().c_str());
+        if (!isPowerOfTwo(banks))
+            m_dbg.fatal(CALL_INFO, -1, "%s, Error: row_batch_banks must be a power of two, got %u\n", getName().c_str(), banks);
+        if (!interleave.hasUnits("B") || !isPowerOfTwo(interleave.getRoundedValue()))
+            m_dbg.fatal(CALL_INFO, -1, "%s, Error: row_batch_bank_interleave_granularity must be a power of two in bytes (B), got '%s'\n",
+                    getName().c_str(), interleave.toStringBestSI().c_str());
+        if (!rowSize.hasUnits("B") || !isPowerOfTwo(rowSize.getRoundedValue()))
+            m_dbg.fatal(CALL_INFO, -1, "%s, Error: row_batch_row_size must be a power of two in bytes (B), got '%s'\n",
+                    getName().c_str(), rowSize.toStringBestSI().c_str());
+        m_requestQueue.configure(batch, banks, log2Of(interleave.getRoundedValue()), log2Of(rowSize.getRoundedValue()));
+    } else if (order != "fifo") {
+        m_dbg.fatal(CALL_INFO, -1, "%s, Error: request_order must be 'fifo' or 'row_batch', got '%s'\n", getName().c_str(), order.c_str());
+    }
+
     stat_GetSReqReceived    = registerStatistic<uint64_t>("requests_received_GetS");
     stat_GetSXReqReceived   = registerStatistic<uint64_t>("requests_received_GetSX");
     stat_GetXReqReceived    = registerStatistic<uint64_t>("requests_received_GetX");
@@ -90,7 +124,7 @@ void MemBackendConvertor::handleMemEvent(  MemEvent* ev ) {
 void MemBackendConvertor::handleCustomEvent( Interfaces::StandardMem::CustomData * info, Event::id_type evId, std::string rqstr) {
     uint32_t id = genReqId();
     CustomReq* req = new CustomReq( info, evId, rqstr, id );
-    m_requestQueue.push_back( req );
+    m_requestQueue.push( req );
     m_pendingRequests[id] = req;
 }
 
@@ -99,19 +133,26 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
     int reqsThisCycle = 0;
     bool cycleWithIssue = false;
+    bool cycleWithReject = false;
+    m_requestQueue.startCycle();
     while ( !m_requestQueue.empty()) {
         if ( reqsThisCycle == m_backend->getMaxReqPerCycle() ) {
             break;
         }
 
         BaseReq* req = m_requestQueue.front();
+        if ( req == nullptr ) {
+            break;
+        }
         Debug(_L10_, "Processing request: %s\n", req->getString().c_str());
 
         if ( issue( req ) ) {
             cycleWithIssue = true;
         } else {
+            cycleWithReject = true;
+            if ( m_requestQueue.rejected() )
+                continue;
             cycleWithIssue = false;
-            stat_cyclesAttemptIssueButRejected->addData(1);
             break;
         }
 
@@ -120,10 +161,13 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
         if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
-            m_requestQueue.pop_front();
         }
+        m_requestQueue.issued( req->issueDone() );
     }
 
+    if (cycleWithReject)
+        stat_cyclesAttemptIssueButRejected->addData(1);
+
     if (cycleWithIssue)
         stat_cyclesWithIssue->addData(1);
 
@@ -195,30 +239,42 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
 
             doResponseStat( event->getCmd(), latency );
 
+            if (m_requestLog) {
+                fprintf(m_requestLog, "%" PRIu64 ",0x%" PRIx64 ",%d,%" PRIu32 ",%" PRIu64 "\n", event->getDeliveryTime(), event->getBaseAddr(),
+                        static_cast<MemReq*>(req)->isWrite() ? 1 : 0, event->getSize(), latency);
+            }
+
             if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
+            Addr baseAddr = event->getBaseAddr();
             sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
 
             // TODO clock responses
-            // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
-                        sendResponse(flush->getID(), flush->getFlags());
-                        m_waitingFlushes.erase(flush);
-                    }
-                }
-                m_dependentRequests.erase(evID);
-            }
+            completeFlushEpoch(baseAddr, static_cast<MemReq*>(req)->getEpoch());
         }
         delete req;
     }
 }
 
+/*
+ * A request in 'epoch' of 'addr' completed. Respond to the flushes whose
+ * epochs have drained, in order.
+ */
+void MemBackendConvertor::completeFlushEpoch( Addr addr, uint64_t epoch ) {
+    std::unordered_map<Addr, AddrEpochs>::iterator it = m_flushEpochs.find(addr);
+    AddrEpochs& addrEpochs = it->second;
+    addrEpochs.epochs[epoch - addrEpochs.first].outstanding--;
+
+    while (addrEpochs.epochs.front().outstanding == 0 && addrEpochs.epochs.front().flush != nullptr) {
+        MemEvent* flush = addrEpochs.epochs.front().flush;
+        sendResponse(flush->getID(), flush->getFlags());
+        addrEpochs.epochs.pop_front();
+        addrEpochs.first++;
+    }
+
+    if (addrEpochs.epochs.size() == 1 && addrEpochs.epochs.front().outstanding == 0)
+        m_flushEpochs.erase(it);
+}
+
 void MemBackendConvertor::sendResponse( SST::Event::id_type id, uint32_t flags ) {
 
     m_notifyResponse( id, flags );
@@ -236,6 +292,10 @@ void MemBackendConvertor::finish(Cycle_t endCycle) {
         m_cycleCount = endCycle;
     }
     stat_totalCycles->addData(m_cycleCount);
+    if (m_requestLog) {
+        fclose(m_requestLog);
+        m_requestLog = nullptr;
+    }
     m_backend->finish();
 }
 
@@ -246,3 +306,170 @@ size_t MemBackendConvertor::getMemSize() {
 uint32_t MemBackendConvertor::getRequestWidth() {
     return m_backend->getRequestWidth();
 }
+
+/******************** RequestQueue ********************/
+
+void MemBackendConvertor::RequestQueue::configure(unsigned batch, unsigned banks, unsigned lineOffset, unsigned rowOffset) {
+    m_rowBatch = true;
+    m_batch = batch;
+    m_bankMask = banks - 1;
+    m_lineOffset = lineOffset;
+    m_rowOffset = rowOffset;
+    m_banks.resize(banks);
+    m_busyBanks.reserve(banks);
+}
+
+void MemBackendConvertor::RequestQueue::push( BaseReq* req ) {
+    m_size++;
+    if (!m_rowBatch) {
+        m_fifo.push_back(req);
+        return;
+    }
+
+    if (!req->isMemEv()) {
+        m_custom.push_back(Entry{req, m_seq++, 0});
+        return;
+    }
+
+    Addr addr = static_cast<MemReq*>(req)->baseAddr();
+    unsigned bankNum = (addr >> m_lineOffset) & m_bankMask;
+    Bank& bank = m_banks[bankNum];
+    if (bank.entries.empty())
+        m_busyBanks.push_back(bankNum);
+
+    Addr row = addr >> m_rowOffset;
+    bank.entries.push_back(Entry{req, m_seq++, row});
+    bank.rows[row].push_back(std::prev(bank.entries.end()));
+}
+
+/* Candidate request of a bank that is older than 'barrier', if any */
+MemBackendConvertor::RequestQueue::Entry* MemBackendConvertor::RequestQueue::select( Bank& bank, uint64_t barrier, EntryList::iterator& it ) {
+    if (bank.hasLastRow && bank.streak < m_batch) {
+        std::unordered_map<Addr, std::deque<EntryList::iterator> >::iterator row = bank.rows.find(bank.lastRow);
+        if (row != bank.rows.end() && row->second.front()->seq < barrier) {
+            it = row->second.front();
+            return &(*it);
+        }
+    }
+    if (bank.entries.front().seq < barrier) {
+        it = bank.entries.begin();
+        return &(*it);
+    }
+    return nullptr;
+}
+
+BaseReq* MemBackendConvertor::RequestQueue::front() {
+    if (!m_rowBatch)
+        return m_fifo.empty() ? nullptr : m_fifo.front();
+
+    if (m_inProgress)
+        return m_selected;
+
+    uint64_t barrier = m_custom.empty() ? UINT64_MAX : m_custom.front().seq;
+    uint64_t oldest = UINT64_MAX;
+    for (size_t i = 0; i < m_busyBanks.size(); i++) {
+        size_t pos = (m_next + i) % m_busyBanks.size();
+        Bank& bank = m_banks[m_busyBanks[pos]];
+        oldest = std::min(oldest, bank.entries.front().seq);
+        if (bank.blocked)
+            continue;
+        EntryList::iterator it;
+        if (select(bank, barrier, it) != nullptr) {
+            m_selected = it->req;
+            m_selectedBank = m_busyBanks[pos];
+            m_selectedIt = it;
+            m_next = pos;
+            return m_selected;
+        }
+    }
+
+    // Custom requests wait for all older memory requests to issue
+    if (!m_custom.empty() && barrier < oldest) {
+        m_selected = m_custom.front().req;
+        m_selectedBank = -1;
+        return m_selected;
+    }
+    return nullptr;
+}
+
+void MemBackendConvertor::RequestQueue::issued( bool done ) {
+    if (!m_rowBatch) {
+        if (done) {
+            m_fifo.pop_front();
+            m_size--;
+        }
+        return;
+    }
+
+    m_inProgress = !done;
+    if (!done)
+        return;
+
+    m_size--;
+    m_selected = nullptr;
+    if (m_selectedBank < 0) {
+        m_custom.pop_front();
+        return;
+    }
+
+    Bank& bank = m_banks[m_selectedBank];
+    Addr row = m_selectedIt->row;
+    if (bank.hasLastRow && bank.lastRow == row) {
+        bank.streak++;
+    } else {
+        bank.hasLastRow = true;
+        bank.lastRow = row;
+        bank.streak = 1;
+    }
+
+    // The selected entry is always the oldest to its row
+    std::unordered_map<Addr, std::deque<EntryList::iterator> >::iterator rowIt = bank.rows.find(row);
+    rowIt->second.pop_front();
+    if (rowIt->second.empty())
+        bank.rows.erase(rowIt);
+    bank.entries.erase(m_selectedIt);
+
+    if (bank.entries.empty()) {
+        std::vector<unsigned>::iterator busy = std::find(m_busyBanks.begin(), m_busyBanks.end(), (unsigned)m_selectedBank);
+        size_t pos = busy - m_busyBanks.begin();
+        m_busyBanks.erase(busy);
+        if (pos < m_next)
+            m_next--;
+    } else {
+        m_next++;   // Next bank's turn
+    }
+    if (m_next >= m_busyBanks.size())
+        m_next = 0;
+}
+
+bool MemBackendConvertor::RequestQueue::rejected() {
+    if (!m_rowBatch || m_inProgress || m_selectedBank < 0)
+        return false;
+    m_banks[m_selectedBank].blocked = true;
+    m_selected = nullptr;
+    return true;
+}
+
+void MemBackendConvertor::RequestQueue::startCycle() {
+    for (std::vector<unsigned>::iterator it = m_busyBanks.begin(); it != m_busyBanks.end(); it++)
+        m_banks[*it].blocked = false;
+}
+
+void MemBackendConvertor::RequestQueue::clear() {
+    while (!m_fifo.empty()) {
+        delete m_fifo.front();
+        m_fifo.pop_front();
+    }
+    while (!m_custom.empty()) {
+        delete m_custom.front().req;
+        m_custom.pop_front();
+    }
+    for (std::vector<Bank>::iterator bank = m_banks.begin(); bank != m_banks.end(); bank++) {
+        for (EntryList::iterator it = bank->entries.begin(); it != bank->entries.end(); it++)
+            delete it->req;
+        bank->entries.clear();
+        bank->rows.clear();
+    }
+    m_busyBanks.clear();
+    m_size = 0;
+}
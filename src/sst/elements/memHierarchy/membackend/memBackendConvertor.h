@@ -21,6 +21,9 @@
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
+#include <list>
+#include <unordered_map>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
@@ -40,7 +43,13 @@ class MemBackendConvertor : public SubComponent {
 /* ELI definitions for subclasses */
 #define MEMBACKENDCONVERTOR_ELI_PARAMS {"debug_level",     "(uint) Debugging level: 0 (no output) to 10 (all output). Output also requires that SST Core be compiled with '--enable-debug'", "0"},\
             {"debug_mask",      "(uint) Mask on debug_level", "0"},\
-            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"}
+            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"},\
+            {"request_log",     "(string) If set, write each completed request to this file as 'arrival cycle,address,is write,size,latency in cycles'. Used by sst-memh-calibrate.", ""},\
+            {"request_order",   "(string) Order in which requests are issued to the backend. 'fifo': arrival order. 'row_batch': per-bank queues, issuing up to 'row_batch_size' requests to a bank's last row ahead of older requests to other rows.", "fifo"},\
+            {"row_batch_size",  "(uint) For request_order=row_batch, maximum consecutive row hits issued to a bank ahead of an older request to another row", "4"},\
+            {"row_batch_banks", "(uint) For request_order=row_batch, number of banks requests are sorted into. Should match the backend.", "8"},\
+            {"row_batch_bank_interleave_granularity", "(string) For request_order=row_batch, granularity of interleaving across banks", "64B"},\
+            {"row_batch_row_size", "(string) For request_order=row_batch, size of a row", "8KiB"}
 
 #define MEMBACKENDCONVERTOR_ELI_STATS { "cycles_with_issue",                  "Total cycles with successful issue to back end",   "cycles",   1 },\
             { "cycles_attempted_issue_but_rejected","Total cycles where an attempt to issue to backend was rejected (indicates backend full)", "cycles", 1 },\
@@ -114,7 +123,7 @@ class MemBackendConvertor : public SubComponent {
     class MemReq : public BaseReq {
       public:
         MemReq( MemEvent* event, uint32_t reqId ) : BaseReq(reqId, BaseReq::ReqType::MEM),
-            m_event(event), m_offset(0), m_numReq(0) { }
+            m_event(event), m_offset(0), m_numReq(0), m_epoch(0) { }
         ~MemReq() { }
 
         static uint32_t getBaseId( ReqId id) { return id >> 32; }
@@ -126,6 +135,8 @@ class MemBackendConvertor : public SubComponent {
         MemEvent* getMemEvent() { return m_event; }
         bool isWrite()          { return (m_event->getCmd() == Command::PutM || m_event->getCmd() == Command::Write); }
         uint32_t size()         { return m_event->getSize(); }
+        uint64_t getEpoch()     { return m_epoch; }
+        void setEpoch( uint64_t epoch ) { m_epoch = epoch; }
         const std::string getRqstr() override { return m_event->getRqstr(); }
 
         void increment( uint32_t bytes ) {
@@ -151,6 +162,7 @@ class MemBackendConvertor : public SubComponent {
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+        uint64_t    m_epoch;    // Flush epoch of the request's address
     };
 
   public:
@@ -182,10 +194,7 @@ class MemBackendConvertor : public SubComponent {
     // such that all the requests are consolidated in one place
   protected:
     virtual ~MemBackendConvertor() {
-        while ( m_requestQueue.size()) {
-            delete m_requestQueue.front();
-            m_requestQueue.pop_front();
-        }
+        m_requestQueue.clear();
     }
 
     void doResponse( ReqId reqId, uint32_t flags = 0 );
@@ -199,42 +208,126 @@ class MemBackendConvertor : public SubComponent {
   private:
     virtual bool issue(BaseReq*) = 0;
 
+    /*
+     * Requests waiting to be issued to the backend.
+     *
+     * In FIFO mode, requests issue in arrival order.
+     * In row-batch mode, memory requests are sorted into per-bank queues
+     * that are also indexed by row. Banks take turns, and a bank issues the
+     * oldest request to the row it last issued to, unless it has already
+     * issued 'batch' requests to that row in a row, in which case it issues
+     * its oldest request. A bank whose request is rejected is skipped for
+     * the rest of the cycle. Custom requests are ordering barriers: they
+     * issue once every older request has issued, and no younger request
+     * issues before them.
+     *
+     * A request that needs several backend requests stays at the front
+     * until all of them have issued.
+     */
+    class RequestQueue {
+    public:
+        RequestQueue() : m_rowBatch(false), m_batch(0), m_bankMask(0), m_lineOffset(0), m_rowOffset(0),
+            m_size(0), m_seq(0), m_next(0), m_selected(nullptr), m_selectedBank(-1), m_inProgress(false) { }
+
+        void configure(unsigned batch, unsigned banks, unsigned lineOffset, unsigned rowOffset);
+
+        bool empty() const { return m_size == 0; }
+        size_t size() const { return m_size; }
+
+        void push( BaseReq* req );
+        /* Next request to issue this cycle, nullptr if none can be */
+        BaseReq* front();
+        /* The request returned by front() was issued; 'done' if fully */
+        void issued( bool done );
+        /* The request returned by front() was rejected. Returns true if another request may be tried this cycle */
+        bool rejected();
+        void startCycle();
+        void clear();
+
+    private:
+        struct Entry {
+            BaseReq* req;
+            uint64_t seq;
+            Addr row;
+        };
+        typedef std::list<Entry> EntryList;
+
+        struct Bank {
+            Bank() : lastRow(0), hasLastRow(false), streak(0), blocked(false) { }
+            EntryList entries;  // arrival order
+            std::unordered_map<Addr, std::deque<EntryList::iterator> > rows;
+            Addr lastRow;
+            bool hasLastRow;
+            unsigned streak;    // consecutive requests issued to lastRow
+            bool blocked;       // rejected this cycle
+        };
+
+        Entry* select( Bank& bank, uint64_t barrier, EntryList::iterator& it );
+
+        bool m_rowBatch;
+        unsigned m_batch;
+        Addr m_bankMask;
+        unsigned m_lineOffset;
+        unsigned m_rowOffset;
+
+        size_t m_size;
+        uint64_t m_seq;
+
+        std::deque<BaseReq*> m_fifo;        // FIFO mode
+        std::deque<Entry> m_custom;         // Row-batch mode, custom requests
+        std::vector<Bank> m_banks;
+        std::vector<unsigned> m_busyBanks;  // banks with queued requests
+        size_t m_next;                      // round-robin position in m_busyBanks
+
+        // Request returned by front()
+        BaseReq* m_selected;
+        int m_selectedBank;                 // -1 for a custom request
+        EntryList::iterator m_selectedIt;
+        bool m_inProgress;                  // partially issued
+    };
 
+    /*
+     * Flushes are ordered per address by epochs. Each memory request joins
+     * the open epoch of its address, and a flush closes the open epoch. A
+     * flush is responded to once its epoch and all earlier ones are empty.
+     */
+    struct FlushEpoch {
+        uint32_t outstanding;   // requests in the epoch that have not completed
+        MemEvent* flush;        // flush closing the epoch, nullptr if open
+    };
 
+    struct AddrEpochs {
+        uint64_t first;         // epoch number of epochs.front()
+        std::deque<FlushEpoch> epochs;
+    };
 
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
-                }
-            }
-
-            if (dependsOn.empty()) return false;
-            m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
+            std::unordered_map<Addr, AddrEpochs>::iterator it = m_flushEpochs.find(ev->getBaseAddr());
+            if (it == m_flushEpochs.end()) return false;
+            it->second.epochs.back().flush = ev;
+            it->second.epochs.push_back(FlushEpoch{0, nullptr});
             return true;
         }
 
         uint32_t id = genReqId();
         MemReq* req = new MemReq( ev, id );
-        m_requestQueue.push_back( req );
+
+        AddrEpochs& addrEpochs = m_flushEpochs[ev->getBaseAddr()];
+        if (addrEpochs.epochs.empty()) {
+            addrEpochs.first = 0;
+            addrEpochs.epochs.push_back(FlushEpoch{0, nullptr});
+        }
+        addrEpochs.epochs.back().outstanding++;
+        req->setEpoch(addrEpochs.first + addrEpochs.epochs.size() - 1);
+
+        m_requestQueue.push( req );
         m_pendingRequests[id] = req;
         return true;
     }
 
+    void completeFlushEpoch( Addr addr, uint64_t epoch );
+
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);
     }
@@ -287,6 +380,8 @@ class MemBackendConvertor : public SubComponent {
 
     uint64_t m_cycleCount;
 
+    FILE* m_requestLog;
+
     bool m_clockOn;
 
     // Callback functions to parent component
@@ -299,12 +394,11 @@ class MemBackendConvertor : public SubComponent {
 
     typedef std::map<uint32_t,BaseReq*> PendingRequests;
 
-    std::deque<BaseReq*>    m_requestQueue;
+    RequestQueue            m_requestQueue;
     PendingRequests         m_pendingRequests;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    std::unordered_map<Addr, AddrEpochs> m_flushEpochs; // Addresses with outstanding requests or flushes
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
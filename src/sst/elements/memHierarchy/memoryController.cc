@@ -107,6 +107,10 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     clockTimeBase_ = registerClock(clockfreq, clockHandler_);
     clockOn_ = true;
 
+    sampling_ = new SamplingController(params, &out, getName());
+    if (sampling_->isEnabled())
+        sampling_->setStatistics(registerStatistic<double>("sampled_window_latency"), registerStatistic<double>("sampled_window_throughput"));
+
     backing_outscreen_ = params.find<bool>("backing_out_screen", false);
 
     string link_lat         = params.find<std::string>("direct_link_latency", "10 ns");
@@ -379,6 +383,8 @@ void MemController::handleEvent(SST::Event* event) {
 
     MemEventBase *meb = static_cast<MemEventBase*>(event);
 
+    sampling_->update(getCurrentSimTimeNano());
+
     if (is_debug_event(meb)) {
         Debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:New     (%s)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), meb->getVerboseString(dlevel).c_str());
@@ -441,7 +447,15 @@ void MemController::handleEvent(SST::Event* event) {
         case Command::GetX:
         case Command::GetSX:
         case Command::Write:
+            if (sampling_->isWarming() && outstandingEvents_.empty()) {
+                // Functional warming: update the backing store and respond now
+                outstandingEvents_.insert(std::make_pair(ev->getID(), ev));
+                handleMemResponse(ev->getID(), 0);
+                break;
+            }
             outstandingEvents_.insert(std::make_pair(ev->getID(), ev));
+            if (sampling_->isEnabled())
+                sampleStartTimes_.insert(std::make_pair(ev->getID(), getNextClockCycle(clockTimeBase_) - 1));
             if (is_debug_event(ev)) {
                 Debug(_L4_, "B: %-20" PRIu64 " %-20" PRIu64 " %-20s Bkend:Send    (%s)\n",
                         getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
@@ -553,6 +567,15 @@ void MemController::handleMemResponse( Event::id_type id, uint32_t flags ) {
     MemEventBase * evb = it->second;
     outstandingEvents_.erase(it);
 
+    if (sampling_->isEnabled()) {
+        sampling_->update(getCurrentSimTimeNano());
+        std::map<SST::Event::id_type, Cycle_t>::iterator st = sampleStartTimes_.find(id);
+        if (st != sampleStartTimes_.end()) {
+            sampling_->recordLatency(getNextClockCycle(clockTimeBase_) - 1 - st->second);
+            sampleStartTimes_.erase(st);
+        }
+    }
+
     if (is_debug_event(evb)) {
         Debug(_L4_, "B: %-20" PRIu64 " %-20" PRIu64 " %-20s Bkend:Recv    (<%" PRIu64 ",%" PRIu32 ">)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), id.first, id.second);
@@ -648,7 +671,12 @@ void MemController::finish(void) {
     Cycle_t cycle = getNextClockCycle(clockTimeBase_); // Get finish time
     cycle--;
     memBackendConvertor_->finish(cycle);
+    sampling_->finish(getCurrentSimTimeNano());
     link_->finish();
+
+    const MemEventPool::Counters& pool = MemEventPool::getCounters();
+    out.verbose(CALL_INFO, 2, 0, "%s, MemEvent payload pool (this thread): %" PRIu64 " payloads allocated, %" PRIu64 " reused\n",
+            getName().c_str(), pool.payloadAllocs, pool.payloadReuses);
     if ( backing_outfile_ != "" ) {
         try { 
             backing_->printToFile(backing_outfile_);
@@ -26,6 +26,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/sampling.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -57,13 +58,16 @@ public:
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"backing_init_zero",   "(string) For 'malloc' backing stores, whether to initialize memory values to 0", "false"},\
             {"memory_file",         "(string) DEPRECATED: Use 'backing_in_file' and/or 'backing_out_file' instead. Optional backing-store file to pre-load memory and/or store resulting state. If file does not exist, the backing-store will create it.", "N/A"},\
-            {"backing_in_file",     "(string) An optional file to pre-load memory contents from.", ""},\
+            {"backing_in_file",     "(string) An optional file to pre-load memory contents from. With 'backing=mmap' and no 'backing_out_file', a file at least as large as memory is mapped copy-on-write rather than copied, so restoring a large image is fast and leaves the file unchanged.", ""},\
             {"backing_out_file",    "(string) An optional file to write out memory contents to. Setting this will also trigger a flush of cache contents prior to writing the file. May be the same as 'backing_in_file'.", ""},\
             {"backing_out_screen",  "(bool) Write out memory contents to screen at end of simulation. Setting this will also trigger a flush of cache contents prior to writing to screen.", "false"},\
-            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""}
+            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""},\
+            MEMHIERARCHY_SAMPLING_ELI_PARAMS
 
     SST_ELI_DOCUMENT_PARAMS( MEMCONTROLLER_ELI_PARAMS )
 
+    SST_ELI_DOCUMENT_STATISTICS( MEMHIERARCHY_SAMPLING_ELI_STATS )
+
 #define MEMCONTROLLER_ELI_PORTS {"highlink", "Direct connection to another memHierarchy component or subcomponent. If a network port is needed, fill the 'highlink' subcomponent slot instead.", {"memHierarchy.MemEventBase"} },\
             {"direct_link", "DEPRECATED: Use 'highlink' subcomponent or port instead. Direct connection to a cache/directory controller", {"memHierarchy.MemEventBase"} },\
             {"network",     "DEPRECATED: Set 'highlink' subcomponent slot to memHierarchy.MemNIC or memHierarchy.MemNICFour instead. Network connection to a cache/directory controller; also request network for split networks", {"memHierarchy.MemRtrEvent"} },\
@@ -165,6 +169,10 @@ protected:
 
     CustomCmdMemHandler * customCommandHandler_;
 
+    /* Statistical sampling. During functional warming, requests bypass the backend once it has drained */
+    SamplingController* sampling_;
+    std::map<SST::Event::id_type, Cycle_t> sampleStartTimes_;
+
     /* Debug -triggered by output.fatal() and/or SIGUSR2 */
     virtual void printStatus(Output &out);
     virtual void emergencyShutdown();
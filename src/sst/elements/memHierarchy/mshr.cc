@@ -107,6 +107,7 @@ void MSHR::removeEntry(Addr addr, size_t index) {
             //dbg_->debug(_L10_, "M: %-41" PRIu64 " %-20s Erase        0x%-16" PRIx64 " %-10d\n",
             //        getCurrentSimCycle(), owner_name_.c_str(), addr, size_);
             //dbg_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
+        MemEventPool::releasePayload(reg->data_buffer_);
         mshr_.erase(addr);
     }
 }
@@ -134,6 +135,7 @@ void MSHR::removeFront(Addr addr) {
         if (is_debug_addr(addr))
             printDebug(10, "Erase", addr, "");
             //dbg_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
+        MemEventPool::releasePayload(reg->data_buffer_);
         mshr_.erase(addr);
     }
 }
@@ -675,6 +677,7 @@ void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
     if (is_debug_addr(addr))
         printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
 
+    MemEventPool::reservePayload(mshr_.find(addr)->second.data_buffer_, data.size());
     mshr_.find(addr)->second.data_buffer_ = data;
     mshr_.find(addr)->second.data_dirty_ = dirty;
 }
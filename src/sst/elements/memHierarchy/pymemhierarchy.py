@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2025 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2025, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+
+
+class Slices:
+    """A shared cache or directory distributed across slices.
+
+    Creates 'num_slices' components of type 'component' (memHierarchy.Cache
+    or memHierarchy.DirectoryController), each with its slice parameters set
+    and a network interface in 'nic_slot'. With policy 'xor', addresses are
+    distributed by an XOR hash of the line address, which spreads
+    power-of-two strides evenly; 'num_slices' must then be a power of two.
+    With policy 'rr', lines are interleaved round-robin.
+
+    Example, a 16-slice LLC on a mesh:
+        llc = Slices("l3_", 16, l3_params, nic_params={"group" : 2})
+        llc.connect([(router[i], "port0") for i in range(16)])
+    """
+
+    def __init__(self, name, num_slices, params, component="memHierarchy.Cache", policy="xor",
+            nic="memHierarchy.MemNIC", nic_slot="highlink", nic_params=None):
+        if policy == "xor" and (num_slices & (num_slices - 1)) != 0:
+            raise ValueError("Slices: num_slices must be a power of two for policy 'xor', got %d" % num_slices)
+
+        if component == "memHierarchy.DirectoryController":
+            names = ("num_slices", "slice_id", "slice_allocation_policy")
+        else:
+            names = ("num_cache_slices", "slice_id", "slice_allocation_policy")
+
+        self.components = []
+        self.nics = []
+        for i in range(num_slices):
+            comp = sst.Component("%s%d" % (name, i), component)
+            comp.addParams(params)
+            comp.addParams({names[0] : num_slices, names[1] : i, names[2] : policy})
+            nicComp = comp.setSubComponent(nic_slot, nic)
+            if nic_params:
+                nicComp.addParams(nic_params)
+            self.components.append(comp)
+            self.nics.append(nicComp)
+
+    def __len__(self):
+        return len(self.components)
+
+    def connect(self, endpoints, latency="100ps", port="port", no_cut=True):
+        """Connect the network interface of slice i to endpoints[i], a (component, port) tuple.
+
+        With 'no_cut', the links are marked so the partitioner never places a
+        slice and its router on different ranks. Only router-to-router links
+        are then cut, so a slice's traffic to its router never crosses ranks.
+        """
+        if len(endpoints) != len(self.nics):
+            raise ValueError("Slices: %d endpoints given for %d slices" % (len(endpoints), len(self.nics)))
+        links = []
+        for i, (comp, comp_port) in enumerate(endpoints):
+            link = sst.Link("%s_%s" % (self.components[i].getFullName(), port))
+            link.connect((self.nics[i], port, latency), (comp, comp_port, latency))
+            if no_cut:
+                link.setNoCut()
+            links.append(link)
+        return links
+
+    def setRanks(self, ranks, threads=None):
+        """Place slice i on ranks[i] (and threads[i]), e.g., the rank of its router."""
+        for i, comp in enumerate(self.components):
+            if threads is None:
+                comp.setRank(ranks[i])
+            else:
+                comp.setRank(ranks[i], threads[i])
@@ -0,0 +1,122 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <cmath>
+
+#include "sampling.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/* Two-sided 95% Student's t values for 1..30 degrees of freedom */
+static const double tTable95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+
+static SimTime_t toNs(Params& params, const std::string& key, const std::string& def, Output* out, const std::string& name) {
+    UnitAlgebra ua(params.find<std::string>(key, def));
+    if (!ua.hasUnits("s"))
+        out->fatal(CALL_INFO, -1, "%s, Error: parameter '%s' must be a time with units of 's'. You specified '%s'\n",
+                name.c_str(), key.c_str(), ua.toString().c_str());
+    return (ua * UnitAlgebra("1GHz")).getRoundedValue();
+}
+
+SamplingController::SamplingController(Params& params, Output* out, const std::string& name) :
+        out_(out), name_(name), warming_(false), measuring_(false), windowMeasured_(false), window_(0),
+        windowLatency_(0), windowRequests_(0), emptyWindows_(0), statLatency_(nullptr), statThroughput_(nullptr) {
+    periodNs_ = toNs(params, "sampling_period", "0s", out, name);
+    warmupNs_ = toNs(params, "sampling_warmup", "1us", out, name);
+    detailNs_ = toNs(params, "sampling_detail", "10us", out, name);
+
+    latency_ = {0, 0.0, 0.0};
+    throughput_ = {0, 0.0, 0.0};
+
+    if (periodNs_ != 0 && (detailNs_ == 0 || warmupNs_ + detailNs_ > periodNs_))
+        out->fatal(CALL_INFO, -1, "%s, Error: sampling_detail must be non-zero and sampling_warmup + sampling_detail must not exceed sampling_period\n",
+                name.c_str());
+}
+
+bool SamplingController::update(SimTime_t nowNs) {
+    if (!isEnabled()) return false;
+
+    SimTime_t window = nowNs / periodNs_;
+    SimTime_t offset = nowNs % periodNs_;
+    if (window != window_) {
+        closeWindow();
+        window_ = window;
+    }
+
+    bool measuring = offset >= warmupNs_ && offset < warmupNs_ + detailNs_;
+    if (measuring_ && !measuring)
+        closeWindow();
+    measuring_ = measuring;
+    windowMeasured_ |= measuring;
+
+    bool warming = offset >= warmupNs_ + detailNs_;
+    bool changed = warming != warming_;
+    warming_ = warming;
+    return changed;
+}
+
+void SamplingController::closeWindow() {
+    if (!windowMeasured_) return;
+    windowMeasured_ = false;
+
+    if (windowRequests_ == 0) {
+        emptyWindows_++;
+        return;
+    }
+
+    double latency = (double)windowLatency_ / windowRequests_;
+    double throughput = (double)windowRequests_ / detailNs_;
+    latency_.add(latency);
+    throughput_.add(throughput);
+    if (statLatency_) statLatency_->addData(latency);
+    if (statThroughput_) statThroughput_->addData(throughput);
+
+    windowLatency_ = 0;
+    windowRequests_ = 0;
+}
+
+void SamplingController::finish(SimTime_t nowNs) {
+    if (!isEnabled()) return;
+    update(nowNs);
+    measuring_ = false;
+    closeWindow();
+
+    out_->output("%s sampling: %" PRIu64 " measured windows, %" PRIu64 " without requests. "
+            "Latency: %.3f +/- %.3f cycles, throughput: %.6f +/- %.6f requests/ns (95%% confidence)\n",
+            name_.c_str(), latency_.samples, emptyWindows_, latency_.mean, latency_.halfWidth(),
+            throughput_.mean, throughput_.halfWidth());
+}
+
+/* Welford's running mean and variance */
+void SamplingController::Estimate::add(double x) {
+    samples++;
+    double delta = x - mean;
+    mean += delta / samples;
+    m2 += delta * (x - mean);
+}
+
+double SamplingController::Estimate::halfWidth() const {
+    if (samples < 2) return 0.0;
+    uint64_t df = samples - 1;
+    double t = df <= 30 ? tTable95[df - 1] : 1.960;
+    return t * std::sqrt(m2 / df / samples);
+}
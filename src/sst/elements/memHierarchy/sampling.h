@@ -0,0 +1,115 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SAMPLING_H
+#define MEMHIERARCHY_SAMPLING_H
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+#include <sst/core/component.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+#define MEMHIERARCHY_SAMPLING_ELI_PARAMS \
+            {"sampling_period",         "(string) Statistical sampling: time between the starts of successive detailed windows. Between windows, the component runs in functional warming mode, which drops timing but still carries every event through the hierarchy, so it speeds up simulation far less than skipping events would. '0s' disables sampling.", "0s"},\
+            {"sampling_warmup",         "(string) Statistical sampling: detailed simulation at the start of each window that is not measured, to warm up queues and in-flight state.", "1us"},\
+            {"sampling_detail",         "(string) Statistical sampling: measured detailed simulation in each window.", "10us"}
+
+#define MEMHIERARCHY_SAMPLING_ELI_STATS \
+            {"sampled_window_latency",  "Statistical sampling: mean request latency of each measured window, in cycles", "cycles", 1},\
+            {"sampled_window_throughput", "Statistical sampling: requests completed per ns in each measured window", "requests/ns", 1}
+
+/*
+ * Schedule for SMARTS-style statistical sampling.
+ *
+ * Every 'sampling_period', a component runs 'sampling_warmup' of detailed,
+ * unmeasured simulation followed by 'sampling_detail' of measured detailed
+ * simulation. The rest of the period is functional warming: the owner keeps
+ * updating cache, replacement, directory and memory state but drops its
+ * timing (latencies and per-cycle limits). Every event is still delivered
+ * during warming, so the savings are limited to the dropped timing work;
+ * the cost per event does not go to zero as it would if warming bypassed
+ * the event-driven hierarchy. The schedule is a function of simulated time
+ * only, so every component configured with the same parameters switches
+ * phase at the same time without exchanging messages.
+ *
+ * Each measured window contributes one sample of mean latency and of
+ * throughput. The summary reports their means with 95% confidence intervals.
+ */
+class SamplingController {
+public:
+    SamplingController(Params& params, Output* out, const std::string& name);
+
+    bool isEnabled() const { return periodNs_ != 0; }
+    bool isWarming() const { return warming_; }
+
+    /* Update the phase for the current time. Returns true if the component
+     * moved in or out of functional warming. */
+    bool update(SimTime_t nowNs);
+
+    /* Record the latency of a request completed at the current time */
+    void recordLatency(uint64_t latency) {
+        if (measuring_) {
+            windowLatency_ += latency;
+            windowRequests_++;
+        }
+    }
+
+    void setStatistics(Statistic<double>* latency, Statistic<double>* throughput) {
+        statLatency_ = latency;
+        statThroughput_ = throughput;
+    }
+
+    /* Close the open window and print the estimates */
+    void finish(SimTime_t nowNs);
+
+private:
+    struct Estimate {
+        uint64_t samples;
+        double mean;
+        double m2;
+        void add(double x);
+        double halfWidth() const; // 95% confidence interval
+    };
+
+    void closeWindow();
+
+    Output* out_;
+    std::string name_;
+
+    SimTime_t periodNs_;
+    SimTime_t warmupNs_;
+    SimTime_t detailNs_;
+
+    bool warming_;
+    bool measuring_;
+    bool windowMeasured_;       // the current window has been in its measured part
+    SimTime_t window_;          // index of the current period
+
+    uint64_t windowLatency_;
+    uint64_t windowRequests_;
+    uint64_t emptyWindows_;
+
+    Estimate latency_;
+    Estimate throughput_;
+
+    Statistic<double>* statLatency_;
+    Statistic<double>* statThroughput_;
+};
+
+}}
+
+#endif
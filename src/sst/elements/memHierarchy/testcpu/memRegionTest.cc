@@ -0,0 +1,234 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "testcpu/memRegionTest.h"
+
+#include <sst/core/params.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+MemRegionTest::MemRegionTest(ComponentId_t id, Params& params) :
+    Component(id), checks(0), failures(0)
+{
+    out.init("MemRegionTest: ", 0, 0, Output::STDOUT);
+    lineSize = params.find<Addr>("line_size", 64);
+    limit = params.find<Addr>("limit", 65536);
+    verbose = params.find<bool>("verbose", false);
+
+    if (lineSize == 0 || limit < 64 * lineSize)
+        out.fatal(CALL_INFO, -1, "%s, Invalid param: limit must be at least 64 lines. You specified line_size=%" PRIu64 " and limit=%" PRIu64 ".\n",
+                getName().c_str(), lineSize, limit);
+}
+
+void MemRegionTest::setup() {
+    testIntersect();
+    testSlices();
+
+    if (failures > 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: %" PRIu32 " of %" PRIu32 " checks failed\n", getName().c_str(), failures, checks);
+
+    out.output("passed %" PRIu32 " checks\n", checks);
+}
+
+void MemRegionTest::check(bool result, const std::string& what) {
+    checks++;
+    if (!result) {
+        failures++;
+        out.output("FAILED: %s\n", what.c_str());
+    } else if (verbose) {
+        out.output("passed: %s\n", what.c_str());
+    }
+}
+
+static bool setContains(const std::set<MemRegion>& regions, Addr addr) {
+    for (std::set<MemRegion>::const_iterator it = regions.begin(); it != regions.end(); it++) {
+        if (it->contains(addr)) return true;
+    }
+    return false;
+}
+
+void MemRegionTest::checkIntersect(const MemRegion& a, const MemRegion& b, bool exact, const std::string& what) {
+    std::set<MemRegion> regions = a.intersect(b);
+    bool missing = false;   // In both, not in the intersection
+    bool extra = false;     // In the intersection, not in both (or not in 'a' if !exact)
+    bool overlap = false;
+    for (Addr addr = 0; addr < limit; addr += lineSize / 4) {
+        bool both = a.contains(addr) && b.contains(addr);
+        bool got = setContains(regions, addr);
+        overlap |= both;
+        if (both && !got) missing = true;
+        if (got && (exact ? !both : !a.contains(addr))) extra = true;
+    }
+    check(!missing, what + ": intersection contains every address in both regions");
+    check(!extra, what + (exact ? ": intersection contains only addresses in both regions" : ": intersection lies within the first region"));
+    check(!overlap || a.doesIntersect(b), what + ": doesIntersect() finds the overlap");
+}
+
+void MemRegionTest::checkPartition(const std::vector<MemRegion>& slices, const std::string& what) {
+    bool ok = true;
+    for (Addr addr = 0; addr < limit; addr += lineSize / 4) {
+        uint32_t owners = 0;
+        for (size_t i = 0; i < slices.size(); i++) {
+            if (slices[i].contains(addr)) owners++;
+        }
+        if (owners != 1) ok = false;
+    }
+    check(ok, what + ": every address is in exactly one slice");
+
+    ok = true;
+    for (size_t i = 0; i < slices.size(); i++) {
+        for (size_t j = i + 1; j < slices.size(); j++) {
+            if (!slices[i].intersect(slices[j]).empty() || slices[i].doesIntersect(slices[j])) ok = false;
+        }
+    }
+    check(ok, what + ": slices do not intersect each other");
+}
+
+void MemRegionTest::checkBalance(const std::vector<MemRegion>& slices, const std::string& what) {
+    Addr count = slices.size();
+    bool ok = true;
+    for (Addr group = 0; group + count * lineSize <= limit; group += count * lineSize) {
+        std::vector<uint32_t> seen(count, 0);
+        for (Addr line = 0; line < count; line++) {
+            for (size_t i = 0; i < count; i++) {
+                if (slices[i].contains(group + line * lineSize)) seen[i]++;
+            }
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (seen[i] != 1) ok = false;
+        }
+    }
+    check(ok, what + ": each aligned group of lines maps to every slice once");
+
+    /* count * count lines at a stride of 2^k lines cover each slice equally */
+    for (uint32_t k = 1; k <= 8; k++) {
+        std::vector<uint32_t> seen(count, 0);
+        for (Addr n = 0; n < count * count; n++) {
+            Addr addr = (n << k) * lineSize;
+            for (size_t i = 0; i < count; i++) {
+                if (slices[i].contains(addr)) seen[i]++;
+            }
+        }
+        ok = true;
+        for (size_t i = 0; i < count; i++) {
+            if (seen[i] != count) ok = false;
+        }
+        check(ok, what + ": stride of " + std::to_string(1 << k) + " lines is spread evenly");
+    }
+}
+
+MemRegion MemRegionTest::plain(Addr start, Addr end) {
+    MemRegion region;
+    region.setDefault();
+    region.start = start;
+    region.end = end;
+    return region;
+}
+
+/* As set up by caches and directories for slice_allocation_policy=rr */
+MemRegion MemRegionTest::roundRobin(uint32_t slices, uint32_t slice) {
+    MemRegion region;
+    region.setDefault();
+    region.start = slice * lineSize;
+    region.interleaveSize = lineSize;
+    region.interleaveStep = slices * lineSize;
+    return region;
+}
+
+/* As set up by caches and directories for slice_allocation_policy=xor */
+MemRegion MemRegionTest::hashed(uint32_t slices, uint32_t slice) {
+    MemRegion region;
+    region.setDefault();
+    region.setHash(slices, slice, lineSize);
+    return region;
+}
+
+void MemRegionTest::testIntersect() {
+    MemRegion all;
+    all.setDefault();
+
+    checkIntersect(plain(0, limit / 2 - 1), plain(limit / 4, MemRegion::REGION_MAX), true, "plain ranges");
+    checkIntersect(roundRobin(4, 1), all, true, "rr slice with whole memory");
+    checkIntersect(all, roundRobin(4, 1), true, "whole memory with rr slice");
+    checkIntersect(roundRobin(4, 1), roundRobin(2, 1), true, "rr slices with different steps");
+    checkIntersect(roundRobin(4, 1), roundRobin(2, 0), true, "disjoint rr slices");
+
+    checkIntersect(hashed(4, 2), all, true, "xor slice with whole memory");
+    checkIntersect(all, hashed(4, 2), true, "whole memory with xor slice");
+    checkIntersect(hashed(4, 2), plain(limit / 4, limit / 2 - 1), true, "xor slice with a plain range");
+    checkIntersect(hashed(4, 2), roundRobin(2, 0), true, "xor slice with rr slice");
+    checkIntersect(roundRobin(2, 1), hashed(4, 3), true, "rr slice with xor slice");
+    checkIntersect(hashed(4, 2), hashed(4, 2), true, "same xor slice");
+
+    check(hashed(4, 2).intersect(hashed(4, 3)).empty(), "different slices of the same xor hash: intersection is empty");
+    check(!hashed(4, 2).doesIntersect(hashed(4, 3)), "different slices of the same xor hash: doesIntersect() is false");
+
+    /* A cache hashed 4 ways above a directory hashed 2 ways. The intersection
+     * keeps the cache's hash, and together the directory slices must cover
+     * the whole cache slice or a route to it would be lost. */
+    for (uint32_t slice = 0; slice < 4; slice++) {
+        std::string what = "xor slice " + std::to_string(slice) + "/4 with xor slices of 2";
+        std::set<MemRegion> regions;
+        for (uint32_t other = 0; other < 2; other++) {
+            checkIntersect(hashed(4, slice), hashed(2, other), false, what);
+            std::set<MemRegion> reg = hashed(4, slice).intersect(hashed(2, other));
+            regions.insert(reg.begin(), reg.end());
+        }
+        bool ok = true;
+        for (Addr addr = 0; addr < limit; addr += lineSize) {
+            if (hashed(4, slice).contains(addr) != setContains(regions, addr)) ok = false;
+        }
+        check(ok, what + ": union of intersections is the xor slice");
+    }
+}
+
+void MemRegionTest::testSlices() {
+    for (uint32_t count = 1; count <= 8; count++) {
+        std::vector<MemRegion> slices;
+        for (uint32_t i = 0; i < count; i++) {
+            slices.push_back(count == 1 ? plain(0, MemRegion::REGION_MAX) : roundRobin(count, i));
+        }
+        checkPartition(slices, std::to_string(count) + " rr slices");
+    }
+
+    for (uint32_t count = 1; count <= 16; count *= 2) {
+        std::vector<MemRegion> slices;
+        for (uint32_t i = 0; i < count; i++) {
+            slices.push_back(hashed(count, i));
+        }
+        std::string what = std::to_string(count) + " xor slices";
+        checkPartition(slices, what);
+        checkBalance(slices, what);
+
+        /* Caches and directories keep the hash when the slice also has an address range */
+        for (uint32_t i = 0; i < count; i++) {
+            MemRegion region = hashed(count, i);
+            region.start = limit / 4;
+            region.end = limit / 2 - 1;
+            slices[i] = region;
+        }
+        bool ok = true;
+        for (Addr addr = 0; addr < limit; addr += lineSize) {
+            uint32_t owners = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                if (slices[i].contains(addr)) owners++;
+            }
+            if (owners != ((addr >= limit / 4 && addr < limit / 2) ? 1u : 0u)) ok = false;
+        }
+        check(ok, what + " within an address range: every address in the range is in exactly one slice");
+    }
+}
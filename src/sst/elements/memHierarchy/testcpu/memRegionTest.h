@@ -0,0 +1,90 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMREGIONTEST_H
+#define _MEMREGIONTEST_H
+
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#include <sst/core/component.h>
+#include <sst/core/output.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "memTypes.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Checks MemRegion containment and intersection, and the slice regions that
+ * caches and directories build for 'rr' and 'xor' slice_allocation_policy,
+ * against a brute-force walk of the address space. Runs in setup() and ends
+ * the simulation with a fatal error if any check fails.
+ */
+class MemRegionTest : public SST::Component {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_COMPONENT(MemRegionTest, "memHierarchy", "MemRegionTest", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Checks address region intersection and slice distribution", COMPONENT_CATEGORY_UNCATEGORIZED)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"line_size",   "(uint) Line size, in bytes, used for slices and interleaving", "64"},
+            {"limit",       "(uint) Addresses [0, limit) are checked", "65536"},
+            {"verbose",     "(bool) Print each check as it is made", "0"} )
+
+/* Begin class definition */
+    MemRegionTest(SST::ComponentId_t id, SST::Params& params);
+    ~MemRegionTest() { }
+
+    void setup() override;
+
+private:
+    void check(bool result, const std::string& what);
+
+    /* Compare a.intersect(b) against a.contains() && b.contains(). If not
+     * 'exact', the intersection may be larger but must lie within 'a'. */
+    void checkIntersect(const MemRegion& a, const MemRegion& b, bool exact, const std::string& what);
+
+    /* Every line is in exactly one of 'slices' */
+    void checkPartition(const std::vector<MemRegion>& slices, const std::string& what);
+
+    /* Each aligned group of slices.size() lines and each power-of-two stride
+     * is spread evenly across 'slices' */
+    void checkBalance(const std::vector<MemRegion>& slices, const std::string& what);
+
+    void testIntersect();
+    void testSlices();
+
+    MemRegion plain(Addr start, Addr end);
+    MemRegion roundRobin(uint32_t slices, uint32_t slice);
+    MemRegion hashed(uint32_t slices, uint32_t slice);
+
+    SST::Output out;
+    Addr lineSize;
+    Addr limit;
+    bool verbose;
+    uint32_t checks;
+    uint32_t failures;
+};
+
+}
+}
+#endif /* _MEMREGIONTEST_H */
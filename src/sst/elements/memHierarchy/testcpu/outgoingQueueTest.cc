@@ -0,0 +1,164 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "testcpu/outgoingQueueTest.h"
+
+#include <sst/core/params.h>
+
+#include "memEvent.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+OutgoingQueueTest::OutgoingQueueTest(ComponentId_t id, Params& params) :
+    Component(id), rng(id, 13), checks(0), failures(0)
+{
+    out.init("OutgoingQueueTest: ", 0, 0, Output::STDOUT);
+    uint32_t seed = params.find<uint32_t>("rngseed", 7);
+    rng.restart(seed, 13);
+    events = params.find<uint64_t>("events", 100000);
+    verbose = params.find<bool>("verbose", false);
+}
+
+void OutgoingQueueTest::setup() {
+    testOrder(1, 8, 0, "one address, short latencies");
+    testOrder(16, 8, 0, "16 addresses, short latencies");
+    testOrder(16, 200, 0, "16 addresses, long latencies");
+    testOrder(64, 8, 50, "64 addresses, bursts far ahead");
+    testShrink();
+
+    if (failures > 0)
+        out.fatal(CALL_INFO, -1, "%s, Error: %" PRIu32 " of %" PRIu32 " checks failed\n", getName().c_str(), failures, checks);
+
+    out.output("passed %" PRIu32 " checks\n", checks);
+}
+
+void OutgoingQueueTest::check(bool result, const std::string& what) {
+    checks++;
+    if (!result) {
+        failures++;
+        out.output("FAILED: %s\n", what.c_str());
+    } else if (verbose) {
+        out.output("passed: %s\n", what.c_str());
+    }
+}
+
+/* The reference is the list the queues used to be: walk back from the newest
+ * event and insert after the first that is due no later or has the same address */
+void OutgoingQueueTest::insert(OutgoingQueue& queue, std::list<Response>& reference, uint64_t time, Addr addr) {
+    MemEvent * ev = new MemEvent(getName(), addr, addr, Command::GetS);
+    Response resp = {ev, time, 8};
+    queue.insert(resp);
+
+    std::list<Response>::reverse_iterator rit;
+    for (rit = reference.rbegin(); rit != reference.rend(); rit++) {
+        if (time >= (*rit).deliveryTime) break;
+        if (addr == (*rit).event->getRoutingAddress()) break;
+    }
+    reference.insert(rit.base(), resp);
+}
+
+bool OutgoingQueueTest::popUntil(OutgoingQueue& queue, std::list<Response>& reference, uint64_t time, uint32_t limit) {
+    for (uint32_t popped = 0; popped < limit && !reference.empty() && reference.front().deliveryTime <= time; popped++) {
+        if (queue.empty() || queue.front().event != reference.front().event)
+            return false;
+        MemEventBase * ev = reference.front().event;
+        queue.pop();
+        reference.pop_front();
+        delete ev;
+    }
+    return queue.size() == reference.size();
+}
+
+void OutgoingQueueTest::clear(std::list<Response>& reference) {
+    for (std::list<Response>::iterator it = reference.begin(); it != reference.end(); it++)
+        delete it->event;
+    reference.clear();
+}
+
+void OutgoingQueueTest::testOrder(uint32_t lines, uint64_t maxLatency, uint32_t burstFreq, const std::string& what) {
+    OutgoingQueue queue;
+    std::list<Response> reference;
+    uint64_t now = 0;
+    uint64_t inserted = 0;
+    size_t maxBuckets = queue.buckets();
+    bool ok = true;
+
+    while (ok && inserted < events) {
+        uint32_t count = rng.generateNextUInt32() % 4;
+        for (uint32_t i = 0; i < count; i++, inserted++) {
+            uint64_t latency = rng.generateNextUInt32() % (maxLatency + 1);
+            if (burstFreq != 0 && rng.generateNextUInt32() % burstFreq == 0)
+                latency += 1000 + rng.generateNextUInt32() % 4000;
+            insert(queue, reference, now + latency, (rng.generateNextUInt32() % lines) * 64);
+        }
+        /* Bandwidth limits may leave due events queued */
+        ok = popUntil(queue, reference, now, 1 + rng.generateNextUInt32() % 3);
+        maxBuckets = std::max(maxBuckets, queue.buckets());
+        now++;
+    }
+    ok = ok && popUntil(queue, reference, std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint32_t>::max());
+
+    check(ok, what + ": events leave in the order of a delivery-ordered list");
+    check(queue.empty(), what + ": queue is empty once drained");
+    check(queue.buckets() == OutgoingQueue::minBuckets, what + ": wheel returns to " + std::to_string(OutgoingQueue::minBuckets) +
+            " buckets once drained, largest was " + std::to_string(maxBuckets));
+    if (burstFreq != 0)
+        check(maxBuckets > OutgoingQueue::minBuckets, what + ": wheel grows for bursts");
+
+    clear(reference);
+}
+
+void OutgoingQueueTest::testShrink() {
+    OutgoingQueue queue;
+    std::list<Response> reference;
+    const uint64_t all = std::numeric_limits<uint32_t>::max();
+
+    /* One event per cycle for 4096 cycles */
+    for (uint64_t t = 0; t < 4096; t++)
+        insert(queue, reference, t, (t % 8) * 64);
+    check(queue.buckets() >= 4096, "burst over 4096 cycles: wheel spans the burst");
+
+    bool ok = popUntil(queue, reference, 3999, all);
+    check(ok, "burst over 4096 cycles: first 4000 events leave in order");
+    check(queue.buckets() < 1024 && queue.buckets() >= 96, "burst over 4096 cycles: wheel shrinks to fit the last 96 events, it has " +
+            std::to_string(queue.buckets()) + " buckets");
+
+    /* Keep inserting across the shrunk wheel, some behind queued events to the same address */
+    for (uint64_t t = 4000; t < 4200; t++)
+        insert(queue, reference, t + (t % 3) * 40, (t % 8) * 64);
+    ok = popUntil(queue, reference, all, all);
+    check(ok, "burst over 4096 cycles: events inserted after the wheel shrank leave in order");
+    check(queue.buckets() == OutgoingQueue::minBuckets, "burst over 4096 cycles: wheel returns to its minimum once drained");
+
+    /* Repeated bursts do not ratchet the wheel up */
+    ok = true;
+    bool shrunk = true;
+    uint64_t now = 5000;
+    for (uint32_t burst = 0; burst < 10; burst++) {
+        for (uint32_t i = 0; i < 2000; i++)
+            insert(queue, reference, now + rng.generateNextUInt32() % 3000, (rng.generateNextUInt32() % 32) * 64);
+        while (ok && !reference.empty()) {
+            ok = popUntil(queue, reference, now, 4);
+            now++;
+        }
+        shrunk &= queue.buckets() == OutgoingQueue::minBuckets;
+    }
+    check(ok, "repeated bursts: events leave in order");
+    check(shrunk, "repeated bursts: wheel returns to its minimum after each burst");
+
+    clear(reference);
+}
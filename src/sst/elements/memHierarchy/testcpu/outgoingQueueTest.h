@@ -0,0 +1,92 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _OUTGOINGQUEUETEST_H
+#define _OUTGOINGQUEUETEST_H
+
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+
+#include <sst/core/component.h>
+#include <sst/core/output.h>
+#include <sst/core/rng/marsaglia.h>
+
+#include <list>
+#include <string>
+
+#include "coherencemgr/coherenceController.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Checks the timing wheel that holds a coherence controller's outgoing
+ * events. Events are popped in the order of a list that is walked backwards
+ * on insert, as the queues were before the wheel, and the wheel shrinks
+ * back after bursts. Runs in setup() and ends the simulation with a fatal
+ * error if any check fails.
+ */
+class OutgoingQueueTest : public SST::Component {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_COMPONENT(OutgoingQueueTest, "memHierarchy", "OutgoingQueueTest", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Checks the order and size of coherence controller outgoing queues", COMPONENT_CATEGORY_UNCATEGORIZED)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"rngseed",     "(int) Seed for the random event streams", "7"},
+            {"events",      "(uint) Number of events in each random stream", "100000"},
+            {"verbose",     "(bool) Print each check as it is made", "0"} )
+
+/* Begin class definition */
+    OutgoingQueueTest(SST::ComponentId_t id, SST::Params& params);
+    ~OutgoingQueueTest() { }
+
+    void setup() override;
+
+private:
+    typedef CoherenceController::Response Response;
+    typedef CoherenceController::OutgoingQueue OutgoingQueue;
+
+    void check(bool result, const std::string& what);
+
+    /* Insert into both the queue and the reference list */
+    void insert(OutgoingQueue& queue, std::list<Response>& reference, uint64_t time, Addr addr);
+
+    /* Pop up to 'limit' events due by 'time' from both. Returns false on the first event
+     * that differs. */
+    bool popUntil(OutgoingQueue& queue, std::list<Response>& reference, uint64_t time, uint32_t limit);
+
+    /* Delete the events left in 'reference' after a failed check */
+    void clear(std::list<Response>& reference);
+
+    /* Random latencies with occasional bursts far ahead */
+    void testOrder(uint32_t lines, uint64_t maxLatency, uint32_t burstFreq, const std::string& what);
+
+    /* Wheel returns to its minimum size after bursts */
+    void testShrink();
+
+    SST::Output out;
+    SST::RNG::MarsagliaRNG rng;
+    uint64_t events;
+    bool verbose;
+    uint32_t checks;
+    uint32_t failures;
+};
+
+}
+}
+#endif /* _OUTGOINGQUEUETEST_H */
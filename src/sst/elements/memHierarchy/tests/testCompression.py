@@ -0,0 +1,105 @@
+import sst
+import struct
+import sys
+
+# A core in front of an L1 and a compressed, inclusive L2. Memory is
+# pre-loaded with one data pattern so that every line the L2 fills has the
+# same compressed size.
+#
+# Arguments (name=value):
+#   compression   none, bdi, fpc or best
+#   pattern       zero, repeat, base_delta or small_ints
+#   writes        0 to only read, 1 to also write, which makes lines grow
+#   infile        memory image to create and pre-load
+#   outfile       memory image written at the end of simulation (optional)
+
+args = { "compression" : "best", "pattern" : "zero", "writes" : "0", "infile" : "compression_mem.in", "outfile" : "" }
+for arg in sys.argv[1:]:
+    key, value = arg.split("=", 1)
+    args[key] = value
+
+memSize = 1024 * 1024
+lineSize = 64
+
+# One 64B line of each pattern
+patterns = {
+    "zero"       : bytes(lineSize),
+    "repeat"     : struct.pack("<8Q", *([0x1122334455667788] * 8)),     # BDI: repeated value
+    "base_delta" : struct.pack("<8Q", *[0x1000000000000000 + i for i in range(8)]),  # BDI: 8B base, 1B deltas
+    "small_ints" : struct.pack("<16I", *range(16)),                    # FPC: 4 and 8 bit words
+}
+
+with open(args["infile"], "wb") as f:
+    f.write(patterns[args["pattern"]] * (memSize // lineSize))
+
+writes = int(args["writes"])
+
+sst.setProgramOption("timebase", "1ps")
+sst.setStatisticLoadLevel(4)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 2,
+    "memSize" : "64KiB",
+    "verbose" : 0,
+    "clock" : "2GHz",
+    "rngseed" : 11,
+    "maxOutstanding" : 16,
+    "opCount" : 20000,
+    "reqsPerIssue" : 2,
+    "write_freq" : 40 if writes else 0,
+    "read_freq" : 60 if writes else 100,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1 = sst.Component("l1cache", "memHierarchy.Cache")
+l1.addParams({
+    "access_latency_cycles" : 2,
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : 2,
+    "cache_line_size" : lineSize,
+    "cache_size" : "1KiB",
+    "L1" : 1,
+})
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams({
+    "access_latency_cycles" : 8,
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : 4,
+    "cache_line_size" : lineSize,
+    "cache_size" : "8KiB",
+    "compression" : args["compression"],
+    # Small segments and many tags let lines that start out small pack a
+    # set, so lines that grow on writeback oversubscribe it
+    "compression_segment_size" : 1 if not writes else 4,
+    "compression_tags_per_way" : 8,
+})
+l2.enableAllStatistics()
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : memSize - 1,
+    "backing" : "mmap",
+    "backing_in_file" : args["infile"],
+})
+if args["outfile"] != "":
+    memctrl.addParams({ "backing_out_file" : args["outfile"] })
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "1MiB",
+})
+
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "lowlink", "500ps"), (l1, "highlink", "500ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1, "lowlink", "500ps"), (l2, "highlink", "500ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2, "lowlink", "500ps"), (memctrl, "highlink", "500ps") )
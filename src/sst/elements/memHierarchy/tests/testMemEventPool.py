@@ -0,0 +1,75 @@
+import sst
+import sys
+
+# Allocation benchmark for the MemEvent payload pool. A core streams reads
+# and writes through an L1 and an L2 to memory. Every access copies data
+# payloads at each hop, and at verbose >= 2 the memory controller prints
+# how many of them came from the heap and how many were recycled.
+#
+# Arguments (name=value):
+#   ops       accesses the core issues (default 20000)
+
+args = { "ops" : "20000" }
+for arg in sys.argv[1:]:
+    key, value = arg.split("=", 1)
+    args[key] = value
+
+sst.setProgramOption("timebase", "1ps")
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 1,
+    "memSize" : "1MiB",
+    "verbose" : 0,
+    "clock" : "2GHz",
+    "rngseed" : 7,
+    "maxOutstanding" : 16,
+    "opCount" : int(args["ops"]),
+    "reqsPerIssue" : 2,
+    "write_freq" : 40,
+    "read_freq" : 60,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1 = sst.Component("l1cache", "memHierarchy.Cache")
+l1.addParams({
+    "access_latency_cycles" : 2,
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : 4,
+    "cache_line_size" : 64,
+    "cache_size" : "4KiB",
+    "L1" : 1,
+})
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams({
+    "access_latency_cycles" : 8,
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : 8,
+    "cache_line_size" : 64,
+    "cache_size" : "32KiB",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "addr_range_end" : 1024*1024 - 1,
+    "backing" : "malloc",
+    "verbose" : 2,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "1MiB",
+})
+
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "lowlink", "500ps"), (l1, "highlink", "500ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1, "lowlink", "500ps"), (l2, "highlink", "500ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2, "lowlink", "500ps"), (memctrl, "highlink", "500ps") )
@@ -0,0 +1,11 @@
+import sst
+
+# Checks address region intersection and the regions of rr and xor slices.
+# The checks run during setup and print 'passed <n> checks' if all pass.
+
+test = sst.Component("regions", "memHierarchy.MemRegionTest")
+test.addParams({
+    "line_size" : 64,
+    "limit" : 65536,
+    "verbose" : 0,
+})
@@ -0,0 +1,12 @@
+import sst
+
+# Checks that coherence controller outgoing queues send events in order and
+# shrink after bursts. The checks run during setup and print
+# 'passed <n> checks' if all pass.
+
+test = sst.Component("queues", "memHierarchy.OutgoingQueueTest")
+test.addParams({
+    "rngseed" : 7,
+    "events" : 100000,
+    "verbose" : 0,
+})
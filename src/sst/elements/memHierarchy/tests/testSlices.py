@@ -0,0 +1,135 @@
+import sst
+import sys
+from sst.memHierarchy import Slices
+
+# Four cores with private L1s share a sliced L2 and a sliced directory over
+# a single router. Each directory slice has its own memory controller, which
+# writes its memory image at the end of simulation.
+#
+# Arguments (name=value):
+#   l2_policy     rr or xor
+#   l2_slices     number of L2 slices
+#   dir_policy    rr or xor
+#   dir_slices    number of directory slices
+#   outfile       memory image prefix, slice i writes <outfile><i>.mem (optional)
+
+args = { "l2_policy" : "xor", "l2_slices" : "4", "dir_policy" : "xor", "dir_slices" : "2", "outfile" : "" }
+for arg in sys.argv[1:]:
+    key, value = arg.split("=", 1)
+    args[key] = value
+
+cores = 4
+l2Slices = int(args["l2_slices"])
+dirSlices = int(args["dir_slices"])
+memSize = 256 * 1024
+network_bw = "60GB/s"
+
+# Slices rejects configurations the components would reject during
+# construction, before creating anything
+def expectValueError(what, func):
+    try:
+        func()
+    except ValueError:
+        print("Slices: %s: ok" % what)
+        return
+    print("Slices: %s: FAILED" % what)
+
+expectValueError("xor with 3 slices is rejected", lambda: Slices("bad_l2_", 3, {}, policy="xor"))
+expectValueError("xor with 6 directory slices is rejected",
+        lambda: Slices("bad_dir_", 6, {}, component="memHierarchy.DirectoryController", policy="xor"))
+
+sst.setStatisticLoadLevel(2)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+network = sst.Component("network", "merlin.hr_router")
+network.addParams({
+    "xbar_bw" : network_bw,
+    "link_bw" : network_bw,
+    "input_buf_size" : "2KiB",
+    "output_buf_size" : "2KiB",
+    "num_ports" : cores + l2Slices + dirSlices,
+    "flit_size" : "36B",
+    "id" : "0",
+})
+network.setSubComponent("topology", "merlin.singlerouter")
+
+for x in range(cores):
+    cpu = sst.Component("core%d" % x, "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : 2,
+        "memSize" : "256KiB",
+        "verbose" : 0,
+        "clock" : "2GHz",
+        "rngseed" : 7 + x,
+        "maxOutstanding" : 16,
+        "opCount" : 4000,
+        "reqsPerIssue" : 2,
+        "write_freq" : 40,
+        "read_freq" : 60,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1 = sst.Component("l1cache%d" % x, "memHierarchy.Cache")
+    l1.addParams({
+        "cache_frequency" : "2GHz",
+        "access_latency_cycles" : 2,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "cache_size" : "2KiB",
+        "associativity" : 2,
+        "L1" : 1,
+    })
+    l1NIC = l1.setSubComponent("lowlink", "memHierarchy.MemNIC")
+    l1NIC.addParams({ "group" : 1, "network_bw" : network_bw })
+
+    link = sst.Link("link_cpu_l1_%d" % x)
+    link.connect( (iface, "lowlink", "500ps"), (l1, "highlink", "500ps") )
+    link = sst.Link("link_l1_network_%d" % x)
+    link.connect( (l1NIC, "port", "100ps"), (network, "port%d" % x, "100ps") )
+
+l2 = Slices("l2cache", l2Slices, {
+        "cache_frequency" : "2GHz",
+        "access_latency_cycles" : 6,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "cache_size" : "8KiB",
+        "associativity" : 4,
+    }, policy=args["l2_policy"], nic_params={ "group" : 2, "network_bw" : network_bw })
+
+directory = Slices("directory", dirSlices, {
+        "clock" : "1GHz",
+        "coherence_protocol" : "MESI",
+        "entry_cache_size" : 4096,
+    }, component="memHierarchy.DirectoryController", policy=args["dir_policy"],
+    nic_params={ "group" : 3, "network_bw" : network_bw })
+
+expectValueError("connect() with too few endpoints is rejected", lambda: l2.connect([(network, "port0")]))
+
+l2.connect([ (network, "port%d" % (cores + x)) for x in range(l2Slices) ])
+directory.connect([ (network, "port%d" % (cores + l2Slices + x)) for x in range(dirSlices) ])
+
+print("Slices: %d L2 slices and %d directory slices: %s" % (l2Slices, dirSlices,
+    "ok" if len(l2) == l2Slices and len(directory) == dirSlices else "FAILED"))
+
+for comp in l2.components + directory.components:
+    comp.enableStatistics(["GetS_recv", "GetX_recv"])
+
+# Memory controllers cover all of memory, so each image holds the lines of
+# one directory slice at their global addresses
+for x, dirctrl in enumerate(directory.components):
+    memctrl = sst.Component("memory%d" % x, "memHierarchy.MemController")
+    memctrl.addParams({
+        "clock" : "1GHz",
+        "addr_range_end" : memSize - 1,
+        "backing" : "mmap",
+    })
+    if args["outfile"] != "":
+        memctrl.addParams({ "backing_out_file" : "%s%d.mem" % (args["outfile"], x) })
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+    memory.addParams({
+        "access_time" : "50ns",
+        "mem_size" : "256KiB",
+    })
+
+    link = sst.Link("link_dir_mem_%d" % x)
+    link.connect( (dirctrl, "lowlink", "500ps"), (memctrl, "highlink", "500ps") )
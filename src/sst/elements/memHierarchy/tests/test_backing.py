@@ -12,6 +12,12 @@ from mhlib import Bus
 # Test 3: Write malloc output file, check that file matches ref
 # Test 4: Read malloc input file, do 0 operations, and check that output matches ref
 # Test 5: Write backing during init(), do 0 operations, check that output matches ref
+# Test 6: Same as test 0 with row-batched request order in front of a banked DRAM, check that file matches test 0's ref
+# Test 7: Same as test 0 with statistical sampling in the MemController, check that file matches test 0's ref
+# Test 8: Same as test 7 with a CoherentMemController, check that file matches test 0's ref
+# Test 9: Same as test 0 with an analytical DRAM backend and a request log, check that file matches test 0's ref
+# Test 10: Same as test 7 with statistical sampling in every cache and directory too, check that file matches test 0's ref
+# Test 11: Same as test 0 with a banked simpleDRAM backend and a request log, check that file matches test 0's ref
 # Test hierarchy includes Bus (MemLink) and Network (MemNIC) to ensure both link types behave as expected
 
 DEBUG_L1 = 0
@@ -32,7 +38,7 @@ infile = sys.argv[6]
 outfile = sys.argv[7]
 
 ops = 0
-if option == 0 or option == 2 or option == 3:
+if option == 0 or option == 2 or option == 3 or option >= 6:
     ops = 75
 
 cpu_params = {
@@ -126,7 +132,10 @@ link3_cpu_l1 = sst.Link("link3_cpu_l1")
 link3_cpu_l1.connect( (cpu3_iface, "lowlink", "100ps"), (l1_cache3, "highlink", "100ps") )
 
 # Memory
-memctrl = sst.Component("memory", "memHierarchy.MemController")
+if option == 8:
+    memctrl = sst.Component("memory", "memHierarchy.CoherentMemController")
+else:
+    memctrl = sst.Component("memory", "memHierarchy.MemController")
 memctrl.addParams({
     "debug" : DEBUG_MEM,
     "debug_level" : 10,
@@ -141,7 +150,12 @@ memctrl.addParams({
 # Test 3: Write malloc output file, check that file matches ref
 # Test 4: Read malloc input file, do 0 operations, and check that output matches ref
 # Test 5: Write backing during init(), do 0 operations, check that output matches ref
-if option < 3:
+# Test 6: Same as test 0 with row-batched request order in front of a banked DRAM, check that file matches test 0's ref
+# Test 7: Same as test 0 with statistical sampling in the MemController, check that file matches test 0's ref
+# Test 8: Same as test 7 with a CoherentMemController, check that file matches test 0's ref
+# Test 9: Same as test 0 with an analytical DRAM backend and a request log, check that file matches test 0's ref
+# Test 11: Same as test 0 with a banked simpleDRAM backend and a request log, check that file matches test 0's ref
+if option < 3 or option >= 6:
     memctrl.addParams({ "backing" : "mmap", "backing_init_zero" : True, "backing_out_file" : outfile })
 else:
     memctrl.addParams({ "backing" : "malloc", "backing_init_zero" : True, "backing_out_file" : outfile })
@@ -149,11 +163,73 @@ else:
 if option == 1 or option == 2 or option == 4:
     memctrl.addParam("backing_in_file", infile)
 
-memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
-memory.addParams({
-      "mem_size" : "24KiB",
-      "access_time" : "80ns",
-})
+# Several short windows over the run, functional warming in between
+sampling_params = {
+    "sampling_period" : "300ns",
+    "sampling_warmup" : "20ns",
+    "sampling_detail" : "100ns",
+}
+
+if option == 7 or option == 8 or option == 10:
+    memctrl.addParams(sampling_params)
+    memctrl.enableStatistics(["sampled_window_latency", "sampled_window_throughput"])
+    sst.setStatisticLoadLevel(1)
+    sst.setStatisticOutput("sst.statOutputConsole")
+
+if option == 9:
+    # The request log is checked against the model by sst-memh-calibrate
+    memctrl.addParams({ "backendConvertor.request_log" : outfile + ".requests" })
+    # Small rows and few banks so that requests find their row open, empty
+    # and closed
+    memory = memctrl.setSubComponent("backend", "memHierarchy.analyticDRAM")
+    memory.addParams({
+        "mem_size" : "24KiB",
+        "cycle_time" : "1ns",
+        "tCAS" : 10,
+        "tRCD" : 12,
+        "tRP" : 14,
+        "tBurst" : 4,
+        "banks" : 2,
+        "row_size" : "512B",
+        "row_policy" : "open",
+    })
+    memory.enableStatistics(["row_hits", "row_empty", "row_conflicts"])
+    sst.setStatisticLoadLevel(1)
+    sst.setStatisticOutput("sst.statOutputConsole")
+elif option == 6 or option == 11:
+    # Small rows and few banks so that requests to different rows of a bank
+    # queue up behind each other
+    if option == 6:
+        memctrl.addParams({
+            "backendConvertor.request_order" : "row_batch",
+            "backendConvertor.row_batch_size" : 2,
+            "backendConvertor.row_batch_banks" : 2,
+            "backendConvertor.row_batch_row_size" : "512B",
+        })
+    else:
+        # The request log is fitted by sst-memh-calibrate
+        memctrl.addParams({ "backendConvertor.request_log" : outfile + ".requests" })
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleDRAM")
+    memory.addParams({
+        "mem_size" : "24KiB",
+        "cycle_time" : "10ns",
+        "tCAS" : 2,
+        "tRCD" : 4,
+        "tRP" : 4,
+        "banks" : 2,
+        "row_size" : "512B",
+        "row_policy" : "open",
+    })
+    if option == 11:
+        memory.enableStatistics(["row_already_open", "no_row_open", "wrong_row_open"])
+        sst.setStatisticLoadLevel(1)
+        sst.setStatisticOutput("sst.statOutputConsole")
+else:
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+    memory.addParams({
+          "mem_size" : "24KiB",
+          "access_time" : "80ns",
+    })
 
 ##################
 ## Hierarchy is
@@ -239,6 +315,14 @@ directory1.addParams(dir_base_params)
 directory0.addParams({"addr_range_start" : 0, "addr_range_end" : 12*1024-1}) # Addrs 0-12K
 directory1.addParams({"addr_range_start" : 12*1024, "addr_range_end" : 24*1024-1}) # Addrs 12K-24K
 
+if option == 10:
+    # Every component switches phase at the same time
+    for comp in [ l1_cache0, l1_cache1, l1_cache2, l1_cache3, l2_cache0, l2_cache1, l2_cache2, l2_cache3,
+                  l3_cache, directory0, directory1 ]:
+        comp.addParams(sampling_params)
+    for comp in [ l1_cache0, l3_cache, directory0 ]:
+        comp.enableStatistics(["sampled_window_latency", "sampled_window_throughput"])
+
 ## Configure NoC
 noc = sst.Component("chiprtr", "merlin.hr_router")
 noc.addParams({
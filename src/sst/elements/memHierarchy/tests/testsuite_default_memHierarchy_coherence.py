@@ -90,6 +90,21 @@ class testcase_memHierarchy_coherence(SSTTestCase):
     
     def test_coherence_four_core_case3_mesi(self):
         self.memHA_Template("4core_5level", 3, [5399, 2533, 433, 1834], "mesi")
+    # Check the ordering and resizing of the coherence controllers' outgoing queues
+    def test_coherence_outgoing_queue(self):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/testOutgoingQueue.py".format(test_path)
+        outfile = "{0}/test_memHierarchy_coherence_outgoing_queue.out".format(outdir)
+        errfile = "{0}/test_memHierarchy_coherence_outgoing_queue.err".format(outdir)
+        self.run_sst(sdlfile, outfile, errfile)
+
+        with open(outfile, 'r') as f:
+            output = f.read()
+        self.assertTrue("FAILED" not in output, "Outgoing queue checks failed, see {0}".format(outfile))
+        self.assertTrue(re.search(r"OutgoingQueueTest: passed \d+ checks", output), "Outgoing queue checks did not complete, see {0}".format(outfile))
+
 #####
 
     def memHA_Template(self, testcase, testnum, cpu_seeds, protocol,
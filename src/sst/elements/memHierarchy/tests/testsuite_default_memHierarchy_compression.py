@@ -0,0 +1,109 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+from sst_unittest_parameterized import parameterized
+import os.path
+import re
+import filecmp
+
+################################################################################
+# Compressed cache arrays (the 'compression' cache parameter)
+################################################################################
+
+# pattern, compression, expected stored size of every line in bytes
+# Sizes are for 64B lines with 1B segments. See testCompression.py for the
+# patterns.
+compression_size_matrix = [
+    ["zero",       "bdi",  1],
+    ["zero",       "fpc",  2],      # two runs of 8 zero words
+    ["zero",       "best", 1],
+    ["repeat",     "bdi",  8],
+    ["repeat",     "fpc",  64],     # no FPC pattern matches
+    ["repeat",     "best", 8],
+    ["base_delta", "bdi",  16],     # 8B base + 8 x 1B deltas
+    ["base_delta", "fpc",  26],
+    ["base_delta", "best", 16],
+    ["small_ints", "bdi",  20],     # 4B base + 16 x 1B deltas
+    ["small_ints", "fpc",  18],
+    ["small_ints", "best", 18],
+]
+
+def gen_custom_name(testcase_func, param_num, param):
+    testcasename = "{0}_{1}_{2}".format(testcase_func.__name__,
+        parameterized.to_safe_name(str(param.args[0])),
+        parameterized.to_safe_name(str(param.args[1])))
+    return testcasename
+
+class testcase_memHierarchy_compression(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    @parameterized.expand(compression_size_matrix, name_func=gen_custom_name)
+    def test_compression_size(self, pattern, compression, size):
+        outfile = self.compression_Template("size_{0}_{1}".format(pattern, compression),
+                "compression={0} pattern={1}".format(compression, pattern))
+
+        stats = self._readStat(outfile, "l2cache", "compression_line_bytes")
+        self.assertTrue(stats is not None and stats["Count"] > 0, "No compressed lines were recorded in {0}".format(outfile))
+        self.assertEqual(stats["Min"], size, "Smallest stored line is {0}B, expected {1}B. See {2}".format(stats["Min"], size, outfile))
+        self.assertEqual(stats["Max"], size, "Largest stored line is {0}B, expected {1}B. See {2}".format(stats["Max"], size, outfile))
+
+    # Lines start as all zeros and grow as the core writes to them. Sets the
+    # writebacks oversubscribe must evict several lines on the next fill. The
+    # final memory image must match the one written without compression.
+    def test_compression_evictions(self):
+        images = []
+        for compression in ["none", "best"]:
+            testcase = "evictions_{0}".format(compression)
+            image = "{0}/test_memHierarchy_compression_{1}.mem".format(self.get_test_output_tmp_dir(), testcase)
+            outfile = self.compression_Template(testcase,
+                    "compression={0} pattern=zero writes=1 outfile={1}".format(compression, image))
+            images.append(image)
+
+        stats = self._readStat(outfile, "l2cache", "compression_evictions")
+        self.assertTrue(stats is not None and stats["Sum"] > 0, "No set needed more than one victim in {0}".format(outfile))
+
+        self.assertTrue(filecmp.cmp(images[0], images[1], shallow=False),
+                "Memory image with compression {0} does not match image without compression {1}".format(images[1], images[0]))
+
+#####
+
+    def compression_Template(self, testcase, modeloptions, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        testDataFileName = "test_memHierarchy_compression_{0}".format(testcase)
+        sdlfile = "{0}/testCompression.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        infile = "{0}/{1}.in".format(tmpdir, testDataFileName)
+
+        otherargs = '--model-options=\"{0} infile={1}\"'.format(modeloptions, infile)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs,
+                     timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("memHierarchy compression test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        return outfile
+
+    # Fields of an accumulator statistic in console output, None if not found
+    def _readStat(self, outfile, component, stat):
+        pattern = re.compile(r"{0}\.{1} : Accumulator : (.*)".format(re.escape(component), re.escape(stat)))
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = pattern.search(line)
+                if m:
+                    return { name : int(value) for name, value in re.findall(r"(\w+)\.u64 = (\d+)", m.group(1)) }
+        return None
@@ -172,6 +172,43 @@ class testcase_memHierarchy_memHA(SSTTestCase):
 
     def test_memHA_RangeCheck(self):
         self.memHA_Template("RangeCheck", testtimeout=60)
+
+    # The MemEvent pool counts are per thread. In a parallel run events
+    # freed on another thread are recycled there, so only run serially.
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "memHA: test_memHA_MemEventPool skipped if ranks > 1")
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "memHA: test_memHA_MemEventPool skipped if threads > 1")
+    def test_memHA_MemEventPool(self):
+        # Once the pool holds as many payloads as are in flight at the
+        # peak, accesses stop allocating them. The counts depend on the
+        # peak, not on the run length, so check a bound per access.
+        ops = 20000
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        testDataFileName = "test_memHA_MemEventPool"
+        sdlfile = "{0}/testMemEventPool.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path,
+                     other_args='--model-options="ops={0}"'.format(ops),
+                     mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("memHA test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        pattern = re.compile(r"MemEvent payload pool \(this thread\): (\d+) payloads allocated, (\d+) reused")
+        counts = None
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = pattern.search(line)
+                if m:
+                    counts = [int(x) for x in m.groups()]
+        self.assertIsNotNone(counts, "No MemEvent payload pool counts in {0}".format(outfile))
+
+        payloadAllocs, payloadReuses = counts
+        self.assertGreater(payloadReuses, ops // 2, "Too few recycled payloads in {0}".format(outfile))
+        self.assertLess(payloadAllocs, ops // 20, "More than 0.05 payloads allocated per access in {0}".format(outfile))
 #####
 
     def memHA_Template(self, testcase,
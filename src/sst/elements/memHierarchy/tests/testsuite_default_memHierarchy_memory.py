@@ -5,8 +5,11 @@ from sst_unittest_support import *
 import os.path
 import re
 import filecmp
+import json
 import shutil
 
+calibrate = shutil.which("sst-memh-calibrate")
+
 ################################################################################
 # Tests related to memory including:
 #   - Backends
@@ -79,10 +82,82 @@ class testcase_memHierarchy_memory(SSTTestCase):
         
         self.memh_template_backing(teststr="init", testnum=5, seed0=20, seed1=21, seed2=22, seed3=23, backing_infile=None, backing_reffile=ref_file, backing_outfile=out_file)
 
+    # Test writing memory backing to mmap with request_order=row_batch
+    # Row batching only reorders requests to different addresses, so the
+    # output mmap file must match the reference of test 0
+    def test_memory_backing_6_mmap_out_row_batch(self):
+        out_file = "{}/test_memHierarchy_memory_backing_6_mmap_out_row_batch.mmap.mem".format(self.get_test_output_run_dir())
+        ref_file = "{}/refFiles/test_memHierarchy_memory_backing_out.mmap.mem".format(self.get_testsuite_dir())
+        self.memh_template_backing(teststr="mmap_out_row_batch", testnum=6, seed0=0, seed1=1, seed2=2, seed3=3, backing_infile=None, backing_outfile=out_file, backing_reffile=ref_file)
+
+    # Test writing memory backing to mmap with statistical sampling
+    # Functional warming skips the backend's timing but not its data, so the
+    # output mmap file must match the reference of test 0
+    def test_memory_backing_7_mmap_out_sampling(self):
+        out_file = "{}/test_memHierarchy_memory_backing_7_mmap_out_sampling.mmap.mem".format(self.get_test_output_run_dir())
+        ref_file = "{}/refFiles/test_memHierarchy_memory_backing_out.mmap.mem".format(self.get_testsuite_dir())
+        self.memh_template_backing(teststr="mmap_out_sampling", testnum=7, seed0=0, seed1=1, seed2=2, seed3=3, backing_infile=None, backing_outfile=out_file, backing_reffile=ref_file, sampling=[ "memory" ])
+
+    # Same as test 7 with a CoherentMemController
+    def test_memory_backing_8_mmap_out_sampling_coherent(self):
+        out_file = "{}/test_memHierarchy_memory_backing_8_mmap_out_sampling_coherent.mmap.mem".format(self.get_test_output_run_dir())
+        ref_file = "{}/refFiles/test_memHierarchy_memory_backing_out.mmap.mem".format(self.get_testsuite_dir())
+        self.memh_template_backing(teststr="mmap_out_sampling_coherent", testnum=8, seed0=0, seed1=1, seed2=2, seed3=3, backing_infile=None, backing_outfile=out_file, backing_reffile=ref_file, sampling=[ "memory" ])
+
+    # Same as test 7 with sampling in every cache and directory as well
+    # Warming drops cache and directory timing but keeps their state, so the
+    # output mmap file must still match the reference of test 0
+    def test_memory_backing_10_mmap_out_sampling_hierarchy(self):
+        out_file = "{}/test_memHierarchy_memory_backing_10_mmap_out_sampling_hierarchy.mmap.mem".format(self.get_test_output_run_dir())
+        ref_file = "{}/refFiles/test_memHierarchy_memory_backing_out.mmap.mem".format(self.get_testsuite_dir())
+        self.memh_template_backing(teststr="mmap_out_sampling_hierarchy", testnum=10, seed0=0, seed1=1, seed2=2, seed3=3, backing_infile=None, backing_outfile=out_file, backing_reffile=ref_file,
+                                   sampling=[ "memory", "l1cache0", "l3cache", "directory0" ])
+
+    # Test writing memory backing to mmap with the analytical DRAM backend
+    # Pass if output mmap file matches the reference of test 0 and the
+    # request log agrees with the backend's statistics
+    def test_memory_backing_9_mmap_out_analytic(self):
+        out_file = "{}/test_memHierarchy_memory_backing_9_mmap_out_analytic.mmap.mem".format(self.get_test_output_run_dir())
+        ref_file = "{}/refFiles/test_memHierarchy_memory_backing_out.mmap.mem".format(self.get_testsuite_dir())
+        self.memh_template_backing(teststr="mmap_out_analytic", testnum=9, seed0=0, seed1=1, seed2=2, seed3=3, backing_infile=None, backing_outfile=out_file, backing_reffile=ref_file)
+        # tCAS + tBurst
+        requests = self.memh_check_request_log(9, "mmap_out_analytic", out_file, [ "row_hits", "row_empty", "row_conflicts" ], 14)
+        # The log was produced by the analytical model, so replaying it
+        # through the same model must fit it almost exactly. The convertor
+        # adds up to a cycle to issue each request.
+        fit = self.memh_calibrate(out_file, requests, "--banks 2 --row 512")
+        if fit:
+            self.assertTrue(fit[0] <= 1.5, "analyticDRAM does not fit its own request log, RMS error {} cycles".format(fit[0]))
+
+    # Test writing memory backing to mmap with the simpleDRAM backend and fit
+    # the analytical model to its request log
+    # Pass if output mmap file matches the reference of test 0 and the fit
+    # recovers simpleDRAM's timings
+    def test_memory_backing_11_mmap_out_calibrate(self):
+        out_file = "{}/test_memHierarchy_memory_backing_11_mmap_out_calibrate.mmap.mem".format(self.get_test_output_run_dir())
+        ref_file = "{}/refFiles/test_memHierarchy_memory_backing_out.mmap.mem".format(self.get_testsuite_dir())
+        self.memh_template_backing(teststr="mmap_out_calibrate", testnum=11, seed0=0, seed1=1, seed2=2, seed3=3, backing_infile=None, backing_outfile=out_file, backing_reffile=ref_file)
+        # tCAS of 2 10ns cycles, logged in 1ns controller cycles
+        requests = self.memh_check_request_log(11, "mmap_out_calibrate", out_file, [ "row_already_open", "no_row_open", "wrong_row_open" ], 20)
+        fit = self.memh_calibrate(out_file, requests, "--controller-period 1 --cycle-time 10 --banks 2 --row 512")
+        if not fit:
+            return
+        rms, timing = fit
+        # simpleDRAM takes tCAS on a row hit, tRCD more on an empty row and tRP
+        # more on a conflict (2, 4 and 4 cycles). It has no data bus, so the
+        # fit may split the hit latency between tCAS and tBurst. It also holds
+        # a bank for the whole access where the analytical model pipelines
+        # column accesses, and the convertor adds up to a controller cycle to
+        # issue, so the fit is allowed a cycle of slack per timing.
+        self.assertTrue(1 <= timing["tCAS"] + timing["tBurst"] <= 3, "Fitted row hit latency {} is not simpleDRAM's tCAS of 2".format(timing))
+        self.assertTrue(3 <= timing["tRCD"] <= 5, "Fitted tRCD {} is not simpleDRAM's tRCD of 4".format(timing))
+        self.assertTrue(3 <= timing["tRP"] <= 5, "Fitted tRP {} is not simpleDRAM's tRP of 4".format(timing))
+        self.assertTrue(rms <= 2.0, "analyticDRAM does not fit simpleDRAM's request log, RMS error {} cycles".format(rms))
+
 
 #####
 
-    def memh_template_backing(self, teststr, testnum, seed0, seed1, seed2, seed3, backing_infile=None, backing_reffile=None, backing_outfile=None, ignore_err_file=False, testtimeout=240):
+    def memh_template_backing(self, teststr, testnum, seed0, seed1, seed2, seed3, backing_infile=None, backing_reffile=None, backing_outfile=None, ignore_err_file=False, sampling=None, testtimeout=240):
          
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
@@ -109,6 +184,10 @@ class testcase_memHierarchy_memory(SSTTestCase):
         with open(test_output) as fn:
             self.assertIn("Simulation is complete", fn.read(), "No end of simulation detected in output file {}".format(test_output))
 
+        if sampling:
+            for component in sampling:
+                self.memh_check_sampling(test_output, component)
+
         # Check that memory contents match reference
         memcheck = filecmp.cmp(backing_reffile, backing_outfile)
         self.assertTrue(memcheck, "Output memory contents {} does not pass check against the reference file {} ".format(backing_outfile, backing_reffile))
@@ -116,5 +195,62 @@ class testcase_memHierarchy_memory(SSTTestCase):
         # Check that the simulation generated no stderr output
         self.assertFalse(os_test_file(test_err, "-s"), "Error file is non-empty {}".format(test_err))
 
+    # Check a request log against the backend's row statistics, which count
+    # every request the backend accepted as a row hit, empty or conflict.
+    # Returns the requests in the log.
+    def memh_check_request_log(self, testnum, teststr, backing_outfile, row_stats, min_latency):
+        test_output = "{}/test_memHierarchy_memory_backing_{}_{}.out".format(self.get_test_output_run_dir(), testnum, teststr)
+        request_log = backing_outfile + ".requests"
+
+        with open(request_log) as fn:
+            requests = [ line.strip().split(",") for line in fn if line.strip() ]
+        self.assertTrue(len(requests) > 0, "Request log {} is empty".format(request_log))
+        for request in requests:
+            self.assertEqual(len(request), 5, "Malformed request log line {} in {}".format(",".join(request), request_log))
+            # No request completes faster than a row hit
+            self.assertTrue(int(request[4]) >= min_latency, "Latency below a row hit: {} in {}".format(",".join(request), request_log))
+
+        with open(test_output) as fn:
+            output = fn.read()
+        rows = {}
+        for stat in row_stats:
+            m = re.search(r"\.{} : Accumulator : Sum\.u64 = (\d+);".format(stat), output)
+            self.assertTrue(m, "No {} statistic in output file {}".format(stat, test_output))
+            rows[stat] = int(m.group(1))
+        self.assertEqual(sum(rows.values()), len(requests), "Row statistics {} do not add up to the {} requests in {}".format(rows, len(requests), request_log))
+        self.assertTrue(rows[row_stats[0]] > 0 and rows[row_stats[2]] > 0, "Expected both row hits and row conflicts, found {}".format(rows))
+        return requests
+
+    # Run sst-memh-calibrate on a request log. Returns the RMS error and the
+    # fitted timings in analyticDRAM cycles, or None if the tool is not built.
+    def memh_calibrate(self, backing_outfile, requests, options):
+        request_log = backing_outfile + ".requests"
+        if calibrate is None:
+            log_testing_note("sst-memh-calibrate not found in PATH, request log {} not calibrated".format(request_log))
+            return None
+        fit_output = "{}.calibrate".format(request_log)
+        rtn = os.system("{} {} {} > {}".format(calibrate, options, request_log, fit_output))
+        self.assertEqual(rtn, 0, "sst-memh-calibrate failed on {}".format(request_log))
+        with open(fit_output) as fn:
+            lines = fn.read().splitlines()
+        fit = re.search(r"Fitted to (\d+) requests.*RMS error ([0-9.]+) cycles", lines[0]) if lines else None
+        self.assertTrue(fit and len(lines) == 2, "No fit in {}".format(fit_output))
+        self.assertEqual(int(fit.group(1)), len(requests), "sst-memh-calibrate did not read every request in {}".format(request_log))
+        return float(fit.group(2)), json.loads(lines[1])
+
+    # Check a component's sampling summary and that every measured window
+    # was also reported to its window statistics
+    def memh_check_sampling(self, test_output, component):
+        with open(test_output) as fn:
+            output = fn.read()
 
+        summary = re.search(r"\b{} sampling: (\d+) measured windows, (\d+) without requests\. Latency: ([0-9.]+) \+/- ([0-9.]+) cycles".format(component), output)
+        self.assertTrue(summary, "No {} sampling summary in output file {}".format(component, test_output))
+        windows = int(summary.group(1))
+        self.assertTrue(windows >= 2, "Expected at least 2 measured windows with requests at {}, found {} in {}".format(component, windows, test_output))
+        self.assertTrue(float(summary.group(3)) > 0, "Sampled latency of {} is not positive in {}".format(component, test_output))
 
+        for stat in [ "sampled_window_latency", "sampled_window_throughput" ]:
+            count = re.search(r"\b{}\.{} : Accumulator : .*Count\.u64 = (\d+);".format(component, stat), output)
+            self.assertTrue(count, "No {}.{} statistic in output file {}".format(component, stat, test_output))
+            self.assertEqual(int(count.group(1)), windows, "{}.{} has {} samples but {} windows were measured, see {}".format(component, stat, count.group(1), windows, test_output))
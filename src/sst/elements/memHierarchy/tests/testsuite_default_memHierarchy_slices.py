@@ -0,0 +1,153 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+from sst_unittest_parameterized import parameterized
+import os.path
+import re
+
+################################################################################
+# Sliced caches and directories (slice_allocation_policy and sst.memHierarchy.Slices)
+################################################################################
+
+# L2 policy, L2 slices, directory policy, directory slices
+# The first entry is the reference that the others' memory must match. xor
+# L2 slices above xor directory slices of a different count need routes
+# through two different hashes.
+slices_matrix = [
+    ["rr",  1, "rr",  1],
+    ["rr",  4, "rr",  2],
+    ["xor", 4, "rr",  2],
+    ["rr",  3, "xor", 2],
+    ["xor", 4, "xor", 2],
+    ["xor", 2, "xor", 4],
+    ["xor", 4, "xor", 4],
+]
+
+lineSize = 64
+
+def gen_custom_name(testcase_func, param_num, param):
+    testcasename = "{0}_{1}{2}_{3}{4}".format(testcase_func.__name__,
+        parameterized.to_safe_name(str(param.args[0])), param.args[1],
+        parameterized.to_safe_name(str(param.args[2])), param.args[3])
+    return testcasename
+
+# Reference for the slice a line belongs to, independent of MemRegion
+def slice_of(line, policy, slices):
+    if policy == "rr":
+        return line % slices
+    bits = slices.bit_length() - 1
+    if bits == 0:
+        return 0
+    hashed = 0
+    while line != 0:
+        hashed ^= line & (slices - 1)
+        line >>= bits
+    return hashed
+
+class testcase_memHierarchy_slices(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_slices_regions(self):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/testMemRegion.py".format(test_path)
+        outfile = "{0}/test_memHierarchy_slices_regions.out".format(outdir)
+        errfile = "{0}/test_memHierarchy_slices_regions.err".format(outdir)
+        self.run_sst(sdlfile, outfile, errfile)
+
+        with open(outfile, 'r') as f:
+            output = f.read()
+        self.assertTrue("FAILED" not in output, "MemRegion checks failed, see {0}".format(outfile))
+        self.assertTrue(re.search(r"MemRegionTest: passed \d+ checks", output), "MemRegion checks did not complete, see {0}".format(outfile))
+
+    @parameterized.expand(slices_matrix, name_func=gen_custom_name)
+    def test_slices(self, l2Policy, l2Slices, dirPolicy, dirSlices):
+        testcase = "{0}{1}_{2}{3}".format(l2Policy, l2Slices, dirPolicy, dirSlices)
+        image = self.slices_Run(testcase, l2Policy, l2Slices, dirPolicy, dirSlices)
+        self.assertTrue(len(image) > 0, "Cores did not write to memory")
+        if [l2Policy, l2Slices, dirPolicy, dirSlices] == slices_matrix[0]:
+            return
+
+        reference = self.slices_Run(testcase + "_reference", *slices_matrix[0])
+        self.assertTrue(image == reference,
+                "Memory with {0} {1}-way L2 and {2} {3}-way directory does not match one L2 and one directory".format(
+                    l2Policy, l2Slices, dirPolicy, dirSlices))
+
+#####
+
+    # Runs a configuration, checks its slices and returns its memory as
+    # { line address : line }
+    def slices_Run(self, testcase, l2Policy, l2Slices, dirPolicy, dirSlices, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        testDataFileName = "test_memHierarchy_slices_{0}".format(testcase)
+        sdlfile = "{0}/testSlices.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        imagePrefix = "{0}/{1}_memory".format(tmpdir, testDataFileName)
+
+        otherargs = '--model-options=\"l2_policy={0} l2_slices={1} dir_policy={2} dir_slices={3} outfile={4}\"'.format(
+                l2Policy, l2Slices, dirPolicy, dirSlices, imagePrefix)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs,
+                     timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("memHierarchy slices test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        # Checks made by the input deck on sst.memHierarchy.Slices
+        with open(outfile, 'r') as f:
+            checks = [ line for line in f if line.startswith("Slices: ") ]
+        self.assertTrue(len(checks) >= 4, "Slices checks did not run, see {0}".format(outfile))
+        for line in checks:
+            self.assertTrue(line.rstrip().endswith(": ok"), "Slices check failed: {0}".format(line.rstrip()))
+
+        # Every slice sees requests
+        for name, slices in [ ("l2cache", l2Slices), ("directory", dirSlices) ]:
+            for x in range(slices):
+                received = self._readStatSum(outfile, "{0}{1}".format(name, x), "GetS_recv") + \
+                           self._readStatSum(outfile, "{0}{1}".format(name, x), "GetX_recv")
+                self.assertTrue(received > 0, "{0}{1} received no requests, see {2}".format(name, x, outfile))
+
+        # Each memory controller only holds lines of its directory slice, and
+        # every word the cores wrote holds its own address
+        memory = {}
+        for x in range(dirSlices):
+            image = "{0}{1}.mem".format(imagePrefix, x)
+            with open(image, 'rb') as f:
+                data = f.read()
+            for addr in range(0, len(data), lineSize):
+                line = data[addr:addr + lineSize]
+                if line.count(0) == lineSize:
+                    continue
+                self.assertEqual(slice_of(addr // lineSize, dirPolicy, dirSlices), x,
+                        "Line {0:#x} is in the memory of directory slice {1}, see {2}".format(addr, x, image))
+                for offset in range(0, lineSize, 4):
+                    word = int.from_bytes(line[offset:offset + 4], "big")
+                    self.assertTrue(word == 0 or word == addr + offset,
+                            "Word {0:#x} holds {1:#x}, see {2}".format(addr + offset, word, image))
+                memory[addr] = line
+        return memory
+
+    # Sum of an accumulator statistic in console output, 0 if not found
+    def _readStatSum(self, outfile, component, stat):
+        pattern = re.compile(r"{0}\.{1} : Accumulator : Sum\.u64 = (\d+);".format(re.escape(component), re.escape(stat)))
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = pattern.search(line)
+                if m:
+                    return int(m.group(1))
+        return 0
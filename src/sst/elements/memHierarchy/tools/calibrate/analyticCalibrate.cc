@@ -0,0 +1,223 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Fit memHierarchy.analyticDRAM timing parameters to a request log.
+//
+// Run the reference backend (timingDRAM, dramsim3, ...) with the memory
+// controller's backend convertor parameter 'request_log' set. Each line of
+// the log is 'arrival cycle,address,is write,size,latency' in memory
+// controller cycles. This tool replays the arrivals through the analytical
+// model and searches for the timing parameters that minimize the squared
+// latency error.
+
+#include "sst_config.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../../membackend/analyticDRAMModel.h"
+
+using namespace SST::MemHierarchy;
+
+struct Request {
+    uint64_t arrival;   // backend cycles
+    uint64_t addr;
+    double latency;     // backend cycles
+};
+
+struct Options {
+    double controllerPeriod = 1.0;
+    double cycleTime = 1.0;
+    unsigned channels = 1;
+    unsigned banks = 16;
+    unsigned lineSize = 64;
+    unsigned rowSize = 8192;
+    bool openPolicy = true;
+    AnalyticDRAMModel::QueueModel queueModel = AnalyticDRAMModel::QueueModel::RESERVE;
+    uint64_t maxLatency = 256;
+    size_t maxRequests = 0;
+};
+
+static void usage() {
+    fprintf(stderr,
+        "usage: sst-memh-calibrate [options] <request log>\n"
+        "  --controller-period <ns>  memory controller clock period used in the log (default 1)\n"
+        "  --cycle-time <ns>         analyticDRAM cycle_time (default 1)\n"
+        "  --channels <n>            analyticDRAM channels (default 1)\n"
+        "  --banks <n>               analyticDRAM banks per channel (default 16)\n"
+        "  --line <bytes>            bank_interleave_granularity (default 64)\n"
+        "  --row <bytes>             row_size (default 8192)\n"
+        "  --policy <open|closed>    row_policy (default open)\n"
+        "  --queue-model <reserve|md1> queue_model (default reserve)\n"
+        "  --max-latency <cycles>    upper bound on each fitted timing parameter (default 256)\n"
+        "  --requests <n>            only use the first n requests of the log\n");
+    exit(1);
+}
+
+static bool isPow2(unsigned x) { return x != 0 && (x & (x - 1)) == 0; }
+
+static unsigned log2u(unsigned x) {
+    unsigned bits = 0;
+    while ((1u << bits) < x) bits++;
+    return bits;
+}
+
+/* Mean squared error of the model over the log */
+static double evaluate(AnalyticDRAMModel& model, const AnalyticDRAMTiming& timing, const std::vector<Request>& reqs, double* mae) {
+    model.setTiming(timing);
+    model.reset();
+    double sq = 0.0, abs = 0.0;
+    for (const Request& r : reqs) {
+        AnalyticDRAMModel::RowResult result;
+        uint64_t queueDelay;
+        double err = (double)model.access(r.arrival, r.addr, result, queueDelay) - r.latency;
+        sq += err * err;
+        abs += std::fabs(err);
+    }
+    if (mae) *mae = abs / reqs.size();
+    return sq / reqs.size();
+}
+
+int
+main(int argc, char* argv[]) {
+    Options opt;
+    const char* path = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.compare(0, 2, "--") != 0) {
+            if (path) usage();
+            path = argv[i];
+            continue;
+        }
+        if (i + 1 >= argc) usage();
+        const char* val = argv[++i];
+        if (arg == "--controller-period") opt.controllerPeriod = atof(val);
+        else if (arg == "--cycle-time") opt.cycleTime = atof(val);
+        else if (arg == "--channels") opt.channels = strtoul(val, nullptr, 0);
+        else if (arg == "--banks") opt.banks = strtoul(val, nullptr, 0);
+        else if (arg == "--line") opt.lineSize = strtoul(val, nullptr, 0);
+        else if (arg == "--row") opt.rowSize = strtoul(val, nullptr, 0);
+        else if (arg == "--policy") opt.openPolicy = strcmp(val, "closed") != 0;
+        else if (arg == "--queue-model") {
+            if (strcmp(val, "md1") == 0) opt.queueModel = AnalyticDRAMModel::QueueModel::MD1;
+            else if (strcmp(val, "reserve") != 0) usage();
+        }
+        else if (arg == "--max-latency") opt.maxLatency = strtoull(val, nullptr, 0);
+        else if (arg == "--requests") opt.maxRequests = strtoull(val, nullptr, 0);
+        else usage();
+    }
+    if (!path || opt.controllerPeriod <= 0.0 || opt.cycleTime <= 0.0)
+        usage();
+    if (!isPow2(opt.channels) || !isPow2(opt.banks) || !isPow2(opt.lineSize) || !isPow2(opt.rowSize)) {
+        fprintf(stderr, "channels, banks, line and row sizes must be powers of two\n");
+        exit(1);
+    }
+
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "could not open %s\n", path);
+        exit(1);
+    }
+
+    std::vector<Request> reqs;
+    double scale = opt.controllerPeriod / opt.cycleTime;
+    char line[256];
+    while (fgets(line, sizeof(line), fp)) {
+        uint64_t arrival, addr, latency;
+        int write;
+        unsigned size;
+        if (sscanf(line, "%" SCNu64 ",%" SCNx64 ",%d,%u,%" SCNu64, &arrival, &addr, &write, &size, &latency) != 5)
+            continue;
+        reqs.push_back({ (uint64_t)std::llround(arrival * scale), addr, latency * scale });
+        if (opt.maxRequests && reqs.size() == opt.maxRequests)
+            break;
+    }
+    fclose(fp);
+
+    if (reqs.empty()) {
+        fprintf(stderr, "no requests found in %s\n", path);
+        exit(1);
+    }
+
+    // The convertor logs requests as they complete
+    std::stable_sort(reqs.begin(), reqs.end(), [](const Request& a, const Request& b) { return a.arrival < b.arrival; });
+
+    AnalyticDRAMTiming timing = { 14, 14, 14, 4, 1.0 };
+    AnalyticDRAMModel model(opt.channels, opt.banks, log2u(opt.lineSize), log2u(opt.rowSize), opt.openPolicy, opt.queueModel, timing);
+
+    // Coordinate descent over the integer timings, with shrinking steps
+    uint64_t* params[] = { &timing.tCAS, &timing.tRCD, &timing.tRP, &timing.tBurst };
+    double best = evaluate(model, timing, reqs, nullptr);
+    for (int64_t step = 16; step >= 1; step /= 2) {
+        bool improved = true;
+        while (improved) {
+            improved = false;
+            for (uint64_t* p : params) {
+                for (int64_t dir = -1; dir <= 1; dir += 2) {
+                    int64_t value = (int64_t)*p + dir * step;
+                    if (value < 0 || (uint64_t)value > opt.maxLatency) continue;
+                    uint64_t old = *p;
+                    *p = value;
+                    double err = evaluate(model, timing, reqs, nullptr);
+                    if (err < best) {
+                        best = err;
+                        improved = true;
+                    } else {
+                        *p = old;
+                    }
+                }
+            }
+        }
+    }
+
+    // Queueing scale, for md1
+    if (opt.queueModel == AnalyticDRAMModel::QueueModel::MD1) {
+        for (double step = 0.5; step >= 0.01; step /= 2) {
+            bool improved = true;
+            while (improved) {
+                improved = false;
+                for (double dir = -1.0; dir <= 1.0; dir += 2.0) {
+                    double old = timing.queueScale;
+                    timing.queueScale = std::max(0.0, old + dir * step);
+                    double err = evaluate(model, timing, reqs, nullptr);
+                    if (err < best) {
+                        best = err;
+                        improved = true;
+                    } else {
+                        timing.queueScale = old;
+                    }
+                }
+            }
+        }
+    }
+
+    double mae;
+    double mse = evaluate(model, timing, reqs, &mae);
+    double mean = 0.0;
+    for (const Request& r : reqs) mean += r.latency;
+    mean /= reqs.size();
+
+    printf("# Fitted to %zu requests, mean latency %.2f cycles, RMS error %.2f cycles, mean absolute error %.2f cycles\n",
+            reqs.size(), mean, std::sqrt(mse), mae);
+    printf("{\"tCAS\" : %" PRIu64 ", \"tRCD\" : %" PRIu64 ", \"tRP\" : %" PRIu64 ", \"tBurst\" : %" PRIu64 ", \"queue_scale\" : %.2f}\n",
+            timing.tCAS, timing.tRCD, timing.tRP, timing.tBurst, timing.queueScale);
+    return 0;
+}
@@ -123,6 +123,7 @@ OperatingSystem::OperatingSystem(SST::ComponentId_t id, SST::Params& params, Nod
   //       : 1);
 
   StackAlloc::init(params);
+  print_stack_stats_ = params.find<bool>("print_stack_stats", false);
   initThreading(params);
 }
 
@@ -150,6 +151,19 @@ OperatingSystem::setup() {
     selfEventLink_->send(r);
 }
 
+void
+OperatingSystem::finish() {
+  //the stack allocator is shared by every OS in the process
+  static bool stack_stats_printed = false;
+  if (print_stack_stats_ && !stack_stats_printed){
+    stack_stats_printed = true;
+    out_->output("stacks: %zu in use, %zu max in use, %zu bytes max committed per stack, "
+                 "%zu bytes max held in copies\n",
+                 StackAlloc::numInUse(), StackAlloc::maxInUse(),
+                 StackAlloc::maxStackCommitted(), StackAlloc::maxCopiedBytes());
+  }
+}
+
 void
 OperatingSystem::initThreading(SST::Params& params)
 {
@@ -184,6 +198,9 @@ OperatingSystem::startThread(Thread* t)
             StackAlloc::stacksize(),
             parent->globalsStorage(),
             nullptr);
+      if (StackAlloc::copyStacks() && t->getState() != Thread::DONE){
+        StackAlloc::park(stack);
+      }
     }
   running_threads_[t->tid()] = t;
 }
@@ -334,12 +351,19 @@ OperatingSystem::switchToThread(Thread* tothread)
   }
   active_thread_ = tothread;
   activeOs() = this;
+  if (StackAlloc::copyStacks()){
+    StackAlloc::unpark(tothread->stack());
+  }
   tothread->context()->resumeContext(des_context_);
   out_->debug(CALL_INFO, 1, 0,
                 "switched back from context %d to main thread %d\n",
                 tothread->threadId(), threadId());
   /** back to main thread */
   active_thread_ = nullptr;
+  //the thread is blocked now, its stack is copied out if it stays blocked
+  if (StackAlloc::copyStacks() && tothread->getState() != Thread::DONE){
+    StackAlloc::park(tothread->stack());
+  }
 }
 
 void
@@ -52,6 +52,8 @@ public:
 
   void setup() override;
 
+  void finish() override;
+
   void handleEvent(SST::Event *ev) override;
 
   bool clockTic(SST::Cycle_t) override {
@@ -148,6 +150,7 @@ protected:
   unsigned int verbose_;
   int nranks_;
   Thread* blocked_thread_;
+  bool print_stack_stats_;
   int next_condition_;
   int next_mutex_;
   std::map<int, condition_t> conditions_;
@@ -32,6 +32,7 @@
 #include <mercury/components/operating_system.h>
 #include <inttypes.h>
 #include <dlfcn.h>
+#include <sstream>
 
 void sst_hg_app_loaded(int /*aid*/){}
 
@@ -669,9 +670,15 @@ UserAppCxxFullMain::initArgv(argv_entry& entry)
   std::string appname = params_.find<std::string>("name");
   std::string argv_str = params_.find<std::string>("argv", "");
   std::deque<std::string> argv_param_dq;
-//  pst::BasicStringTokenizer::tokenize(argv_str, argv_param_dq, std::string(" "));
+  std::istringstream argv_sstr(argv_str);
+  std::string token;
+  size_t argv_len = appname.size() + 1;
+  while (argv_sstr >> token){
+    argv_len += token.size() + 1;
+    argv_param_dq.push_back(token);
+  }
   int argc = argv_param_dq.size() + 1;
-  char* argv_buffer = new char[256 * argc];
+  char* argv_buffer = new char[argv_len];
   char* argv_buffer_ptr = argv_buffer;
   char** argv = new char*[argc+1];
   argv[0] = argv_buffer;
@@ -106,6 +106,10 @@ class Thread
     return state_;
   }
 
+  void* stack() const {
+    return stack_;
+  }
+
   AppId aid() const {
     return sid_.app_;
   }
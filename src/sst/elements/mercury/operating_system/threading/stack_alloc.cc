@@ -22,7 +22,10 @@
 #include <mercury/operating_system/threading/stack_alloc_chunk.h>
 #include <mercury/operating_system/threading/thread_lock.h>
 
+#include <sys/mman.h>
+#include <signal.h>
 #include <unistd.h>
+#include <algorithm>
 
 namespace SST {
 namespace Hg {
@@ -31,11 +34,88 @@ StackAlloc::chunk_set StackAlloc::chunks_;
 size_t StackAlloc::suggested_chunk_ = 0;
 size_t StackAlloc::stacksize_ = 0;
 bool StackAlloc::protect_stacks_ = false;
+bool StackAlloc::release_stacks_ = true;
+bool StackAlloc::copy_stacks_ = false;
+std::unordered_map<void*, StackAlloc::stack_copy> StackAlloc::copies_;
+std::list<void*> StackAlloc::parked_;
+std::unordered_map<void*, std::list<void*>::iterator> StackAlloc::parked_index_;
+size_t StackAlloc::resident_blocked_ = 16;
+size_t StackAlloc::num_in_use_ = 0;
+size_t StackAlloc::max_in_use_ = 0;
+size_t StackAlloc::max_stack_committed_ = 0;
+size_t StackAlloc::copied_bytes_ = 0;
+size_t StackAlloc::max_copied_bytes_ = 0;
 
 extern "C" {
 int sst_hg_global_stacksize = 0;
 }
 
+static thread_lock stack_lock;
+
+static size_t
+pageSize()
+{
+  static const size_t page = sysconf(_SC_PAGESIZE);
+  return page;
+}
+
+#ifdef __APPLE__
+typedef char mincore_vec_t;
+#else
+typedef unsigned char mincore_vec_t;
+#endif
+
+//
+// Mark which pages of a stack are resident, false if that is not known
+//
+static bool
+residentPages(void* stack, size_t size, std::vector<mincore_vec_t>& resident)
+{
+  resident.resize(size / pageSize());
+  return mincore(stack, size, resident.data()) == 0;
+}
+
+static struct sigaction prev_segv_action;
+static struct sigaction prev_bus_action;
+
+//
+// A fault in a copied-out stack restores the page and retries the access.
+// Any other fault goes to the previous handler by reinstalling it and
+// letting the access fault again.
+//
+static void
+stackFaultHandler(int sig, siginfo_t* info, void* ctx)
+{
+  if (StackAlloc::restoreFaultedPage(info->si_addr)){
+    return;
+  }
+  sigaction(sig, sig == SIGBUS ? &prev_bus_action : &prev_segv_action, nullptr);
+}
+
+static void
+installFaultHandler()
+{
+  struct sigaction action;
+  ::memset(&action, 0, sizeof(action));
+  action.sa_sigaction = stackFaultHandler;
+  action.sa_flags = SA_SIGINFO;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGSEGV, &action, &prev_segv_action);
+  //macOS reports access to a protected page as SIGBUS
+  sigaction(SIGBUS, &action, &prev_bus_action);
+}
+
+static bool
+pageIsZero(const char* page, size_t size)
+{
+  const uint64_t* words = (const uint64_t*) page;
+  size_t nwords = size / sizeof(uint64_t);
+  for (size_t i=0; i < nwords; ++i){
+    if (words[i] != 0) return false;
+  }
+  return true;
+}
+
 void
 StackAlloc::init(SST::Params& params)
 {
@@ -44,16 +124,23 @@ StackAlloc::init(SST::Params& params)
   }
 
   sst_hg_global_stacksize = params.find<SST::UnitAlgebra>("stack_size", "131072B").getRoundedValue();
-  //must be a multiple of 4096
-  int stack_rem = sst_hg_global_stacksize % 4096;
+  //must be a multiple of the page size so pages can be released
+  int page = pageSize();
+  int stack_rem = sst_hg_global_stacksize % page;
   if (stack_rem != 0){
-    sst_hg_global_stacksize += (4096 - stack_rem);
+    sst_hg_global_stacksize += (page - stack_rem);
   }
   std::string chunk = Hg::sprintf("%dB", 8*sst_hg_global_stacksize);
   suggested_chunk_ = params.find<SST::UnitAlgebra>("stack_chunk_size", chunk).getRoundedValue();
   stacksize_ = sst_hg_global_stacksize;
 
   protect_stacks_ = params.find<bool>("protect_stacks", false);
+  release_stacks_ = params.find<bool>("release_stacks", true);
+  copy_stacks_ = params.find<bool>("copy_stacks", false);
+  resident_blocked_ = params.find<size_t>("resident_blocked_stacks", 16);
+  if (copy_stacks_){
+    installFaultHandler();
+  }
 }
 
 void
@@ -68,14 +155,30 @@ StackAlloc::chunk_set::clear()
   available.clear();
 }
 
+//
+// Count the resident pages of a stack.
+//
+size_t
+StackAlloc::committedBytes(void* stack)
+{
+  std::vector<mincore_vec_t> resident;
+  if (!residentPages(stack, stacksize_, resident)){
+    return 0;
+  }
+  size_t count = 0;
+  for (auto r : resident){
+    if (r & 1) ++count;
+  }
+  return count * pageSize();
+}
+
 //
 // Get a stack memory region.
 //
 void*
 StackAlloc::alloc()
 {
-  static thread_lock lock;
-  lock.lock();
+  stack_lock.lock();
   if (stacksize_ == 0) {
     sst_hg_throw_printf(ValueError, "stackalloc::stacksize was not initialized");
   }
@@ -92,7 +195,9 @@ StackAlloc::alloc()
   }
   void *buf = chunks_.available.back();
   chunks_.available.pop_back();
-  lock.unlock();
+  ++num_in_use_;
+  max_in_use_ = std::max(max_in_use_, num_in_use_);
+  stack_lock.unlock();
   return buf;
 }
 
@@ -101,12 +206,186 @@ StackAlloc::alloc()
 //
 void StackAlloc::free(void* buf)
 {
-  static thread_lock lock; 
-  lock.lock();
+  stack_lock.lock();
+  auto it = copies_.find(buf);
+  if (it != copies_.end()){
+    unprotect(buf, it->second.first_page);
+    copied_bytes_ -= it->second.data.size();
+    copies_.erase(it);
+  }
+  auto parked = parked_index_.find(buf);
+  if (parked != parked_index_.end()){
+    parked_.erase(parked->second);
+    parked_index_.erase(parked);
+  }
+  stack_lock.unlock();
+
+  size_t committed = committedBytes(buf);
+  if (release_stacks_){
+    madvise(buf, stacksize_, MADV_DONTNEED);
+  }
+
+  stack_lock.lock();
+  max_stack_committed_ = std::max(max_stack_committed_, committed);
+  --num_in_use_;
   chunks_.available.push_back(buf);
-  lock.unlock();
+  stack_lock.unlock();
+}
+
+void
+StackAlloc::unprotect(void* stack, size_t first_page)
+{
+  size_t page = pageSize();
+  size_t npages = stacksize_ / page;
+  if (first_page < npages){
+    mprotect((char*) stack + first_page * page, (npages - first_page) * page, PROT_READ | PROT_WRITE);
+  }
 }
 
+//
+// Save the non-zero pages of a stack, drop them and remove their access.
+// Dropped pages read back as zero, so only the saved pages are restored.
+// The stack grows down, so nothing below its deepest resident page has
+// been touched and the scan starts there.
+//
+void
+StackAlloc::copyOut(void* stack)
+{
+  size_t page = pageSize();
+  size_t npages = stacksize_ / page;
+  size_t committed = 0;
+  size_t first_page = 0;
+  std::vector<mincore_vec_t> resident;
+  if (residentPages(stack, stacksize_, resident)){
+    first_page = npages;
+    for (size_t i=0; i < npages; ++i){
+      if (resident[i] & 1){
+        first_page = std::min(first_page, i);
+        committed += page;
+      }
+    }
+  }
+
+  stack_copy saved;
+  saved.first_page = first_page;
+  char* base = (char*) stack;
+  for (size_t i=first_page; i < npages; ++i){
+    char* src = base + i * page;
+    if (!pageIsZero(src, page)){
+      saved.pages.push_back(i);
+      saved.data.insert(saved.data.end(), src, src + page);
+    }
+  }
+
+  saved.restored.assign(saved.pages.size(), false);
+
+  stack_lock.lock();
+  max_stack_committed_ = std::max(max_stack_committed_, committed);
+  copied_bytes_ += saved.data.size();
+  max_copied_bytes_ = std::max(max_copied_bytes_, copied_bytes_);
+  copies_[stack] = std::move(saved);
+  stack_lock.unlock();
+
+  //the copy is registered before any access can fault
+  if (first_page < npages){
+    madvise(base + first_page * page, (npages - first_page) * page, MADV_DONTNEED);
+    mprotect(base + first_page * page, (npages - first_page) * page, PROT_NONE);
+  }
+}
+
+void
+StackAlloc::copyIn(void* stack)
+{
+  stack_lock.lock();
+  auto it = copies_.find(stack);
+  if (it == copies_.end()){
+    stack_lock.unlock();
+    return;
+  }
+  //the copy stays registered until every page is accessible again, and
+  //pages restored on a fault may have been written since, so skip them
+  stack_copy& saved = it->second;
+  unprotect(stack, saved.first_page);
+  size_t page = pageSize();
+  char* base = (char*) stack;
+  for (size_t i=0; i < saved.pages.size(); ++i){
+    if (!saved.restored[i]){
+      ::memcpy(base + saved.pages[i] * page, saved.data.data() + i * page, page);
+    }
+  }
+  copied_bytes_ -= saved.data.size();
+  copies_.erase(it);
+  stack_lock.unlock();
+}
+
+//
+// The simulator accessed a copied-out page of a blocked thread's stack.
+// Give the page its access back and restore it, a page without saved
+// data was zero when it was dropped and is left as is.
+//
+bool
+StackAlloc::restoreFaultedPage(void* addr)
+{
+  size_t page = pageSize();
+  char* fault = (char*) addr;
+  bool found = false;
+  stack_lock.lock();
+  for (auto& pair : copies_){
+    char* base = (char*) pair.first;
+    stack_copy& saved = pair.second;
+    if (fault < base + saved.first_page * page || fault >= base + stacksize_){
+      continue;
+    }
+    uint32_t idx = (fault - base) / page;
+    char* dst = base + idx * page;
+    mprotect(dst, page, PROT_READ | PROT_WRITE);
+    auto it = std::lower_bound(saved.pages.begin(), saved.pages.end(), idx);
+    if (it != saved.pages.end() && *it == idx){
+      size_t i = it - saved.pages.begin();
+      ::memcpy(dst, saved.data.data() + i * page, page);
+      saved.restored[i] = true;
+    }
+    found = true;
+    break;
+  }
+  stack_lock.unlock();
+  return found;
+}
+
+void
+StackAlloc::park(void* stack)
+{
+  void* oldest = nullptr;
+  stack_lock.lock();
+  parked_.push_front(stack);
+  parked_index_[stack] = parked_.begin();
+  if (parked_.size() > resident_blocked_){
+    oldest = parked_.back();
+    parked_.pop_back();
+    parked_index_.erase(oldest);
+  }
+  stack_lock.unlock();
+
+  if (oldest){
+    copyOut(oldest);
+  }
+}
+
+void
+StackAlloc::unpark(void* stack)
+{
+  stack_lock.lock();
+  auto parked = parked_index_.find(stack);
+  if (parked != parked_index_.end()){
+    //blocked only briefly, the stack is still resident
+    parked_.erase(parked->second);
+    parked_index_.erase(parked);
+    stack_lock.unlock();
+    return;
+  }
+  stack_lock.unlock();
+  copyIn(stack);
+}
 
 } // end pf namespace sw
 } // end of namespace sstmac
@@ -17,7 +17,10 @@
 
 #include <sst/core/params.h>
 
+#include <cstdint>
 #include <cstring>
+#include <list>
+#include <unordered_map>
 #include <vector>
 
 namespace SST {
@@ -29,8 +32,19 @@ namespace Hg {
  * which allocates uniform-size chunks (with the NX bit unset)
  * and sets guard pages on each side of the allocated stacks.
  *
- * This allocator does not return memory to the system until it is
- * deleted, but regions can be allocated and free-d repeatedly.
+ * Stack pages are only committed when touched. Regions are never
+ * unmapped until the allocator is deleted, but free-d stacks are
+ * reused and (optionally) their pages returned to the system.
+ * Threads which stay blocked for a long time can also have their used
+ * stack pages copied aside so that only the actually used depth stays
+ * resident.
+ *
+ * The simulator may still read or write the stack of a blocked thread,
+ * for example a receive buffer or status object a skeleton keeps on its
+ * stack. Copied-out pages are therefore mapped with no access. The first
+ * access to one of them faults, restores that page from the copy and
+ * continues, so accesses never see the dropped page and restoring the
+ * rest of the copy never overwrites them.
  */
 class StackAlloc
 {
@@ -45,6 +59,17 @@ class StackAlloc
     void clear();
   };
  private:
+  /// The non-zero pages of a stack, saved while its thread is blocked
+  struct stack_copy {
+    /// Pages from here to the top of the stack have no access
+    size_t first_page;
+    /// Saved pages in increasing order
+    std::vector<uint32_t> pages;
+    std::vector<char> data;
+    /// Saved pages already restored on a fault
+    std::vector<bool> restored;
+  };
+
   static chunk_set chunks_;
   /// Each chunk is of this suggested size.
   static size_t suggested_chunk_;
@@ -52,6 +77,35 @@ class StackAlloc
   static size_t stacksize_;
   /// Optionally added a protected stack between each stack we return
   static bool protect_stacks_;
+  /// madvise away the pages of free-d stacks
+  static bool release_stacks_;
+  /// Copy the stacks of blocked threads aside and release their pages
+  static bool copy_stacks_;
+  static std::unordered_map<void*, stack_copy> copies_;
+  /// Blocked stacks which are still resident, most recently blocked first
+  static std::list<void*> parked_;
+  static std::unordered_map<void*, std::list<void*>::iterator> parked_index_;
+  /// How many blocked stacks stay resident before the oldest is copied out
+  static size_t resident_blocked_;
+
+  /// Usage statistics and their high-water marks
+  static size_t num_in_use_;
+  static size_t max_in_use_;
+  static size_t max_stack_committed_;
+  static size_t copied_bytes_;
+  static size_t max_copied_bytes_;
+
+  static size_t committedBytes(void* stack);
+
+  /// Save the used pages of a stack and release them to the system.
+  /// Must not be called on the running stack.
+  static void copyOut(void* stack);
+
+  /// Restore a stack previously saved with copyOut, if any
+  static void copyIn(void* stack);
+
+  /// Give a copied-out range its access back
+  static void unprotect(void* stack, size_t first_page);
 
  public:
   static size_t stacksize() {
@@ -66,14 +120,47 @@ class StackAlloc
     return suggested_chunk_;
   }
 
+  static bool copyStacks() {
+    return copy_stacks_;
+  }
+
+  static size_t numInUse() {
+    return num_in_use_;
+  }
+
+  static size_t maxInUse() {
+    return max_in_use_;
+  }
+
+  /// The most bytes committed by a single stack (sampled on free and copy)
+  static size_t maxStackCommitted() {
+    return max_stack_committed_;
+  }
+
+  static size_t maxCopiedBytes() {
+    return max_copied_bytes_;
+  }
+
   static void init(SST::Params& params);
 
   static void* alloc();
 
   static void free(void*);
 
+  /// The thread on this stack has blocked. The stack is copied out only
+  /// once more than resident_blocked_stacks other stacks have blocked
+  /// after it, so threads that block briefly are never copied.
+  static void park(void* stack);
+
+  /// The thread on this stack is about to resume
+  static void unpark(void* stack);
+
   static void clear();
 
+  /// Called on a memory fault at addr. If addr is in a copied-out stack,
+  /// restore its page and return true so the access is retried.
+  static bool restoreFaultedPage(void* addr);
+
 };
 
 } // end of namespace Hg
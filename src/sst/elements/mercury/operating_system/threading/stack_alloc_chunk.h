@@ -26,6 +26,8 @@ namespace Hg {
 
 /**
  * A chunk of allocated memory to be divided into fixed-size stacks.
+ * The region is reserved without committing swap, so only the pages
+ * a stack actually touches count against the process.
  */
 class StackAlloc::chunk
 {
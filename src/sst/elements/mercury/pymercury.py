@@ -111,6 +111,16 @@ class HgOS(TemplateBase):
                                            "use_put_window",
                                            "compute_library_access_width",
                                            "compute_library_loop_overhead",
+                                           "smp_optimize",
+                                           "allreduce",
+                                           "bcast",
+                                           "allgather",
+                                           "alltoall",
+                                           "ring_cutoff",
+                                           "ring_max_nproc",
+                                           "pipeline_cutoff",
+                                           "segment_size",
+                                           "bcast_fanout",
                                           ],
                                           "app1.")
         self._subscribeToPlatformParamSet("operating_system")        
@@ -242,6 +242,7 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
 
     pc_params.insert("flit_size", flit_size.toStringBestSI());
     if (pc_params.contains("network_inspectors")) pc_params.insert("network_inspectors", params.find<std::string>("network_inspectors", ""));
+    if (params.contains("packet_reducer")) pc_params.insert("packet_reducer", params.find<std::string>("packet_reducer", ""));
     pc_params.insert("oql_track_port", params.find<std::string>("oql_track_port","false"));
     pc_params.insert("oql_track_remote", params.find<std::string>("oql_track_remote","false"));
 
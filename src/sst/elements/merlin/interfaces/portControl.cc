@@ -438,6 +438,18 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
         network_inspectors.push_back(ni);
     }
 
+    // Reducers only see packets as they enter the network
+    packet_reducer = nullptr;
+    std::string reducer_name = params.find<std::string>("packet_reducer","");
+    if ( host_port && !reducer_name.empty() ) {
+        Params reducer_params = params.get_scoped_params("packet_reducer");
+        packet_reducer = loadAnonymousSubComponent<PacketReducer>
+            (reducer_name, "packet_reducer", 0, ComponentInfo::INSERT_STATS, reducer_params, rtr_id);
+        if ( packet_reducer == nullptr ) {
+            merlin_abort.fatal(CALL_INFO,1,"PacketReducer: %s, not found.\n",reducer_name.c_str());
+        }
+    }
+
     dlink_thresh = params.find<float>("dlink_thresh",-1.0);
     // Unless otherwise stated, we will turn on track port if we are a host port
     oql_track_port = params.find<bool>("oql_track_port",host_port);
@@ -552,6 +564,7 @@ PortControl::~PortControl() {
     for ( unsigned int i = 0; i < network_inspectors.size(); i++ ) {
         delete network_inspectors[i];
     }
+    if ( packet_reducer != nullptr ) delete packet_reducer;
 }
 
 void
@@ -945,8 +958,24 @@ PortControl::handle_input_n2r(Event* ev)
 	    RtrEvent* event = static_cast<RtrEvent*>(ev);
 	    // Simply put the event into the right virtual network queue
 
-	    // Need to process input and do the routing
         int vn = event->getRouteVN();
+
+        if ( packet_reducer != nullptr ) {
+            SST::Interfaces::SimpleNetwork::Request* req = packet_reducer->reduce(event->inspectRequest());
+            if ( req != event->inspectRequest() ) {
+                // The reducer now owns the original request
+                event->takeRequest();
+                if ( req == nullptr ) {
+                    // Packet was held, so its buffer space is free again
+                    port_link->send(1,new credit_event(vn,event->getSizeInFlits()));
+                    delete event;
+                    break;
+                }
+                event->setRequest(req);
+            }
+        }
+
+	    // Need to process input and do the routing
         internal_router_event* rtr_event = topo->process_input(event);
         if ( enable_congestion_management ) parent->reportIncomingEvent(rtr_event);
         rtr_event->setCreditReturnVC(vn);
@@ -63,6 +63,7 @@ public:
         {"input_buf_size",     "Size of input buffers specified in b or B (can include SI prefix)."},
         {"output_buf_size",    "Size of output buffers specified in b or B (can include SI prefix)."},
         {"network_inspectors", "Comma separated list of network inspectors to put on output ports.", ""},
+        {"packet_reducer",     "PacketReducer applied to packets entering the network on host ports.  Its parameters are scoped under packet_reducer.", ""},
         {"dlink_thresh",       ""},
         {"num_vns",            "Number of VNs set in router or python file (-1 if not set in the parent router)."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
@@ -91,6 +92,7 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
         {"inspector_slot", "Network inspectors", "SST::Interfaces::SimpleNetwork::NetworkInspector" },
+        {"packet_reducer", "Reducer for packets entering the network on host ports", "SST::Merlin::PacketReducer" },
         {"arbitration", "Arbitration unit to use for output", "SST::Merlin::OutputArbitration" }
     )
 
@@ -347,6 +349,7 @@ public:
 private:
 
     std::vector<SST::Interfaces::SimpleNetwork::NetworkInspector*> network_inspectors;
+    PacketReducer* packet_reducer;
 
     void dumpQueueState(port_queue_t& q, std::ostream& stream);
     void dumpQueueState(port_queue_t& q, Output& out);
@@ -87,7 +87,7 @@ class topoSimple(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys.extend(["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw","input_latency","output_latency","input_buf_size","output_buf_size"])
-        self.topoOptKeys.extend(["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs"])
+        self.topoOptKeys.extend(["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs","packet_reducer"])
     def getName(self):
         return "Simple"
     def prepParams(self):
@@ -123,7 +123,7 @@ class topoTorus(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys.extend(["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "torus.shape", "torus.width", "torus.local_ports","input_latency","output_latency","input_buf_size","output_buf_size"])
-        self.topoOptKeys.extend(["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs"])
+        self.topoOptKeys.extend(["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs","packet_reducer"])
     def getName(self):
         return "Torus"
     def prepParams(self):
@@ -253,7 +253,7 @@ class topoMesh(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "mesh.shape", "mesh.width", "mesh.local_ports","input_latency","output_latency","input_buf_size","output_buf_size"]
-        self.topoOptKeys = ["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs"]
+        self.topoOptKeys = ["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs","packet_reducer"]
     def getName(self):
         return "Mesh"
     def prepParams(self):
@@ -388,7 +388,7 @@ class topoHyperX(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "hyperx.shape", "hyperx.width", "hyperx.local_ports","input_latency","output_latency","input_buf_size","output_buf_size"]
-        self.topoOptKeys = ["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs"]
+        self.topoOptKeys = ["xbar_arb","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs","packet_reducer"]
     def getName(self):
         return "HyperX"
     def prepParams(self):
@@ -527,7 +527,7 @@ class topoFatTree(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "flit_size", "link_bw", "xbar_bw","input_latency","output_latency","input_buf_size","output_buf_size", "fattree.shape"]
-        self.topoOptKeys = ["xbar_arb", "fattree.routing_alg", "fattree.adaptive_threshold","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs"]
+        self.topoOptKeys = ["xbar_arb", "fattree.routing_alg", "fattree.adaptive_threshold","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs","packet_reducer"]
         self.nicKeys = ["link_bw"]
         self.ups = []
         self.downs = []
@@ -757,7 +757,7 @@ class topoDragonFly(Topo):
     def __init__(self):
         Topo.__init__(self)
         self.topoKeys = ["topology", "debug", "num_ports", "flit_size", "link_bw", "xbar_bw", "dragonfly.hosts_per_router", "dragonfly.routers_per_group", "dragonfly.intergroup_per_router", "dragonfly.num_groups","dragonfly.intergroup_links","input_latency","output_latency","input_buf_size","output_buf_size","dragonfly.global_route_mode"]
-        self.topoOptKeys = ["xbar_arb","link_bw.host","link_bw.group","link_bw.global","input_latency.host","input_latency.group","input_latency.global","output_latency.host","output_latency.group","output_latency.global","input_buf_size.host","input_buf_size.group","input_buf_size.global","output_buf_size.host","output_buf_size.group","output_buf_size.global","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs"]
+        self.topoOptKeys = ["xbar_arb","link_bw.host","link_bw.group","link_bw.global","input_latency.host","input_latency.group","input_latency.global","output_latency.host","output_latency.group","output_latency.global","input_buf_size.host","input_buf_size.group","input_buf_size.global","output_buf_size.host","output_buf_size.group","output_buf_size.global","num_vns","vn_remap","vn_remap_shm","portcontrol.output_arb","portcontrol.arbitration.qos_settings","portcontrol.arbitration.arb_vns","portcontrol.arbitration.arb_vcs","packet_reducer"]
         self.global_link_map = None
         self.global_routes = "absolute"
 
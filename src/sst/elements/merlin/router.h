@@ -161,6 +161,8 @@ public:
         request = nullptr;
         return ret;
     }
+    inline SST::Interfaces::SimpleNetwork::Request* inspectRequest() { return request; }
+    inline void setRequest(SST::Interfaces::SimpleNetwork::Request* req) { request = req; }
 
     virtual void print(const std::string& header, Output &out) const  override {
         out.output("%s RtrEvent to be delivered at %" PRI_SIMTIME " with priority %d. src = %" PRI_NID " (logical: %" PRI_NID "), dest = %" PRI_NID "\n",
@@ -654,6 +656,29 @@ public:
 
 };
 
+// Combines packets as they enter the network from an endpoint, used to
+// model in-network reductions.  One reducer is loaded for each host
+// port, so reducers that combine packets from several endpoints need
+// to share state across the ports of a router themselves.
+class PacketReducer : public SubComponent {
+public:
+
+    // params are: router id
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::Merlin::PacketReducer, int)
+
+    PacketReducer(ComponentId_t cid) :
+        SubComponent(cid)
+    {}
+    virtual ~PacketReducer() {}
+
+    // Called for every packet received from the endpoint.  Returns
+    // the request to route: req to forward it unchanged, nullptr if
+    // the reducer kept it, or another request of the same size that
+    // is routed in its place.  The reducer owns req whenever anything
+    // other than req is returned.
+    virtual SST::Interfaces::SimpleNetwork::Request* reduce(SST::Interfaces::SimpleNetwork::Request* req) = 0;
+};
+
 }
 }
 
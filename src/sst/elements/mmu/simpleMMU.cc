@@ -165,25 +165,35 @@ void SimpleMMU::checkpoint( std::string dir ) {
 
     std::stringstream filename;
     filename << dir << "/" << getName();
-    auto fp = fopen(filename.str().c_str(),"w+");
+    auto fp = fopen(filename.str().c_str(),"w");
+    if ( nullptr == fp ) {
+        m_dbg.fatal(CALL_INFO, -1, "Error: unable to open MMU checkpoint %s\n", filename.str().c_str());
+    }
 
     m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
-    fprintf(fp,"m_pageTableMap.size() %zu\n",m_pageTableMap.size());
+    CheckpointHeader header = { MMU_CHECKPOINT_MAGIC, MMU_CHECKPOINT_VERSION, 0 };
+    checkpointWrite( &m_dbg, fp, &header, sizeof(header) );
+
+    uint64_t size = m_pageTableMap.size();
+    checkpointWrite( &m_dbg, fp, &size, sizeof(size) );
     for ( auto & x : m_pageTableMap ) {
-        auto pageTable = x.second;
-        fprintf(fp,"pid: %i\n",x.first);
-        pageTable->checkpoint( fp );
+        uint64_t pid = x.first;
+        checkpointWrite( &m_dbg, fp, &pid, sizeof(pid) );
+        x.second->checkpoint( &m_dbg, fp );
     }
 
-    fprintf(fp,"m_coreToPid.size() %zu\n", m_coreToPid.size());
+    size = m_coreToPid.size();
+    checkpointWrite( &m_dbg, fp, &size, sizeof(size) );
     for ( auto core = 0; core < m_coreToPid.size(); core++ ) {
-        auto& x = m_coreToPid[core];
-        fprintf(fp,"core: %d, numPids: %zu\n",core,x.size());
-        for ( auto j = 0; j < x.size(); j++ ) {
-            fprintf(fp,"%d ",x[j]);
-        }
-        fprintf(fp,"\n");
+        std::vector<uint32_t> pids( m_coreToPid[core].begin(), m_coreToPid[core].end() );
+        size = pids.size();
+        checkpointWrite( &m_dbg, fp, &size, sizeof(size) );
+        checkpointWrite( &m_dbg, fp, pids.data(), size * sizeof(uint32_t) );
+    }
+
+    if ( 0 != fclose( fp ) ) {
+        m_dbg.fatal(CALL_INFO, -1, "Error: unable to write MMU checkpoint %s\n", filename.str().c_str());
     }
 }
 
@@ -191,35 +201,40 @@ void SimpleMMU::checkpointLoad( std::string dir ) {
     std::stringstream filename;
     filename << dir << "/" << getName();
     auto fp = fopen(filename.str().c_str(),"r");
-    assert(fp);
+    if ( nullptr == fp ) {
+        m_dbg.fatal(CALL_INFO, -1, "Error: unable to open MMU checkpoint %s\n", filename.str().c_str());
+    }
 
     m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"Checkpoint load component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
-    int size;
-    assert( 1 == fscanf( fp, "m_pageTableMap.size() %d\n",&size) );
-    m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"m_pageTableMap.size() %d\n",size);
+    CheckpointHeader header;
+    checkpointRead( &m_dbg, fp, &header, sizeof(header) );
+    if ( MMU_CHECKPOINT_MAGIC != header.magic || MMU_CHECKPOINT_VERSION != header.version ) {
+        m_dbg.fatal(CALL_INFO, -1, "Error: %s is not a version %d MMU checkpoint\n", filename.str().c_str(), MMU_CHECKPOINT_VERSION);
+    }
+
+    uint64_t size;
+    checkpointRead( &m_dbg, fp, &size, sizeof(size) );
+    m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"m_pageTableMap.size() %" PRIu64 "\n",size);
     for ( auto i = 0; i < size; i++ ) {
-        int pid;
-        assert( 1 == fscanf( fp, "pid: %d\n",&pid) );
-        m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"pid: %d\n",pid);
+        uint64_t pid;
+        checkpointRead( &m_dbg, fp, &pid, sizeof(pid) );
+        m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"pid: %" PRIu64 "\n",pid);
         m_pageTableMap[pid] = new PageTable( &m_dbg, fp );
     }
 
-    assert( 1 == fscanf( fp, "m_coreToPid.size() %d\n", &size) );
-    m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"m_coreToPid.size() %d\n",size );
+    checkpointRead( &m_dbg, fp, &size, sizeof(size) );
+    m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"m_coreToPid.size() %" PRIu64 "\n",size );
 
     m_coreToPid.resize( size );
     for ( auto core = 0; core < m_coreToPid.size(); core++ ) {
-        int x, numPids;
-        assert( 2 == fscanf( fp, "core: %d, numPids: %d\n", &x, &numPids) );
-        m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT, "core: %d, numPids: %d\n", x, numPids);
-        m_coreToPid[core].resize( numPids );
-        for ( auto i = 0; i < numPids; i++ ) {
-            int pid;
-            assert( 1 == fscanf(fp,"%d ",&pid) );
-            m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"%d ",pid);
-            m_coreToPid[core][i] =  pid;
-        }
-        m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"\n");
+        uint64_t numPids;
+        checkpointRead( &m_dbg, fp, &numPids, sizeof(numPids) );
+        std::vector<uint32_t> pids( numPids );
+        checkpointRead( &m_dbg, fp, pids.data(), numPids * sizeof(uint32_t) );
+        m_dbg.debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT, "core: %d, numPids: %" PRIu64 "\n", core, numPids);
+        m_coreToPid[core].assign( pids.begin(), pids.end() );
     }
+
+    fclose( fp );
 }
@@ -23,6 +23,8 @@
 namespace SST {
 
 #define MMU_DBG_CHECKPOINT (1<<0)
+#define MMU_CHECKPOINT_MAGIC   0x544e504b43554d4dULL   // "MMUCKPNT"
+#define MMU_CHECKPOINT_VERSION 1
 namespace MMU_Lib {
 
 class SimpleMMU : public MMU {
@@ -101,21 +103,47 @@ class SimpleMMU : public MMU {
 
   private:
 
+    // The checkpoint is binary, a header followed by the page tables as
+    // arrays of fixed size records so large tables restore with one read
+    struct CheckpointHeader {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t pad;
+    };
+
+    struct CheckpointPTE {
+        uint32_t vpn;
+        uint32_t ppn;
+        uint32_t perms;
+        uint32_t pad;
+    };
+
+    static void checkpointWrite( SST::Output* output, FILE* fp, const void* data, size_t length ) {
+        if ( length && 1 != fwrite( data, length, 1, fp ) ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to write MMU checkpoint\n");
+        }
+    }
+
+    static void checkpointRead( SST::Output* output, FILE* fp, void* data, size_t length ) {
+        if ( length && 1 != fread( data, length, 1, fp ) ) {
+            output->fatal(CALL_INFO, -1, "Error: MMU checkpoint is truncated\n");
+        }
+    }
+
     class PageTable {
       public:
         PageTable() {}
         PageTable( SST::Output* output, FILE* fp ) {
-            int size;
-
-            assert( 1 == fscanf( fp, "pteMap.size() %d\n", &size ) );
-            output->debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"pteMap.size() %d\n",size);
-            for ( auto i = 0; i < size; i++ ) {
-                uint32_t vpn;
-                uint32_t ppn;
-                uint32_t perms;
-                assert( 3 == fscanf( fp, "vpn: %d, ppn: %d, perms: %x\n", &vpn, &ppn, &perms ) );
-                output->debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"vpn: %d, ppn: %d, perms: %x\n", vpn, ppn, perms );
-                pteMap[vpn] = PTE( ppn, perms );
+            uint64_t size;
+            checkpointRead( output, fp, &size, sizeof(size) );
+            output->debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"pteMap.size() %" PRIu64 "\n",size);
+
+            std::vector<CheckpointPTE> ptes( size );
+            checkpointRead( output, fp, ptes.data(), size * sizeof(CheckpointPTE) );
+
+            // entries were written in vpn order, hint each insert at the end
+            for ( auto & x : ptes ) {
+                pteMap.emplace_hint( pteMap.end(), x.vpn, PTE( x.ppn, x.perms ) );
             }
         }
 
@@ -142,11 +170,15 @@ class SimpleMMU : public MMU {
                 printf("PageTabl::%s() %s vpn=%d ppn=%d perm=%#x\n",__func__,str.c_str(),kv.first,kv.second.ppn,kv.second.perms);
             }
         }
-        void checkpoint( FILE* fp ) {
-            fprintf(fp,"pteMap.size() %zu\n",pteMap.size());
+        void checkpoint( SST::Output* output, FILE* fp ) {
+            std::vector<CheckpointPTE> ptes;
+            ptes.reserve( pteMap.size() );
             for ( auto & x : pteMap ) {
-                fprintf(fp,"vpn: %d, ppn: %d, perms: %d \n", x.first,x.second.ppn,x.second.perms );
+                ptes.push_back( { x.first, x.second.ppn, x.second.perms, 0 } );
             }
+            uint64_t size = ptes.size();
+            checkpointWrite( output, fp, &size, sizeof(size) );
+            checkpointWrite( output, fp, ptes.data(), size * sizeof(CheckpointPTE) );
         }
       private:
         std::map<uint32_t,PTE> pteMap; 
@@ -79,8 +79,10 @@ class VanadisInstruction
             hasExecuted           = false;
             hasIssued             = false;
             enduOpGroup           = false;
+            startuOpGroup         = false;
             isFrontOfROB          = false;
             hasROBSlot            = false;
+            needReplay            = false;
             sw_thread = hw_thr;
         }
 
@@ -113,8 +115,10 @@ class VanadisInstruction
             hasExecuted           = copy_me.hasExecuted;
             hasIssued             = copy_me.hasIssued;
             enduOpGroup           = copy_me.enduOpGroup;
+            startuOpGroup         = copy_me.startuOpGroup;
             isFrontOfROB          = false;
             hasROBSlot            = false;
+            needReplay            = false;
             sw_thread             = copy_me.sw_thread;
 
             phys_int_regs_in  = (count_phys_int_reg_in > 0) ? new uint16_t[count_phys_int_reg_in] : nullptr;
@@ -306,6 +310,8 @@ class VanadisInstruction
 
         void markEndOfMicroOpGroup() { enduOpGroup = true; }
         bool endsMicroOpGroup() const { return enduOpGroup; }
+        void markStartOfMicroOpGroup() { startuOpGroup = true; }
+        bool startsMicroOpGroup() const { return startuOpGroup; }
         bool trapsError() const { return trapError; }
 
         uint64_t getInstructionAddress() const { return ins_address; }
@@ -418,6 +424,12 @@ class VanadisInstruction
 
         void flagError() { trapError = true; }
 
+        // The instruction read a value which was later found to be stale (e.g.
+        // a load issued ahead of an older store it overlaps), when it reaches
+        // the front of the ROB the pipeline is cleared and refetched from it
+        bool needsReplay() const { return needReplay; }
+        void flagReplay() { needReplay = true; }
+
         virtual bool performIntRegisterRecovery() const { return true; }
         virtual bool performFPRegisterRecovery() const { return true; }
 
@@ -461,8 +473,10 @@ class VanadisInstruction
         bool hasExecuted;
         bool hasIssued;
         bool enduOpGroup;
+        bool startuOpGroup;
         bool isFrontOfROB;
         bool hasROBSlot;        
+        bool needReplay;
 
         const VanadisDecoderOptions* isa_options;
         uint32_t sw_thread;
@@ -22,6 +22,8 @@
 
 #include "lsq/vlsq.h"
 #include "lsq/vbasiclsqentry.h"
+#include "lsq/vbasicstoreindex.h"
+#include "lsq/vstoreset.h"
 #include "util/vsignx.h"
 #include "inst/vstorecond.h"
 
@@ -30,6 +32,9 @@
 #include <cstdint>
 #include <vector>
 #include <queue>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace SST::Interfaces;
 
@@ -53,7 +58,11 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                 { "max_loads", "Set the maximum number of loads permitted in the queue", "16" },
                 { "address_mask", "Can mask off address bits if needed during construction of a operation", "0xFFFFFFFFFFFFFFFF"},
                 { "issues_per_cycle", "Maximum number of issues the LSQ can attempt per cycle.", "2"},
-                { "cache_line_width", "Number of bytes in a (L1) cache line", "64"}
+                { "cache_line_width", "Number of bytes in a (L1) cache line", "64"},
+                { "store_forwarding", "Allow a load whose bytes are all held by pending stores in the store buffer to take its value from them instead of waiting for the stores to drain", "false"},
+                { "speculative_loads", "Allow a load to issue ahead of older stores which are waiting for space in the store buffer, using a store-set predictor to avoid likely conflicts", "false"},
+                { "store_set_entries", "Number of entries in the store-set predictor table", "1024"},
+                { "speculation_window", "Number of queued operations behind a stalled store searched for a load to issue speculatively", "8"}
             )
 
         SST_ELI_DOCUMENT_STATISTICS({ "bytes_read", "Count all the bytes read for data operations", "bytes", 1 },
@@ -69,13 +78,22 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                                     { "stores_in_flight", "Count the number of stores which are in-flight", "operations", 1},
                                     { "store_buffer_entries", "Count the number of stores held in the store buffer", "operations", 1},
                                     { "split_stores", "Count the number of stores which are fractured due to cache boundaries", "operations", 1},
-                                    { "split_loads", "Count the number of loads which are fractured due to cache boundaries", "operations", 1})
+                                    { "split_loads", "Count the number of loads which are fractured due to cache boundaries", "operations", 1},
+                                    { "store_forwards", "Count the number of loads satisfied from the store buffer without accessing memory", "operations", 1},
+                                    { "store_forward_conflicts", "Count the number of load issue attempts stalled by an overlapping buffered store which cannot forward to the load", "operations", 1},
+                                    { "speculative_loads", "Count the number of loads issued ahead of older stores with unresolved addresses", "operations", 1},
+                                    { "predicted_dependences", "Count the number of speculative load attempts held back by the store-set predictor", "operations", 1},
+                                    { "ordering_violations", "Count the number of speculative loads found to overlap an older store and replayed", "operations", 1})
 
         
         VanadisBasicLoadStoreQueue(ComponentId_t id, Params& params, int coreid, int hwthreads) : VanadisLoadStoreQueue(id, params, coreid, hwthreads),
             max_stores(params.find<size_t>("max_stores", 8)),
         max_loads(params.find<size_t>("max_loads", 16)),
-        max_issue_attempts_per_cycle(params.find("issues_per_cycle", 2)) 
+        max_issue_attempts_per_cycle(params.find("issues_per_cycle", 2)),
+        store_forwarding_enabled(params.find<bool>("store_forwarding", false)),
+        speculative_loads_enabled(params.find<bool>("speculative_loads", false)),
+        speculation_window(params.find<size_t>("speculation_window", 8)),
+        store_sets(params.find<size_t>("store_set_entries", 1024))
         {
             std_mem_handlers = new VanadisBasicLoadStoreQueue::StandardMemHandlers(this, output);
 
@@ -95,6 +113,12 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
             stores_pending.resize(hw_threads);
             stores_pending_index = 0;
             stores_pending_size = 0;
+            store_index.resize(hw_threads);
+
+            loads_pending_size = 0;
+            loads_pending_count.resize(hw_threads, 0);
+
+            speculative_loads.resize(hw_threads);
 
             stat_loads_issued = registerStatistic<uint64_t>("loads_issued", "1");
             stat_stores_issued = registerStatistic<uint64_t>("stores_issued", "1");
@@ -111,6 +135,24 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
             stat_stores_pending = registerStatistic<uint64_t>("stores_in_flight", "1");
             stat_loads_pending = registerStatistic<uint64_t>("loads_in_flight", "1");
             stat_op_q_size = registerStatistic<uint64_t>("operations_pending");
+
+            // only registered when the feature is on so the default output is unchanged
+            stat_store_forwards = nullptr;
+            stat_store_forward_conflicts = nullptr;
+            stat_speculative_loads = nullptr;
+            stat_predicted_dependences = nullptr;
+            stat_ordering_violations = nullptr;
+
+            if(store_forwarding_enabled) {
+                stat_store_forwards = registerStatistic<uint64_t>("store_forwards", "1");
+                stat_store_forward_conflicts = registerStatistic<uint64_t>("store_forward_conflicts", "1");
+            }
+
+            if(speculative_loads_enabled) {
+                stat_speculative_loads = registerStatistic<uint64_t>("speculative_loads", "1");
+                stat_predicted_dependences = registerStatistic<uint64_t>("predicted_dependences", "1");
+                stat_ordering_violations = registerStatistic<uint64_t>("ordering_violations", "1");
+            }
         }
 
 
@@ -166,20 +208,33 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
             }
 
+            // a split load is held under each of its request ids, delete it with the last one
             for(auto load_itr = loads_pending.begin(); load_itr != loads_pending.end(); ) {
-                if( (*load_itr)->getHWThread() == thread ) {
-                    delete (*load_itr);
+                VanadisBasicLoadPendingEntry* load_entry = load_itr->second;
+
+                if( load_entry->getHWThread() == thread ) {
+                    load_entry->removeRequest(load_itr->first);
+
+                    if(0 == load_entry->countRequests()) {
+                        delete load_entry;
+                        loads_pending_size--;
+                    }
+
                     load_itr = loads_pending.erase(load_itr);
                 } else {
                     ++load_itr;
                 }
             }
+            loads_pending_count[thread] = 0;
 
             stores_pending_size -= stores_pending[thread].size();
             for(auto store_itr = stores_pending[thread].begin(); store_itr != stores_pending[thread].end(); ) {
                 delete (*store_itr);
                 store_itr = stores_pending[thread].erase(store_itr);
             }
+            store_index[thread].clear();
+
+            speculative_loads[thread].clear();
         }
 
         // must be implemented to allow the memory system to initialize itself during
@@ -220,14 +275,12 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
             if(output->getVerboseLevel() >= 16) {
                 output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "-> tick LSQ at cycle %" PRIu64 "\n", cycle);
 
-                if(loads_pending.size() > 0) {
-                    for(int i = loads_pending.size() - 1; i >= 0; i--) {
-                        VanadisBasicLoadPendingEntry* load_entry = loads_pending.at(i);
-                        output->verbose(CALL_INFO, 8, 0, "-->   load[%5d] ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " / addr: 0x%" PRI_ADDR " / width: %" PRIu64 "\n",
-                            i, load_entry->getLoadInstruction()->getInstructionAddress(),
-                            load_entry->getLoadInstruction()->getHWThread(),
-                            load_entry->getLoadAddress(), load_entry->getLoadWidth());
-                    }
+                for(auto load_itr = loads_pending.begin(); load_itr != loads_pending.end(); load_itr++) {
+                    VanadisBasicLoadPendingEntry* load_entry = load_itr->second;
+                    output->verbose(CALL_INFO, 8, 0, "-->   load[%5" PRIu64 "] ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " / addr: 0x%" PRI_ADDR " / width: %" PRIu64 "\n",
+                        (uint64_t) load_itr->first, load_entry->getLoadInstruction()->getInstructionAddress(),
+                        load_entry->getLoadInstruction()->getHWThread(),
+                        load_entry->getLoadAddress(), load_entry->getLoadWidth());
                 }
 
                 if(stores_pending_size > 0) {
@@ -245,7 +298,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
             }
 
             stat_op_q_size->addData(op_q_size);
-            stat_loads_pending->addData(loads_pending.size());
+            stat_loads_pending->addData(loads_pending_size);
             stat_stores_pending->addData(std_stores_in_flight.size());
             stat_store_buffer_entries->addData(stores_pending_size);
 
@@ -334,14 +387,11 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     out->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "-> handle read-response (virt-addr: 0x%" PRI_ADDR ")\n", ev->vAddr);
                     lsq->stat_loaded_bytes->addData(ev->size);
 
-                    auto load_itr = lsq->loads_pending.begin();
+                    auto load_itr = lsq->loads_pending.find(ev->getID());
                     VanadisBasicLoadPendingEntry* load_entry = nullptr;
 
-                    for(; load_itr != lsq->loads_pending.end(); load_itr++) {
-                        if((*load_itr)->containsRequest(ev->getID())) {
-                            load_entry = *load_itr;
-                            break;
-                        }
+                    if(load_itr != lsq->loads_pending.end()) {
+                        load_entry = load_itr->second;
                     }
                     VanadisLoadInstruction* load_ins = nullptr;
                     if ( load_entry ) {
@@ -492,6 +542,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     ///////////////////////////////////////////////////////////////////////////////////
 
                     load_entry->removeRequest(ev->getID());
+                    lsq->loads_pending.erase(load_itr);
 
                     if(0 == load_entry->countRequests()) {
                         if(out->getVerboseLevel() >= 9) {
@@ -503,7 +554,8 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
                         load_ins->markExecuted();
                         lsq->stat_loads_executed->addData(1);
-                        lsq->loads_pending.erase(load_itr);
+                        lsq->loads_pending_size--;
+                        lsq->loads_pending_count[load_entry->getHWThread()]--;
                         delete load_entry;
                     } else {
                         if(out->getVerboseLevel() >= 9) {
@@ -556,6 +608,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                                 processLLSC(ev,store_ins,store_entry);
 
                                 store_ins->markExecuted();
+                                lsq->store_index[thr].remove(store_entry);
                                 lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
                                 lsq->stores_pending_size--;
                                 delete store_entry;
@@ -564,6 +617,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                             case MEM_TRANSACTION_LOCK: 
                             {
                                 store_ins->markExecuted();
+                                lsq->store_index[thr].remove(store_entry);
                                 lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
                                 lsq->stores_pending_size--;
                                 delete store_entry;
@@ -635,6 +689,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     // this was a standard store (not LLSC/LOCK) and we issued into system successfully
                     if(LIKELY(issue_result)) 
                     {
+                        store_index[thr].remove(current_store);
                         stores_pending[thr].pop_front();
                         stores_pending_size--;
                         
@@ -960,7 +1015,11 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                 output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "-----> ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " processed and requests sent to memory system. numRequests=%lu\n",
                     load_ins->getInstructionAddress(), load_ins->getHWThread(), load_entry->countRequests());
 
-                loads_pending.push_back(load_entry);
+                for(auto req_id : load_entry->getRequests()) {
+                    loads_pending[req_id] = load_entry;
+                }
+                loads_pending_size++;
+                loads_pending_count[load_entry->getHWThread()]++;
             }
         }
 
@@ -996,7 +1055,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
             VanadisBasicStorePendingEntry* new_pending_store= store_process(store_ins->getHWThread(),store_ins,&store_address_last, &trap_error);
             if(trap_error==1)
             {
-                ;
+                resolveSpeculativeLoads(store_ins->getHWThread(), nullptr);
             }
             else
             {
@@ -1009,6 +1068,9 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                         new_pending_store->getStoreInstruction()->getInstructionAddress(), new_pending_store->getStoreInstruction()->getHWThread());
                 stores_pending[store_ins->getHWThread()].push_back(new_pending_store);
                 stores_pending_size++;
+                store_index[store_ins->getHWThread()].add(new_pending_store);
+
+                resolveSpeculativeLoads(store_ins->getHWThread(), new_pending_store);
             }
             return true;
         }
@@ -1046,7 +1108,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     }
 
                     // can't do anything this cycle, so return false
-                    if(loads_pending.size() >= max_loads) 
+                    if(loads_pending_size >= max_loads) 
                     {
                         output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "--> cycle: %" PRIu64 " issue LOAD failed: max_loads\n", cycle);
                         return false;
@@ -1084,7 +1146,8 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     // we couldn't perform any operations this cycle
                     if(stores_pending_size >= max_stores) {
                         //output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "--> cycle: %" PRIu64 " issue STORE failed: max stores\n", cycle);
-                        return false;
+                        // the store cannot move into the store buffer, see if a younger load can go ahead of it
+                        return speculative_loads_enabled && attemptSpeculativeLoad(cycle, thr);
                     }
 
                     if(output->getVerboseLevel() >= 16) {
@@ -1180,9 +1243,25 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                 }
 
                 // check to see if loading from this address would conflict with a store which
-                // we have pending, if yes, wait for conflict to clear and then we can proceed
-                if(UNLIKELY(checkStoreConflict(load_ins->getHWThread(), load_address, load_width))) 
+                // we have pending, if the stores hold every byte we can take the value from them
+                // otherwise wait for conflict to clear and then we can proceed
+                const VanadisStoreIndexResult store_check = store_index[load_ins->getHWThread()].lookup(
+                    load_address, load_width, forward_sources);
+
+                if(UNLIKELY(VanadisStoreIndexResult::FORWARD == store_check) && store_forwarding_enabled &&
+                    (load_ins->getTransactionType() == MEM_TRANSACTION_NONE) && (! load_ins->isPartialLoad()))
+                {
+                    output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "---> load ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " forwarded from %zu store buffer entries\n",
+                        load_ins->getInstructionAddress(), load_ins->getHWThread(), forward_sources.size());
+                    forwardLoad(load_ins, load_width);
+                    return true;
+                }
+                else if(UNLIKELY(VanadisStoreIndexResult::NO_OVERLAP != store_check))
                 {
+                    if(store_forwarding_enabled) {
+                        stat_store_forward_conflicts->addData(1);
+                    }
+
                     if(output->getVerboseLevel() >= 16) 
                     {
                         output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "---> load ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " conflicts with store entry, will not issue until conflict is resolved (load-addr: 0x%" PRI_ADDR " / width: %" PRIu32 ")\n",
@@ -1293,44 +1372,206 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
         bool pendingLoads(const uint32_t thr) 
         {
-            bool matchID = false;
+            return loads_pending_count[thr] > 0;
+        }
 
-            for(auto load_itr = loads_pending.begin(); load_itr != loads_pending.end(); load_itr++) {
-                if((*load_itr)->getHWThread() == thr) {
-                    matchID = true;
-                    break;
+        // write a load which is fully covered by the store buffer into its register using
+        // the bytes found by the store index lookup, this mirrors the read-response path
+        void forwardLoad(VanadisLoadInstruction* load_ins, const uint64_t load_width)
+        {
+            std::vector<uint8_t> value(load_width);
+            uint16_t store_thread;
+            uint16_t store_reg;
+
+            for(const VanadisStoreForwardSource& source : forward_sources) {
+                VanadisStoreInstruction* store_ins = source.store->getStoreInstruction();
+                getStoreTarget(source.store, store_ins, &store_thread, &store_reg);
+                registerFiles->at(store_thread)->copyFromRegister(store_reg, store_ins->getRegisterOffset() + source.store_offset,
+                    &value[source.load_offset], source.length, store_ins->getValueRegisterType() == STORE_FP_REGISTER);
+            }
+
+            uint16_t target_reg = 0;
+            uint16_t target_isa_reg = 0;
+            uint32_t target_thread = 0;
+            const uint64_t reg_offset = load_ins->getRegisterOffset();
+
+            switch(load_ins->getValueRegisterType()) {
+            case LOAD_INT_REGISTER:
+            {
+                std_mem_handlers->copyLoadResp(load_ins, &target_reg, &target_isa_reg, &target_thread, nullptr, 0);
+
+                if(target_reg != load_ins->getISAOptions()->getRegisterIgnoreWrites()) {
+                    const uint32_t reg_width = registerFiles->at(target_thread)->getIntRegWidth();
+                    std::vector<uint8_t> register_value(reg_width);
+                    registerFiles->at(target_thread)->copyFromIntRegister(target_reg, 0, &register_value[0], reg_width);
+
+                    assert((reg_offset + load_width) <= reg_width);
+
+                    for(uint64_t i = 0; i < load_width; ++i) {
+                        register_value.at(reg_offset + i) = value[i];
+                    }
+
+                    const uint8_t extend = (load_ins->performSignExtension() && ((value[load_width - 1] & 0x80) != 0)) ? 0xFF : 0x00;
+                    for(auto i = reg_offset + load_width; i < reg_width; ++i) {
+                        register_value.at(i) = extend;
+                    }
+
+                    registerFiles->at(target_thread)->copyToIntRegister(target_reg, 0, &register_value[0], reg_width);
+                }
+            } break;
+            case LOAD_FP_REGISTER:
+            {
+                std_mem_handlers->copyLoadResp(load_ins, &target_reg, &target_isa_reg, &target_thread, nullptr, 1);
+
+                const uint32_t reg_width = registerFiles->at(target_thread)->getFPRegWidth();
+                std::vector<uint8_t> register_value(reg_width);
+                registerFiles->at(target_thread)->copyFromFPRegister(target_reg, 0, &register_value[0], reg_width);
+
+                assert((reg_offset + load_width) <= reg_width);
+
+                for(uint64_t i = 0; i < load_width; ++i) {
+                    register_value.at(reg_offset + i) = value[i];
                 }
+
+                for(auto i = reg_offset + load_width; i < reg_width; ++i) {
+                    register_value.at(i) = 0xff;
+                }
+
+                registerFiles->at(target_thread)->copyToFPRegister(target_reg, 0, &register_value[0], reg_width);
+            } break;
+            default:
+                output->fatal(CALL_INFO, -1, "Unknown register type.\n");
             }
 
-            return matchID;
+            load_ins->markExecuted();
+            stat_loads_executed->addData(1);
+            stat_store_forwards->addData(1);
         }
 
-        bool checkStoreConflict(const uint32_t thread, const uint64_t address, const uint64_t width) 
+        // The store at the front of the queue is waiting for space in the store buffer. Look
+        // behind it for a load which can be issued now, the stores it passes have not had their
+        // addresses checked yet so this is only done when the store-set predictor does not
+        // connect the load with any of them. The load is remembered until those stores have
+        // been processed so an overlap can be caught and the load replayed.
+        bool attemptSpeculativeLoad(uint64_t cycle, uint32_t thr)
         {
-            bool conflicts = false;
+            if(loads_pending_size >= max_loads) {
+                return false;
+            }
 
-            for(auto store_itr = stores_pending[thread].begin(); store_itr != stores_pending[thread].end(); store_itr++) {
-                VanadisBasicStorePendingEntry* current_entry = (*store_itr);
+            std::deque<VanadisBasicLoadStoreEntry*>& thr_q = op_q[thr];
+            const size_t search_entries = std::min(thr_q.size(), speculation_window + 1);
 
-                if(UNLIKELY(current_entry->storeAddressOverlaps(address, width))) {
-                    conflicts = true;
+            for(size_t i = 0; i < search_entries; ++i) {
+                VanadisBasicLoadStoreEntry* entry = thr_q[i];
+
+                switch(entry->getEntryOp()) {
+                case VanadisBasicLoadStoreEntryOp::STORE:
                     break;
+                case VanadisBasicLoadStoreEntryOp::FENCE:
+                    return false;
+                case VanadisBasicLoadStoreEntryOp::LOAD:
+                {
+                    VanadisLoadInstruction* load_ins = dynamic_cast<VanadisLoadInstruction*>(entry->getInstruction());
+
+                    // a replay refetches from the instruction address, so only the first micro-op of
+                    // an instruction may run ahead or the older micro-ops would be executed twice
+                    if((nullptr == load_ins) || (! load_ins->completedIssue()) || (! load_ins->startsMicroOpGroup()) ||
+                        (load_ins->getTransactionType() != MEM_TRANSACTION_NONE) || load_ins->isPartialLoad()) {
+                        return false;
+                    }
+
+                    // every entry in front of the load is a store it would pass
+                    for(size_t j = 0; j < i; ++j) {
+                        if(store_sets.predictsDependence(load_ins->getInstructionAddress(), thr_q[j]->getInstructionAddress())) {
+                            stat_predicted_dependences->addData(1);
+                            return false;
+                        }
+                    }
+
+                    uint64_t load_address = 0;
+                    uint16_t load_width   = 0;
+                    load_ins->computeLoadAddress(registerFiles->at(thr), &load_address, &load_width);
+
+                    std::vector<uint64_t> load_addresses;
+                    std::vector<uint16_t> load_widths;
+
+                    if(! load_process(thr, load_ins, load_addresses, load_widths)) {
+                        return false;
+                    }
+
+                    if(! load_addresses.empty()) {
+                        issueLoad(load_ins, load_addresses[0], load_widths[0]);
+                    }
+
+                    output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, "--> cycle: %" PRIu64 " speculative load ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " issued ahead of %zu stores\n",
+                        cycle, load_ins->getInstructionAddress(), thr, i);
+
+                    if(! load_ins->trapsError()) {
+                        speculative_loads[thr].push_back({ load_ins, load_address, load_width, (uint32_t) i });
+                    }
+                    stat_speculative_loads->addData(1);
+
+                    delete entry;
+                    thr_q.erase(thr_q.begin() + i);
+                    op_q_size--;
+                    return true;
+                }
                 }
             }
 
-            return conflicts;
+            return false;
+        }
+
+        // A store of this thread has just been processed from the front of the queue, it is older
+        // than every speculative load still waiting on stores. store_entry is null if the store
+        // trapped and will not be written.
+        void resolveSpeculativeLoads(const uint32_t thr, VanadisBasicStorePendingEntry* store_entry)
+        {
+            for(auto spec_itr = speculative_loads[thr].begin(); spec_itr != speculative_loads[thr].end(); ) {
+                if((nullptr != store_entry) && (! spec_itr->load_ins->needsReplay()) &&
+                    store_entry->storeAddressOverlaps(spec_itr->address, spec_itr->width)) {
+
+                    output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> ordering violation: load ins: 0x%" PRI_ADDR " / addr: 0x%" PRI_ADDR " passed store ins: 0x%" PRI_ADDR " / addr: 0x%" PRI_ADDR ", load will be replayed\n",
+                        spec_itr->load_ins->getInstructionAddress(), spec_itr->address,
+                        store_entry->getInstructionAddress(), store_entry->getStoreAddress());
+
+                    spec_itr->load_ins->flagReplay();
+                    store_sets.recordViolation(spec_itr->load_ins->getInstructionAddress(), store_entry->getInstructionAddress());
+                    stat_ordering_violations->addData(1);
+                }
+
+                if(0 == --spec_itr->older_stores) {
+                    spec_itr = speculative_loads[thr].erase(spec_itr);
+                } else {
+                    ++spec_itr;
+                }
+            }
         }
 
+        // A load issued ahead of older stores, kept until all of them have been checked
+        struct SpeculativeLoad {
+            VanadisLoadInstruction* load_ins;
+            uint64_t address;
+            uint64_t width;
+            uint32_t older_stores;
+        };
 
         // Per-hardware-thread queues
         std::vector< std::deque<VanadisBasicLoadStoreEntry*> > op_q;
         std::vector< std::deque<VanadisBasicStorePendingEntry*> > stores_pending;
-        std::deque<VanadisBasicLoadPendingEntry*> loads_pending;
-        std::set<StandardMem::Request::id_t> std_stores_in_flight;
+        std::vector< VanadisBasicStoreIndex > store_index;
+        std::vector< std::deque<SpeculativeLoad> > speculative_loads;
+        std::vector< size_t > loads_pending_count;
+        // keyed by request id, a load split over two cache lines appears once per request
+        std::unordered_map<StandardMem::Request::id_t, VanadisBasicLoadPendingEntry*> loads_pending;
+        std::unordered_set<StandardMem::Request::id_t> std_stores_in_flight;
+        std::vector<VanadisStoreForwardSource> forward_sources;
         int op_q_index; // Next hw_thread to check in op_q queues
         int stores_pending_index; // Next hw thread to check in stores_pending q's
         size_t op_q_size;
         size_t stores_pending_size;
+        size_t loads_pending_size;
 
         StandardMem* memInterface;
         StandardMemHandlers* std_mem_handlers;
@@ -1340,6 +1581,11 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
         const uint32_t max_issue_attempts_per_cycle;
 
+        const bool store_forwarding_enabled;
+        const bool speculative_loads_enabled;
+        const size_t speculation_window;
+        VanadisStoreSetPredictor store_sets;
+
         uint64_t cache_line_width;
         uint64_t address_mask;
 
@@ -1357,6 +1603,11 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
         Statistic<uint64_t>* stat_split_loads;
         Statistic<uint64_t>* stat_stored_bytes;
         Statistic<uint64_t>* stat_loaded_bytes;    
+        Statistic<uint64_t>* stat_store_forwards;
+        Statistic<uint64_t>* stat_store_forward_conflicts;
+        Statistic<uint64_t>* stat_speculative_loads;
+        Statistic<uint64_t>* stat_predicted_dependences;
+        Statistic<uint64_t>* stat_ordering_violations;
 };
 
 } // namespace SST
@@ -13,6 +13,9 @@
 // information, see the LICENSE file in the top level directory of the
 // distribution.
 
+#ifndef _H_VANADIS_BASIC_LSQ_ENTRY
+#define _H_VANADIS_BASIC_LSQ_ENTRY
+
 #include <map>
 
 
@@ -266,7 +269,11 @@ class VanadisBasicLoadPendingEntry : public VanadisBasicLoadEntry {
         }
 
         size_t countRequests() const {
-                return requests.size(); 
+                return requests.size();
+        }
+
+        const std::vector<StandardMem::Request::id_t>& getRequests() const {
+            return requests;
         }
 
         // identify what the req order is for this entry
@@ -295,3 +302,5 @@ class VanadisBasicLoadPendingEntry : public VanadisBasicLoadEntry {
 
 }
 }
+
+#endif
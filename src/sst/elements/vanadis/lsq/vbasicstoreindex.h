@@ -0,0 +1,203 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BASIC_STORE_INDEX
+#define _H_VANADIS_BASIC_STORE_INDEX
+
+#include "lsq/vbasiclsqentry.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+enum class VanadisStoreIndexResult {
+    NO_OVERLAP,     // no buffered store writes any byte of the access
+    FORWARD,        // every byte can be taken from the youngest buffered store that writes it
+    CONFLICT        // partial overlap or an overlapping store that cannot forward
+};
+
+// A run of bytes of a load which can be supplied by one buffered store
+struct VanadisStoreForwardSource {
+    VanadisBasicStorePendingEntry* store;
+    uint64_t store_offset;
+    uint64_t load_offset;
+    uint64_t length;
+};
+
+// Index over the stores a hardware thread has in its store buffer, keyed by
+// 64-byte block. Each block keeps a byte mask of what the buffered stores
+// write (same layout as VanadisMemoryWrittenRecord) and the stores touching
+// it in program order, so checking a load only looks at the one or two
+// blocks it touches instead of walking the whole buffer.
+//
+// The block size is fixed rather than following the cache line width so the
+// mask always fits in a single 64-bit word.
+class VanadisBasicStoreIndex {
+public:
+    static constexpr uint64_t BLOCK_BYTES = 64;
+
+    void add(VanadisBasicStorePendingEntry* store) {
+        const uint64_t address = store->getStoreAddress();
+        const uint64_t width   = store->getStoreWidth();
+
+        if(0 == width) {
+            return;
+        }
+
+        for(uint64_t blk = address / BLOCK_BYTES; blk <= (address + width - 1) / BLOCK_BYTES; ++blk) {
+            Block& block = blocks[blk];
+            block.mask |= blockMask(blk, address, width);
+            block.stores.push_back(store);
+        }
+    }
+
+    void remove(VanadisBasicStorePendingEntry* store) {
+        const uint64_t address = store->getStoreAddress();
+        const uint64_t width   = store->getStoreWidth();
+
+        if(0 == width) {
+            return;
+        }
+
+        for(uint64_t blk = address / BLOCK_BYTES; blk <= (address + width - 1) / BLOCK_BYTES; ++blk) {
+            auto block_itr = blocks.find(blk);
+
+            if(block_itr == blocks.end()) {
+                continue;
+            }
+
+            Block& block = block_itr->second;
+            auto store_itr = std::find(block.stores.begin(), block.stores.end(), store);
+
+            if(store_itr != block.stores.end()) {
+                block.stores.erase(store_itr);
+            }
+
+            if(block.stores.empty()) {
+                blocks.erase(block_itr);
+            } else {
+                block.mask = 0;
+                for(auto next_store : block.stores) {
+                    block.mask |= blockMask(blk, next_store->getStoreAddress(), next_store->getStoreWidth());
+                }
+            }
+        }
+    }
+
+    void clear() { blocks.clear(); }
+    bool empty() const { return blocks.empty(); }
+
+    // Check a load against the buffered stores. When the result is FORWARD the
+    // sources cover the load in order, taking each byte from the youngest store
+    // which writes it. Only standard stores can forward, a load touching a
+    // store-conditional or locked store is reported as a conflict.
+    VanadisStoreIndexResult lookup(const uint64_t address, const uint64_t width,
+        std::vector<VanadisStoreForwardSource>& sources) const {
+
+        sources.clear();
+
+        if(blocks.empty() || 0 == width) {
+            return VanadisStoreIndexResult::NO_OVERLAP;
+        }
+
+        bool overlaps = false;
+        bool covered  = true;
+
+        for(uint64_t blk = address / BLOCK_BYTES; blk <= (address + width - 1) / BLOCK_BYTES; ++blk) {
+            const uint64_t load_mask = blockMask(blk, address, width);
+            auto block_itr = blocks.find(blk);
+
+            if(block_itr == blocks.end()) {
+                covered = false;
+            } else {
+                const uint64_t hit = block_itr->second.mask & load_mask;
+                overlaps |= (0 != hit);
+                covered  &= (hit == load_mask);
+            }
+        }
+
+        if(!overlaps) {
+            return VanadisStoreIndexResult::NO_OVERLAP;
+        }
+
+        if(!covered) {
+            return VanadisStoreIndexResult::CONFLICT;
+        }
+
+        for(uint64_t i = 0; i < width; ++i) {
+            const uint64_t byte_addr = address + i;
+            const Block& block = blocks.at(byte_addr / BLOCK_BYTES);
+
+            VanadisBasicStorePendingEntry* youngest = nullptr;
+            for(auto store_itr = block.stores.rbegin(); store_itr != block.stores.rend(); ++store_itr) {
+                const uint64_t store_address = (*store_itr)->getStoreAddress();
+
+                if((byte_addr >= store_address) && (byte_addr < store_address + (*store_itr)->getStoreWidth())) {
+                    youngest = (*store_itr);
+                    break;
+                }
+            }
+
+            if((nullptr == youngest) ||
+                (youngest->getStoreInstruction()->getTransactionType() != MEM_TRANSACTION_NONE)) {
+                sources.clear();
+                return VanadisStoreIndexResult::CONFLICT;
+            }
+
+            const uint64_t store_offset = byte_addr - youngest->getStoreAddress();
+
+            if(!sources.empty() && (sources.back().store == youngest) &&
+                (sources.back().store_offset + sources.back().length == store_offset)) {
+                sources.back().length++;
+            } else {
+                sources.push_back({ youngest, store_offset, i, 1 });
+            }
+        }
+
+        return VanadisStoreIndexResult::FORWARD;
+    }
+
+private:
+    struct Block {
+        Block() : mask(0) {}
+
+        uint64_t mask;
+        std::vector<VanadisBasicStorePendingEntry*> stores;
+    };
+
+    // bytes of [address, address + width) which fall in block blk
+    static uint64_t blockMask(const uint64_t blk, const uint64_t address, const uint64_t width) {
+        const uint64_t block_start = blk * BLOCK_BYTES;
+        const uint64_t lo = std::max(address, block_start) - block_start;
+        const uint64_t hi = std::min(address + width, block_start + BLOCK_BYTES) - block_start;
+
+        if(hi <= lo) {
+            return 0;
+        }
+
+        return ((hi - lo) == 64) ? ~(0ULL) : (((1ULL << (hi - lo)) - 1) << lo);
+    }
+
+    std::unordered_map<uint64_t, Block> blocks;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -0,0 +1,79 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_STORE_SET_PREDICTOR
+#define _H_VANADIS_STORE_SET_PREDICTOR
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// Store-set memory dependence predictor (Chrysos and Emer). A table indexed
+// by instruction address maps loads and stores to a store set. A load is
+// predicted to depend on an older store when both are in the same set, sets
+// are created and merged whenever a load is caught reading ahead of a store
+// it overlaps.
+class VanadisStoreSetPredictor {
+public:
+    static constexpr uint32_t INVALID_SET = UINT32_MAX;
+
+    VanadisStoreSetPredictor(const size_t entries) :
+        ssit(std::max(entries, (size_t) 1), INVALID_SET), next_set(0) {}
+
+    bool predictsDependence(const uint64_t load_ins_addr, const uint64_t store_ins_addr) const {
+        const uint32_t load_set = ssit[index(load_ins_addr)];
+        return (INVALID_SET != load_set) && (load_set == ssit[index(store_ins_addr)]);
+    }
+
+    void recordViolation(const uint64_t load_ins_addr, const uint64_t store_ins_addr) {
+        uint32_t& load_set  = ssit[index(load_ins_addr)];
+        uint32_t& store_set = ssit[index(store_ins_addr)];
+
+        if((INVALID_SET == load_set) && (INVALID_SET == store_set)) {
+            load_set  = next_set;
+            store_set = next_set;
+            next_set  = (next_set + 1) % ssit.size();
+        } else if(INVALID_SET == load_set) {
+            load_set = store_set;
+        } else if(INVALID_SET == store_set) {
+            store_set = load_set;
+        } else {
+            // merge, both move to the lower numbered set
+            load_set  = std::min(load_set, store_set);
+            store_set = load_set;
+        }
+    }
+
+    void clear() {
+        std::fill(ssit.begin(), ssit.end(), INVALID_SET);
+    }
+
+private:
+    size_t index(const uint64_t ins_addr) const {
+        // instructions are at least 2-byte aligned
+        return (ins_addr >> 1) % ssit.size();
+    }
+
+    std::vector<uint32_t> ssit;
+    uint32_t next_set;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
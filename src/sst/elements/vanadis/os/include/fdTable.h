@@ -25,6 +25,8 @@
 #include <unistd.h>
 #include <unordered_map>
 
+#include "os/vcheckpointio.h"
+
 namespace SST {
 namespace Vanadis {
 
@@ -107,27 +109,19 @@ public:
         return fd;
     }
 
-    FileDescriptor( SST::Output* output, FILE* fp ) {
-        char str[80];
-        assert( 1 == fscanf(fp,"path: %s\n",str) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"path: %s\n",str );
-        path = str;
-
-        assert( 1 == fscanf(fp,"fd: %d\n", &fd) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"fd: %d\n", fd);
-
-        assert( 1 == fscanf(fp,"flags: %d\n", &flags ) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"flags: %d\n", flags );
-
-        assert( 1 == fscanf(fp,"mode: %hd\n", &mode) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"mode: %d\n", mode);
+    FileDescriptor( SST::Output* output, VanadisCheckpointReader& cp ) {
+        path = cp.readString();
+        fd = cp.read<int32_t>();
+        flags = cp.read<int32_t>();
+        mode = cp.read<uint32_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"path: %s fd: %d flags: %d mode: %d\n", path.c_str(), fd, flags, mode );
     }
 
-    void checkpoint( FILE* fp) {
-        fprintf(fp, "path: %s\n", path.c_str() );
-        fprintf(fp, "fd: %d\n", fd );
-        fprintf(fp, "flags: %d\n", flags );
-        fprintf(fp, "mode: %d\n", mode );
+    void checkpoint( VanadisCheckpointWriter& cp ) {
+        cp.writeString( path );
+        cp.write<int32_t>( fd );
+        cp.write<int32_t>( flags );
+        cp.write<uint32_t>( mode );
     }
 
 protected:
@@ -232,51 +226,27 @@ public:
         return iter->second->getPath();
     }
 
-    FileDescriptorTable( SST::Output* output, FILE* fp ) {
-        char* tmp = nullptr;
-        size_t num = 0;
-        getline( &tmp, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",tmp);
-        assert( 0 == strcmp(tmp,"#FileDescriptorTable start\n") );
-        free(tmp);
-
-        assert( 1 == fscanf(fp,"m_refCnt: %d\n",&m_refCnt) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_refCnt: %d\n",m_refCnt);
-
-        assert( 1 ==fscanf(fp,"m_maxFD: %d\n",&m_maxFD) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_maxFD: %d\n",m_maxFD);
-
-        size_t size;
-        assert( 1 == fscanf(fp,"m_fileDescriptors.size(): %zu\n",&size) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_fileDescriptors.size(): %zu\n",size);
+    FileDescriptorTable( SST::Output* output, VanadisCheckpointReader& cp ) {
+        m_refCnt = cp.read<int32_t>();
+        m_maxFD = cp.read<int32_t>();
+        auto size = cp.read<uint64_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_refCnt: %d m_maxFD: %d m_fileDescriptors.size(): %" PRIu64 "\n",m_refCnt,m_maxFD,size);
 
         for ( auto i = 0; i < size; i++ ) {
-            int fd;
-            assert( 1 == fscanf(fp,"fd: %d\n", &fd ) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"fd: %d\n", fd );
-            m_fileDescriptors[fd] = new FileDescriptor(output, fp); 
+            auto fd = cp.read<uint32_t>();
+            m_fileDescriptors[fd] = new FileDescriptor(output, cp); 
         }
-
-        tmp = nullptr;
-        num = 0;
-        getline( &tmp, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",tmp);
-        assert( 0 == strcmp(tmp,"#FileDescriptorTable end\n") );
-        free(tmp);
     }
 
-    void checkpoint( FILE* fp ) {
-        fprintf(fp,"#FileDescriptorTable start\n");
-        fprintf(fp,"m_refCnt: %d\n",m_refCnt);
-        fprintf(fp,"m_maxFD: %d\n",m_maxFD);
-
-        fprintf(fp,"m_fileDescriptors.size(): %zu\n",m_fileDescriptors.size());
+    void checkpoint( VanadisCheckpointWriter& cp ) {
+        cp.write<int32_t>( m_refCnt );
+        cp.write<int32_t>( m_maxFD );
+        cp.write<uint64_t>( m_fileDescriptors.size() );
 
         for ( auto & x : m_fileDescriptors ) {
-            fprintf(fp,"fd: %d\n",x.first);
-            x.second->checkpoint(fp);
+            cp.write<uint32_t>( x.first );
+            x.second->checkpoint(cp);
         }
-        fprintf(fp,"#FileDescriptorTable end\n");
     }
 private:
 
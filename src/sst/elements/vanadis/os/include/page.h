@@ -68,13 +68,6 @@ class Page {
         return refCnt;
     }
 
-    std::string checkpoint() {
-        std::stringstream ss;
-        ss << "ppn: " << ppn;
-        ss << ", refCnt: " << refCnt;
-        return ss.str();
-    }
-
   private:
     PhysMemManager* mem;
     unsigned refCnt; 
@@ -32,6 +32,7 @@
 #include "os/include/threadGrp.h"
 #include "os/include/page.h"
 #include "os/vphysmemmanager.h"
+#include "os/vcheckpointio.h"
 
 namespace SST {
 namespace Vanadis {
@@ -142,79 +143,44 @@ class ProcessInfo {
 
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Checkpoint load process %d %s\n",getpid(), filename.str().c_str());
 
-        auto fp = fopen(filename.str().c_str(),"r");
-        assert(fp);
+        VanadisCheckpointReader cp( output, filename.str(), VanadisCheckpointKind::PROCESS );
 
         m_pageShift = log2(m_pageSize);
 
-        int val;
-        assert( 1 == fscanf(fp,"m_pageSize: %d\n",&val) );
+        auto val = cp.read<uint32_t>();
         assert( val == m_pageSize );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_pageSize: %d\n",m_pageSize);
-
-        assert( 1 == fscanf(fp,"m_pid: %d\n",&val) );
+        val = cp.read<uint32_t>();
         assert( val == m_pid ); 
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_pid: %d\n",m_pid);
-
-        assert( 1 == fscanf(fp,"m_tid: %d\n",&val) );
+        val = cp.read<uint32_t>();
         assert( val == m_tid ); 
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_tid: %d\n",m_tid);
-
-        assert( 1 == fscanf(fp,"m_ppid: %d\n", &m_ppid) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_ppid: %d\n", m_ppid);
-
-        assert( 1 == fscanf(fp,"m_pgid: %d\n", &val) );
+        m_ppid = cp.read<uint32_t>();
+        val = cp.read<uint32_t>();
         assert( val == m_pgid ); 
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_pgid: %d\n", m_pgid);
-
-        assert( 1 == fscanf(fp,"m_uid: %d\n",&m_uid) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_uid: %d\n",m_uid);
-
-        assert( 1 == fscanf(fp,"m_gid: %d\n",&m_gid) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_gid: %d\n",m_gid);
-
-        assert( 1 == fscanf(fp,"m_core: %d\n",&m_core) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_core: %d\n",m_core);
-
-        assert( 1 == fscanf(fp,"m_hwThread: %d\n",&m_hwThread) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_hwThread: %d\n",m_hwThread);
-
-        assert( 1 == fscanf(fp,"m_tidAddress: %" PRIx64 "\n",&m_tidAddress) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_tidAddress: %#" PRIx64 "\n",m_tidAddress);
-
-        m_virtMemMap = new VirtMemMap(output,fp,physMemMgr,elfInfo);
-        m_fileTable = new FileDescriptorTable(output,fp);
+        m_uid = cp.read<uint32_t>();
+        m_gid = cp.read<uint32_t>();
+        m_core = cp.read<uint32_t>();
+        m_hwThread = cp.read<uint32_t>();
+        m_tidAddress = cp.read<uint64_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"pid: %d ppid: %d uid: %d gid: %d core: %d hwThread: %d tidAddress: %#" PRIx64 "\n",
+                m_pid, m_ppid, m_uid, m_gid, m_core, m_hwThread, m_tidAddress);
+
+        m_virtMemMap = new VirtMemMap(output,cp,physMemMgr,elfInfo);
+        m_fileTable = new FileDescriptorTable(output,cp);
         
         m_threadGrp = new ThreadGrp;
         m_futex = new Futex;
 
         m_cpusMask.resize((m_coreCount + 7) / 8, 0xFF); 
         
-        size_t size;
-        assert( 1 == fscanf(fp,"m_params.size() %zu\n",&size) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_params.size() %zu\n",size);
-
-        char* tmp = nullptr;
-        size_t num = 0;
-        getline( &tmp, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",tmp);
-        assert( 0 == strcmp(tmp,"Local params:\n") );
-        free(tmp);
+        auto size = cp.read<uint64_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_params.size() %" PRIu64 "\n",size);
 
         for ( auto i = 0; i < size; i++ ) {
-            char tmp1[80],tmp2[80];
-            fscanf(fp, "%s %s\n", tmp1, tmp2 );
-            std::string key = tmp1;
-            key.erase( key.size() - 1, 1 ); 
-            std::string value = tmp2;
-            auto pos1 = key.find_first_of('=' ) + 1; 
-            auto pos2 = value.find_first_of('=' ) + 1; 
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s %s\n",key.c_str(),value.c_str());
-            m_params.insert(key.substr(pos1).c_str(),value.substr(pos2).c_str());
+            auto key = cp.readString();
+            auto value = cp.readString();
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s = %s\n",key.c_str(),value.c_str());
+            m_params.insert(key,value);
         }
-    #if 0
-        m_params.print_all_params( std::cout );
-    #endif
     }
 
     ~ProcessInfo() {
@@ -240,41 +206,29 @@ class ProcessInfo {
 
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"dump process %d %s\n",getpid(), filename.str().c_str());
 
-        auto fp = fopen(filename.str().c_str(),"w+");
-        assert(fp);
-        fprintf(fp,"m_pageSize: %d\n",m_pageSize);
-        fprintf(fp,"m_pid: %d\n",m_pid);
-        fprintf(fp,"m_tid: %d\n",m_tid);
-        fprintf(fp,"m_ppid: %d\n", m_ppid);
-        fprintf(fp,"m_pgid: %d\n", m_pgid);
-        fprintf(fp,"m_uid: %d\n",m_uid);
-        fprintf(fp,"m_gid: %d\n",m_gid);
-        fprintf(fp,"m_core: %d\n",m_core);
-        fprintf(fp,"m_hwThread: %d\n",m_hwThread);
-        fprintf(fp,"m_tidAddress: %#llx\n",m_tidAddress);
-
-        m_virtMemMap->checkpoint(fp);
-        m_fileTable->checkpoint(fp);
-
-        #if 0
-        fprintf(fp,"#ThreadGrp start\n");
-
-        auto tmp = m_threadGrp->getThreadList(); 
-        
-        fprintf(fp,"m_group.size(): %zu\n",tmp.size());
-        for ( auto & x : tmp ) {
-            fprintf(fp,"tid: %d\n", x.first );
-        }
-        fprintf(fp,"#ThreadGrp end\n");
-        #endif
+        VanadisCheckpointWriter cp( output, filename.str(), VanadisCheckpointKind::PROCESS );
+        cp.write<uint32_t>( m_pageSize );
+        cp.write<uint32_t>( m_pid );
+        cp.write<uint32_t>( m_tid );
+        cp.write<uint32_t>( m_ppid );
+        cp.write<uint32_t>( m_pgid );
+        cp.write<uint32_t>( m_uid );
+        cp.write<uint32_t>( m_gid );
+        cp.write<uint32_t>( m_core );
+        cp.write<uint32_t>( m_hwThread );
+        cp.write<uint64_t>( m_tidAddress );
+
+        m_virtMemMap->checkpoint(cp);
+        m_fileTable->checkpoint(cp);
 
         assert( m_futex->isEmpty() );
         
-        std::stringstream ss; 
-
-        fprintf(fp,"m_params.size() %zu\n",m_params.size());
-        m_params.print_all_params( ss );
-        fprintf(fp,"%s",ss.str().c_str());
+        auto keys = m_params.getKeys();
+        cp.write<uint64_t>( keys.size() );
+        for ( auto & key : keys ) {
+            cp.writeString( key );
+            cp.writeString( m_params.find<std::string>( key ) );
+        }
     }
 
     void decRefCnts() { 
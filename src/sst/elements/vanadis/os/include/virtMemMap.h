@@ -24,6 +24,7 @@
 #include "os/include/freeList.h"
 #include "os/include/page.h"
 #include "os/include/device.h"
+#include "os/vcheckpointio.h"
 
 #if 0
 #define VirtMemDbg( format, ... ) printf( "VirtMemMap::%s() " format, __func__, ##__VA_ARGS__ )
@@ -53,71 +54,38 @@ public:
     std::vector<uint8_t> data;
     uint64_t dataStartAddr;
 
-    MemoryBacking( SST::Output* output, FILE* fp, VanadisELFInfo* elf ) {
-        char* tmp = nullptr;
-        size_t num = 0;
-        getline( &tmp, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",tmp);
-        assert( 0 == strcmp(tmp,"#MemoryBacking start\n") );
-        free(tmp);
-
-        char str[80];
-        assert( 1 == fscanf(fp,"backing: %s\n",str) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"backing: %s\n",str);
-
-        if ( 0 == strcmp( str, "elf" ) ) {
-            assert ( 1 == fscanf(fp,"elf: %s\n", str ) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"elf: %s\n",str);
-            assert( 0 == strcmp( str, elf->getBinaryPath() ) );
+    enum { CHECKPOINT_ELF, CHECKPOINT_DATA };
+
+    MemoryBacking( SST::Output* output, VanadisCheckpointReader& cp, VanadisELFInfo* elf ) : elfInfo(nullptr), dev(nullptr), dataStartAddr(0) {
+        auto type = cp.read<uint32_t>();
+
+        if ( CHECKPOINT_ELF == type ) {
+            auto path = cp.readString();
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"backing elf: %s\n",path.c_str());
+            assert( 0 == strcmp( path.c_str(), elf->getBinaryPath() ) );
             elfInfo = elf;
-        } else if ( 0 == strcmp( str, "data" ) ) {
-            assert ( 1 == fscanf(fp,"dataStartAddr: %" PRIx64 "\n",&dataStartAddr) ); 
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"dataStartAddr: %#" PRIx64 "\n",dataStartAddr );
+        } else if ( CHECKPOINT_DATA == type ) {
+            dataStartAddr = cp.read<uint64_t>();
             size_t size;
-            assert( 1 == fscanf(fp,"size: %zu\n", &size ) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"size: %zu\n", size );
-            data.resize(size);
-            std::stringstream ss;
-            ss << std::hex;
-            for ( auto i = 0; i < size; i++ ) {
-                uint64_t value;
-                assert( 1 == fscanf(fp,"%" PRIx64 ",", &value) );
-                data[i] = value;
-                ss << "0x" << value << ",";
-            }
-            fscanf(fp,"\n" );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s\n",ss.str().c_str());
-
+            auto ptr = cp.readArray<uint8_t>( size );
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"backing data: %#" PRIx64 " size: %zu\n",dataStartAddr,size);
+            data.assign( ptr, ptr + size );
         } else {
             assert(0);
         }
-
-        tmp = nullptr;
-        num = 0;
-        getline( &tmp, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",tmp);
-        assert( 0 == strcmp(tmp,"#MemoryBacking end\n") );
-        free(tmp);
     }
 
-    void checkpoint( FILE* fp ) {
-        fprintf(fp,"#MemoryBacking start\n");
+    void checkpoint( VanadisCheckpointWriter& cp ) {
         if ( elfInfo ) {
-            fprintf(fp,"backing: elf\n");
-            fprintf(fp,"elf: %s\n",elfInfo->getBinaryPath());
+            cp.write<uint32_t>( CHECKPOINT_ELF );
+            cp.writeString( elfInfo->getBinaryPath() );
         } else if ( data.size() ) {
-            fprintf(fp,"backing: data\n");
-            fprintf(fp,"dataStartAddr: %#" PRIx64 "\n",dataStartAddr);
-            auto ptr = (uint64_t*) data.data();
-            fprintf(fp,"size: %zu\n", data.size()/sizeof(uint64_t) );
-            for ( auto i = 0; i < data.size()/sizeof(uint64_t); i++ ) {
-                fprintf(fp,"%#" PRIx64 ",",ptr[i]);
-            }
-            fprintf(fp,"\n");
+            cp.write<uint32_t>( CHECKPOINT_DATA );
+            cp.write<uint64_t>( dataStartAddr );
+            cp.writeArray( data.data(), data.size() );
         } else {
             assert(0);
         }
-        fprintf(fp,"#MemoryBacking end\n");
     }
 };
 
@@ -181,71 +149,44 @@ struct MemoryRegion {
         return data;
     }
     
-    void checkpoint( FILE* fp ) {
-        fprintf(fp,"#MemoryRegion start\n");
-        fprintf(fp,"name: %s\n",name.c_str());
-        fprintf(fp,"addr: %#" PRIx64 "\n",addr);
-        fprintf(fp,"length: %zu\n",length);
-        fprintf(fp,"perms: %#" PRIx32 "\n",perms);
+    void checkpoint( VanadisCheckpointWriter& cp ) {
+        cp.writeString( name );
+        cp.write<uint64_t>( addr );
+        cp.write<uint64_t>( length );
+        cp.write<uint32_t>( perms );
+        cp.write<uint32_t>( nullptr != backing );
         if ( backing ) {
-            fprintf(fp,"backing: yes\n");
-            backing->checkpoint( fp );
-        } else {
-            fprintf(fp,"backing: no\n");
+            backing->checkpoint( cp );
         }
 
-        fprintf(fp,"m_virtToPhysMap.size() %zu\n",m_virtToPhysMap.size());
+        std::vector<VanadisCheckpointPage> pages;
+        pages.reserve( m_virtToPhysMap.size() );
         for ( auto & x : m_virtToPhysMap ) {
-            fprintf(fp,"vpn: %d, %s\n", x.first, x.second->checkpoint().c_str() );
+            pages.push_back( { x.first, x.second->getPPN(), x.second->getRefCnt(), 0 } );
         }
-        fprintf(fp,"#MemoryRegion end\n");
+        cp.writeArray( pages.data(), pages.size() );
     }
 
-    MemoryRegion( SST::Output* output, FILE* fp, PhysMemManager* memManager, VanadisELFInfo* elfInfo ) : backing(nullptr) {
-        char* tmp = nullptr;
-        size_t num = 0;
-        getline( &tmp, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",tmp);
-        assert( 0 == strcmp(tmp,"#MemoryRegion start\n"));
-        free(tmp);
-
-        char str[80];
-        assert( 1 == fscanf(fp,"name: %s\n",str));
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"name: %s\n",str);
-        name = str; 
-
-        assert( 1 == fscanf(fp,"addr: %" PRIx64 "\n",&addr) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"addr: %#" PRIx64 "\n",addr);
+    MemoryRegion( SST::Output* output, VanadisCheckpointReader& cp, PhysMemManager* memManager, VanadisELFInfo* elfInfo ) : backing(nullptr) {
+        name = cp.readString();
+        addr = cp.read<uint64_t>();
+        length = cp.read<uint64_t>();
+        perms = cp.read<uint32_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"region %s addr: %#" PRIx64 " length: %zu perms: %#" PRIx32 "\n",
+                name.c_str(), addr, length, perms);
 
-        assert( 1 == fscanf(fp,"length: %zu\n",&length) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"length: %zu\n",length);
-
-        assert( 1 == fscanf(fp,"perms: %" PRIx32 "\n",&perms) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"perms: %#" PRIx32 "\n",perms);
-
-        assert( 1 == fscanf(fp,"backing: %s\n", str) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"backing: %s\n", str );
-        if ( 0 == strcmp( str, "yes" ) ) {
-            backing = new MemoryBacking( output, fp, elfInfo );
+        if ( cp.read<uint32_t>() ) {
+            backing = new MemoryBacking( output, cp, elfInfo );
         }
 
         size_t size;
-        assert( 1 == fscanf(fp,"m_virtToPhysMap.size() %zu\n",&size) );
+        auto pages = cp.readArray<VanadisCheckpointPage>( size );
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_virtToPhysMap.size() %zu\n",size);
 
+        // the pages were written in vpn order, hint each insert at the end
         for ( auto i = 0; i < size; i++ ) {
-            int vpn,ppn,refCnt;
-            assert( 3 == fscanf(fp,"vpn: %d, ppn: %d, refCnt: %d\n", &vpn, &ppn, &refCnt ) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"vpn: %d, ppn: %d, refCnt: %d\n", vpn, ppn, refCnt );
-            m_virtToPhysMap[vpn] = new OS::Page( memManager, ppn, refCnt );
+            m_virtToPhysMap.emplace_hint( m_virtToPhysMap.end(), pages[i].vpn, new OS::Page( memManager, pages[i].ppn, pages[i].refCnt ) );
         }
-
-        tmp = nullptr;
-        num = 0;
-        getline( &tmp, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",tmp);
-        assert( 0 == strcmp(tmp,"#MemoryRegion end\n"));
-        free(tmp);
     }
 
     MemoryBacking* backing; 
@@ -460,51 +401,38 @@ public:
         return true;
     }
 
-    void checkpoint( FILE* fp ) {
-        fprintf(fp,"#VirtMemMap start\n");
-        fprintf(fp,"m_brk: %#" PRIx64 "\n",m_brk);    
-        fprintf(fp,"m_refCnt: %d\n",m_refCnt);    
-        fprintf(fp,"m_regionMap.size() %zu\n",m_regionMap.size());    
+    void checkpoint( VanadisCheckpointWriter& cp ) {
+        cp.write<uint64_t>( m_brk );
+        cp.write<int32_t>( m_refCnt );
+        cp.write<uint64_t>( m_regionMap.size() );
 
         for ( auto & x : m_regionMap ) {
-            fprintf(fp,"addr: %#" PRIx64 "\n",x.first);    
-            x.second->checkpoint(fp);
+            cp.write<uint64_t>( x.first );
+            x.second->checkpoint(cp);
         }
-        fprintf(fp,"#VirtMemMap end\n");
     }
 
-    VirtMemMap( SST::Output* output, FILE* fp, PhysMemManager* memManager, VanadisELFInfo* elfInfo) {
-        char* str = nullptr;
-        size_t num = 0;
-        getline( &str, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",str);
-        assert( 0 == strcmp(str,"#VirtMemMap start\n"));
-        free(str);
-
-        uint64_t foo;
-        assert( 1 == fscanf(fp,"m_brk: %" PRIx64 "\n",&foo));    
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_brk: %#" PRIx64"\n",foo);    
+    VirtMemMap( SST::Output* output, VanadisCheckpointReader& cp, PhysMemManager* memManager, VanadisELFInfo* elfInfo) : m_heapRegion(nullptr) {
+        m_brk = cp.read<uint64_t>();
+        m_refCnt = cp.read<int32_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_brk: %#" PRIx64 " m_refCnt: %d\n",m_brk,m_refCnt);
 
-        assert( 1 == fscanf(fp,"m_refCnt: %d\n",&m_refCnt));    
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_refCnt: %d\n",m_refCnt);    
+        m_freeList = new FreeList( 0x1000, 0x80000000);
 
-        size_t size;
-        assert( 1 == fscanf(fp,"m_regionMap.size() %zu\n",&size));    
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_regionMap.size() %zu\n",size);    
+        auto size = cp.read<uint64_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_regionMap.size() %" PRIu64 "\n",size);
         for ( auto i = 0; i < size; i++ ) {
-            uint64_t addr;
-            assert( 1 == fscanf(fp,"addr: %" PRIx64 "\n",&addr));    
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"addr: %#" PRIx64 "\n",addr);    
-
-            m_regionMap[addr] = new MemoryRegion( output, fp, memManager, elfInfo );
+            auto addr = cp.read<uint64_t>();
+            auto region = new MemoryRegion( output, cp, memManager, elfInfo );
+            assert( addr == region->addr );
+
+            // rebuild the free list and heap so brk and mmap work after a restore
+            assert( m_freeList->alloc( region->addr, region->length ) );
+            if ( 0 == region->name.compare( "heap" ) ) {
+                m_heapRegion = region;
+            }
+            m_regionMap[addr] = region;
         }
-
-        str = nullptr;
-        num = 0;
-        getline( &str, &num, fp );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s",str);
-        assert( 0 == strcmp(str,"#VirtMemMap end\n"));
-        free(str);
     }
 
 private:
@@ -0,0 +1,232 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_CHECKPOINT_IO
+#define _H_VANADIS_CHECKPOINT_IO
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <string>
+#include <type_traits>
+
+#include "output.h"
+
+namespace SST {
+namespace Vanadis {
+
+// Checkpoint files are binary. Every file starts with a fixed header and
+// is followed by the values of the owning object in the order it wrote
+// them. Arrays start on an 8 byte boundary with a 64-bit element count
+// followed by the raw elements, and the elements are padded to 8 bytes, so
+// a reader which maps the file can use an array in place without copying
+// or parsing it.
+//
+// Bump VANADIS_CHECKPOINT_VERSION whenever the contents of any file change.
+
+#define VANADIS_CHECKPOINT_MAGIC   0x544e504b43534e56ULL   // "VNSCKPNT"
+#define VANADIS_CHECKPOINT_VERSION 2
+
+enum class VanadisCheckpointKind : uint32_t {
+    CORE          = 1,
+    NODE_OS       = 2,
+    PROCESS       = 3,
+    PHYS_MEM      = 4
+};
+
+struct VanadisCheckpointFileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t kind;
+};
+
+// One virtual to physical page mapping
+struct VanadisCheckpointPage {
+    uint32_t vpn;
+    uint32_t ppn;
+    uint32_t refCnt;
+    uint32_t pad;
+};
+
+class VanadisCheckpointWriter {
+public:
+    VanadisCheckpointWriter( SST::Output* output, const std::string& filename, VanadisCheckpointKind kind ) :
+        output(output), filename(filename), offset(0)
+    {
+        fp = fopen( filename.c_str(), "w" );
+        if ( nullptr == fp ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open checkpoint file %s (%s)\n", filename.c_str(), strerror(errno) );
+        }
+
+        VanadisCheckpointFileHeader header;
+        header.magic = VANADIS_CHECKPOINT_MAGIC;
+        header.version = VANADIS_CHECKPOINT_VERSION;
+        header.kind = static_cast<uint32_t>(kind);
+        write( header );
+    }
+
+    ~VanadisCheckpointWriter() {
+        if ( 0 != fclose( fp ) ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to write checkpoint file %s (%s)\n", filename.c_str(), strerror(errno) );
+        }
+    }
+
+    template<typename T>
+    void write( const T& value ) {
+        static_assert( std::is_trivially_copyable<T>::value, "checkpoint values must be trivially copyable" );
+        writeBytes( &value, sizeof(T) );
+    }
+
+    template<typename T>
+    void writeArray( const T* data, size_t count ) {
+        static_assert( std::is_trivially_copyable<T>::value, "checkpoint values must be trivially copyable" );
+        static_assert( alignof(T) <= 8, "checkpoint arrays are 8 byte aligned" );
+        pad();
+        write<uint64_t>( count );
+        writeBytes( data, count * sizeof(T) );
+        pad();
+    }
+
+    void writeString( const std::string& str ) {
+        writeArray( str.data(), str.size() );
+    }
+
+private:
+    void writeBytes( const void* data, size_t length ) {
+        if ( length && 1 != fwrite( data, length, 1, fp ) ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to write checkpoint file %s (%s)\n", filename.c_str(), strerror(errno) );
+        }
+        offset += length;
+    }
+
+    void pad() {
+        static const uint8_t zeros[8] = { 0 };
+        writeBytes( zeros, ( 8 - ( offset % 8 ) ) % 8 );
+    }
+
+    SST::Output* output;
+    std::string filename;
+    FILE* fp;
+    uint64_t offset;
+};
+
+// Maps a checkpoint file read only. Arrays returned by readArray() point
+// into the mapping and are valid until the reader is destroyed.
+class VanadisCheckpointReader {
+public:
+    VanadisCheckpointReader( SST::Output* output, const std::string& filename, VanadisCheckpointKind kind ) :
+        output(output), filename(filename), base(nullptr), length(0), offset(0)
+    {
+        int fd = open( filename.c_str(), O_RDONLY );
+        if ( -1 == fd ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open checkpoint file %s (%s)\n", filename.c_str(), strerror(errno) );
+        }
+
+        struct stat buf;
+        if ( 0 != fstat( fd, &buf ) ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to stat checkpoint file %s (%s)\n", filename.c_str(), strerror(errno) );
+        }
+        length = buf.st_size;
+
+        if ( length < sizeof(VanadisCheckpointFileHeader) ) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint file %s is truncated\n", filename.c_str() );
+        }
+
+        base = (const uint8_t*) mmap( nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( MAP_FAILED == base ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to map checkpoint file %s (%s)\n", filename.c_str(), strerror(errno) );
+        }
+        close( fd );
+
+        auto header = read<VanadisCheckpointFileHeader>();
+        if ( VANADIS_CHECKPOINT_MAGIC != header.magic ) {
+            output->fatal(CALL_INFO, -1, "Error: %s is not a Vanadis checkpoint file, checkpoints written before version %d must be regenerated\n",
+                    filename.c_str(), VANADIS_CHECKPOINT_VERSION );
+        }
+        if ( VANADIS_CHECKPOINT_VERSION != header.version ) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint file %s is version %" PRIu32 ", expected version %d\n",
+                    filename.c_str(), header.version, VANADIS_CHECKPOINT_VERSION );
+        }
+        if ( static_cast<uint32_t>(kind) != header.kind ) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint file %s holds kind %" PRIu32 ", expected kind %" PRIu32 "\n",
+                    filename.c_str(), header.kind, static_cast<uint32_t>(kind) );
+        }
+    }
+
+    ~VanadisCheckpointReader() {
+        munmap( (void*) base, length );
+    }
+
+    template<typename T>
+    T read() {
+        static_assert( std::is_trivially_copyable<T>::value, "checkpoint values must be trivially copyable" );
+        T value;
+        memcpy( &value, advance( sizeof(T) ), sizeof(T) );
+        return value;
+    }
+
+    template<typename T>
+    const T* readArray( size_t& count ) {
+        static_assert( std::is_trivially_copyable<T>::value, "checkpoint values must be trivially copyable" );
+        static_assert( alignof(T) <= 8, "checkpoint arrays are 8 byte aligned" );
+        align();
+        count = read<uint64_t>();
+        if ( count > ( length - offset ) / sizeof(T) ) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint file %s is truncated\n", filename.c_str() );
+        }
+        const T* data = (const T*) advance( count * sizeof(T) );
+        align();
+        return data;
+    }
+
+    std::string readString() {
+        size_t count;
+        const char* data = readArray<char>( count );
+        return std::string( data, count );
+    }
+
+private:
+    // skip the padding the writer adds in front of and behind an array
+    void align() {
+        advance( ( 8 - ( offset % 8 ) ) % 8 );
+    }
+
+    const uint8_t* advance( size_t bytes ) {
+        if ( bytes > length - offset ) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint file %s is truncated\n", filename.c_str() );
+        }
+        const uint8_t* ptr = base + offset;
+        offset += bytes;
+        return ptr;
+    }
+
+    SST::Output* output;
+    std::string filename;
+    const uint8_t* base;
+    size_t length;
+    size_t offset;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
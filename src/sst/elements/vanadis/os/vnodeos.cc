@@ -255,60 +255,64 @@ VanadisNodeOSComponent::checkpoint( std::string dir )
     filename << dir << "/" << getName();
     output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
-    auto fp = fopen(filename.str().c_str(),"w+");
-    assert(fp);
+    VanadisCheckpointWriter cp( output, filename.str(), VanadisCheckpointKind::NODE_OS );
 
     m_mmu->checkpoint( dir );
     m_physMemMgr->checkpoint( output, dir );
 
     // dump ELF map
-    fprintf(fp,"m_elfMap.size() %zu\n",m_elfMap.size());
+    cp.write<uint64_t>( m_elfMap.size() );
     for ( auto & x : m_elfMap ) {
-        fprintf(fp,"%s %s\n",x.first.c_str(), x.second->getBinaryPath() );
+        cp.writeString( x.first );
+        cp.writeString( x.second->getBinaryPath() );
     }
 
     // dump the processes
-    fprintf(fp,"m_threadMap.size() %zu\n", m_threadMap.size());
+    cp.write<uint64_t>( m_threadMap.size() );
     for ( auto & x : m_threadMap ) {
         // only alow one process
         assert( 100 == x.second->getpid() );
-        fprintf(fp,"thread: %d, pid: %d %s\n",x.first,x.second->getpid(), x.second->getElfInfo()->getBinaryPath());
+        cp.write<int32_t>( x.first );
+        cp.write<int32_t>( x.second->getpid() );
+        cp.writeString( x.second->getElfInfo()->getBinaryPath() );
         if ( x.second->getpid() == x.second->gettid() ) {
             x.second->checkpoint( output, dir );
         }
     }
 
-    fprintf(fp, "m_coreInfoMap.size() %zu\n",m_coreInfoMap.size());
+    cp.write<uint64_t>( m_coreInfoMap.size() );
     for ( auto i = 0; i < m_coreInfoMap.size(); i++ ) {
-        fprintf(fp, "core: %d\n",i);
-        m_coreInfoMap[i].checkpoint(fp);
+        m_coreInfoMap[i].checkpoint(cp);
     }
 
-    fprintf(fp,"m_elfPageCache.size() %zu\n",m_elfPageCache.size());
+    cp.write<uint64_t>( m_elfPageCache.size() );
     for ( auto & x : m_elfPageCache ) {
         auto& pageMap = x.second;
-        fprintf(fp,"filename: %s\n",x.first->getBinaryPath());
-        fprintf(fp,"pageMap.size(): %zu\n",pageMap.size());
+        std::vector<VanadisCheckpointPage> pages;
+        pages.reserve( pageMap.size() );
         for ( auto & y : pageMap ) {
-            fprintf(fp,"vpn: %d, ppn: %d, refCnt: %d\n",y.first,y.second->getPPN(), y.second->getRefCnt());
+            pages.push_back( { (uint32_t) y.first, y.second->getPPN(), y.second->getRefCnt(), 0 } );
         }
+        cp.writeString( x.first->getBinaryPath() );
+        cp.writeArray( pages.data(), pages.size() );
     }
 
-    fprintf(fp,"m_availHwThreads.size() %zu\n",m_availHwThreads.size());
-    while ( !m_availHwThreads.empty() ) {
-        auto x = m_availHwThreads.front();
-        fprintf(fp,"core: %d, hwThread: %d\n",x->core,x->hwThread);
-        m_availHwThreads.pop();
+    auto availHwThreads = m_availHwThreads;
+    cp.write<uint64_t>( availHwThreads.size() );
+    while ( !availHwThreads.empty() ) {
+        auto x = availHwThreads.front();
+        cp.write<int32_t>( x->core );
+        cp.write<int32_t>( x->hwThread );
+        availHwThreads.pop();
     }
 
-    fprintf(fp,"m_processDebugLevel: %d\n",m_processDebugLevel);
-    fprintf(fp,"m_pageSize: %d\n",m_pageSize);
-    fprintf(fp,"m_pageSize: %d\n",m_pageSize);
-    fprintf(fp,"m_phdr_address: %#" PRIx64 "\n",m_phdr_address);
-    fprintf(fp,"m_stack_top: %#" PRIx64 "\n",m_stack_top);
-    fprintf(fp,"m_nodeNum: %d\n",m_nodeNum);
-    fprintf(fp,"m_osStartTimeNano: %llu\n",m_osStartTimeNano);
-    fprintf(fp,"m_currentTid: %d\n",m_currentTid);
+    cp.write<int32_t>( m_processDebugLevel );
+    cp.write<int32_t>( m_pageSize );
+    cp.write<uint64_t>( m_phdr_address );
+    cp.write<uint64_t>( m_stack_top );
+    cp.write<int32_t>( m_nodeNum );
+    cp.write<uint64_t>( m_osStartTimeNano );
+    cp.write<int32_t>( m_currentTid );
 
     assert( m_pendingFault.empty() );
     assert( m_blockMemoryWriteReqQ.empty() );
@@ -317,47 +321,44 @@ VanadisNodeOSComponent::checkpoint( std::string dir )
 
 int VanadisNodeOSComponent::checkpointLoad( std::string dir ) 
 {
-    size_t size; 
-    int numProcess = 0;
     std::stringstream filename;
     filename << m_checkpointDir << "/" << getName();
     output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
-    auto fp = fopen(filename.str().c_str(),"r");
-    assert(fp);
+    VanadisCheckpointReader cp( output, filename.str(), VanadisCheckpointKind::NODE_OS );
 
     m_mmu->checkpointLoad( dir );
     m_physMemMgr->checkpointLoad( output, dir );
 
     // load ELF map
-    assert( 1 == fscanf(fp,"m_elfMap.size() %zu\n",&size) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_elfMap.size() %zu\n",size);
+    auto size = cp.read<uint64_t>();
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_elfMap.size() %" PRIu64 "\n",size);
     for ( auto i = 0; i < size; i++ ) {
-        char key[80], value[80];
-        assert( 2 == fscanf(fp,"%s %s\n",key, value ) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s %s\n",key,value);
+        auto key = cp.readString();
+        auto value = cp.readString();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s %s\n",key.c_str(),value.c_str());
 
-        VanadisELFInfo* elfInfo = readBinaryELFInfo(output, key);
+        VanadisELFInfo* elfInfo = readBinaryELFInfo(output, key.c_str());
         // readBinaryELFInfo does not return if fatal error is encountered
         if ( elfInfo->isDynamicExecutable() ) {
-            output->fatal( CALL_INFO, -1, "--> error - exe %s is not staticlly linked\n",key);
+            output->fatal( CALL_INFO, -1, "--> error - exe %s is not staticlly linked\n",key.c_str());
         }
         m_elfMap[key] = elfInfo;
     }
 
     // create processes
-    assert( 1 == fscanf(fp,"m_threadMap.size() %zu\n", &size) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_threadMap.size() %zu\n", size);
+    size = cp.read<uint64_t>();
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_threadMap.size() %" PRIu64 "\n", size);
 
     std::map<int,OS::ProcessInfo*> processMap;
     std::map<int,int> threadToProcessMap;
     for ( auto i = 0; i < size; i++ ) {
-        int tid, pid;
-        char str[80];
-        assert( 3 == fscanf(fp,"thread: %d, pid: %d %s\n",&tid,&pid,str ) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"thread: %d, pid: %d %s\n",tid,pid, str);
+        auto tid = cp.read<int32_t>();
+        auto pid = cp.read<int32_t>();
+        auto elf = cp.readString();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"thread: %d, pid: %d %s\n",tid,pid,elf.c_str());
         if ( tid == pid ) { 
-            m_threadMap[tid] = new OS::ProcessInfo( output, dir, m_mmu, m_physMemMgr, m_nodeNum, tid, m_elfMap[str], m_processDebugLevel, m_pageSize, size);
+            m_threadMap[tid] = new OS::ProcessInfo( output, dir, m_mmu, m_physMemMgr, m_nodeNum, tid, m_elfMap[elf], m_processDebugLevel, m_pageSize, size);
             processMap[pid] = m_threadMap[tid];
         } else {
             m_threadMap[tid] = new OS::ProcessInfo;
@@ -376,101 +377,68 @@ int VanadisNodeOSComponent::checkpointLoad( std::string dir )
         processMap[ pid ]->addThread( m_threadMap[ tid ] );
     }
 
-    // m_coreInfoMap.size() 1
-    assert( 1 == fscanf(fp,"m_coreInfoMap.size() %zd\n",&size) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_coreInfoMap.size() %zu\n",size);
+    size = cp.read<uint64_t>();
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_coreInfoMap.size() %" PRIu64 "\n",size);
     assert( size == m_coreInfoMap.size() );
     
     for ( auto i = 0; i < m_coreInfoMap.size(); i++ ) {
-
-        int core;
-        assert( 1 == fscanf(fp, "core: %d\n",&core) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"core: %d\n",core);
-        assert( core == i );
-
-        assert( 1 == fscanf(fp,"m_hwThreadMap.size(): %zd\n",&size) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_hwThreadMap.size(): %zu\n",size);
+        size = cp.read<uint64_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"core: %d m_hwThreadMap.size(): %" PRIu64 "\n",i,size);
+        assert( size == m_coreInfoMap[i].numHwThreads() );
     
         for ( auto j = 0; j < size; j++ ) {
-            int hwThread;
-            // hwThread: 0
-            assert( 1 == fscanf(fp, "hwThread: %d\n",&hwThread) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"hwThread: %d\n",hwThread);
-            assert( hwThread == j );
-            int pid,tid;
-            assert ( 2 == fscanf(fp, "pid,tid: %d, %d\n",&pid,&tid) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"pid,tid: %d %d\n",pid,tid);
+            auto pid = cp.read<int32_t>();
+            auto tid = cp.read<int32_t>();
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"hwThread: %d pid,tid: %d %d\n",j,pid,tid);
             if ( -1 != pid ) { 
                 setProcess( i, j, m_threadMap[tid] );
             }
         }
     }
 
-    assert ( 1 == fscanf(fp,"m_elfPageCache.size() %zu\n",&size) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_elfPageCache.size() %zu\n",size);
+    size = cp.read<uint64_t>();
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_elfPageCache.size() %" PRIu64 "\n",size);
     for ( auto i = 0; i < size; i++ ) {
-        char str [80];
-        assert( 1 == fscanf(fp,"filename: %s\n",str));
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"filename: %s\n",str);
-
-        auto & pageMap = m_elfPageCache[ m_elfMap[str] ];
+        auto elf = cp.readString();
+        size_t numPages;
+        auto pages = cp.readArray<VanadisCheckpointPage>( numPages );
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"filename: %s pageMap.size(): %zu\n",elf.c_str(),numPages);
 
-        size_t size2;
-        assert( 1 == fscanf(fp,"pageMap.size(): %zu\n", &size2 ) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"pageMap.size(): %zu\n",size2);
+        auto region = m_threadMap[100]->findMemRegion("text");
 
-        for ( auto j = 0; j < size2; j++ ) {
-            int vpn,ppn,refCnt;
-            assert( 3 == fscanf(fp,"vpn: %d, ppn: %d, refCnt: %d\n",&vpn, &ppn, &refCnt ) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"vpn: %d, ppn: %d, refCnt: %d\n",vpn,ppn,refCnt);
-            
-            auto region = m_threadMap[100]->findMemRegion("text");
+        assert( region->backing && region->backing->elfInfo );
+        assert( 0 == strcmp( elf.c_str(), region->backing->elfInfo->getBinaryPath() ) );
 
-            assert( region->backing && region->backing->elfInfo );
-            assert( 0 == strcmp( str, region->backing->elfInfo->getBinaryPath() ) );
+        auto & pageMap = m_elfPageCache[ m_elfMap[elf] ];
 
-            auto page = region->getPage( vpn );
+        for ( auto j = 0; j < numPages; j++ ) {
+            auto page = region->getPage( pages[j].vpn );
 
-            assert( refCnt == page->getRefCnt() ); 
-            assert( ppn == page->getPPN() );
-            m_elfPageCache[m_elfMap[str]][vpn] = page;
+            assert( pages[j].refCnt == page->getRefCnt() ); 
+            assert( pages[j].ppn == page->getPPN() );
+            pageMap[pages[j].vpn] = page;
         }
     }
 
-    assert( 1 == fscanf(fp,"m_availHwThreads.size() %zu\n",&size) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_availHwThreads.size() %zu\n",size);
+    size = cp.read<uint64_t>();
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_availHwThreads.size() %" PRIu64 "\n",size);
     for ( auto i = 0; i < size; i++ ) {
-        int core, hwThread;
-        assert( 2 == fscanf(fp,"core: %d, hwThread: %d\n",&core,&hwThread) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"core: %d, hwThread: %d\n",core,hwThread);
+        auto core = cp.read<int32_t>();
+        auto hwThread = cp.read<int32_t>();
         m_availHwThreads.push(new OS::HwThreadID(core,hwThread));
     }
 
-    assert( 1 == fscanf(fp,"m_processDebugLevel: %d\n",&m_processDebugLevel) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_processDebugLevel: %d\n",m_processDebugLevel);
-
-    assert( 1 == fscanf(fp,"m_pageSize: %d\n",&m_pageSize) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_pageSize: %d\n",m_pageSize);
-
-    assert( 1 == fscanf(fp,"m_pageSize: %d\n",&m_pageSize) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_pageSize: %d\n",m_pageSize);
-
-    assert( 1 == fscanf(fp,"m_phdr_address: %" PRIx64 "\n",&m_phdr_address) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_phdr_address: %#llx\n",m_phdr_address);
-
-    assert( 1 == fscanf(fp,"m_stack_top: %" PRIx64 "\n",&m_stack_top) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_stack_top: %#llx\n",m_stack_top);
-
-    assert( 1 == fscanf(fp,"m_nodeNum: %d\n",&m_nodeNum) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_nodeNum: %d\n",m_nodeNum);
-
-    assert( 1 == fscanf(fp,"m_osStartTimeNano: %llu\n",&m_osStartTimeNano) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_osStartTimeNano: %llu\n",m_osStartTimeNano);
+    m_processDebugLevel = cp.read<int32_t>();
+    m_pageSize = cp.read<int32_t>();
+    m_phdr_address = cp.read<uint64_t>();
+    m_stack_top = cp.read<uint64_t>();
+    m_nodeNum = cp.read<int32_t>();
+    m_osStartTimeNano = cp.read<uint64_t>();
+    m_currentTid = cp.read<int32_t>();
 
-    assert( 1 == fscanf(fp,"m_currentTid: %d\n",&m_currentTid) );
-    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_currentTid: %d\n",m_currentTid);
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_pageSize: %d m_phdr_address: %#" PRIx64 " m_stack_top: %#" PRIx64 " m_currentTid: %d\n",
+            m_pageSize, m_phdr_address, m_stack_top, m_currentTid);
 
-//    exit(0);
     return m_threadMap.size();
 }
 
@@ -28,6 +28,7 @@
 #include "os/vstartthreadreq.h"
 #include "os/vappruntimememory.h"
 #include "os/vphysmemmanager.h"
+#include "os/vcheckpointio.h"
 #include "os/include/process.h"
 #include "os/syscall/fork.h"
 #include "os/syscall/clone.h"
@@ -249,11 +250,13 @@ private:
         void clearSyscall( ) { assert(m_syscall); m_syscall = nullptr; }
         OS::ProcessInfo* getProcess() { return m_processInfo; }
         VanadisSyscall* getSyscall() { return m_syscall; }
-        void checkpoint( FILE* fp ) {
+        void checkpoint( VanadisCheckpointWriter& cp ) {
             if ( m_processInfo ) {
-                fprintf(fp,"pid,tid: %d,%d\n",m_processInfo->getpid(),m_processInfo->gettid());
+                cp.write<int32_t>( m_processInfo->getpid() );
+                cp.write<int32_t>( m_processInfo->gettid() );
             } else {
-                fprintf(fp,"pid,tid: %d,%d\n",-1,-1);
+                cp.write<int32_t>( -1 );
+                cp.write<int32_t>( -1 );
             }
             assert( nullptr == m_syscall );
         }
@@ -272,15 +275,14 @@ private:
         OS::ProcessInfo* getProcess( unsigned hwThread ) { return m_hwThreadMap.at(hwThread).getProcess(); }
         VanadisSyscall* getSyscall( unsigned hwThread ) { return m_hwThreadMap.at(hwThread).getSyscall(); }
 
-        void checkpoint( FILE* fp ) {
-            fprintf(fp, "m_hwThreadMap.size(): %zu\n",m_hwThreadMap.size());
+        size_t numHwThreads() const { return m_hwThreadMap.size(); }
+
+        void checkpoint( VanadisCheckpointWriter& cp ) {
+            cp.write<uint64_t>( m_hwThreadMap.size() );
             for ( auto i = 0; i < m_hwThreadMap.size(); i++ ) {
-                fprintf(fp, "hwThread: %d\n",i);
-                m_hwThreadMap[i].checkpoint( fp );
+                m_hwThreadMap[i].checkpoint( cp );
             }
         }
-        void checkpointLoad( FILE* fp ) {
-        }
       private:
         std::vector< HardwareThreadInfo > m_hwThreadMap;
     };
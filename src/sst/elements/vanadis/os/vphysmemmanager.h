@@ -26,6 +26,7 @@
 
 #include "output.h"
 #include "vanadisDbgFlags.h"
+#include "os/vcheckpointio.h"
 
 #define FOUR_KB 4096
 #define TWO_MB ( 1024*1024*2)
@@ -70,26 +71,18 @@ class PhysMemManager {
             assert(0);
         }
 
-        void checkpoint( FILE* fp ) {
-            fprintf(fp,"BitMap size: %zu\n",m_bitMap.size());
-            for ( auto i = 0; i < m_bitMap.size(); i++ ) {
-                if ( m_bitMap[i] ) {
-                    fprintf(fp,"%d %#018" PRIx64 "\n",i,m_bitMap[i]);
-                }
-            }
+        void checkpoint( SST::Vanadis::VanadisCheckpointWriter& cp ) {
+            cp.writeArray( m_bitMap.data(), m_bitMap.size() );
         }
 
-        void checkpointLoad( SST::Output* output, FILE* fp ) {
-            int size;
-            assert( 1 == fscanf(fp,"BitMap size: %d\n",&size) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"BitMap size: %d\n",size);
-            m_bitMap.resize(size,0);
-            int index;
-            uint64_t value;
-            while ( 2 == fscanf( fp, "%d %" PRIx64 "\n", &index, &value ) ) {
-                output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%d %#018" PRIx64 "\n",index,value);
-                m_bitMap[index] = value;
+        void checkpointLoad( SST::Output* output, SST::Vanadis::VanadisCheckpointReader& cp ) {
+            size_t size;
+            const uint64_t* words = cp.readArray<uint64_t>( size );
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"BitMap size: %zu\n",size);
+            if ( size != m_bitMap.size() ) {
+                output->fatal(CALL_INFO, -1, "Error: checkpoint physical memory bitmap has %zu words, this node has %zu\n",size,m_bitMap.size());
             }
+            m_bitMap.assign( words, words + size );
         }
 
       private:
@@ -141,22 +134,21 @@ class PhysMemManager {
     void checkpoint( SST::Output* output, std::string dir ) {
         std::stringstream filename;
         filename << dir << "/" << "PhysMemManager";
-        auto fp = fopen(filename.str().c_str(),"w+");
 
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"PhysMemManager %s\n", filename.str().c_str());
 
-        fprintf(fp,"m_numAllocated %llu\n",m_numAllocated);
-        m_bitMap.checkpoint(fp);
+        SST::Vanadis::VanadisCheckpointWriter cp( output, filename.str(), SST::Vanadis::VanadisCheckpointKind::PHYS_MEM );
+        cp.write<uint64_t>( m_numAllocated );
+        m_bitMap.checkpoint(cp);
     }
     void checkpointLoad( SST::Output* output , std::string dir ) {
         std::stringstream filename;
         filename << dir << "/" << "PhysMemManager";
-        auto fp = fopen(filename.str().c_str(),"r");
-        assert(fp);
 
-        assert( 1 == fscanf(fp,"m_numAllocated %llu\n",&m_numAllocated) );
+        SST::Vanadis::VanadisCheckpointReader cp( output, filename.str(), SST::Vanadis::VanadisCheckpointKind::PHYS_MEM );
+        m_numAllocated = cp.read<uint64_t>();
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_numAllocated %llu\n",m_numAllocated);
-        m_bitMap.checkpointLoad(output,fp);
+        m_bitMap.checkpointLoad(output,cp);
     }
 
   private:
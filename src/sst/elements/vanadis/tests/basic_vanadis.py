@@ -6,8 +6,8 @@ mh_debug=0
 dbgAddr="0"
 stopDbg="0"
 
-checkpointDir = ""
-checkpoint = ""
+checkpointDir = os.getenv("VANADIS_CHECKPOINT_DIR", "")
+checkpoint = os.getenv("VANADIS_CHECKPOINT", "")
 
 #checkpointDir = "checkpoint0"
 #checkpoint = "load"
@@ -77,6 +77,8 @@ os_verbosity = os.getenv("VANADIS_OS_VERBOSE", verbosity)
 pipe_trace_file = os.getenv("VANADIS_PIPE_TRACE", "")
 lsq_ld_entries = os.getenv("VANADIS_LSQ_LD_ENTRIES", 16)
 lsq_st_entries = os.getenv("VANADIS_LSQ_ST_ENTRIES", 8)
+lsq_store_forwarding = os.getenv("VANADIS_LSQ_STORE_FORWARDING", 0)
+lsq_speculative_loads = os.getenv("VANADIS_LSQ_SPECULATIVE_LOADS", 0)
 
 rob_slots = os.getenv("VANADIS_ROB_SLOTS", 64)
 retires_per_cycle = os.getenv("VANADIS_RETIRES_PER_CYCLE", 4)
@@ -214,6 +216,15 @@ memCtrlParams = {
       "checkpoint" : checkpoint
 }
 
+# a saved run writes the memory image next to the checkpoint and a loaded
+# run maps that image copy-on-write, leaving it unmodified
+if checkpoint == "save":
+    memCtrlParams["backing"] = "mmap"
+    memCtrlParams["backing_out_file"] = checkpointDir + "/memory"
+elif checkpoint == "load":
+    memCtrlParams["backing"] = "mmap"
+    memCtrlParams["backing_in_file"] = checkpointDir + "/memory"
+
 memParams = {
       "mem_size" : "4GiB",
       "access_time" : "1 ns"
@@ -275,6 +286,8 @@ lsqParams = {
     "address_mask" : 0xFFFFFFFF,
     "max_stores" : lsq_st_entries,
     "max_loads" : lsq_ld_entries,
+    "store_forwarding" : lsq_store_forwarding,
+    "speculative_loads" : lsq_speculative_loads,
 }
 
 l1dcacheParams = {
@@ -8,6 +8,9 @@ import subprocess
 module_init = 0
 module_sema = threading.Semaphore()
 vanadis_test_matrix = []
+vanadis_lsq_test_matrix = []
+vanadis_unit_test_matrix = []
+vanadis_checkpoint_test_matrix = []
 
 MakeTests = False
 #MakeTests = True
@@ -118,8 +121,53 @@ def build_vanadis_test_matrix():
 
 ################################################################################
 
+# Programs run with store forwarding and speculative loads enabled in the LSQ.
+# The program output must match the default run and at least one load must
+# have been replayed after passing an older store it overlaps.
+def build_vanadis_lsq_test_matrix():
+    global vanadis_lsq_test_matrix
+    vanadis_lsq_test_matrix = []
+
+    location="small/misc"
+    tests = ["stream","mt-dgemm"]
+    arch_list = ["mipsel","riscv64"]
+    testnum = 0
+    for test in tests:
+        for arch in arch_list:
+            testnum = testnum + 1
+            testname = "{0}_{1}_{2}_lsq_speculation".format(location.replace("/", "_"), test, arch)
+            vanadis_lsq_test_matrix.append((testnum, testname, location, test, arch))
+
+def build_vanadis_unit_test_matrix():
+    global vanadis_unit_test_matrix
+    vanadis_unit_test_matrix = []
+
+    suites = ["lsq","checkpoint"]
+    for testnum, suite in enumerate(suites):
+        vanadis_unit_test_matrix.append((testnum + 1, suite))
+
+# The checkpoint program saves the node at a syscall and a second run loads
+# the saved node, including its memory image, and finishes the program.
+def build_vanadis_checkpoint_test_matrix():
+    global vanadis_checkpoint_test_matrix
+    vanadis_checkpoint_test_matrix = []
+
+    location="small/misc"
+    arch_list = ["riscv64"]
+    testnum = 0
+    for arch in arch_list:
+        for numCores, numHwThreads in [(1,1), (1,2)]:
+            testnum = testnum + 1
+            testname = "{0}_checkpoint_{1}_{2}core-{3}thread".format(location.replace("/", "_"), arch, numCores, numHwThreads)
+            vanadis_checkpoint_test_matrix.append((testnum, testname, location, "checkpoint", arch, numCores, numHwThreads))
+
+################################################################################
+
 # At startup, build the test matrix
 build_vanadis_test_matrix()
+build_vanadis_lsq_test_matrix()
+build_vanadis_unit_test_matrix()
+build_vanadis_checkpoint_test_matrix()
 
 def gen_custom_name(testcase_func, param_num, param):
 # Full TestCaseName
@@ -154,12 +202,102 @@ class testcase_vanadis(SSTTestCase):
         log_debug("Running Vanadis test #{0} ({1}): elffile={4} in dir {3}, isa {5}; using sdl={2}".format(testnum, testname, sdlfile, elftestdir, elffile, isa, timeout_sec))
         self.vanadis_test_template(testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec )
 
+    @parameterized.expand(vanadis_lsq_test_matrix, name_func=gen_custom_name)
+    def test_vanadis_lsq_speculation(self, testnum, testname, elftestdir, elffile, isa):
+        self._checkSkipConditions( isa )
+
+        # a small store buffer makes stores wait so loads have something to pass
+        lsq_env = { "VANADIS_LSQ_STORE_FORWARDING" : "1",
+                    "VANADIS_LSQ_SPECULATIVE_LOADS" : "1",
+                    "VANADIS_LSQ_ST_ENTRIES" : "2" }
+
+        log_debug("Running Vanadis LSQ speculation test #{0} ({1}): elffile={3} in dir {2}, isa {4}".format(testnum, testname, elftestdir, elffile, isa))
+        sst_outfile = self.vanadis_test_template(testnum, testname, "basic_vanadis.py", elftestdir, elffile, isa, 1, 1, "", 300,
+                                                 variant="lsq_speculation", env=lsq_env)
+
+        violations = 0
+        with open(sst_outfile, 'r') as f:
+            for line in f:
+                if "lsq.ordering_violations" in line:
+                    violations += int(line.split("Sum.u64 = ")[1].split(";")[0])
+        self.assertTrue(violations > 0, "Vanadis LSQ speculation test {0} did not replay any loads".format(testname))
+
+    @parameterized.expand(vanadis_unit_test_matrix, name_func=gen_custom_name)
+    def test_vanadis_unit_tests(self, testnum, suite):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/unit_test_vanadis.py".format(test_path)
+        sst_outfile = "{0}/test_vanadis_unit_{1}.out".format(outdir, suite)
+        sst_errfile = "{0}/test_vanadis_unit_{1}.err".format(outdir, suite)
+
+        self.run_sst(sdlfile, sst_outfile, sst_errfile, other_args="--model-options={0}".format(suite), set_cwd=outdir)
+
+        with open(sst_outfile, 'r') as f:
+            output = f.read()
+        self.assertTrue("FAILED" not in output, "Vanadis unit test suite {0} failed, see {1}".format(suite, sst_outfile))
+        self.assertTrue("suite {0} passed".format(suite) in output, "Vanadis unit test suite {0} did not complete, see {1}".format(suite, sst_outfile))
+
+    @parameterized.expand(vanadis_checkpoint_test_matrix, name_func=gen_custom_name)
+    def test_vanadis_checkpoint(self, testnum, testname, elftestdir, elffile, isa, numCores, numHwThreads):
+        self._checkSkipConditions( isa )
+
+        test_path = self.get_testsuite_dir()
+        sdlfile = "{0}/basic_vanadis.py".format(test_path)
+        testdir = "{0}/vanadis_tests/{1}".format(self.get_test_output_run_dir(), testname)
+        checkpointdir = "{0}/checkpoint".format(testdir)
+        os.makedirs(checkpointdir)
+
+        cpu_env = { "VANADIS_EXE" : "{0}/{1}/{2}/{3}/{2}".format(test_path, elftestdir, elffile, isa),
+                    "VANADIS_ISA" : "RISCV64",
+                    "VANADIS_NUM_CORES" : str(numCores),
+                    "VANADIS_NUM_HW_THREADS" : str(numHwThreads),
+                    "VANADIS_CHECKPOINT_DIR" : checkpointdir }
+
+        # run the program up to the checkpoint, then restart it from the saved node
+        os_output = ""
+        for mode in ["save", "load"]:
+            outdir = "{0}/{1}".format(testdir, mode)
+            os.makedirs(outdir)
+            sst_outfile = "{0}/test_vanadis_{1}_{2}.out".format(outdir, testname, mode)
+            sst_errfile = "{0}/test_vanadis_{1}_{2}.err".format(outdir, testname, mode)
+
+            cpu_env["VANADIS_CHECKPOINT"] = mode
+            for key, value in cpu_env.items():
+                os.environ[key] = value
+            try:
+                self.run_sst(sdlfile, sst_outfile, sst_errfile, set_cwd=outdir, timeout_sec=300)
+            finally:
+                for key in cpu_env:
+                    del os.environ[key]
+
+            os_outfile = "{0}/stdout-100".format(outdir)
+            self.assertTrue(os.path.isfile(os_outfile), "Vanadis checkpoint {0} run did not write {1}".format(mode, os_outfile))
+            with open(os_outfile, 'r') as f:
+                os_output += f.read()
+
+            if mode == "save":
+                self.assertTrue(os.path.isfile("{0}/memory".format(checkpointdir)), "Vanadis checkpoint save run did not write a memory image")
+                memory_mtime = os.path.getmtime("{0}/memory".format(checkpointdir))
+
+        # the loaded run maps the image privately and must leave it untouched
+        self.assertTrue(memory_mtime == os.path.getmtime("{0}/memory".format(checkpointdir)), "Vanadis checkpoint load run modified the memory image")
+
+        # between them the two runs print every line of the program exactly once
+        numThreads = numCores * numHwThreads
+        expected = ["OMP_NUM_THREADS {0}".format(numThreads), "Number of threads = {0}".format(numThreads), "exit"]
+        expected += ["Hello World from thread = {0}".format(tid) for tid in range(numThreads)]
+        lines = os_output.splitlines()
+        self.assertTrue(sorted(lines) == sorted(expected), "Vanadis checkpoint output {0} does not match expected {1}".format(lines, expected))
+
 #####
 
-    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, testtimeout=120):
+    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, testtimeout=120, variant="", env={}):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = "{0}/vanadis_tests/{1}/{2}/{3}/{4}".format(self.get_test_output_run_dir(), elftestdir,elffile,isa,goldfiledir)
+        if len(variant):
+            outdir = "{0}/{1}".format(outdir, variant)
         tmpdir = self.get_test_output_tmp_dir()
         os.makedirs(outdir)
 
@@ -195,7 +333,14 @@ class testcase_vanadis(SSTTestCase):
         testfile_exists = os.path.exists(testfilepath) and os.path.isfile(testfilepath)
         self.assertTrue(testfile_exists, "Vanadis test {0} does not exist".format(testfilepath))
 
-        oscmd = self.run_sst(sdlfile, sst_outfile, sst_errfile, mpi_out_files=mpioutfiles, set_cwd=outdir, timeout_sec=testtimeout)
+        for key, value in env.items():
+            os.environ[key] = value
+
+        try:
+            oscmd = self.run_sst(sdlfile, sst_outfile, sst_errfile, mpi_out_files=mpioutfiles, set_cwd=outdir, timeout_sec=testtimeout)
+        finally:
+            for key in env:
+                del os.environ[key]
 
         # Perform the tests
         # Verify that the errfile from SST is empty
@@ -208,7 +353,10 @@ class testcase_vanadis(SSTTestCase):
         self.assertTrue(os_outfileexists, "Vanadis test outfile-os not found in directory {0}".format(outdir))
         self.assertTrue(os_errfileexists, "Vanadis test errfile-os not found in directory {0}".format(outdir))
 
-        if ( os.path.exists( ref_sst_outfile ) ):
+        # statistics from a variant run differ from the default gold, only the program output is compared
+        if len(variant):
+            log_testing_note("vanadis test {0} is a {1} run, did not compare SST output".format(testDataFileName, variant))
+        elif ( os.path.exists( ref_sst_outfile ) ):
             cmp_result = testing_compare_filtered_diff(testname, sst_outfile, ref_sst_outfile ,filters=[StartsWithFilter(" v0.instructions_issued.1")])
             if (cmp_result == False):
                 diffdata = testing_get_diff_data(testname)
@@ -229,7 +377,7 @@ class testcase_vanadis(SSTTestCase):
             log_failure(oscmd)
             log_failure(diffdata)
 
-            if updateFiles:
+            if updateFiles and not len(variant):
                 print("Updating sst file ",os_outfile, "->" ,ref_os_outfile)
                 subprocess.call( [ "cp", os_outfile, ref_os_outfile ] )
 
@@ -241,12 +389,14 @@ class testcase_vanadis(SSTTestCase):
             log_failure(oscmd)
             log_failure(diffdata)
 
-            if updateFiles:
+            if updateFiles and not len(variant):
                 print("Updating sst file ",os_errfile, "->" ,ref_os_errfile)
                 subprocess.call( [ "cp", os_errfile, ref_os_errfile ] )
 
         self.assertTrue(cmp_result, "Vanadis os error file {0} does not match reference error file {1}".format(os_outfile, ref_os_outfile))
 
+        return sst_outfile
+
         # DEVELOPER NOTE: In the future, we may want to compare the SST output (statisics) vs some reference file
 
 
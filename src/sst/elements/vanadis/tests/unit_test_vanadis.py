@@ -0,0 +1,17 @@
+import os
+import sys
+import sst
+
+# Runs one of the Vanadis unit test suites, the suite is given as a model
+# option, e.g. sst unit_test_vanadis.py --model-options=lsq
+suite = "lsq"
+if len(sys.argv) > 1:
+    suite = sys.argv[1]
+
+verbose = int(os.getenv("VANADIS_VERBOSE", 1))
+
+unit_test = sst.Component("unit_test", "vanadis.VanadisUnitTest")
+unit_test.addParams({
+    "suite" : suite,
+    "verbose" : verbose,
+})
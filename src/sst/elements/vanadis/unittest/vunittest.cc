@@ -0,0 +1,249 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "unittest/vunittest.h"
+
+#include "decoder/visaopts.h"
+#include "inst/vstore.h"
+#include "lsq/vbasiclsqentry.h"
+#include "lsq/vbasicstoreindex.h"
+#include "lsq/vstoreset.h"
+#include "os/vcheckpointio.h"
+
+#include <vector>
+
+using namespace SST::Vanadis;
+
+VanadisUnitTestComponent::VanadisUnitTestComponent(SST::ComponentId_t id, SST::Params& params) :
+    Component(id), checks(0), failures(0)
+{
+    output  = new SST::Output("[vanadis-unit-test]: ", 0, 0, SST::Output::STDOUT);
+    suite   = params.find<std::string>("suite", "lsq");
+    verbose = params.find<bool>("verbose", false);
+
+    if ( suite != "lsq" && suite != "checkpoint" ) {
+        output->fatal(CALL_INFO, -1, "Error: unknown unit test suite \"%s\"\n", suite.c_str());
+    }
+}
+
+void
+VanadisUnitTestComponent::setup()
+{
+    if ( suite == "lsq" ) {
+        testStoreIndex();
+        testStoreSetPredictor();
+    } else if ( suite == "checkpoint" ) {
+        testCheckpointIO();
+    }
+
+    if ( failures > 0 ) {
+        output->fatal(CALL_INFO, -1, "Error: suite %s failed %" PRIu32 " of %" PRIu32 " checks\n", suite.c_str(), failures, checks);
+    }
+
+    output->output("suite %s passed %" PRIu32 " checks\n", suite.c_str(), checks);
+}
+
+void
+VanadisUnitTestComponent::check(bool result, const char* what)
+{
+    checks++;
+
+    if ( !result ) {
+        failures++;
+        output->output("FAILED: %s\n", what);
+    } else if ( verbose ) {
+        output->output("passed: %s\n", what);
+    }
+}
+
+void
+VanadisUnitTestComponent::testStoreIndex()
+{
+    VanadisDecoderOptions options;
+    std::vector<VanadisStoreInstruction*>       instructions;
+    std::vector<VanadisBasicStorePendingEntry*> entries;
+
+    auto makeStore = [&](uint64_t address, uint64_t width, VanadisMemoryTransaction type) {
+        VanadisStoreInstruction* ins = new VanadisStoreInstruction(
+            0x1000 + (instructions.size() * 4), 0, &options, 1, 0, 2, width, type, STORE_INT_REGISTER);
+        VanadisBasicStorePendingEntry* entry = new VanadisBasicStorePendingEntry(ins, address, width, STORE_INT_REGISTER, 2);
+        instructions.push_back(ins);
+        entries.push_back(entry);
+        return entry;
+    };
+
+    VanadisBasicStoreIndex                 index;
+    std::vector<VanadisStoreForwardSource> sources;
+
+    check(index.empty(), "store index starts empty");
+    check(VanadisStoreIndexResult::NO_OVERLAP == index.lookup(0x8000, 8, sources), "lookup in an empty index does not overlap");
+
+    VanadisBasicStorePendingEntry* store_a = makeStore(0x8000, 8, MEM_TRANSACTION_NONE);
+    index.add(store_a);
+
+    check(VanadisStoreIndexResult::FORWARD == index.lookup(0x8000, 8, sources), "load matching a store forwards");
+    check(sources.size() == 1 && sources[0].store == store_a && sources[0].store_offset == 0 && sources[0].load_offset == 0 &&
+              sources[0].length == 8,
+          "matching load takes all eight bytes from the store");
+
+    check(VanadisStoreIndexResult::FORWARD == index.lookup(0x8004, 4, sources), "load inside a store forwards");
+    check(sources.size() == 1 && sources[0].store_offset == 4 && sources[0].load_offset == 0 && sources[0].length == 4,
+          "load inside a store starts at the right store offset");
+
+    check(VanadisStoreIndexResult::CONFLICT == index.lookup(0x8006, 4, sources), "load partially covered by a store conflicts");
+    check(sources.empty(), "conflicting lookup returns no sources");
+    check(VanadisStoreIndexResult::CONFLICT == index.lookup(0x7ffc, 8, sources), "load overlapping the start of a store conflicts");
+    check(VanadisStoreIndexResult::NO_OVERLAP == index.lookup(0x8008, 8, sources), "load next to a store does not overlap");
+    check(VanadisStoreIndexResult::NO_OVERLAP == index.lookup(0x7ff8, 8, sources), "load before a store does not overlap");
+
+    // a younger store to the upper half supplies those bytes
+    VanadisBasicStorePendingEntry* store_b = makeStore(0x8004, 4, MEM_TRANSACTION_NONE);
+    index.add(store_b);
+
+    check(VanadisStoreIndexResult::FORWARD == index.lookup(0x8000, 8, sources), "load covered by two stores forwards");
+    check(sources.size() == 2 && sources[0].store == store_a && sources[0].load_offset == 0 && sources[0].length == 4 &&
+              sources[1].store == store_b && sources[1].store_offset == 0 && sources[1].load_offset == 4 &&
+              sources[1].length == 4,
+          "each byte comes from the youngest store which writes it");
+
+    // stores and loads which cross a 64 byte block
+    VanadisBasicStorePendingEntry* store_c = makeStore(0x803c, 8, MEM_TRANSACTION_NONE);
+    index.add(store_c);
+
+    check(VanadisStoreIndexResult::FORWARD == index.lookup(0x803c, 8, sources), "load crossing a block forwards");
+    check(sources.size() == 1 && sources[0].store == store_c && sources[0].length == 8, "load crossing a block uses one source");
+    check(VanadisStoreIndexResult::FORWARD == index.lookup(0x8040, 4, sources), "load in the second block of a store forwards");
+    check(sources.size() == 1 && sources[0].store_offset == 4, "second block load starts at the right store offset");
+    check(VanadisStoreIndexResult::CONFLICT == index.lookup(0x8040, 8, sources), "load past the end of a crossing store conflicts");
+
+    index.remove(store_b);
+    check(VanadisStoreIndexResult::FORWARD == index.lookup(0x8004, 4, sources), "older store forwards once the younger is removed");
+    check(sources.size() == 1 && sources[0].store == store_a, "removed store is no longer a source");
+
+    index.remove(store_a);
+    check(VanadisStoreIndexResult::NO_OVERLAP == index.lookup(0x8000, 8, sources), "removed stores no longer overlap");
+
+    // only standard stores may forward
+    VanadisBasicStorePendingEntry* store_d = makeStore(0x9000, 8, MEM_TRANSACTION_LLSC_STORE);
+    index.add(store_d);
+    check(VanadisStoreIndexResult::CONFLICT == index.lookup(0x9000, 8, sources), "load covered by a store-conditional conflicts");
+
+    index.remove(store_c);
+    index.remove(store_d);
+    check(index.empty(), "store index is empty once every store is removed");
+
+    index.add(makeStore(0xa000, 8, MEM_TRANSACTION_NONE));
+    index.clear();
+    check(index.empty(), "store index is empty after clear");
+
+    for ( auto entry : entries ) {
+        delete entry;
+    }
+    for ( auto ins : instructions ) {
+        delete ins;
+    }
+}
+
+void
+VanadisUnitTestComponent::testStoreSetPredictor()
+{
+    VanadisStoreSetPredictor predictor(1024);
+
+    check(!predictor.predictsDependence(0x100, 0x200), "untrained predictor does not predict a dependence");
+
+    predictor.recordViolation(0x100, 0x200);
+    check(predictor.predictsDependence(0x100, 0x200), "violating pair is predicted after training");
+    check(!predictor.predictsDependence(0x100, 0x300), "store outside the set is not predicted");
+    check(!predictor.predictsDependence(0x104, 0x200), "load outside the set is not predicted");
+
+    // a new load joins the store's set and a new store joins the load's set
+    predictor.recordViolation(0x104, 0x200);
+    check(predictor.predictsDependence(0x104, 0x200), "second load joins the store set");
+    predictor.recordViolation(0x100, 0x300);
+    check(predictor.predictsDependence(0x100, 0x300), "second store joins the load set");
+    check(predictor.predictsDependence(0x104, 0x300), "loads in a set depend on every store in it");
+
+    // two trained sets merge into the lower numbered one
+    predictor.recordViolation(0x400, 0x500);
+    check(!predictor.predictsDependence(0x400, 0x200), "separate sets are independent");
+    predictor.recordViolation(0x400, 0x200);
+    check(predictor.predictsDependence(0x400, 0x200), "violation between two sets merges them");
+    check(predictor.predictsDependence(0x100, 0x200), "merge keeps the existing members of the lower set");
+
+    predictor.clear();
+    check(!predictor.predictsDependence(0x100, 0x200), "clear forgets every set");
+
+    // a table of one entry aliases every instruction
+    VanadisStoreSetPredictor tiny(0);
+    tiny.recordViolation(0x100, 0x200);
+    check(tiny.predictsDependence(0x800, 0x900), "single entry table predicts for every pair");
+}
+
+void
+VanadisUnitTestComponent::testCheckpointIO()
+{
+    const std::string filename = "vanadis-unit-test.ckpt";
+
+    const uint64_t              words[3] = { 0x0123456789abcdefULL, 0, UINT64_MAX };
+    const VanadisCheckpointPage pages[2] = { { 1, 2, 3, 0 }, { 0x10000, 0x20000, 1, 0 } };
+    const uint16_t              shorts[3] = { 1, 2, 3 };
+
+    // odd sized values in between make every array start misaligned unless it is padded
+    {
+        VanadisCheckpointWriter cp(output, filename, VanadisCheckpointKind::PROCESS);
+        cp.write<uint32_t>(0xdeadbeef);
+        cp.writeArray(words, 3);
+        cp.write<uint8_t>(0x5a);
+        cp.writeString("hello");
+        cp.write<uint32_t>(7);
+        cp.writeArray(pages, 2);
+        cp.writeArray(shorts, 3);
+        cp.writeArray(words, 0);
+        cp.write<uint16_t>(0xbeef);
+    }
+
+    {
+        VanadisCheckpointReader cp(output, filename, VanadisCheckpointKind::PROCESS);
+        size_t                  count;
+
+        check(0xdeadbeef == cp.read<uint32_t>(), "value before the first array is read back");
+
+        const uint64_t* read_words = cp.readArray<uint64_t>(count);
+        check(0 == ((uintptr_t)read_words % 8), "array after a 4 byte value is 8 byte aligned");
+        check(3 == count && words[0] == read_words[0] && words[1] == read_words[1] && words[2] == read_words[2],
+              "word array is read back");
+
+        check(0x5a == cp.read<uint8_t>(), "byte after an array is read back");
+        check("hello" == cp.readString(), "string after a single byte is read back");
+        check(7 == cp.read<uint32_t>(), "value after a string is read back");
+
+        const VanadisCheckpointPage* read_pages = cp.readArray<VanadisCheckpointPage>(count);
+        check(0 == ((uintptr_t)read_pages % 8), "page array is 8 byte aligned");
+        check(2 == count && 0x10000 == read_pages[1].vpn && 0x20000 == read_pages[1].ppn && 1 == read_pages[1].refCnt,
+              "page array is read back");
+
+        const uint16_t* read_shorts = cp.readArray<uint16_t>(count);
+        check(0 == ((uintptr_t)read_shorts % 8), "array after an array is 8 byte aligned");
+        check(3 == count && 1 == read_shorts[0] && 3 == read_shorts[2], "short array is read back");
+
+        cp.readArray<uint64_t>(count);
+        check(0 == count, "empty array is read back");
+        check(0xbeef == cp.read<uint16_t>(), "value after an empty array is read back");
+    }
+
+    unlink(filename.c_str());
+}
@@ -0,0 +1,63 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_UNIT_TEST
+#define _H_VANADIS_UNIT_TEST
+
+#include <sst/core/component.h>
+#include <sst/core/output.h>
+
+#include <string>
+
+namespace SST {
+namespace Vanadis {
+
+// Checks the data structures used inside the core which are hard to reach
+// from a simulated program. The selected suite runs during setup(), every
+// failed check is reported and the simulation is stopped with an error if
+// any check failed.
+class VanadisUnitTestComponent : public SST::Component {
+public:
+    SST_ELI_REGISTER_COMPONENT(VanadisUnitTestComponent, "vanadis", "VanadisUnitTest", SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                               "Unit tests for Vanadis internal data structures", COMPONENT_CATEGORY_UNCATEGORIZED)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "suite", "Which tests to run: lsq or checkpoint", "lsq" },
+        { "verbose", "Print each check as it is made", "0" }
+    )
+
+    VanadisUnitTestComponent(SST::ComponentId_t id, SST::Params& params);
+    ~VanadisUnitTestComponent() {}
+
+    void setup() override;
+
+private:
+    void check(bool result, const char* what);
+
+    void testStoreIndex();
+    void testStoreSetPredictor();
+    void testCheckpointIO();
+
+    SST::Output* output;
+    std::string  suite;
+    bool         verbose;
+    uint32_t     checks;
+    uint32_t     failures;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
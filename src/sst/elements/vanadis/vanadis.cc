@@ -827,6 +827,18 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
     }
 
     if ( rob_front->completedIssue() && rob_front->completedExecution() ) {
+        // The LSQ found this instruction read memory ahead of an older store
+        // it overlaps, clear the pipeline and refetch from the instruction
+        if ( UNLIKELY(rob_front->needsReplay()) ) {
+            #ifdef VANADIS_BUILD_DEBUG
+            output->verbose(
+                CALL_INFO, 8, 0, "----> replay thread %" PRIu32 " from ins: 0x%" PRI_ADDR " (memory ordering violation)\n",
+                ins_thread, rob_front->getInstructionAddress());
+            #endif
+            handleMisspeculate(ins_thread, rob_front->getInstructionAddress());
+            return 1;
+        }
+
         bool     perform_cleanup       = true;
         bool     perform_delay_cleanup = false;
         uint64_t pipeline_reset_addr   = 0;
@@ -857,6 +869,12 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                     VanadisInstruction* delay_ins = rob->peekAt(1);
 
                     if ( delay_ins->completedExecution() ) {
+                        // replay from the branch so the delay slot is refetched with it
+                        if ( UNLIKELY(delay_ins->needsReplay()) ) {
+                            handleMisspeculate(ins_thread, rob_front->getInstructionAddress());
+                            return 1;
+                        }
+
                         if ( UNLIKELY(delay_ins->trapsError()) ) {
                             output->fatal(
                                 CALL_INFO, -1,
@@ -1890,9 +1908,8 @@ VANADIS_COMPONENT::setup()
         std::stringstream filename;
         filename << m_checkpointDir << "/" << getName();
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"checkpoint file %s\n",filename.str().c_str());
-        auto fp = fopen(filename.str().c_str(),"r");
-        assert(fp);
-        checkpointLoad(fp);
+        VanadisCheckpointReader cp( output, filename.str(), VanadisCheckpointKind::CORE );
+        checkpointLoad(cp);
     } 
 }
 
@@ -1907,12 +1924,10 @@ VANADIS_COMPONENT::finish()
 
         std::stringstream filename;
         filename << m_checkpointDir << "/" << getName();
-        auto fp = fopen(filename.str().c_str(),"w+");
-        assert(fp);
-
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
-        checkpoint(fp); 
+        VanadisCheckpointWriter cp( output, filename.str(), VanadisCheckpointKind::CORE );
+        checkpoint(cp); 
     }
 }
 
@@ -2278,86 +2293,86 @@ void VANADIS_COMPONENT::startThreadFork( VanadisStartThreadForkReq* req )
 }
 
 void 
-VANADIS_COMPONENT::checkpoint(FILE* fp ) 
+VANADIS_COMPONENT::checkpoint(VanadisCheckpointWriter& cp) 
 {
+    cp.write<uint32_t>( hw_threads );
 
     for ( auto i = 0; i < hw_threads; i++ ) {
-        fprintf(fp,"Hardware thread: %d\n",i);
+        cp.write<uint32_t>( m_checkpointing[i] );
         if ( m_checkpointing[i] ) {
-            fprintf(fp,"active: yes\n");
-            fprintf(fp,"rob[0] %#llx %s\n", rob[i]->peekAt(0)->getInstructionAddress(), rob[i]->peekAt(0)->getInstCode()  );
-            fprintf(fp,"rob[1] %#llx %s\n", rob[i]->peekAt(1)->getInstructionAddress(), rob[i]->peekAt(1)->getInstCode() );
-
             auto isa_table = retire_isa_tables[i];
             auto reg_file = register_files[i];
             auto thr_decoder = thread_decoders[i];
 
-            uint64_t tlsPtr = thread_decoders[i]->getThreadLocalStoragePointer();
-            fprintf(fp,"tlsPtr: %#" PRIx64 "\n",tlsPtr);
-            for ( int i = 0; i < isa_table->getNumIntRegs(); i++ ) {
-                uint64_t val = reg_file->getIntReg<uint64_t>( isa_table->getIntPhysReg( i ) );
-                fprintf(fp,"INT %d %#" PRIx64 "\n",i,val);
+            // the thread is halted on its checkpoint syscall, rob[0] is the syscall
+            cp.write<uint64_t>( rob[i]->peekAt(0)->getInstructionAddress() );
+            cp.write<uint64_t>( thr_decoder->getThreadLocalStoragePointer() );
+            cp.write<uint32_t>( (uint32_t) thr_decoder->getFPRegisterMode() );
+
+            std::vector<uint64_t> regs( isa_table->getNumIntRegs() );
+            for ( int j = 0; j < regs.size(); j++ ) {
+                regs[j] = reg_file->getIntReg<uint64_t>( isa_table->getIntPhysReg( j ) );
             }
-            for ( int i = 0; i < isa_table->getNumFpRegs(); i++ ) {
+            cp.writeArray( regs.data(), regs.size() );
+
+            regs.resize( isa_table->getNumFpRegs() );
+            for ( int j = 0; j < regs.size(); j++ ) {
                 if ( thr_decoder->getFPRegisterMode() == VANADIS_REGISTER_MODE_FP32 ) {
-                    uint32_t val = reg_file->getFPReg<uint32_t>( isa_table->getFPPhysReg( i ) );
-                    fprintf(fp,"FP %d %#" PRIx32 "\n",i,val);
+                    regs[j] = reg_file->getFPReg<uint32_t>( isa_table->getFPPhysReg( j ) );
                 } else {
-                    uint64_t val = reg_file->getFPReg<uint64_t>( isa_table->getFPPhysReg( i ) );
-                    fprintf(fp,"FP %d %#" PRIx64 "\n",i,val);
+                    regs[j] = reg_file->getFPReg<uint64_t>( isa_table->getFPPhysReg( j ) );
                 }
             }
-        } else {
-            fprintf(fp,"active: no\n");
+            cp.writeArray( regs.data(), regs.size() );
+
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"hw_thr %d checkpointed at %#" PRIx64 "\n",
+                    i, rob[i]->peekAt(0)->getInstructionAddress() );
         }
     }
 }
 
 void
-VANADIS_COMPONENT::checkpointLoad(FILE* fp) 
+VANADIS_COMPONENT::checkpointLoad(VanadisCheckpointReader& cp) 
 {
-    for ( auto hw_thr = 0; hw_thr < hw_threads; hw_thr++ ) {
-        uint64_t value;
+    auto numThreads = cp.read<uint32_t>();
+    if ( numThreads != hw_threads ) {
+        output->fatal(CALL_INFO, -1, "Error: checkpoint has %" PRIu32 " hardware threads, core has %" PRIu32 "\n", numThreads, hw_threads );
+    }
 
+    for ( auto hw_thr = 0; hw_thr < hw_threads; hw_thr++ ) {
         auto isa_table = retire_isa_tables[hw_thr];
         auto reg_file = register_files[hw_thr];
         auto thr_decoder = thread_decoders[hw_thr];
 
-        assert( 1 == fscanf(fp,"Hardware thread: %d\n",&hw_thr) );
-        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Hardware thread: %d\n",hw_thr);
-
-        char str[80];
-        assert( 1 ==  fscanf(fp,"active: %s\n",str) );
-        if ( 0 == strcmp( str, "yes" ) ) {
-
-            uint64_t startAddr;
-            char str1[40],str2[40];
-            assert( 3 == fscanf(fp,"%s %" PRIx64 " %s\n",str1,&value,str2) ); 
-            startAddr = value + 4;
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s %#" PRIx64 " %s\n",str1,value,str2 );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"set thread %d start address %#" PRIx64 "\n",hw_thr,startAddr);
-
-            assert( 3 == fscanf(fp,"%s %" PRIx64 " %s\n",str1,&value,str2) ); 
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s %#" PRIx64 " %s\n",str1,value,str2 );
-
-            assert( 1 == fscanf(fp,"tlsPtr: %" PRIx64 "\n",&value) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"tlsPtr: %" PRIx64 "\n", value);
-            thr_decoder->setThreadLocalStoragePointer( value );
+        if ( cp.read<uint32_t>() ) {
+            // restart after the checkpoint syscall
+            uint64_t startAddr = cp.read<uint64_t>() + 4;
+            uint64_t tlsPtr = cp.read<uint64_t>();
+            auto fpMode = cp.read<uint32_t>();
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"set thread %d start address %#" PRIx64 " tlsPtr %#" PRIx64 "\n",
+                    hw_thr, startAddr, tlsPtr);
+
+            thr_decoder->setThreadLocalStoragePointer( tlsPtr );
+
+            size_t count;
+            const uint64_t* regs = cp.readArray<uint64_t>( count );
+            if ( count != (size_t) isa_table->getNumIntRegs() ) {
+                output->fatal(CALL_INFO, -1, "Error: checkpoint thread %d has %zu integer registers, expected %d\n",
+                        hw_thr, count, isa_table->getNumIntRegs() );
+            }
+            for ( int i = 0; i < count; i++ ) {
+                reg_file->setIntReg<uint64_t>(isa_table->getIntPhysReg(i), regs[i]);
+            }
 
-            for ( auto i = 0; i < 35; i++ ) {
-                int reg;
-                assert( 3 == fscanf(fp,"%s %d %" PRIx64 "\n",str1,&reg,&value) ); 
-                output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"INT %d %" PRIx64 "\n",reg,value);
-                reg_file->setIntReg<uint64_t>(isa_table->getIntPhysReg(i), value);
+            regs = cp.readArray<uint64_t>( count );
+            if ( count != (size_t) isa_table->getNumFpRegs() || fpMode != (uint32_t) thr_decoder->getFPRegisterMode() ) {
+                output->fatal(CALL_INFO, -1, "Error: checkpoint thread %d floating point registers do not match the core\n", hw_thr );
             }
-            for ( int i = 0; i < 32; i++ ) {
-                int reg;
-                assert( 3 == fscanf(fp,"%s %d %" PRIx64 "\n",str1,&reg,&value) ); 
-                output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"FP %d %" PRIx64 "\n",reg,value);
+            for ( int i = 0; i < count; i++ ) {
                 if ( VANADIS_REGISTER_MODE_FP32 == thr_decoder->getFPRegisterMode() ) {
-                    reg_file->setFPReg<uint32_t>(isa_table->getFPPhysReg(i), value);
+                    reg_file->setFPReg<uint32_t>(isa_table->getFPPhysReg(i), regs[i]);
                 } else {
-                    reg_file->setFPReg<uint64_t>(isa_table->getFPPhysReg(i), value);
+                    reg_file->setFPReg<uint64_t>(isa_table->getFPPhysReg(i), regs[i]);
                 }
             }
 
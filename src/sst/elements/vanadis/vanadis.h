@@ -31,6 +31,7 @@
 #include "os/vgetthreadstate.h"
 #include "os/vdumpregsreq.h"
 #include "os/vcheckpointreq.h"
+#include "os/vcheckpointio.h"
 
 #include <array>
 #include <limits>
@@ -368,8 +369,8 @@ private:
     bool* m_checkpointing;
     std::string m_checkpointDir;
     enum { NO_CHECKPOINT, CHECKPOINT_LOAD, CHECKPOINT_SAVE } m_checkpoint;
-    void checkpoint(FILE*);
-    void checkpointLoad(FILE*);
+    void checkpoint(VanadisCheckpointWriter&);
+    void checkpointLoad(VanadisCheckpointReader&);
 };
 
 } // namespace Vanadis
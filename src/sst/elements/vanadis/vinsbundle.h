@@ -43,7 +43,14 @@ public:
     uint32_t getInstructionCount() const { return inst_bundle.size(); }
 
     void addInstruction(VanadisInstruction* newIns) {
-        inst_bundle.push_back(newIns->clone());
+        VanadisInstruction* ins = newIns->clone();
+
+        // the first micro-op is where the instruction restarts if it has to be replayed
+        if ( inst_bundle.empty() ) {
+            ins->markStartOfMicroOpGroup();
+        }
+
+        inst_bundle.push_back(ins);
     }
 
     VanadisInstruction* getInstructionByIndex(const uint32_t index) {
@@ -8,6 +8,7 @@ iterations = 1;
 msgSize = 0;
 shape = "2"
 num_vNics = 1
+traceParams = {}
 
 netPktSizeBytes="64B"
 netFlitSize="8B"
@@ -18,7 +19,7 @@ def main():
     global shape
     global num_vNics
     try:
-        opts, args = getopt.getopt(sys.argv[1:], "", ["msgSize=","iter=","shape=","numCores="])
+        opts, args = getopt.getopt(sys.argv[1:], "", ["msgSize=","iter=","shape=","numCores=","traceservice=","tracethreads=","tracering="])
     except getopt.GetopError as err:
         print (str(err))
         sys.exit(2)
@@ -31,6 +32,8 @@ def main():
             num_vNics = a
         elif o in ("--shape"):
             shape = a
+        elif o in ("--traceservice", "--tracethreads", "--tracering"):
+            traceParams[o[2:]] = a
         else:
             assert False, "unhandle option" 
 
@@ -166,6 +169,7 @@ class EmberEP(EndPoint):
 		for x in range(num_vNics ):
 			ep = sst.Component("nic" + str(nodeID) + "core" + str(x) + "_TraceReader", "zodiac.ZodiacSiriusTraceReader")
 			ep.addParams(driverParams)
+			ep.addParams(traceParams)
 			os = ep.setSubComponent( "OS", "firefly.hades" )
 			for key, value in driverParams.items():
 				if key.startswith("hermesParams."):
@@ -32,9 +32,17 @@ class testcase_SiriusZodiacTrace(SSTTestCase):
     def test_Sirius_Zodiac_128(self):
         self.SiriusZodiacTrace_test_template("8x8x2")
 
+    # The trace service must replay the same calls as the inline reader. A
+    # small ring makes the workers refill every rank many times over.
+    def test_Sirius_Zodiac_64_traceservice_1thread(self):
+        self.SiriusZodiacTrace_test_template("8x8", "--traceservice=1 --tracethreads=1 --tracering=4", "traceservice_1thread")
+
+    def test_Sirius_Zodiac_64_traceservice_4threads(self):
+        self.SiriusZodiacTrace_test_template("8x8", "--traceservice=1 --tracethreads=4 --tracering=4", "traceservice_4threads")
+
 #####
 
-    def SiriusZodiacTrace_test_template(self, testcase, testtimeout = 60):
+    def SiriusZodiacTrace_test_template(self, testcase, traceargs = "", suffix = "", testtimeout = 60):
 
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
@@ -47,9 +55,12 @@ class testcase_SiriusZodiacTrace(SSTTestCase):
         self.testSiriusZodiacTraceTestsDir = "{0}/sst/elements/zodiac/test/allreduce".format(self.testSiriusZodiacTraceDir)
 
         # Set the various file paths
-        testDataFileName="test_Sirius_allred_{0}".format(testcase)
+        refDataFileName="test_Sirius_allred_{0}".format(testcase)
+        testDataFileName = refDataFileName
+        if suffix != "":
+            testDataFileName = "{0}_{1}".format(refDataFileName, suffix)
 
-        reffile = "{0}/sirius/tests/refFiles/{1}.out".format(self.SiriusZodiacTraceElementDir, testDataFileName)
+        reffile = "{0}/sirius/tests/refFiles/{1}.out".format(self.SiriusZodiacTraceElementDir, refDataFileName)
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         tmpfile1 = "{0}/{1}_grepped.tmp".format(outdir, testDataFileName)
@@ -57,7 +68,7 @@ class testcase_SiriusZodiacTrace(SSTTestCase):
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
 
         sdlfile = "{0}/allreduce/allreduce.py".format(test_path)
-        otherargs = '--model-options \"--shape={0}\"'.format(testcase)
+        otherargs = '--model-options \"--shape={0} {1}\"'.format(testcase, traceargs)
 
         # Run SST
         self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles,
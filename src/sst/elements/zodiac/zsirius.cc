@@ -37,7 +37,9 @@ ZodiacSiriusTraceReader::ZodiacSiriusTraceReader(ComponentId_t id, Params& param
   retFunctor(DerivedFunctor(this, &ZodiacSiriusTraceReader::completedFunction)),
   sendFunctor(DerivedFunctor(this, &ZodiacSiriusTraceReader::completedSendFunction)),
   waitFunctor(DerivedFunctor(this, &ZodiacSiriusTraceReader::completedWaitFunction)),
-  trace(NULL)
+  trace(NULL),
+  traceService(NULL),
+  traceStream(NULL)
 {
     scaleCompute = params.find("scalecompute", 1.0);
 
@@ -77,6 +79,17 @@ ZodiacSiriusTraceReader::ZodiacSiriusTraceReader(ComponentId_t id, Params& param
 
     tConv = getTimeConverter("1ns");
 
+    traceThreads = params.find("tracethreads", 2);
+    traceRing = params.find("tracering", 256);
+    startTime = params.find("starttime", 0.0);
+
+    if(params.find("traceservice", false)) {
+        traceService = ZodiacTraceService::attach(traceThreads, params.find("verbose", 0));
+    } else if(startTime > 0) {
+        std::cerr << "Error: starttime needs the trace service (traceservice=1)" << std::endl;
+        exit(-1);
+    }
+
     emptyBufferSize = (uint32_t) params.find("buffer", 4096);
     emptyBuffer = (char*) malloc(sizeof(char) * emptyBufferSize);
 
@@ -101,11 +114,16 @@ void ZodiacSiriusTraceReader::setup() {
     snprintf(trace_name, trace_file.length() + 20, "%s.%d", trace_file.c_str(), rank);
 
     printf("Opening trace file: %s\n", trace_name);
-    trace = new SiriusReader(trace_name, rank, 64, eventQ, verbosityLevel);
-    trace->setOutput(&zOut);
+    if(traceService) {
+        // Decoding starts on the service workers, this only registers the rank
+        traceStream = traceService->openStream(trace_name, rank, traceRing, startTime);
+    } else {
+        trace = new SiriusReader(trace_name, rank, 64, eventQ, verbosityLevel);
+        trace->setOutput(&zOut);
+    }
 
-    int count = trace->generateNextEvents();
-    std::cout << "Obtained: " << count << " events" << std::endl;
+    generateNextEvents();
+    std::cout << "Obtained: " << eventQ->size() << " events" << std::endl;
 
     if(eventQ->size() > 0) {
 	selfLink->send(eventQ->front());
@@ -183,6 +201,18 @@ ZodiacSiriusTraceReader::~ZodiacSiriusTraceReader() {
 
         trace->close();
     }
+
+    if ( traceStream ) {
+        if(! traceStream->hasReachedFinalize()) {
+            zOut.output("WARNING: Component did not reach a finalize event, yet the component destructor has been called.\n");
+        }
+
+        traceService->closeStream(traceStream);
+    }
+
+    if ( traceService ) {
+        ZodiacTraceService::detach(traceService);
+    }
 }
 
 ZodiacSiriusTraceReader::ZodiacSiriusTraceReader() :
@@ -378,7 +408,19 @@ void ZodiacSiriusTraceReader::handleWaitEvent(ZodiacEvent* zEv) {
 	// what to remove from our map.
 	currentlyProcessingWaitEvent = zWEv->getRequestID();
 
-	MessageRequest* msgReq = reqMap[zWEv->getRequestID()];
+	std::map<uint64_t, MessageRequest*>::iterator req_map_itr = reqMap.find(zWEv->getRequestID());
+	if(req_map_itr == reqMap.end()) {
+		if(startTime > 0) {
+			// The irecv was posted before the replay window
+			zOut.verbose(CALL_INFO, 2, 0, "Skipping a wait on a request from before the start time.\n");
+			enqueueNextEvent();
+			return;
+		}
+
+		zOut.fatal(CALL_INFO, -1, "Error: unable to find a wait request in the ID to MessageRequest map.\n");
+	}
+
+	MessageRequest* msgReq = req_map_itr->second;
 	currentRecv = (MessageResponse*) malloc(sizeof(MessageResponse));
 	memset(currentRecv, 1, sizeof(MessageResponse));
 
@@ -424,8 +466,8 @@ void ZodiacSiriusTraceReader::handleComputeEvent(ZodiacEvent* zEv) {
 		2, 1, "Processing a compute event (duration=%f seconds)\n",
 		zCEv->getComputeDuration());
 
-	if((0 == eventQ->size()) && (!trace->hasReachedFinalize())) {
-		trace->generateNextEvents();
+	if((0 == eventQ->size()) && (!traceFinalized())) {
+		generateNextEvents();
 	}
 
 	if(eventQ->size() > 0) {
@@ -520,9 +562,9 @@ bool ZodiacSiriusTraceReader::completedWaitFunction(int retVal) {
 }
 
 void ZodiacSiriusTraceReader::enqueueNextEvent() {
-	if((0 == eventQ->size()) && (!trace->hasReachedFinalize())) {
+	if((0 == eventQ->size()) && (!traceFinalized())) {
 		zOut.verbose(CALL_INFO, 8, 0, "Generating next set of events from trace...\n");
-		trace->generateNextEvents();
+		generateNextEvents();
 		zOut.verbose(CALL_INFO, 8, 0, "Completed generating next set of events from trace.\n");
 	}
 
@@ -541,3 +583,18 @@ void ZodiacSiriusTraceReader::enqueueNextEvent() {
 	}
 }
 
+void ZodiacSiriusTraceReader::generateNextEvents() {
+	if(traceStream) {
+		// Events are created one call at a time, the ring holds the rest
+		ZodiacTraceRecord rec;
+		if(traceStream->next(rec)) {
+			materializeTraceRecord(rec, eventQ);
+		}
+	} else {
+		trace->generateNextEvents();
+	}
+}
+
+bool ZodiacSiriusTraceReader::traceFinalized() {
+	return traceStream ? traceStream->hasReachedFinalize() : trace->hasReachedFinalize();
+}
@@ -31,6 +31,7 @@
 #include <sst/elements/hermes/msgapi.h>
 
 #include "siriusreader.h"
+#include "ztraceservice.h"
 #include "zevent.h"
 
 using namespace SST::Hermes;
@@ -62,6 +63,10 @@ public:
 	{ "scalecompute", "Scale compute event times by a double precision value (allows dilation of times in traces), default is 1.0", "1.0" },
 	{ "verbose", "Sets the verbosity level for the component to output debug/information messages", "0" },
 	{ "buffer", "Sets the size of the buffer to use for message data backing, default is 4096 bytes", "4096" },
+	{ "traceservice", "Decode the trace ahead on the process wide trace service instead of on the simulation thread", "0" },
+	{ "tracethreads", "Sets the number of trace service decode threads, fixed by the first reader in the process", "2" },
+	{ "tracering", "Sets the number of decoded calls buffered per rank by the trace service", "256" },
+	{ "starttime", "Replay the trace from the first call at or after this trace time in seconds, needs traceservice", "0.0" },
     	{ "name","used internally","" },
     	{ "module","used internally","" }
   )
@@ -100,6 +105,8 @@ private:
   bool completedBarrierFunction(int val);
 
   void enqueueNextEvent();
+  void generateNextEvents();
+  bool traceFinalized();
 
   ////////////////////////////////////////////////////////
 
@@ -109,6 +116,11 @@ private:
   OS* os;
   MP::Interface* msgapi;
   SiriusReader* trace;
+  ZodiacTraceService* traceService;
+  ZodiacTraceStream* traceStream;
+  uint32_t traceThreads;
+  uint32_t traceRing;
+  double startTime;
   std::queue<ZodiacEvent*>* eventQ;
   SST::Link* selfLink;
   SST::TimeConverter* tConv;
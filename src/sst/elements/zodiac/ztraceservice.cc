@@ -0,0 +1,630 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include <assert.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ztraceservice.h"
+
+#include "sirius/siriusconst.h"
+
+#include "zinitevent.h"
+#include "zsendevent.h"
+#include "zirecvevent.h"
+#include "zrecvevent.h"
+#include "zbarrierevent.h"
+#include "zcomputeevent.h"
+#include "zwaitevent.h"
+#include "zfinalizeevent.h"
+#include "zallredevent.h"
+
+using namespace std;
+using namespace SST::Zodiac;
+
+// call type and start time before the payload, end time and result after it
+static const size_t recordOverhead = sizeof(uint32_t) + sizeof(double) + sizeof(double) + sizeof(int32_t);
+
+template<typename T>
+static inline T readField(const uint8_t* data, size_t offset) {
+	T temp;
+	memcpy(&temp, data + offset, sizeof(T));
+	return temp;
+}
+
+static PayloadDataType convertToHermesType(uint32_t dtype) {
+	PayloadDataType hType = CHAR;
+
+	if(dtype == SIRIUS_MPI_INTEGER) {
+		hType = INT;
+	} else if(dtype == SIRIUS_MPI_DOUBLE) {
+		hType = DOUBLE;
+	}
+
+	return hType;
+}
+
+static ReductionOperation convertToHermesOp(uint32_t op) {
+	switch(op) {
+	case SIRIUS_MPI_MAX:
+		return MAX;
+	case SIRIUS_MPI_MIN:
+		return MIN;
+	default:
+		return SUM;
+	}
+}
+
+ZodiacTraceStream::ZodiacTraceStream(ZodiacTraceService* svc, const std::string& file,
+	uint32_t focusOnRank, uint32_t ringSize, double start) :
+	service(svc),
+	fileName(file),
+	rank(focusOnRank),
+	startTime(start),
+	data(NULL),
+	length(0),
+	offset(0),
+	prevEventTime(0),
+	foundFinalize(false),
+	pendingInit(true),
+	numRecords(0),
+	head(0),
+	tail(0),
+	opened(false),
+	done(false),
+	busy(false),
+	listed(false),
+	initConsumed(false),
+	finalizeConsumed(false)
+{
+	size_t capacity = 2;
+	while(capacity < ringSize) {
+		capacity <<= 1;
+	}
+
+	ring.resize(capacity);
+	ringMask = capacity - 1;
+}
+
+ZodiacTraceStream::~ZodiacTraceStream() {
+	if(NULL != data) {
+		munmap((void*) data, length);
+	}
+}
+
+bool ZodiacTraceStream::claim() {
+	bool expected = false;
+	return busy.compare_exchange_strong(expected, true, std::memory_order_acquire);
+}
+
+size_t ZodiacTraceStream::level() const {
+	return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+}
+
+void ZodiacTraceStream::open() {
+	Output* output = service->getOutput();
+
+	int fd = ::open(fileName.c_str(), O_RDONLY);
+	if(fd < 0) {
+		output->fatal(CALL_INFO, -1, "Error opening the Sirius trace file: %s\n", fileName.c_str());
+	}
+
+	struct stat info;
+	if(fstat(fd, &info) != 0) {
+		output->fatal(CALL_INFO, -1, "Error reading the size of Sirius trace file: %s\n", fileName.c_str());
+	}
+
+	length = info.st_size;
+	if(length > 0) {
+		void* map = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(MAP_FAILED == map) {
+			output->fatal(CALL_INFO, -1, "Error mapping the Sirius trace file: %s\n", fileName.c_str());
+		}
+
+		madvise(map, length, MADV_SEQUENTIAL);
+		data = (const uint8_t*) map;
+	}
+
+	// The mapping stays valid without the descriptor
+	::close(fd);
+
+	buildIndex();
+
+	if(startTime > 0) {
+		seek(startTime);
+	}
+
+	opened.store(true, std::memory_order_release);
+}
+
+size_t ZodiacTraceStream::recordSize(uint32_t callType, size_t at) {
+	size_t payload = 0;
+
+	switch(callType) {
+	case SIRIUS_MPI_SEND:
+	case SIRIUS_MPI_RECV:
+		payload = sizeof(uint64_t) + 5 * sizeof(uint32_t);
+		break;
+	case SIRIUS_MPI_IRECV:
+		payload = 2 * sizeof(uint64_t) + 5 * sizeof(uint32_t);
+		break;
+	case SIRIUS_MPI_ALLREDUCE:
+		payload = 2 * sizeof(uint64_t) + 4 * sizeof(uint32_t);
+		break;
+	case SIRIUS_MPI_BARRIER:
+		payload = sizeof(uint32_t);
+		break;
+	case SIRIUS_MPI_WAIT:
+		payload = 2 * sizeof(uint64_t);
+		break;
+	case SIRIUS_MPI_INIT:
+	case SIRIUS_MPI_FINALIZE:
+		break;
+	default:
+		service->getOutput()->fatal(CALL_INFO, -1, "Unknown MPI command in trace %s (%" PRIu32 ") position: %" PRIu64 "\n",
+			fileName.c_str(), callType, (uint64_t) at);
+	}
+
+	if(at + recordOverhead + payload > length) {
+		service->getOutput()->fatal(CALL_INFO, -1, "Truncated record in trace %s at position: %" PRIu64 "\n",
+			fileName.c_str(), (uint64_t) at);
+	}
+
+	return recordOverhead + payload;
+}
+
+void ZodiacTraceStream::buildIndex() {
+	size_t at = 0;
+	double prevTime = 0;
+
+	numRecords = 0;
+	index.clear();
+
+	while(at < length) {
+		const uint32_t callType = readField<uint32_t>(data, at);
+		const size_t size = recordSize(callType, at);
+
+		if(0 == (numRecords % ZodiacTraceService::indexStride)) {
+			IndexEntry entry = { at, readField<double>(data, at + sizeof(uint32_t)), prevTime };
+			index.push_back(entry);
+		}
+
+		prevTime = readField<double>(data, at + size - sizeof(double) - sizeof(int32_t));
+		at += size;
+		numRecords++;
+
+		// Anything after the finalize is never replayed
+		if(SIRIUS_MPI_FINALIZE == callType) {
+			break;
+		}
+	}
+
+	service->getOutput()->verbose(CALL_INFO, 4, 0, "Indexed %" PRIu64 " records of %s\n",
+		numRecords, fileName.c_str());
+}
+
+void ZodiacTraceStream::seek(double time) {
+	// Last index entry starting before the time, the records after it are walked
+	size_t lo = 0;
+	size_t hi = index.size();
+	while(lo < hi) {
+		const size_t mid = (lo + hi) / 2;
+		if(index[mid].time < time) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if(lo > 0) {
+		offset = index[lo - 1].offset;
+		prevEventTime = index[lo - 1].prevEventTime;
+	} else {
+		offset = 0;
+		prevEventTime = 0;
+	}
+
+	foundFinalize = false;
+
+	while(offset < length) {
+		const uint32_t callType = readField<uint32_t>(data, offset);
+		if(readField<double>(data, offset + sizeof(uint32_t)) >= time) {
+			break;
+		}
+
+		const size_t size = recordSize(callType, offset);
+		prevEventTime = readField<double>(data, offset + size - sizeof(double) - sizeof(int32_t));
+		offset += size;
+
+		if(SIRIUS_MPI_FINALIZE == callType) {
+			foundFinalize = true;
+			break;
+		}
+	}
+
+	service->getOutput()->verbose(CALL_INFO, 4, 0, "Rank %" PRIu32 " skipped to time %f at position %" PRIu64 "\n",
+		rank, time, (uint64_t) offset);
+}
+
+bool ZodiacTraceStream::decode(ZodiacTraceRecord& rec) {
+	memset(&rec, 0, sizeof(rec));
+
+	// The replay always starts with an init, as the unindexed reader does
+	if(pendingInit) {
+		pendingInit = false;
+		rec.type = Z_INIT;
+		return true;
+	}
+
+	if(foundFinalize || offset >= length) {
+		return false;
+	}
+
+	const uint32_t callType = readField<uint32_t>(data, offset);
+	const size_t size = recordSize(callType, offset);
+	size_t at = offset + sizeof(uint32_t);
+
+	rec.time = readField<double>(data, at);
+	at += sizeof(double);
+
+	if(rec.time - prevEventTime > 0) {
+		rec.compute = rec.time - prevEventTime;
+	}
+
+	switch(callType) {
+	case SIRIUS_MPI_SEND:
+	case SIRIUS_MPI_RECV:
+	case SIRIUS_MPI_IRECV:
+		rec.type = (SIRIUS_MPI_SEND == callType) ? Z_SEND :
+			(SIRIUS_MPI_RECV == callType) ? Z_RECV : Z_IRECV;
+		at += sizeof(uint64_t);	// buffer
+		rec.count = readField<uint32_t>(data, at);
+		rec.dataType = (uint8_t) convertToHermesType(readField<uint32_t>(data, at + 4));
+		rec.peer = (uint32_t) readField<int32_t>(data, at + 8);
+		rec.tag = (uint32_t) readField<int32_t>(data, at + 12);
+		rec.comm = readField<uint32_t>(data, at + 16);
+		if(SIRIUS_MPI_IRECV == callType) {
+			rec.request = readField<uint64_t>(data, at + 20);
+		}
+		break;
+
+	case SIRIUS_MPI_ALLREDUCE:
+		rec.type = Z_ALLREDUCE;
+		at += 2 * sizeof(uint64_t);	// send and receive buffers
+		rec.count = readField<uint32_t>(data, at);
+		rec.dataType = (uint8_t) convertToHermesType(readField<uint32_t>(data, at + 4));
+		rec.op = (uint8_t) readField<uint32_t>(data, at + 8);
+		rec.comm = readField<uint32_t>(data, at + 12);
+		break;
+
+	case SIRIUS_MPI_BARRIER:
+		rec.type = Z_BARRIER;
+		rec.comm = readField<uint32_t>(data, at);
+		break;
+
+	case SIRIUS_MPI_WAIT:
+		rec.type = Z_WAIT;
+		rec.request = readField<uint64_t>(data, at);
+		break;
+
+	case SIRIUS_MPI_INIT:
+		rec.type = Z_INIT;
+		break;
+
+	case SIRIUS_MPI_FINALIZE:
+		rec.type = Z_FINALIZE;
+		foundFinalize = true;
+		break;
+	}
+
+	prevEventTime = readField<double>(data, offset + size - sizeof(double) - sizeof(int32_t));
+	offset += size;
+
+	return true;
+}
+
+void ZodiacTraceStream::fill() {
+	size_t t = tail.load(std::memory_order_relaxed);
+	const size_t h = head.load(std::memory_order_acquire);
+
+	while((t - h) < ring.size()) {
+		if(! decode(ring[t & ringMask])) {
+			done.store(true, std::memory_order_release);
+			break;
+		}
+
+		tail.store(++t, std::memory_order_release);
+	}
+}
+
+bool ZodiacTraceStream::next(ZodiacTraceRecord& rec) {
+	const size_t h = head.load(std::memory_order_relaxed);
+
+	while(true) {
+		// Read done first, a producer sets it after its last record
+		const bool finished = done.load(std::memory_order_acquire);
+
+		if(h != tail.load(std::memory_order_acquire)) {
+			break;
+		}
+
+		if(finished) {
+			return false;
+		}
+
+		// The ring ran dry, decode here rather than wait for a worker
+		if(claim()) {
+			if(! opened.load(std::memory_order_relaxed)) {
+				open();
+			}
+
+			fill();
+			release();
+		} else {
+			std::this_thread::yield();
+		}
+	}
+
+	rec = ring[h & ringMask];
+	head.store(h + 1, std::memory_order_release);
+
+	if(Z_INIT == rec.type) {
+		initConsumed = true;
+	} else if(Z_FINALIZE == rec.type) {
+		finalizeConsumed = true;
+	}
+
+	if(level() == ring.size() / 2) {
+		service->notify();
+	}
+
+	return true;
+}
+
+void ZodiacTraceStream::skipTo(double time) {
+	while(! claim()) {
+		std::this_thread::yield();
+	}
+
+	if(! opened.load(std::memory_order_relaxed)) {
+		open();
+	}
+
+	// Both ends are ours while the flag is held
+	head.store(0, std::memory_order_relaxed);
+	tail.store(0, std::memory_order_relaxed);
+	done.store(false, std::memory_order_relaxed);
+	pendingInit = ! initConsumed;
+
+	seek(time);
+	release();
+
+	service->requeue(this);
+}
+
+std::mutex ZodiacTraceService::instanceLock;
+ZodiacTraceService* ZodiacTraceService::instance = NULL;
+uint32_t ZodiacTraceService::refCount = 0;
+
+ZodiacTraceService* ZodiacTraceService::attach(uint32_t threads, int verbose) {
+	std::lock_guard<std::mutex> guard(instanceLock);
+
+	if(NULL == instance) {
+		instance = new ZodiacTraceService(threads, verbose);
+	}
+
+	refCount++;
+	return instance;
+}
+
+void ZodiacTraceService::detach(ZodiacTraceService* service) {
+	std::lock_guard<std::mutex> guard(instanceLock);
+
+	assert(service == instance);
+	if(0 == --refCount) {
+		delete instance;
+		instance = NULL;
+	}
+}
+
+ZodiacTraceService::ZodiacTraceService(uint32_t threads, int verbose) :
+	nextStream(0),
+	workPending(false),
+	shutdown(false)
+{
+	output.init("ZTraceService", (uint32_t) verbose, 0, Output::STDOUT);
+	output.verbose(CALL_INFO, 1, 0, "Starting trace service with %" PRIu32 " decode threads\n", threads);
+
+	for(uint32_t i = 0; i < threads; i++) {
+		workers.push_back(std::thread(&ZodiacTraceService::worker, this));
+	}
+}
+
+ZodiacTraceService::~ZodiacTraceService() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		shutdown = true;
+	}
+
+	workCV.notify_all();
+
+	for(size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+
+	for(size_t i = 0; i < streams.size(); i++) {
+		delete streams[i];
+	}
+}
+
+ZodiacTraceStream* ZodiacTraceService::openStream(const std::string& file, uint32_t rank,
+	uint32_t ringSize, double startTime) {
+
+	ZodiacTraceStream* stream = new ZodiacTraceStream(this, file, rank, ringSize, startTime);
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		streams.push_back(stream);
+		stream->listed = true;
+	}
+
+	notify();
+	return stream;
+}
+
+void ZodiacTraceService::notify() {
+	{
+		// Under the lock so the flag cannot be set between a worker's scan and its wait
+		std::lock_guard<std::mutex> guard(lock);
+		workPending = true;
+	}
+
+	workCV.notify_one();
+}
+
+void ZodiacTraceService::requeue(ZodiacTraceStream* stream) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		if(stream->listed) {
+			return;
+		}
+
+		streams.push_back(stream);
+		stream->listed = true;
+	}
+
+	notify();
+}
+
+void ZodiacTraceService::closeStream(ZodiacTraceStream* stream) {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		for(size_t i = 0; stream->listed && i < streams.size(); i++) {
+			if(streams[i] == stream) {
+				streams[i] = streams.back();
+				streams.pop_back();
+				break;
+			}
+		}
+	}
+
+	// Workers only claim streams they can see, wait out one still decoding
+	while(! stream->claim()) {
+		std::this_thread::yield();
+	}
+
+	delete stream;
+}
+
+ZodiacTraceStream* ZodiacTraceService::claimWork() {
+	// Streams whose producer reached the end never need a worker again
+	for(size_t i = 0; i < streams.size(); ) {
+		ZodiacTraceStream* candidate = streams[i];
+		if(candidate->done.load(std::memory_order_acquire)) {
+			candidate->listed = false;
+			streams[i] = streams.back();
+			streams.pop_back();
+		} else {
+			i++;
+		}
+	}
+
+	// Round robin so one rank cannot starve the others
+	for(size_t i = 0; i < streams.size(); i++) {
+		ZodiacTraceStream* candidate = streams[(nextStream + i) % streams.size()];
+
+		if(candidate->opened.load(std::memory_order_acquire) &&
+			candidate->level() > candidate->ring.size() / 2) {
+			continue;
+		}
+
+		if(candidate->claim()) {
+			nextStream = (nextStream + i + 1) % streams.size();
+			return candidate;
+		}
+	}
+
+	return NULL;
+}
+
+void ZodiacTraceService::worker() {
+	std::unique_lock<std::mutex> guard(lock);
+
+	while(! shutdown) {
+		// Cleared before the scan, so a notify() during it forces another
+		workPending = false;
+
+		ZodiacTraceStream* stream = claimWork();
+
+		if(NULL == stream) {
+			workCV.wait(guard, [this]() { return shutdown || workPending; });
+			continue;
+		}
+
+		guard.unlock();
+
+		if(! stream->opened.load(std::memory_order_relaxed)) {
+			stream->open();
+		}
+
+		stream->fill();
+		stream->release();
+
+		guard.lock();
+	}
+}
+
+void SST::Zodiac::materializeTraceRecord(const ZodiacTraceRecord& rec, std::queue<ZodiacEvent*>* eventQ) {
+	if(rec.compute > 0) {
+		eventQ->push(new ZodiacComputeEvent(rec.compute));
+	}
+
+	const PayloadDataType dtype = (PayloadDataType) rec.dataType;
+
+	switch(rec.type) {
+	case Z_SEND:
+		eventQ->push(new ZodiacSendEvent(rec.peer, rec.count, dtype, rec.tag, rec.comm));
+		break;
+	case Z_RECV:
+		eventQ->push(new ZodiacRecvEvent(rec.peer, rec.count, dtype, rec.tag, rec.comm));
+		break;
+	case Z_IRECV:
+		eventQ->push(new ZodiacIRecvEvent(rec.peer, rec.count, dtype, rec.tag, rec.comm, rec.request));
+		break;
+	case Z_WAIT:
+		eventQ->push(new ZodiacWaitEvent(rec.request));
+		break;
+	case Z_ALLREDUCE:
+		eventQ->push(new ZodiacAllreduceEvent(rec.count, dtype, convertToHermesOp(rec.op), rec.comm));
+		break;
+	case Z_BARRIER:
+		eventQ->push(new ZodiacBarrierEvent(rec.comm));
+		break;
+	case Z_INIT:
+		eventQ->push(new ZodiacInitEvent());
+		break;
+	case Z_FINALIZE:
+		eventQ->push(new ZodiacFinalizeEvent());
+		break;
+	default:
+		break;
+	}
+}
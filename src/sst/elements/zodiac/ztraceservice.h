@@ -0,0 +1,193 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_ZODIAC_TRACE_SERVICE
+#define _H_ZODIAC_TRACE_SERVICE
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sst/core/output.h"
+#include "sst/elements/hermes/msgapi.h"
+
+#include "zevent.h"
+
+using namespace SST::Hermes;
+using namespace SST::Hermes::MP;
+
+namespace SST {
+namespace Zodiac {
+
+/*
+ * One decoded trace call. Plain data so it can live in a preallocated ring;
+ * the ZodiacEvent for it is only created when the replay reaches it.
+ */
+struct ZodiacTraceRecord {
+	double   compute;	// seconds of compute before the call, 0 for none
+	double   time;		// trace time the call started at
+	uint64_t request;
+	uint32_t peer;
+	uint32_t count;
+	uint32_t tag;
+	uint32_t comm;
+	uint8_t  type;		// ZodiacEventType
+	uint8_t  dataType;	// PayloadDataType
+	uint8_t  op;		// SIRIUS_MPI_SUM/MAX/MIN
+};
+
+class ZodiacTraceService;
+
+/*
+ * The trace of one rank. The file is memory mapped and its descriptor
+ * closed, so tens of thousands of ranks do not hold open files. Every
+ * indexStride records the offset and start time are kept, which lets
+ * skipTo() jump close to a timestamp and decode only the last stretch.
+ *
+ * Decoded records go into a fixed size ring with one producer and one
+ * consumer. Whoever holds the busy flag (a service worker, or the
+ * simulation thread when the ring ran dry) is the producer.
+ */
+class ZodiacTraceStream {
+    public:
+	/* Copy the next record out, returns false once the trace is done */
+	bool next(ZodiacTraceRecord& rec);
+
+	/* Drop everything before the first call starting at or after time */
+	void skipTo(double time);
+
+	bool hasReachedFinalize() const { return finalizeConsumed; }
+	uint64_t getRecordCount() const { return numRecords; }
+	uint32_t getRank() const { return rank; }
+
+    private:
+	friend class ZodiacTraceService;
+
+	struct IndexEntry {
+		size_t offset;
+		double time;
+		double prevEventTime;
+	};
+
+	ZodiacTraceStream(ZodiacTraceService* service, const std::string& file,
+		uint32_t rank, uint32_t ringSize, double startTime);
+	~ZodiacTraceStream();
+
+	bool claim();
+	void release() { busy.store(false, std::memory_order_release); }
+	size_t level() const;
+
+	/* Producer side, only called while holding the busy flag */
+	void open();
+	void buildIndex();
+	void seek(double time);
+	void fill();
+	bool decode(ZodiacTraceRecord& rec);
+	size_t recordSize(uint32_t callType, size_t offset);
+
+	ZodiacTraceService* service;
+	std::string fileName;
+	uint32_t rank;
+	double startTime;
+
+	const uint8_t* data;
+	size_t length;
+	size_t offset;
+	double prevEventTime;
+	bool foundFinalize;
+	bool pendingInit;
+	uint64_t numRecords;
+	std::vector<IndexEntry> index;
+
+	std::vector<ZodiacTraceRecord> ring;
+	size_t ringMask;
+	std::atomic<size_t> head;	// written by the consumer
+	std::atomic<size_t> tail;	// written by the producer
+	std::atomic<bool> opened;
+	std::atomic<bool> done;		// producer reached the end of the trace
+	std::atomic<bool> busy;
+	bool listed;			// in the service's stream list, guarded by its lock
+
+	// Consumer side
+	bool initConsumed;
+	bool finalizeConsumed;
+};
+
+/*
+ * Decodes Sirius traces ahead of the simulation. One service is shared by
+ * every trace reader in the process. Its workers open and index new
+ * streams, then keep topping up any ring that has drained below half.
+ * Workers sleep until a stream is opened or a consumer drains its ring to
+ * the half way mark, and a stream leaves the list once its trace is done.
+ * The number of workers is fixed by the first reader to attach.
+ */
+class ZodiacTraceService {
+    public:
+	static ZodiacTraceService* attach(uint32_t threads, int verbose);
+	static void detach(ZodiacTraceService* service);
+
+	ZodiacTraceStream* openStream(const std::string& file, uint32_t rank,
+		uint32_t ringSize, double startTime);
+	void closeStream(ZodiacTraceStream* stream);
+
+	/* Wake a worker, a ring has room */
+	void notify();
+
+	Output* getOutput() { return &output; }
+
+	static const uint32_t indexStride = 512;
+
+    private:
+	friend class ZodiacTraceStream;
+
+	ZodiacTraceService(uint32_t threads, int verbose);
+	~ZodiacTraceService();
+
+	/* Put a stream that was done back on the list, skipTo() rewound it */
+	void requeue(ZodiacTraceStream* stream);
+
+	/* Called with the lock held, NULL if no stream needs decoding */
+	ZodiacTraceStream* claimWork();
+	void worker();
+
+	static std::mutex instanceLock;
+	static ZodiacTraceService* instance;
+	static uint32_t refCount;
+
+	Output output;
+	std::vector<std::thread> workers;
+
+	std::mutex lock;
+	std::condition_variable workCV;
+	std::vector<ZodiacTraceStream*> streams;
+	size_t nextStream;
+	bool workPending;	// set by notify(), cleared before each scan
+	bool shutdown;
+};
+
+/* Queue the compute event (if any) and the call event for a record */
+void materializeTraceRecord(const ZodiacTraceRecord& rec, std::queue<ZodiacEvent*>* eventQ);
+
+}
+}
+
+#endif